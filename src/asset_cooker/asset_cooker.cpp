@@ -0,0 +1,224 @@
+#include <fstream>
+#include <vector>
+#include <optional>
+#include <system_error>
+#include <nlohmann/json.hpp>
+
+#include "asset_cooker.h"
+#include "data/cooked_asset.h"
+#include "data/binary_world.h"
+#include "data/data_provider_locations.h"
+#include "graphics/texture_atlas.h"
+#include "api/logging/logging.h"
+
+namespace projectfarm::asset_cooker
+{
+    bool AssetCooker::Cook() noexcept
+    {
+        this->_numberOfCookedAssets = 0u;
+        this->_numberOfFailedAssets = 0u;
+        this->_worldFilePaths.clear();
+
+        this->CookWorlds();
+        this->CookTileSetAtlas();
+
+        this->CookJsonAssets(this->_dataProvider->GetClientDirectoryPath());
+        this->CookJsonAssets(this->_dataProvider->GetServerDirectoryPath());
+        this->CookJsonAssets(this->_dataProvider->GetSharedDirectoryPath());
+
+        return this->_numberOfFailedAssets == 0u;
+    }
+
+    bool AssetCooker::Clean() noexcept
+    {
+        auto result = true;
+
+        for (const auto& directoryPath : { this->_dataProvider->GetClientDirectoryPath(),
+                                           this->_dataProvider->GetServerDirectoryPath(),
+                                           this->_dataProvider->GetSharedDirectoryPath() })
+        {
+            std::error_code ec;
+            if (!std::filesystem::exists(directoryPath, ec))
+            {
+                continue;
+            }
+
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(directoryPath, ec))
+            {
+                if (!entry.is_regular_file() || entry.path().extension() != shared::CookedAssetExtension)
+                {
+                    continue;
+                }
+
+                if (!std::filesystem::remove(entry.path(), ec))
+                {
+                    shared::api::logging::Log("Failed to remove cooked asset: " + entry.path().u8string());
+                    result = false;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    void AssetCooker::CookWorlds() noexcept
+    {
+        for (const auto& [name, filePath] : this->_dataProvider->GetWorldLocations())
+        {
+            auto plotsFilePath = this->_dataProvider->ResolveFileName(shared::DataProviderLocations::SharedWorlds,
+                                                                      std::filesystem::path(name) / "plots.json");
+
+            this->_worldFilePaths.insert(filePath);
+
+            if (!shared::ConvertToBinaryWorld(filePath, plotsFilePath, shared::GetCookedAssetPath(filePath)))
+            {
+                shared::api::logging::Log("Failed to cook world: " + name);
+                ++this->_numberOfFailedAssets;
+                continue;
+            }
+
+            shared::api::logging::Log("Cooked world: " + name);
+            ++this->_numberOfCookedAssets;
+        }
+    }
+
+    void AssetCooker::CookTileSetAtlas() noexcept
+    {
+        std::error_code ec;
+        if (!std::filesystem::exists(this->_dataProvider->GetClientDirectoryPath(), ec))
+        {
+            return;
+        }
+
+        if (!this->_dataProvider->LoadTileSetLocations())
+        {
+            shared::api::logging::Log("Failed to load tile set locations.");
+            ++this->_numberOfFailedAssets;
+            return;
+        }
+
+        // only the image headers are read, so the images are not decoded
+        std::vector<shared::graphics::AtlasImage> images;
+
+        for (const auto& [name, filePath] : this->_dataProvider->GetTileSetLocations())
+        {
+            auto json = this->_dataProvider->LoadJsonAsset(filePath);
+            if (!json || !json->contains("imagePath"))
+            {
+                shared::api::logging::Log("Failed to load tile set: " + name);
+                ++this->_numberOfFailedAssets;
+                return;
+            }
+
+            auto imagePath = this->_dataProvider->NormalizePath((*json)["imagePath"].get<std::string>());
+
+            auto imageFile = this->_dataProvider->OpenFile(imagePath);
+            auto size = imageFile ? shared::graphics::GetPngImageSize(imageFile->GetData())
+                                  : std::optional<std::pair<uint32_t, uint32_t>> {};
+            if (!size)
+            {
+                shared::api::logging::Log("Failed to read tile set image size: " + imagePath.u8string());
+                ++this->_numberOfFailedAssets;
+                return;
+            }
+
+            images.push_back({ name, size->first, size->second });
+        }
+
+        shared::graphics::TextureAtlasLayout layout;
+        if (!layout.Build(std::move(images)))
+        {
+            shared::api::logging::Log("Failed to pack the tile set atlas.");
+            ++this->_numberOfFailedAssets;
+            return;
+        }
+
+        auto layoutFilePath = this->_dataProvider->ResolveFileName(shared::DataProviderLocations::ClientTileSets,
+                                                                   shared::graphics::TileSetAtlasLayoutFileName);
+
+        if (!shared::WriteCookedJsonAsset(layout.ToJson(), shared::GetCookedAssetPath(layoutFilePath)))
+        {
+            shared::api::logging::Log("Failed to write the tile set atlas layout.");
+            ++this->_numberOfFailedAssets;
+            return;
+        }
+
+        shared::api::logging::Log("Cooked tile set atlas with " + std::to_string(layout.GetPages().size()) +
+                                  " page(s).");
+        ++this->_numberOfCookedAssets;
+    }
+
+    void AssetCooker::CookJsonAssets(const std::filesystem::path& directoryPath) noexcept
+    {
+        std::error_code ec;
+        if (!std::filesystem::exists(directoryPath, ec))
+        {
+            return;
+        }
+
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(directoryPath, ec))
+        {
+            if (!entry.is_regular_file() || entry.path().extension() != ".json")
+            {
+                continue;
+            }
+
+            if (this->_worldFilePaths.find(entry.path()) != this->_worldFilePaths.end())
+            {
+                continue;
+            }
+
+            if (!this->CookJsonAsset(entry.path()))
+            {
+                ++this->_numberOfFailedAssets;
+                continue;
+            }
+
+            ++this->_numberOfCookedAssets;
+        }
+    }
+
+    bool AssetCooker::CookJsonAsset(const std::filesystem::path& filePath) noexcept
+    {
+        nlohmann::json json;
+
+        // nlohmann::json can throw exceptions
+        try
+        {
+            std::ifstream file(filePath);
+            if (!file.is_open())
+            {
+                shared::api::logging::Log("Failed to open json file: " + filePath.u8string());
+                return false;
+            }
+
+            file >> json;
+        }
+        catch (const std::exception& ex)
+        {
+            shared::api::logging::Log("Invalid json file: " + filePath.u8string() + " with error: " + ex.what());
+            return false;
+        }
+
+        auto cookedFilePath = shared::GetCookedAssetPath(filePath);
+
+        if (!shared::WriteCookedJsonAsset(json, cookedFilePath))
+        {
+            shared::api::logging::Log("Failed to cook json file: " + filePath.u8string());
+            return false;
+        }
+
+        // make sure the runtime will read back exactly what was cooked
+        if (auto cookedJson = shared::ReadCookedJsonAsset(cookedFilePath); !cookedJson || *cookedJson != json)
+        {
+            shared::api::logging::Log("Cooked asset does not match its json file: " + filePath.u8string());
+
+            std::error_code ec;
+            std::filesystem::remove(cookedFilePath, ec);
+
+            return false;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef PROJECTFARM_ASSET_COOKER_H
+#define PROJECTFARM_ASSET_COOKER_H
+
+#include <cstdint>
+#include <set>
+#include <filesystem>
+
+#include "data/consume_data_provider.h"
+
+namespace projectfarm::asset_cooker
+{
+    // Validates every json asset in the data folder and writes a cooked asset next to it.
+    // Worlds are cooked to binary worlds with their plot names resolved to indexes, and
+    // the tile set images are packed into an atlas layout for the client.
+    class AssetCooker final : public shared::ConsumeDataProvider
+    {
+    public:
+        AssetCooker() = default;
+        ~AssetCooker() override = default;
+
+        [[nodiscard]]
+        bool Cook() noexcept;
+
+        // removes every cooked asset, so the runtime uses the json files
+        [[nodiscard]]
+        bool Clean() noexcept;
+
+        [[nodiscard]]
+        uint32_t GetNumberOfCookedAssets() const noexcept
+        {
+            return this->_numberOfCookedAssets;
+        }
+
+        [[nodiscard]]
+        uint32_t GetNumberOfFailedAssets() const noexcept
+        {
+            return this->_numberOfFailedAssets;
+        }
+
+    private:
+        uint32_t _numberOfCookedAssets {0u};
+        uint32_t _numberOfFailedAssets {0u};
+
+        // these are cooked as worlds, not as json assets
+        std::set<std::filesystem::path> _worldFilePaths;
+
+        void CookWorlds() noexcept;
+
+        void CookTileSetAtlas() noexcept;
+
+        void CookJsonAssets(const std::filesystem::path& directoryPath) noexcept;
+
+        [[nodiscard]]
+        bool CookJsonAsset(const std::filesystem::path& filePath) noexcept;
+    };
+}
+
+#endif
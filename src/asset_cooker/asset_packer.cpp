@@ -0,0 +1,87 @@
+#include <system_error>
+
+#include "asset_packer.h"
+#include "data/asset_archive.h"
+#include "data/cooked_asset.h"
+#include "data/binary_world.h"
+#include "api/logging/logging.h"
+
+namespace projectfarm::asset_cooker
+{
+    bool AssetPacker::Pack(const std::filesystem::path& archiveFilePath) noexcept
+    {
+        this->_numberOfPackedFiles = 0u;
+
+        shared::AssetArchiveWriter writer;
+
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(
+                this->_dataProvider->GetDataFolderPath(), ec))
+        {
+            if (!entry.is_regular_file())
+            {
+                continue;
+            }
+
+            const auto& filePath = entry.path();
+
+            // a stale cooked asset would hide the changes made to its source
+            if (filePath.extension() == shared::CookedAssetExtension)
+            {
+                auto sourceFilePath = filePath;
+                sourceFilePath.replace_extension();
+
+                if (!shared::IsCookedAssetCurrent(sourceFilePath))
+                {
+                    shared::api::logging::Log("Skipping stale cooked asset: " + filePath.u8string());
+                    continue;
+                }
+            }
+
+            auto name = this->_dataProvider->GetArchiveEntryName(filePath);
+            if (name.empty())
+            {
+                continue;
+            }
+
+            if (!writer.AddFile(name, filePath, AssetPacker::ShouldCompress(filePath)))
+            {
+                shared::api::logging::Log("Failed to pack file: " + filePath.u8string());
+                return false;
+            }
+        }
+
+        if (ec)
+        {
+            shared::api::logging::Log("Failed to read data folder: " +
+                                      this->_dataProvider->GetDataFolderPath().u8string() +
+                                      " with error: " + ec.message());
+            return false;
+        }
+
+        if (!writer.Write(archiveFilePath))
+        {
+            shared::api::logging::Log("Failed to write asset archive: " + archiveFilePath.u8string());
+            return false;
+        }
+
+        this->_numberOfPackedFiles = writer.GetNumberOfEntries();
+
+        return true;
+    }
+
+    bool AssetPacker::ShouldCompress(const std::filesystem::path& filePath) noexcept
+    {
+        auto extension = filePath.extension();
+
+        // these are already compressed
+        if (extension == ".png" || extension == ".jpg" || extension == ".jpeg" ||
+            extension == ".ogg" || extension == ".mp3")
+        {
+            return false;
+        }
+
+        // binary worlds are read in place
+        return !shared::BinaryWorldFile::IsBinaryWorldFile(filePath);
+    }
+}
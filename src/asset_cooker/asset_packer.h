@@ -0,0 +1,35 @@
+#ifndef PROJECTFARM_ASSET_PACKER_H
+#define PROJECTFARM_ASSET_PACKER_H
+
+#include <cstdint>
+#include <filesystem>
+
+#include "data/consume_data_provider.h"
+
+namespace projectfarm::asset_cooker
+{
+    // Packs the whole data folder, including any current cooked assets, into an asset archive.
+    class AssetPacker final : public shared::ConsumeDataProvider
+    {
+    public:
+        AssetPacker() = default;
+        ~AssetPacker() override = default;
+
+        [[nodiscard]]
+        bool Pack(const std::filesystem::path& archiveFilePath) noexcept;
+
+        [[nodiscard]]
+        uint32_t GetNumberOfPackedFiles() const noexcept
+        {
+            return this->_numberOfPackedFiles;
+        }
+
+    private:
+        uint32_t _numberOfPackedFiles {0u};
+
+        [[nodiscard]]
+        static bool ShouldCompress(const std::filesystem::path& filePath) noexcept;
+    };
+}
+
+#endif
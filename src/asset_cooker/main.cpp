@@ -0,0 +1,113 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <memory>
+#include <filesystem>
+
+#include "platform/platform_id.h"
+#if !defined(IS_IOS)
+#include "version.h"
+#endif
+#include "asset_cooker.h"
+#include "asset_packer.h"
+#include "data/data_provider.h"
+#include "api/logging/logging.h"
+
+using namespace projectfarm;
+
+// usage: asset_cooker [-clean | -pack] [-data=<folder containing `data`>]
+int main(int argc, char* argv[])
+{
+    std::cout << "Starting asset cooker..." << std::endl;
+#if !defined(IS_IOS)
+    std::cout << "Project Name: " << PROJECT_NAME << std::endl;
+    std::cout << "Project Version: " << PROJECT_VERSION << std::endl;
+#endif
+
+    std::filesystem::path basePath = std::filesystem::path(argv[0]).remove_filename();
+    auto clean = false;
+    auto pack = false;
+
+    for (auto i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+
+        if (arg == "-clean")
+        {
+            clean = true;
+        }
+        else if (arg == "-pack")
+        {
+            pack = true;
+        }
+        else if (arg.rfind("-data=", 0) == 0)
+        {
+            basePath = arg.substr(6);
+        }
+        else
+        {
+            std::cout << "Unknown argument: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    auto dataProvider = std::make_shared<shared::DataProvider>(basePath);
+
+    // we work on the data folder itself
+    dataProvider->SetMountArchiveOnSetup(false);
+
+    if (!dataProvider->SetupServer())
+    {
+        shared::api::logging::Log("Failed to setup data provider.");
+        return 1;
+    }
+
+    asset_cooker::AssetCooker cooker;
+    cooker.SetDataProvider(dataProvider);
+
+    if (clean)
+    {
+        if (!cooker.Clean())
+        {
+            shared::api::logging::Log("Failed to remove all cooked assets.");
+            return 1;
+        }
+
+        std::cout << "Removed cooked assets." << std::endl;
+        return 0;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    if (pack)
+    {
+        asset_cooker::AssetPacker packer;
+        packer.SetDataProvider(dataProvider);
+
+        auto archiveFilePath = dataProvider->GetArchiveFilePath();
+
+        if (!packer.Pack(archiveFilePath))
+        {
+            shared::api::logging::Log("Failed to pack assets.");
+            return 1;
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+
+        std::cout << "Packed " << packer.GetNumberOfPackedFiles() << " files into " << archiveFilePath.u8string()
+                  << " in " << elapsed << "ms." << std::endl;
+
+        return 0;
+    }
+
+    auto result = cooker.Cook();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+
+    std::cout << "Cooked " << cooker.GetNumberOfCookedAssets() << " assets in " << elapsed << "ms. "
+              << cooker.GetNumberOfFailedAssets() << " failed." << std::endl;
+
+    return result ? 0 : 1;
+}
@@ -0,0 +1,463 @@
+#include <array>
+#include <algorithm>
+#include <cstdlib>
+#include <chrono>
+
+#include "bot.h"
+#include "api/logging/logging.h"
+#include "utils/util.h"
+#include "entities/character_states.h"
+#include "entities/character_state_values.h"
+#include "networking/packet_factory.h"
+#include "networking/packets/client_server_chatbox_message.h"
+#include "networking/packets/client_server_entity_update.h"
+#include "networking/packets/client_server_player_authenticate.h"
+#include "networking/packets/client_server_request_hashed_password.h"
+#include "networking/packets/client_server_test_udp.h"
+#include "networking/packets/server_client_chatbox_message.h"
+#include "networking/packets/server_client_entity_update.h"
+#include "networking/packets/server_client_load_world.h"
+#include "networking/packets/server_client_send_hashed_password.h"
+#include "networking/packets/server_client_set_player_details.h"
+
+namespace projectfarm::bot_client
+{
+    namespace
+    {
+        constexpr uint64_t UdpTestIntervalInMicroseconds {100'000u};
+
+        // the send time is after this, so the receiving bots can measure the round trip
+        constexpr auto ChatMessagePrefix = "bot-rtt:";
+
+        struct MovementLeg
+        {
+            shared::entities::CharacterStateValues Direction;
+            float X;
+            float Y;
+        };
+
+        constexpr std::array<MovementLeg, 4> MovementLegs
+        {{
+            {shared::entities::CharacterStateValues::Right, 1.0f, 0.0f},
+            {shared::entities::CharacterStateValues::Down, 0.0f, 1.0f},
+            {shared::entities::CharacterStateValues::Left, -1.0f, 0.0f},
+            {shared::entities::CharacterStateValues::Up, 0.0f, -1.0f},
+        }};
+    }
+
+    uint64_t GetTimeInMicroseconds() noexcept
+    {
+        static const auto startTime = std::chrono::steady_clock::now();
+
+        // never 0, so it can be used to mean "not set"
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - startTime).count()) + 1u;
+    }
+
+    bool Bot::Connect(const IPaddress& tcpServerAddress, uint64_t currentTimeInMicroseconds) noexcept
+    {
+        auto address = tcpServerAddress;
+
+        this->_tcpSocket = SDLNet_TCP_Open(&address);
+        if (this->_tcpSocket == nullptr)
+        {
+            this->_statistics.ConnectFailures.Increment();
+            this->Fail("Failed to connect over TCP: " + std::string(SDLNet_GetError()));
+            return false;
+        }
+
+        this->_statistics.Connected.Increment();
+
+        this->_connectTime = currentTimeInMicroseconds;
+
+        // spread the chat out so all of the bots don't chat at once
+        this->_nextChatTime = currentTimeInMicroseconds +
+            static_cast<uint64_t>(this->_options.ChatIntervalInMilliseconds) * 1000u * (this->_index % 10u + 1u) / 10u;
+
+        this->SetState(BotStates::RequestingHashedPassword);
+        this->SendRequestHashedPasswordPacket();
+
+        return true;
+    }
+
+    void Bot::Disconnect() noexcept
+    {
+        if (this->_state == BotStates::InWorld)
+        {
+            this->_statistics.InWorld.Decrement();
+        }
+
+        if (this->IsActive())
+        {
+            this->SetState(BotStates::Disconnected);
+        }
+    }
+
+    void Bot::OnServerDisconnected() noexcept
+    {
+        if (!this->IsActive())
+        {
+            return;
+        }
+
+        shared::api::logging::Log("Bot: " + this->_userName + " was disconnected by the server.");
+
+        this->_statistics.Disconnects.Increment();
+        this->Disconnect();
+    }
+
+    void Bot::CloseSocket() noexcept
+    {
+        if (this->_tcpSocket != nullptr)
+        {
+            SDLNet_TCP_Close(this->_tcpSocket);
+            this->_tcpSocket = nullptr;
+        }
+    }
+
+    void Bot::Tick(uint64_t currentTimeInMicroseconds) noexcept
+    {
+        if (!this->IsActive())
+        {
+            return;
+        }
+
+        if (this->_state != BotStates::InWorld)
+        {
+            if (currentTimeInMicroseconds - this->_connectTime >
+                static_cast<uint64_t>(this->_options.LoginTimeoutInMilliseconds) * 1000u)
+            {
+                this->_statistics.LoginTimeouts.Increment();
+                this->Fail("Timed out logging in.");
+                return;
+            }
+
+            // like the client, the test is sent until the server has our address and asks us to load a world
+            if (this->_state == BotStates::TestingUdp &&
+                currentTimeInMicroseconds - this->_lastUdpTestTime >= UdpTestIntervalInMicroseconds)
+            {
+                this->_lastUdpTestTime = currentTimeInMicroseconds;
+                this->SendTestUdpPacket();
+            }
+
+            return;
+        }
+
+        if (this->_hasPosition &&
+            currentTimeInMicroseconds - this->_lastUpdateTime >=
+                static_cast<uint64_t>(this->_options.UpdateIntervalInMilliseconds) * 1000u)
+        {
+            this->SendEntityUpdatePacket(currentTimeInMicroseconds);
+        }
+
+        if (this->_options.ChatIntervalInMilliseconds > 0u && currentTimeInMicroseconds >= this->_nextChatTime)
+        {
+            this->_nextChatTime = currentTimeInMicroseconds +
+                                  static_cast<uint64_t>(this->_options.ChatIntervalInMilliseconds) * 1000u;
+            this->SendChatboxMessagePacket(currentTimeInMicroseconds);
+        }
+    }
+
+    void Bot::ProcessPacket(const std::shared_ptr<shared::networking::Packet>& packet,
+                            uint64_t currentTimeInMicroseconds) noexcept
+    {
+        if (!this->IsActive())
+        {
+            return;
+        }
+
+        const auto packetType = packet->GetPacketType();
+
+        if (packetType == shared::networking::PacketTypes::ServerClientSendHashedPassword)
+        {
+            this->HandleServerClientSendHashedPasswordPacket(packet);
+        }
+        else if (packetType == shared::networking::PacketTypes::ServerClientSetPlayerDetails)
+        {
+            this->HandleServerClientSetPlayerDetailsPacket(packet);
+        }
+        else if (packetType == shared::networking::PacketTypes::ServerClientLoadWorld)
+        {
+            this->HandleServerClientLoadWorldPacket(packet, currentTimeInMicroseconds);
+        }
+        else if (packetType == shared::networking::PacketTypes::ServerClientEntityUpdate)
+        {
+            this->HandleServerClientEntityUpdatePacket(packet);
+        }
+        else if (packetType == shared::networking::PacketTypes::ServerClientChatboxMessage)
+        {
+            this->HandleServerClientChatboxMessagePacket(packet, currentTimeInMicroseconds);
+        }
+    }
+
+    void Bot::SendPacket(const std::shared_ptr<shared::networking::Packet>& packet) noexcept
+    {
+        this->_statistics.PacketsSent.Increment();
+        this->_statistics.BytesSent.Increment(packet->PacketSize());
+
+        if (packet->IsVital())
+        {
+            this->_packetSender.AddPacketToSend(this->_tcpSocket, packet);
+        }
+        else
+        {
+            this->_packetSender.AddPacketToSend(this->_udpServerAddress, packet);
+        }
+    }
+
+    void Bot::SetState(BotStates state) noexcept
+    {
+        this->_state = state;
+    }
+
+    void Bot::Fail(const std::string& reason) noexcept
+    {
+        shared::api::logging::Log("Bot: " + this->_userName + " failed. " + reason);
+
+        this->Disconnect();
+        this->SetState(BotStates::Failed);
+    }
+
+    void Bot::HandleServerClientSendHashedPasswordPacket(const std::shared_ptr<shared::networking::Packet>& packet) noexcept
+    {
+        if (this->_state != BotStates::RequestingHashedPassword)
+        {
+            return;
+        }
+
+        const auto serverClientSendHashedPasswordPacket =
+                std::static_pointer_cast<shared::networking::packets::ServerClientSendHashedPasswordPacket>(packet);
+
+        if (serverClientSendHashedPasswordPacket->GetUserName() != this->_userName)
+        {
+            return;
+        }
+
+        auto hashedPassword = serverClientSendHashedPasswordPacket->GetHashedPassword();
+
+        // an empty hash is a new player, who is registered when they authenticate
+        if (hashedPassword.empty())
+        {
+            auto result = this->_cryptoProvider.QuickHash(this->_options.Password);
+            if (!result)
+            {
+                this->Fail("Failed to hash password.");
+                return;
+            }
+
+            hashedPassword = *result;
+        }
+        else if (!shared::crypto::CryptoProvider::Compare(this->_options.Password, hashedPassword))
+        {
+            this->Fail("The password doesn't match.");
+            return;
+        }
+
+        this->SetState(BotStates::Authenticating);
+        this->SendPlayerAuthenticatePacket(hashedPassword);
+    }
+
+    void Bot::HandleServerClientSetPlayerDetailsPacket(const std::shared_ptr<shared::networking::Packet>& packet) noexcept
+    {
+        const auto serverClientSetPlayerDetails =
+                std::static_pointer_cast<shared::networking::packets::ServerClientSetPlayerDetails>(packet);
+
+        this->_playerId = serverClientSetPlayerDetails->GetPlayerId();
+
+        this->_statistics.Authenticated.Increment();
+
+        this->SetState(BotStates::TestingUdp);
+    }
+
+    void Bot::HandleServerClientLoadWorldPacket(const std::shared_ptr<shared::networking::Packet>& packet,
+                                                uint64_t currentTimeInMicroseconds) noexcept
+    {
+        const auto serverClientLoadWorld =
+                std::static_pointer_cast<shared::networking::packets::ServerClientLoadWorldPacket>(packet);
+
+        this->_worldName = serverClientLoadWorld->GetWorldToLoad();
+
+        // our character is recreated in the new world, so wait to be told where it is
+        this->_hasPosition = false;
+        this->_entityId = 0u;
+
+        if (this->_state != BotStates::InWorld)
+        {
+            this->_statistics.EnteredWorld.Increment();
+            this->_statistics.InWorld.Increment();
+            this->_statistics.LoginDurationInMilliseconds.Record((currentTimeInMicroseconds - this->_connectTime) / 1000u);
+
+            this->SetState(BotStates::InWorld);
+        }
+
+        // there is nothing to load, so the world is loaded straight away
+        this->SendWorldLoadedPacket();
+    }
+
+    void Bot::HandleServerClientEntityUpdatePacket(const std::shared_ptr<shared::networking::Packet>& packet) noexcept
+    {
+        const auto serverClientEntityUpdate =
+                std::static_pointer_cast<shared::networking::packets::ServerClientEntityUpdatePacket>(packet);
+
+        if (serverClientEntityUpdate->GetPlayerId() != this->_playerId ||
+            serverClientEntityUpdate->GetEntityType() != shared::entities::EntityTypes::Character ||
+            serverClientEntityUpdate->GetWorldName() != this->_worldName)
+        {
+            return;
+        }
+
+        auto data = serverClientEntityUpdate->GetEntityData();
+        uint32_t dataIndex {0};
+
+        pfu::ReadUInt32(data, dataIndex); // the player id
+
+        auto lerpPositionChange = pfu::ReadBool(data, dataIndex);
+        auto x = pfu::ReadInt32(data, dataIndex) * 0.0001f;
+        auto y = pfu::ReadInt32(data, dataIndex) * 0.0001f;
+
+        // the server echoes our own position back, so only take it when it places us somewhere
+        if (this->_hasPosition && lerpPositionChange)
+        {
+            return;
+        }
+
+        pfu::ReadUInt32(data, dataIndex); // the state key
+        pfu::ReadUInt32(data, dataIndex); // the state value
+        pfu::ReadString(data, dataIndex); // the character type
+
+        if (auto walkSpeed = pfu::ReadUInt32(data, dataIndex) * 0.0001f; walkSpeed > 0.0f)
+        {
+            this->_walkSpeed = walkSpeed;
+        }
+
+        this->_entityId = serverClientEntityUpdate->GetEntityId();
+        this->_positionX = x;
+        this->_positionY = y;
+
+        this->_hasPosition = true;
+    }
+
+    void Bot::HandleServerClientChatboxMessagePacket(const std::shared_ptr<shared::networking::Packet>& packet,
+                                                     uint64_t currentTimeInMicroseconds) noexcept
+    {
+        const auto serverClientChatboxMessage =
+                std::static_pointer_cast<shared::networking::packets::ServerClientChatboxMessagePacket>(packet);
+
+        this->_statistics.ChatMessagesReceived.Increment();
+
+        const auto& message = serverClientChatboxMessage->GetMessage();
+
+        if (message.rfind(ChatMessagePrefix, 0) != 0)
+        {
+            return;
+        }
+
+        // every bot is in this process, so they share the clock the send time is from
+        auto sendTime = static_cast<uint64_t>(std::strtoull(
+                message.c_str() + std::char_traits<char>::length(ChatMessagePrefix), nullptr, 10));
+        if (sendTime == 0u || sendTime > currentTimeInMicroseconds)
+        {
+            return;
+        }
+
+        this->_statistics.ChatRoundTripInMicroseconds.Record(currentTimeInMicroseconds - sendTime);
+    }
+
+    void Bot::SendRequestHashedPasswordPacket() noexcept
+    {
+        const auto clientServerRequestHashedPasswordPacket = std::static_pointer_cast<shared::networking::packets::ClientServerRequestHashedPasswordPacket>(
+                shared::networking::PacketFactory::CreatePacket(
+                        shared::networking::PacketTypes::ClientServerRequestHashedPassword));
+
+        clientServerRequestHashedPasswordPacket->SetUserName(this->_userName);
+
+        this->SendPacket(clientServerRequestHashedPasswordPacket);
+    }
+
+    void Bot::SendPlayerAuthenticatePacket(const std::string& hashedPassword) noexcept
+    {
+        const auto clientServerPlayerAuthenticatePacket = std::static_pointer_cast<shared::networking::packets::ClientServerPlayerAuthenticatePacket>(
+                shared::networking::PacketFactory::CreatePacket(
+                        shared::networking::PacketTypes::ClientServerPlayerAuthenticate));
+
+        clientServerPlayerAuthenticatePacket->SetUserName(this->_userName);
+        clientServerPlayerAuthenticatePacket->SetHashedPassword(hashedPassword);
+
+        this->SendPacket(clientServerPlayerAuthenticatePacket);
+    }
+
+    void Bot::SendTestUdpPacket() noexcept
+    {
+        const auto clientServerTestUdp = std::static_pointer_cast<shared::networking::packets::ClientServerTestUdp>(
+                shared::networking::PacketFactory::CreatePacket(
+                        shared::networking::PacketTypes::ClientServerTestUdp));
+
+        clientServerTestUdp->SetPlayerId(this->_playerId);
+
+        this->SendPacket(clientServerTestUdp);
+    }
+
+    void Bot::SendWorldLoadedPacket() noexcept
+    {
+        const auto clientServerWorldLoadedPacket = shared::networking::PacketFactory::CreatePacket(
+                shared::networking::PacketTypes::ClientServerWorldLoaded);
+
+        this->SendPacket(clientServerWorldLoadedPacket);
+    }
+
+    void Bot::SendEntityUpdatePacket(uint64_t currentTimeInMicroseconds) noexcept
+    {
+        auto elapsedMicroseconds = this->_lastUpdateTime > 0u ? currentTimeInMicroseconds - this->_lastUpdateTime : 0u;
+        this->_lastUpdateTime = currentTimeInMicroseconds;
+
+        if (this->_movementStartTime == 0u)
+        {
+            this->_movementStartTime = currentTimeInMicroseconds;
+        }
+
+        auto legInMicroseconds = std::max<uint64_t>(this->_options.MovementLegInMilliseconds, 1u) * 1000u;
+        const auto& leg = MovementLegs[((currentTimeInMicroseconds - this->_movementStartTime) / legInMicroseconds) %
+                                       MovementLegs.size()];
+
+        auto distance = this->_walkSpeed * static_cast<float>(elapsedMicroseconds) / 1'000'000.0f;
+        this->_positionX += leg.X * distance;
+        this->_positionY += leg.Y * distance;
+
+        // the same data the client's character sends
+        std::vector<std::byte> data;
+
+        pfu::WriteUInt32(data, this->_playerId);
+        pfu::WriteString(data, this->_worldName, static_cast<uint32_t>(this->_worldName.size()));
+        pfu::WriteInt32(data, static_cast<int32_t>(this->_positionX * 10000.0f));
+        pfu::WriteInt32(data, static_cast<int32_t>(this->_positionY * 10000.0f));
+        pfu::WriteUInt32(data, static_cast<uint32_t>(shared::entities::CharacterStates::Walk));
+        pfu::WriteUInt32(data, static_cast<uint32_t>(leg.Direction));
+
+        const auto clientServerEntityUpdatePacket = std::static_pointer_cast<shared::networking::packets::ClientServerEntityUpdatePacket>(
+                shared::networking::PacketFactory::CreatePacket(
+                        shared::networking::PacketTypes::ClientServerEntityUpdate));
+
+        clientServerEntityUpdatePacket->SetPlayerId(this->_playerId);
+        clientServerEntityUpdatePacket->SetEntityId(this->_entityId);
+        clientServerEntityUpdatePacket->SetTimeOfUpdate(currentTimeInMicroseconds);
+        clientServerEntityUpdatePacket->SetEntityType(shared::entities::EntityTypes::Character);
+        clientServerEntityUpdatePacket->SetEntityData(data);
+
+        this->SendPacket(clientServerEntityUpdatePacket);
+
+        this->_statistics.EntityUpdatesSent.Increment();
+    }
+
+    void Bot::SendChatboxMessagePacket(uint64_t currentTimeInMicroseconds) noexcept
+    {
+        const auto clientServerChatboxMessagePacket = std::static_pointer_cast<shared::networking::packets::ClientServerChatboxMessagePacket>(
+                shared::networking::PacketFactory::CreatePacket(
+                        shared::networking::PacketTypes::ClientServerChatboxMessage));
+
+        clientServerChatboxMessagePacket->SetMessage(ChatMessagePrefix + std::to_string(currentTimeInMicroseconds));
+
+        this->SendPacket(clientServerChatboxMessagePacket);
+
+        this->_statistics.ChatMessagesSent.Increment();
+    }
+}
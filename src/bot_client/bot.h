@@ -0,0 +1,175 @@
+#ifndef PROJECTFARM_BOT_H
+#define PROJECTFARM_BOT_H
+
+#include <cstdint>
+#include <string>
+#include <memory>
+#include <SDL_net.h>
+
+#include "networking/packet.h"
+#include "networking/packet_sender.h"
+#include "crypto/crypto_provider.h"
+#include "bot_statistics.h"
+
+namespace projectfarm::bot_client
+{
+    struct BotOptions
+    {
+        // each bot logs in as `<prefix><index>`, and the account is created the first time
+        std::string UserNamePrefix {"bot"};
+        std::string Password {"bot-password"};
+
+        uint32_t UpdateIntervalInMilliseconds {100u};
+
+        // 0 to not chat
+        uint32_t ChatIntervalInMilliseconds {5000u};
+
+        // the bots walk in a square, with each side taking this long
+        uint32_t MovementLegInMilliseconds {2000u};
+
+        uint32_t LoginTimeoutInMilliseconds {30000u};
+    };
+
+    // the time every bot works in, which starts when the process does
+    [[nodiscard]]
+    uint64_t GetTimeInMicroseconds() noexcept;
+
+    enum class BotStates : uint8_t
+    {
+        NotConnected,
+        RequestingHashedPassword,
+        Authenticating,
+        TestingUdp,
+        InWorld,
+        Disconnected,
+        Failed,
+    };
+
+    // A simulated player. It goes through the same steps as the client's authenticate
+    // and world scenes, but sends scripted movement and chat instead of input.
+    // A bot is only used from its group's thread.
+    class Bot final
+    {
+    public:
+        Bot(uint32_t index, const BotOptions& options, BotStatistics& statistics,
+            shared::networking::PacketSender& packetSender,
+            const shared::crypto::CryptoProvider& cryptoProvider,
+            const IPaddress& udpServerAddress)
+            : _index {index},
+              _userName {options.UserNamePrefix + std::to_string(index)},
+              _options {options},
+              _statistics {statistics},
+              _packetSender {packetSender},
+              _cryptoProvider {cryptoProvider},
+              _udpServerAddress {udpServerAddress}
+        {
+        }
+
+        ~Bot()
+        {
+            this->CloseSocket();
+        }
+
+        Bot(const Bot&) = delete;
+        Bot(Bot&&) = delete;
+
+        [[nodiscard]]
+        bool Connect(const IPaddress& tcpServerAddress, uint64_t currentTimeInMicroseconds) noexcept;
+
+        // stops the bot, but keeps the socket open as the packet sender may still be using it
+        void Disconnect() noexcept;
+
+        void OnServerDisconnected() noexcept;
+
+        // the socket must only be closed once the packet sender has stopped
+        void CloseSocket() noexcept;
+
+        void Tick(uint64_t currentTimeInMicroseconds) noexcept;
+
+        void ProcessPacket(const std::shared_ptr<shared::networking::Packet>& packet,
+                           uint64_t currentTimeInMicroseconds) noexcept;
+
+        [[nodiscard]]
+        BotStates GetState() const noexcept
+        {
+            return this->_state;
+        }
+
+        [[nodiscard]]
+        bool IsActive() const noexcept
+        {
+            return this->_state != BotStates::NotConnected &&
+                   this->_state != BotStates::Disconnected &&
+                   this->_state != BotStates::Failed;
+        }
+
+        [[nodiscard]]
+        TCPsocket GetTcpSocket() const noexcept
+        {
+            return this->_tcpSocket;
+        }
+
+        [[nodiscard]]
+        uint32_t GetPlayerId() const noexcept
+        {
+            return this->_playerId;
+        }
+
+        [[nodiscard]]
+        const std::string& GetUserName() const noexcept
+        {
+            return this->_userName;
+        }
+
+    private:
+        uint32_t _index {0u};
+        std::string _userName;
+
+        const BotOptions& _options;
+        BotStatistics& _statistics;
+        shared::networking::PacketSender& _packetSender;
+        const shared::crypto::CryptoProvider& _cryptoProvider;
+
+        TCPsocket _tcpSocket {nullptr};
+        IPaddress _udpServerAddress {};
+
+        BotStates _state {BotStates::NotConnected};
+
+        uint64_t _connectTime {0u};
+        uint64_t _lastUdpTestTime {0u};
+        uint64_t _lastUpdateTime {0u};
+        uint64_t _nextChatTime {0u};
+
+        uint32_t _playerId {0u};
+        uint32_t _entityId {0u};
+        std::string _worldName;
+
+        bool _hasPosition {false};
+        float _positionX {0.0f};
+        float _positionY {0.0f};
+        float _walkSpeed {1.0f};
+        uint64_t _movementStartTime {0u};
+
+        void SendPacket(const std::shared_ptr<shared::networking::Packet>& packet) noexcept;
+
+        void SetState(BotStates state) noexcept;
+        void Fail(const std::string& reason) noexcept;
+
+        void HandleServerClientSendHashedPasswordPacket(const std::shared_ptr<shared::networking::Packet>& packet) noexcept;
+        void HandleServerClientSetPlayerDetailsPacket(const std::shared_ptr<shared::networking::Packet>& packet) noexcept;
+        void HandleServerClientLoadWorldPacket(const std::shared_ptr<shared::networking::Packet>& packet,
+                                               uint64_t currentTimeInMicroseconds) noexcept;
+        void HandleServerClientEntityUpdatePacket(const std::shared_ptr<shared::networking::Packet>& packet) noexcept;
+        void HandleServerClientChatboxMessagePacket(const std::shared_ptr<shared::networking::Packet>& packet,
+                                                    uint64_t currentTimeInMicroseconds) noexcept;
+
+        void SendRequestHashedPasswordPacket() noexcept;
+        void SendPlayerAuthenticatePacket(const std::string& hashedPassword) noexcept;
+        void SendTestUdpPacket() noexcept;
+        void SendWorldLoadedPacket() noexcept;
+        void SendEntityUpdatePacket(uint64_t currentTimeInMicroseconds) noexcept;
+        void SendChatboxMessagePacket(uint64_t currentTimeInMicroseconds) noexcept;
+    };
+}
+
+#endif
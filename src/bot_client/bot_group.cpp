@@ -0,0 +1,232 @@
+#include <algorithm>
+
+#include "bot_group.h"
+#include "api/logging/logging.h"
+#include "networking/packets/server_client_entity_update.h"
+
+namespace projectfarm::bot_client
+{
+    namespace
+    {
+        // the largest UDP datagram
+        constexpr int UdpPacketSize {65535};
+
+        constexpr uint32_t SocketWaitInMilliseconds {1u};
+    }
+
+    void BotGroup::AddBot(uint32_t index, uint64_t connectTimeInMicroseconds) noexcept
+    {
+        auto bot = std::make_unique<Bot>(index, this->_options, this->_statistics, this->_packetSender,
+                                         this->_cryptoProvider, this->_udpServerAddress);
+
+        this->_bots.push_back({std::move(bot), connectTimeInMicroseconds, false});
+    }
+
+    bool BotGroup::Start() noexcept
+    {
+        this->_udpSocket = SDLNet_UDP_Open(0);
+        if (this->_udpSocket == nullptr)
+        {
+            shared::api::logging::Log("Failed to create UDP socket.");
+            shared::api::logging::Log(SDLNet_GetError());
+            return false;
+        }
+
+        this->_udpPacket = SDLNet_AllocPacket(UdpPacketSize);
+        if (this->_udpPacket == nullptr)
+        {
+            shared::api::logging::Log("Failed to allocate UDP packet.");
+            return false;
+        }
+
+        this->_tcpSocketSet = SDLNet_AllocSocketSet(static_cast<int>(std::max<size_t>(this->_bots.size(), 1u)));
+        if (this->_tcpSocketSet == nullptr)
+        {
+            shared::api::logging::Log("Failed to allocate TCP socket set.");
+            return false;
+        }
+
+        // the server learns each bot's UDP address from the packets sent on this socket
+        this->_packetSender.SetIsServer(false);
+        this->_packetSender.SetUDPSocket(this->_udpSocket);
+        if (!this->_packetSender.Initialize())
+        {
+            shared::api::logging::Log("Failed to initialize packet sender.");
+            return false;
+        }
+
+        this->_runThread = true;
+        this->_thread = std::thread(&BotGroup::ThreadWorker, this);
+
+        return true;
+    }
+
+    void BotGroup::Shutdown() noexcept
+    {
+        if (this->_thread.joinable())
+        {
+            this->_runThread = false;
+            this->_thread.join();
+        }
+
+        for (auto& scheduledBot : this->_bots)
+        {
+            scheduledBot.BotToRun->Disconnect();
+        }
+
+        // the packet sender may be in the middle of using the sockets
+        this->_packetSender.Shutdown();
+
+        for (auto& scheduledBot : this->_bots)
+        {
+            scheduledBot.BotToRun->CloseSocket();
+        }
+
+        this->_botsByPlayerId.clear();
+
+        if (this->_tcpSocketSet != nullptr)
+        {
+            SDLNet_FreeSocketSet(this->_tcpSocketSet);
+            this->_tcpSocketSet = nullptr;
+        }
+
+        if (this->_udpSocket != nullptr)
+        {
+            SDLNet_UDP_Close(this->_udpSocket);
+            this->_udpSocket = nullptr;
+        }
+
+        if (this->_udpPacket != nullptr)
+        {
+            SDLNet_FreePacket(this->_udpPacket);
+            this->_udpPacket = nullptr;
+        }
+    }
+
+    void BotGroup::ThreadWorker() noexcept
+    {
+        while (this->_runThread)
+        {
+            auto currentTime = GetTimeInMicroseconds();
+
+            this->ConnectScheduledBots(currentTime);
+
+            this->CheckTCPSockets(currentTime);
+            this->CheckUDPSocket(currentTime);
+
+            currentTime = GetTimeInMicroseconds();
+
+            for (auto& scheduledBot : this->_bots)
+            {
+                if (!scheduledBot.IsConnected)
+                {
+                    continue;
+                }
+
+                scheduledBot.BotToRun->Tick(currentTime);
+
+                if (!scheduledBot.BotToRun->IsActive())
+                {
+                    SDLNet_TCP_DelSocket(this->_tcpSocketSet, scheduledBot.BotToRun->GetTcpSocket());
+                    this->_botsByPlayerId.erase(scheduledBot.BotToRun->GetPlayerId());
+
+                    scheduledBot.IsConnected = false;
+                }
+            }
+        }
+    }
+
+    void BotGroup::ConnectScheduledBots(uint64_t currentTimeInMicroseconds) noexcept
+    {
+        for (auto& scheduledBot : this->_bots)
+        {
+            if (scheduledBot.BotToRun->GetState() != BotStates::NotConnected ||
+                currentTimeInMicroseconds < scheduledBot.ConnectTimeInMicroseconds)
+            {
+                continue;
+            }
+
+            if (!scheduledBot.BotToRun->Connect(this->_tcpServerAddress, currentTimeInMicroseconds))
+            {
+                continue;
+            }
+
+            SDLNet_TCP_AddSocket(this->_tcpSocketSet, scheduledBot.BotToRun->GetTcpSocket());
+            scheduledBot.IsConnected = true;
+        }
+    }
+
+    void BotGroup::CheckTCPSockets(uint64_t currentTimeInMicroseconds) noexcept
+    {
+        if (SDLNet_CheckSockets(this->_tcpSocketSet, SocketWaitInMilliseconds) <= 0)
+        {
+            return;
+        }
+
+        for (auto& scheduledBot : this->_bots)
+        {
+            auto& bot = scheduledBot.BotToRun;
+
+            if (!scheduledBot.IsConnected || !bot->IsActive())
+            {
+                continue;
+            }
+
+            auto [success, packet] = shared::networking::PacketReceiver::CheckTCPSocket(bot->GetTcpSocket());
+
+            if (!success)
+            {
+                bot->OnServerDisconnected();
+                continue;
+            }
+
+            if (!packet)
+            {
+                continue;
+            }
+
+            this->CountReceivedPacket(packet);
+
+            bot->ProcessPacket(packet, currentTimeInMicroseconds);
+
+            if (packet->GetPacketType() == shared::networking::PacketTypes::ServerClientSetPlayerDetails)
+            {
+                this->_botsByPlayerId[bot->GetPlayerId()] = bot.get();
+            }
+        }
+    }
+
+    void BotGroup::CheckUDPSocket(uint64_t currentTimeInMicroseconds) noexcept
+    {
+        while (auto packet = this->_packetReceiver.CheckUDPSocket(this->_udpSocket, this->_udpPacket))
+        {
+            this->CountReceivedPacket(packet);
+
+            if (packet->GetPacketType() != shared::networking::PacketTypes::ServerClientEntityUpdate)
+            {
+                continue;
+            }
+
+            const auto serverClientEntityUpdate =
+                    std::static_pointer_cast<shared::networking::packets::ServerClientEntityUpdatePacket>(packet);
+
+            // the bots only need the updates about themselves, the rest are counted
+            if (auto bot = this->_botsByPlayerId.find(serverClientEntityUpdate->GetPlayerId());
+                bot != this->_botsByPlayerId.end())
+            {
+                bot->second->ProcessPacket(packet, currentTimeInMicroseconds);
+            }
+        }
+    }
+
+    void BotGroup::CountReceivedPacket(const std::shared_ptr<shared::networking::Packet>& packet) noexcept
+    {
+        this->_statistics.PacketsReceived.Increment();
+        this->_statistics.BytesReceived.Increment(packet->PacketSize());
+
+        if (packet->GetPacketType() == shared::networking::PacketTypes::ServerClientEntityUpdate)
+        {
+            this->_statistics.EntityUpdatesReceived.Increment();
+        }
+    }
+}
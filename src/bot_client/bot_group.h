@@ -0,0 +1,94 @@
+#ifndef PROJECTFARM_BOT_GROUP_H
+#define PROJECTFARM_BOT_GROUP_H
+
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <SDL_net.h>
+
+#include "bot.h"
+#include "bot_statistics.h"
+#include "networking/packet_sender.h"
+#include "networking/packet_receiver.h"
+#include "crypto/crypto_provider.h"
+
+namespace projectfarm::bot_client
+{
+    // Runs a set of bots on one thread. The bots share a packet sender and a UDP socket,
+    // so the server sends all of their UDP packets to the one address, but each bot has
+    // its own TCP connection.
+    class BotGroup final
+    {
+    public:
+        BotGroup(const BotOptions& options, BotStatistics& statistics,
+                 const shared::crypto::CryptoProvider& cryptoProvider,
+                 const IPaddress& tcpServerAddress, const IPaddress& udpServerAddress)
+            : _options {options},
+              _statistics {statistics},
+              _cryptoProvider {cryptoProvider},
+              _tcpServerAddress {tcpServerAddress},
+              _udpServerAddress {udpServerAddress}
+        {
+        }
+
+        ~BotGroup()
+        {
+            this->Shutdown();
+        }
+
+        BotGroup(const BotGroup&) = delete;
+        BotGroup(BotGroup&&) = delete;
+
+        // the bot connects once `connectTimeInMicroseconds` has passed
+        void AddBot(uint32_t index, uint64_t connectTimeInMicroseconds) noexcept;
+
+        [[nodiscard]]
+        bool Start() noexcept;
+
+        // disconnects the bots
+        void Shutdown() noexcept;
+
+    private:
+        struct ScheduledBot
+        {
+            std::unique_ptr<Bot> BotToRun;
+            uint64_t ConnectTimeInMicroseconds {0u};
+            bool IsConnected {false};
+        };
+
+        const BotOptions& _options;
+        BotStatistics& _statistics;
+        const shared::crypto::CryptoProvider& _cryptoProvider;
+
+        IPaddress _tcpServerAddress {};
+        IPaddress _udpServerAddress {};
+
+        std::vector<ScheduledBot> _bots;
+
+        // UDP packets only say which player they are about, so this finds the bot they are for
+        std::unordered_map<uint32_t, Bot*> _botsByPlayerId;
+
+        shared::networking::PacketSender _packetSender;
+        shared::networking::PacketReceiver _packetReceiver;
+
+        UDPsocket _udpSocket {nullptr};
+        UDPpacket* _udpPacket {nullptr};
+        SDLNet_SocketSet _tcpSocketSet {nullptr};
+
+        std::atomic_bool _runThread {false};
+        std::thread _thread;
+
+        void ThreadWorker() noexcept;
+
+        void ConnectScheduledBots(uint64_t currentTimeInMicroseconds) noexcept;
+        void CheckTCPSockets(uint64_t currentTimeInMicroseconds) noexcept;
+        void CheckUDPSocket(uint64_t currentTimeInMicroseconds) noexcept;
+
+        void CountReceivedPacket(const std::shared_ptr<shared::networking::Packet>& packet) noexcept;
+    };
+}
+
+#endif
@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <nlohmann/json.hpp>
+
+#include "bot_statistics.h"
+
+namespace projectfarm::bot_client
+{
+    namespace
+    {
+        double PerSecond(uint64_t value, double elapsedSeconds) noexcept
+        {
+            return elapsedSeconds > 0.0 ? static_cast<double>(value) / elapsedSeconds : 0.0;
+        }
+
+        double AsMilliseconds(uint64_t microseconds) noexcept
+        {
+            return static_cast<double>(microseconds) / 1000.0;
+        }
+    }
+
+    void BotStatistics::WriteProgress(std::ostream& stream, double elapsedSeconds) const noexcept
+    {
+        stream << std::fixed << std::setprecision(1)
+               << "[" << elapsedSeconds << "s]"
+               << " in world: " << this->InWorld.GetValue()
+               << ", disconnects: " << this->Disconnects.GetValue()
+               << ", updates received/s: " << PerSecond(this->EntityUpdatesReceived.GetValue(), elapsedSeconds)
+               << ", chat rtt p50/p99: "
+               << AsMilliseconds(this->ChatRoundTripInMicroseconds.GetValueAtPercentile(50.0)) << "/"
+               << AsMilliseconds(this->ChatRoundTripInMicroseconds.GetValueAtPercentile(99.0)) << "ms"
+               << std::endl;
+    }
+
+    void BotStatistics::WriteReport(std::ostream& stream, uint32_t numberOfBots, double elapsedSeconds) const noexcept
+    {
+        auto botsInWorld = std::max<int64_t>(this->InWorld.GetValue(), 1);
+
+        stream << std::fixed << std::setprecision(2)
+               << "Bots: " << numberOfBots << '\n'
+               << "Duration: " << elapsedSeconds << "s\n"
+               << "Connected: " << this->Connected.GetValue() << '\n'
+               << "Authenticated: " << this->Authenticated.GetValue() << '\n'
+               << "Entered world: " << this->EnteredWorld.GetValue() << '\n'
+               << "Connect failures: " << this->ConnectFailures.GetValue() << '\n'
+               << "Login timeouts: " << this->LoginTimeouts.GetValue() << '\n'
+               << "Disconnects: " << this->Disconnects.GetValue() << '\n'
+               << "Login duration p50/p99/max: "
+               << this->LoginDurationInMilliseconds.GetValueAtPercentile(50.0) << "/"
+               << this->LoginDurationInMilliseconds.GetValueAtPercentile(99.0) << "/"
+               << this->LoginDurationInMilliseconds.GetMax() << "ms\n"
+               << "Chat round trip p50/p90/p99/max: "
+               << AsMilliseconds(this->ChatRoundTripInMicroseconds.GetValueAtPercentile(50.0)) << "/"
+               << AsMilliseconds(this->ChatRoundTripInMicroseconds.GetValueAtPercentile(90.0)) << "/"
+               << AsMilliseconds(this->ChatRoundTripInMicroseconds.GetValueAtPercentile(99.0)) << "/"
+               << AsMilliseconds(this->ChatRoundTripInMicroseconds.GetMax()) << "ms ("
+               << this->ChatRoundTripInMicroseconds.GetCount() << " samples)\n"
+               << "Entity updates sent/s: " << PerSecond(this->EntityUpdatesSent.GetValue(), elapsedSeconds) << '\n'
+               << "Entity updates received/s: " << PerSecond(this->EntityUpdatesReceived.GetValue(), elapsedSeconds)
+               << " (" << PerSecond(this->EntityUpdatesReceived.GetValue(), elapsedSeconds) /
+                          static_cast<double>(botsInWorld) << " per bot)\n"
+               << "Chat messages sent/received: " << this->ChatMessagesSent.GetValue() << "/"
+               << this->ChatMessagesReceived.GetValue() << '\n'
+               << "Sent: " << this->PacketsSent.GetValue() << " packets, "
+               << PerSecond(this->BytesSent.GetValue(), elapsedSeconds) / 1024.0 << " KiB/s\n"
+               << "Received: " << this->PacketsReceived.GetValue() << " packets, "
+               << PerSecond(this->BytesReceived.GetValue(), elapsedSeconds) / 1024.0 << " KiB/s\n";
+    }
+
+    bool BotStatistics::WriteJson(const std::filesystem::path& filePath, uint32_t numberOfBots,
+                                  double elapsedSeconds) const noexcept
+    {
+        nlohmann::json json;
+        json["bots"] = numberOfBots;
+        json["durationSeconds"] = elapsedSeconds;
+        json["connected"] = this->Connected.GetValue();
+        json["authenticated"] = this->Authenticated.GetValue();
+        json["enteredWorld"] = this->EnteredWorld.GetValue();
+        json["connectFailures"] = this->ConnectFailures.GetValue();
+        json["loginTimeouts"] = this->LoginTimeouts.GetValue();
+        json["disconnects"] = this->Disconnects.GetValue();
+        json["loginDurationMilliseconds"] = {
+            {"p50", this->LoginDurationInMilliseconds.GetValueAtPercentile(50.0)},
+            {"p99", this->LoginDurationInMilliseconds.GetValueAtPercentile(99.0)},
+            {"max", this->LoginDurationInMilliseconds.GetMax()},
+        };
+        json["chatRoundTripMicroseconds"] = {
+            {"p50", this->ChatRoundTripInMicroseconds.GetValueAtPercentile(50.0)},
+            {"p90", this->ChatRoundTripInMicroseconds.GetValueAtPercentile(90.0)},
+            {"p99", this->ChatRoundTripInMicroseconds.GetValueAtPercentile(99.0)},
+            {"max", this->ChatRoundTripInMicroseconds.GetMax()},
+            {"count", this->ChatRoundTripInMicroseconds.GetCount()},
+        };
+        json["entityUpdatesSent"] = this->EntityUpdatesSent.GetValue();
+        json["entityUpdatesReceived"] = this->EntityUpdatesReceived.GetValue();
+        json["chatMessagesSent"] = this->ChatMessagesSent.GetValue();
+        json["chatMessagesReceived"] = this->ChatMessagesReceived.GetValue();
+        json["packetsSent"] = this->PacketsSent.GetValue();
+        json["bytesSent"] = this->BytesSent.GetValue();
+        json["packetsReceived"] = this->PacketsReceived.GetValue();
+        json["bytesReceived"] = this->BytesReceived.GetValue();
+
+        std::ofstream fp(filePath, std::ios::trunc);
+        if (!fp.is_open())
+        {
+            return false;
+        }
+
+        fp << json.dump(4) << '\n';
+
+        return fp.good();
+    }
+}
@@ -0,0 +1,59 @@
+#ifndef PROJECTFARM_BOT_STATISTICS_H
+#define PROJECTFARM_BOT_STATISTICS_H
+
+#include <cstdint>
+#include <ostream>
+#include <filesystem>
+
+#include "metrics/metrics.h"
+
+namespace projectfarm::bot_client
+{
+    // Shared by every bot group, so everything is a lock-free metric
+    class BotStatistics final
+    {
+    public:
+        BotStatistics() = default;
+        ~BotStatistics() = default;
+
+        BotStatistics(const BotStatistics&) = delete;
+        BotStatistics(BotStatistics&&) = delete;
+
+        shared::metrics::Counter Connected;
+        shared::metrics::Counter Authenticated;
+        shared::metrics::Counter EnteredWorld;
+        shared::metrics::Gauge InWorld;
+
+        shared::metrics::Counter ConnectFailures;
+        shared::metrics::Counter LoginTimeouts;
+
+        // the server closed the connection, rather than the bot
+        shared::metrics::Counter Disconnects;
+
+        shared::metrics::Counter PacketsSent;
+        shared::metrics::Counter BytesSent;
+        shared::metrics::Counter PacketsReceived;
+        shared::metrics::Counter BytesReceived;
+
+        shared::metrics::Counter EntityUpdatesSent;
+        shared::metrics::Counter EntityUpdatesReceived;
+        shared::metrics::Counter ChatMessagesSent;
+        shared::metrics::Counter ChatMessagesReceived;
+
+        // from a bot sending a chat message to another bot receiving it through the server
+        shared::metrics::Histogram ChatRoundTripInMicroseconds;
+
+        // from connecting to the world being loaded
+        shared::metrics::Histogram LoginDurationInMilliseconds;
+
+        void WriteProgress(std::ostream& stream, double elapsedSeconds) const noexcept;
+
+        void WriteReport(std::ostream& stream, uint32_t numberOfBots, double elapsedSeconds) const noexcept;
+
+        [[nodiscard]]
+        bool WriteJson(const std::filesystem::path& filePath, uint32_t numberOfBots,
+                       double elapsedSeconds) const noexcept;
+    };
+}
+
+#endif
@@ -0,0 +1,219 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <filesystem>
+#include <SDL.h>
+#include <SDL_net.h>
+
+#include "platform/platform_id.h"
+#if !defined(IS_IOS)
+#include "version.h"
+#endif
+#include "bot.h"
+#include "bot_group.h"
+#include "bot_statistics.h"
+#include "networking/networking.h"
+#include "crypto/crypto_provider.h"
+
+using namespace projectfarm;
+
+// usage: bot_client -tcpport=<server TCP port> -udpport=<server UDP port> [-host=<server host>]
+//                   [-bots=<number of bots>] [-threads=<number of threads>] [-rampup=<milliseconds between connects>]
+//                   [-duration=<seconds after the last bot connects>] [-updateinterval=<milliseconds>]
+//                   [-chatinterval=<milliseconds, 0 to not chat>] [-username=<user name prefix>]
+//                   [-password=<password>] [-json=<results file>] [-maxdisconnects=<allowed disconnects>]
+// exits with 1 if a bot didn't get into a world, or more bots were disconnected than allowed
+int main(int argc, char* argv[])
+{
+    std::cout << "Starting bot client..." << std::endl;
+#if !defined(IS_IOS)
+    std::cout << "Project Name: " << PROJECT_NAME << std::endl;
+    std::cout << "Project Version: " << PROJECT_VERSION << std::endl;
+#endif
+
+    bot_client::BotOptions options;
+
+    std::string host {"127.0.0.1"};
+    uint16_t tcpPort {0u};
+    uint16_t udpPort {0u};
+    uint32_t numberOfBots {100u};
+    uint32_t numberOfThreads {std::max(std::thread::hardware_concurrency(), 1u)};
+    uint32_t rampUpInMilliseconds {20u};
+    uint32_t durationInSeconds {60u};
+    uint64_t maxDisconnects {0u};
+    std::filesystem::path jsonFilePath;
+
+    for (auto i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+
+        if (arg.rfind("-host=", 0) == 0)
+        {
+            host = arg.substr(6);
+        }
+        else if (arg.rfind("-tcpport=", 0) == 0)
+        {
+            tcpPort = static_cast<uint16_t>(std::stoul(arg.substr(9)));
+        }
+        else if (arg.rfind("-udpport=", 0) == 0)
+        {
+            udpPort = static_cast<uint16_t>(std::stoul(arg.substr(9)));
+        }
+        else if (arg.rfind("-bots=", 0) == 0)
+        {
+            numberOfBots = static_cast<uint32_t>(std::stoul(arg.substr(6)));
+        }
+        else if (arg.rfind("-threads=", 0) == 0)
+        {
+            numberOfThreads = std::max(static_cast<uint32_t>(std::stoul(arg.substr(9))), 1u);
+        }
+        else if (arg.rfind("-rampup=", 0) == 0)
+        {
+            rampUpInMilliseconds = static_cast<uint32_t>(std::stoul(arg.substr(8)));
+        }
+        else if (arg.rfind("-duration=", 0) == 0)
+        {
+            durationInSeconds = static_cast<uint32_t>(std::stoul(arg.substr(10)));
+        }
+        else if (arg.rfind("-updateinterval=", 0) == 0)
+        {
+            options.UpdateIntervalInMilliseconds = static_cast<uint32_t>(std::stoul(arg.substr(16)));
+        }
+        else if (arg.rfind("-chatinterval=", 0) == 0)
+        {
+            options.ChatIntervalInMilliseconds = static_cast<uint32_t>(std::stoul(arg.substr(14)));
+        }
+        else if (arg.rfind("-username=", 0) == 0)
+        {
+            options.UserNamePrefix = arg.substr(10);
+        }
+        else if (arg.rfind("-password=", 0) == 0)
+        {
+            options.Password = arg.substr(10);
+        }
+        else if (arg.rfind("-json=", 0) == 0)
+        {
+            jsonFilePath = arg.substr(6);
+        }
+        else if (arg.rfind("-maxdisconnects=", 0) == 0)
+        {
+            maxDisconnects = std::stoull(arg.substr(16));
+        }
+        else
+        {
+            std::cout << "Unknown argument: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    if (tcpPort == 0u || udpPort == 0u)
+    {
+        std::cout << "The server's TCP and UDP ports must be given." << std::endl;
+        return 1;
+    }
+
+    shared::networking::Networking networking;
+    if (!networking.Initialize())
+    {
+        std::cout << "Failed to initialize networking." << std::endl;
+        return 1;
+    }
+
+    shared::crypto::CryptoProvider cryptoProvider;
+    if (!cryptoProvider.Initialize())
+    {
+        std::cout << "Failed to initialize crypto provider." << std::endl;
+        return 1;
+    }
+
+    IPaddress tcpServerAddress {};
+    IPaddress udpServerAddress {};
+    if (SDLNet_ResolveHost(&tcpServerAddress, host.c_str(), tcpPort) < 0 ||
+        SDLNet_ResolveHost(&udpServerAddress, host.c_str(), udpPort) < 0)
+    {
+        std::cout << "Failed to resolve server address: " << host << std::endl;
+        return 1;
+    }
+
+    bot_client::BotStatistics statistics;
+
+    numberOfThreads = std::min(numberOfThreads, std::max(numberOfBots, 1u));
+
+    std::vector<std::unique_ptr<bot_client::BotGroup>> groups;
+    for (auto i = 0u; i < numberOfThreads; ++i)
+    {
+        groups.push_back(std::make_unique<bot_client::BotGroup>(options, statistics, cryptoProvider,
+                                                                tcpServerAddress, udpServerAddress));
+    }
+
+    auto startTime = bot_client::GetTimeInMicroseconds();
+
+    for (auto i = 0u; i < numberOfBots; ++i)
+    {
+        groups[i % numberOfThreads]->AddBot(i, startTime + static_cast<uint64_t>(i) * rampUpInMilliseconds * 1000u);
+    }
+
+    std::cout << "Running " << numberOfBots << " bots against " << host << ":" << tcpPort
+              << " on " << numberOfThreads << " threads..." << std::endl;
+
+    for (auto& group : groups)
+    {
+        if (!group->Start())
+        {
+            std::cout << "Failed to start bots." << std::endl;
+            return 1;
+        }
+    }
+
+    auto runTime = std::chrono::milliseconds(static_cast<uint64_t>(numberOfBots) * rampUpInMilliseconds) +
+                   std::chrono::seconds(durationInSeconds);
+    auto endTime = std::chrono::steady_clock::now() + runTime;
+
+    while (std::chrono::steady_clock::now() < endTime)
+    {
+        std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+                std::chrono::seconds(5), endTime - std::chrono::steady_clock::now()));
+
+        auto elapsedSeconds = static_cast<double>(bot_client::GetTimeInMicroseconds() - startTime) / 1'000'000.0;
+        statistics.WriteProgress(std::cout, elapsedSeconds);
+    }
+
+    auto elapsedSeconds = static_cast<double>(bot_client::GetTimeInMicroseconds() - startTime) / 1'000'000.0;
+    auto botsInWorld = statistics.InWorld.GetValue();
+
+    // report before disconnecting, so the bots still in the world are counted
+    std::cout << std::endl;
+    statistics.WriteReport(std::cout, numberOfBots, elapsedSeconds);
+
+    if (!jsonFilePath.empty())
+    {
+        if (!statistics.WriteJson(jsonFilePath, numberOfBots, elapsedSeconds))
+        {
+            std::cout << "Failed to write results to: " << jsonFilePath.u8string() << std::endl;
+            return 1;
+        }
+
+        std::cout << "Wrote results to: " << jsonFilePath.u8string() << std::endl;
+    }
+
+    for (auto& group : groups)
+    {
+        group->Shutdown();
+    }
+
+    networking.Shutdown();
+
+    if (statistics.EnteredWorld.GetValue() < numberOfBots || statistics.Disconnects.GetValue() > maxDisconnects)
+    {
+        std::cout << "Failed: " << statistics.EnteredWorld.GetValue() << " of " << numberOfBots
+                  << " bots entered a world, " << botsInWorld << " were still in it at the end, and "
+                  << statistics.Disconnects.GetValue() << " were disconnected." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
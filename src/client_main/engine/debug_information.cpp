@@ -1,4 +1,8 @@
 #include "debug_information.h"
+#include "profiling/allocation_tracker.h"
+#include "networking/network_metrics.h"
+#include "api/logging/logging.h"
+#include "time/monotonic_clock.h"
 
 namespace projectfarm::engine
 {
@@ -10,10 +14,31 @@ namespace projectfarm::engine
 
         this->_tilesDrawn = 0;
         this->_lastFrameTilesDrawn = 0;
+
+        this->_renderLayersDrawn = 0;
+        this->_lastFrameRenderLayersDrawn = 0;
 #endif
+
+        this->_lastThreadAllocations = shared::profiling::AllocationTracker::GetThreadNumberOfAllocations();
+        this->_lastPacketsSent = shared::networking::GetNumberOfPacketsSent();
+        this->_lastPacketsReceived = shared::networking::GetNumberOfPacketsReceived();
+    }
+
+    void DebugInformation::WriteFrameTrace() const
+    {
+        if (this->_frameTraceFilePath.empty() || this->_frameStatistics.GetNumberOfFrames() == 0u)
+        {
+            return;
+        }
+
+        if (!this->_frameStatistics.WriteCsvFile(this->_frameTraceFilePath))
+        {
+            shared::api::logging::Log("Failed to write frame trace.");
+        }
     }
 
-    void DebugInformation::OnFrame()
+    void DebugInformation::OnFrame(uint64_t frameTimeInMicroseconds, uint64_t updateTimeInMicroseconds,
+                                   uint64_t renderTimeInMicroseconds)
     {
 #ifdef DEBUG
         this->_lastFrameDrawCalls = this->_drawCalls;
@@ -21,6 +46,49 @@ namespace projectfarm::engine
 
         this->_lastFrameTilesDrawn = this->_tilesDrawn;
         this->_tilesDrawn = 0;
+
+        this->_lastFrameRenderLayersDrawn = this->_renderLayersDrawn;
+        this->_renderLayersDrawn = 0;
 #endif
+
+        // the main thread's, so the network and loading threads aren't counted against the frame
+        auto threadAllocations = shared::profiling::AllocationTracker::GetThreadNumberOfAllocations();
+        auto packetsSent = shared::networking::GetNumberOfPacketsSent();
+        auto packetsReceived = shared::networking::GetNumberOfPacketsReceived();
+
+        shared::profiling::FrameSample sample;
+        sample.FrameTimeInMicroseconds = frameTimeInMicroseconds;
+        sample.UpdateTimeInMicroseconds = updateTimeInMicroseconds;
+        sample.RenderTimeInMicroseconds = renderTimeInMicroseconds;
+        sample.Allocations = threadAllocations - this->_lastThreadAllocations;
+        sample.DrawCalls = this->_lastFrameDrawCalls;
+        sample.PacketsSent = packetsSent - this->_lastPacketsSent;
+        sample.PacketsReceived = packetsReceived - this->_lastPacketsReceived;
+        sample.RoundTripTimeInMicroseconds = this->_roundTripTimeInMicroseconds;
+        sample.NumberOfEntities = this->_numberOfEntities;
+        sample.TextureMemoryInBytes = this->_textureMemoryInBytes;
+
+        this->_lastThreadAllocations = threadAllocations;
+        this->_lastPacketsSent = packetsSent;
+        this->_lastPacketsReceived = packetsReceived;
+
+        if (!this->_frameStatistics.AddFrame(sample) || this->_frameTraceFilePath.empty())
+        {
+            return;
+        }
+
+        // a slowdown is usually many slow frames, and writing the trace is slow itself
+        auto now = shared::time::MonotonicClock::GetMicroseconds();
+        if (std::chrono::microseconds(now - this->_lastFrameTraceTime) < DebugInformation::MinTimeBetweenFrameTraces)
+        {
+            return;
+        }
+
+        this->_lastFrameTraceTime = now;
+
+        shared::api::logging::Log("Slow frame of " + std::to_string(frameTimeInMicroseconds) +
+                                  "us, writing frame trace.");
+
+        this->WriteFrameTrace();
     }
-}
\ No newline at end of file
+}
@@ -2,6 +2,10 @@
 #define PROJECTFARM_DEBUG_INFORMATION_H
 
 #include <cstdint>
+#include <chrono>
+#include <filesystem>
+
+#include "profiling/frame_statistics.h"
 
 namespace projectfarm::engine
 {
@@ -28,6 +32,22 @@ namespace projectfarm::engine
             return this->_numberOfTexturesLoaded;
         }
 
+        // with the draw calls, shows how many draws each layer needs
+        [[nodiscard]] uint64_t GetLastFrameRenderLayersDrawn() const
+        {
+            return this->_lastFrameRenderLayersDrawn;
+        }
+
+        [[nodiscard]] uint64_t GetNumberOfAtlasPages() const
+        {
+            return this->_numberOfAtlasPages;
+        }
+
+        void SetNumberOfAtlasPages(uint64_t numberOfAtlasPages)
+        {
+            this->_numberOfAtlasPages = numberOfAtlasPages;
+        }
+
 #ifdef DEBUG
         void AddDrawCall(uint64_t drawCallsToAdd = 1)
 #else
@@ -50,6 +70,17 @@ namespace projectfarm::engine
 #endif
         }
 
+#ifdef DEBUG
+        void AddDrawnRenderLayer(uint64_t renderLayersDrawnToAdd = 1)
+#else
+        void AddDrawnRenderLayer(uint64_t = 0)
+#endif
+        {
+#ifdef DEBUG
+            this->_renderLayersDrawn += renderLayersDrawnToAdd;
+#endif
+        }
+
 #ifdef DEBUG
         void AddNumberOfTexturesLoaded(uint64_t numberOfTexturesLoaded = 1)
 #else
@@ -61,17 +92,70 @@ namespace projectfarm::engine
 #endif
         }
 
-        void OnFrame();
+        // the frame timings, round trip, entities and texture memory are kept in every build
+        [[nodiscard]] const shared::profiling::FrameStatistics& GetFrameStatistics() const
+        {
+            return this->_frameStatistics;
+        }
+
+        void SetRoundTripTime(uint64_t roundTripTimeInMicroseconds)
+        {
+            this->_roundTripTimeInMicroseconds = roundTripTimeInMicroseconds;
+        }
+
+        void SetNumberOfEntities(uint64_t numberOfEntities)
+        {
+            this->_numberOfEntities = numberOfEntities;
+        }
+
+        void SetTextureMemory(uint64_t textureMemoryInBytes)
+        {
+            this->_textureMemoryInBytes = textureMemoryInBytes;
+        }
+
+        // the latest frames are written here after a slow frame, and on shutdown
+        void SetFrameTraceFilePath(const std::filesystem::path& filePath)
+        {
+            this->_frameTraceFilePath = filePath;
+        }
+
+        [[nodiscard]] bool IsWritingFrameTrace() const
+        {
+            return !this->_frameTraceFilePath.empty();
+        }
+
+        void WriteFrameTrace() const;
+
+        void OnFrame(uint64_t frameTimeInMicroseconds, uint64_t updateTimeInMicroseconds,
+                     uint64_t renderTimeInMicroseconds);
 
     private:
+        static constexpr std::chrono::seconds MinTimeBetweenFrameTraces {10};
+
 #ifdef DEBUG
         uint64_t _tilesDrawn = 0;
         uint64_t _drawCalls = 0;
+        uint64_t _renderLayersDrawn = 0;
 #endif
 
         uint64_t _lastFrameTilesDrawn = 0;
         uint64_t _lastFrameDrawCalls = 0;
+        uint64_t _lastFrameRenderLayersDrawn = 0;
         uint64_t _numberOfTexturesLoaded = 0;
+        uint64_t _numberOfAtlasPages = 0;
+
+        shared::profiling::FrameStatistics _frameStatistics;
+
+        uint64_t _roundTripTimeInMicroseconds = 0;
+        uint64_t _numberOfEntities = 0;
+        uint64_t _textureMemoryInBytes = 0;
+
+        uint64_t _lastThreadAllocations = 0;
+        uint64_t _lastPacketsSent = 0;
+        uint64_t _lastPacketsReceived = 0;
+
+        std::filesystem::path _frameTraceFilePath;
+        uint64_t _lastFrameTraceTime = 0;
     };
 }
 
@@ -1,5 +1,4 @@
 #include <nlohmann/json.hpp>
-#include <fstream>
 
 #include "character_appearance_library.h"
 #include "api/logging/logging.h"
@@ -26,16 +25,15 @@ namespace projectfarm::engine::entities
     {
         try
         {
-            std::ifstream fs(path);
+            auto json = this->_dataProvider->LoadJsonAsset(path);
 
-            if (!fs)
+            if (!json)
             {
                 shared::api::logging::Log("Failed to open file: " + path.u8string());
                 return false;
             }
 
-            nlohmann::json jsonFile;
-            fs >> jsonFile;
+            auto& jsonFile = *json;
 
             auto type = jsonFile["type"].get<std::string>();
             auto part = jsonFile["part"].get<std::string>();
@@ -1,5 +1,6 @@
 #include "world_entity.h"
 #include "utils/util.h"
+#include "game/world/world_change_log.h"
 #include "api/logging/logging.h"
 
 namespace projectfarm::engine::entities
@@ -26,27 +27,20 @@ namespace projectfarm::engine::entities
             return;
         }
 
+        std::vector<shared::game::world::WorldChangeLogEntry> changes;
+
         for (const auto& island : islands)
         {
-            auto numberOfLogEntries = pfu::ReadUInt32(data, dataIndex);
-
-            auto lastUpdateTime = island->GetLastPlotUpdateTime();
+            if (!shared::game::world::DecodeWorldChanges(data, dataIndex, changes))
+            {
+                shared::api::logging::Log("Failed to decode the world changes.");
+                return;
+            }
 
-            while (numberOfLogEntries--)
+            // the island skips changes older than those already applied to each tile
+            for (const auto& change : changes)
             {
-                auto layerIndex = pfu::ReadUInt8(data, dataIndex);
-                auto tileX = pfu::ReadUInt32(data, dataIndex);
-                auto tileY = pfu::ReadUInt32(data, dataIndex);
-                auto time = pfu::ReadUInt64(data, dataIndex);
-                auto plotIndex = pfu::ReadUInt16(data, dataIndex);
-
-                // no need to read updates already processed
-                if (time <= lastUpdateTime)
-                {
-                    break;
-                }
-
-                island->ProcessPlotUpdate(layerIndex, tileX, tileY, time, plotIndex);
+                island->ProcessPlotUpdate(change.LayerIndex, change.TileX, change.TileY, change.Time, change.PlotIndex);
             }
         }
     }
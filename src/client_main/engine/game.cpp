@@ -1,14 +1,28 @@
+#include <chrono>
 #include <SDL.h>
 
 #include "game.h"
 #include "device_capabilities.h"
 #include "scenes/implemented_scenes/authenticate_scene.h"
 #include "api/logging/logging.h"
+#include "profiling/profiler.h"
+#include "profiling/allocation_tracker.h"
 
 namespace projectfarm::engine
 {
+    namespace
+    {
+        uint64_t GetMicroseconds(std::chrono::steady_clock::time_point start,
+                                 std::chrono::steady_clock::time_point end) noexcept
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+        }
+    }
+
 	void Game::Run(int argc, char* argv[])
 	{
+		shared::api::logging::InstallLogCrashHandlers();
+
 		shared::api::logging::Log("Starting game...");
 
 		if (!this->Initialize(argc, argv))
@@ -28,6 +42,9 @@ namespace projectfarm::engine
 	{
 		shared::api::logging::Log("Initializing game...");
 
+		// this is the cold start time, which cooked assets are meant to reduce
+		auto startTime = std::chrono::steady_clock::now();
+
         if (!this->_cryptoProvider->Initialize())
         {
             shared::api::logging::Log("Failed to setup crypto provider.");
@@ -40,6 +57,20 @@ namespace projectfarm::engine
             return false;
         }
 
+        if (this->_systemArguments.GetProfileTicks())
+        {
+            shared::profiling::Profiler::SetThreadName("main");
+            shared::profiling::Profiler::SetEnabled(true);
+        }
+
+        if (this->_systemArguments.GetFrameTrace())
+        {
+            shared::profiling::AllocationTracker::SetEnabled(true);
+
+            this->_debugInformation->SetFrameTraceFilePath(
+                    this->_systemArguments.GetBinaryPath() / "profiles" / "frames.csv");
+        }
+
 		if (SDL_Init(SDL_INIT_VIDEO) < 0)
 		{
 			shared::api::logging::Log("Failed to initialize SDL.");
@@ -150,7 +181,10 @@ namespace projectfarm::engine
 			return false;
 		}
 
-		shared::api::logging::Log("Initialized game.");
+		auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+		        std::chrono::steady_clock::now() - startTime).count();
+
+		shared::api::logging::Log("Initialized game in " + std::to_string(elapsed) + "ms.");
 
 		return true;
 	}
@@ -159,6 +193,15 @@ namespace projectfarm::engine
 	{
 		shared::api::logging::Log("Shutting down game...");
 
+        if (this->_systemArguments.GetProfileTicks() &&
+            !shared::profiling::Profiler::ExportChromeTrace(
+                    this->_systemArguments.GetBinaryPath() / "profiles" / "ticks.trace.json"))
+        {
+            shared::api::logging::Log("Failed to export tick profile.");
+        }
+
+        this->_debugInformation->WriteFrameTrace();
+
         this->_scriptSystem->Shutdown();
 		this->_networkClient->Shutdown();
 		this->_networking.Shutdown();
@@ -184,6 +227,10 @@ namespace projectfarm::engine
 
 		while (true)
 		{
+            PROFILE_ZONE("Game::Frame");
+
+            auto frameStartTime = std::chrono::steady_clock::now();
+
             this->UpdateEngineEvents();
             
             if (this->_isInLowerActivityState)
@@ -211,7 +258,14 @@ namespace projectfarm::engine
 
             currentScene->PrepareRender();
 
-			this->_graphics->Render();
+            auto renderStartTime = std::chrono::steady_clock::now();
+
+            {
+                PROFILE_ZONE("Graphics::Render");
+                this->_graphics->Render();
+            }
+
+            auto renderTime = GetMicroseconds(renderStartTime, std::chrono::steady_clock::now());
 
             if (!this->_sceneManager->HandleQueuedScene([this](){ this->SceneLoaded(); }))
             {
@@ -219,12 +273,22 @@ namespace projectfarm::engine
                 return;
             }
 
+            // a scene that was loaded above is counted in the frame, not the render
+            auto endFrameStartTime = std::chrono::steady_clock::now();
+
             this->_graphics->EndFrame();
 
+            renderTime += GetMicroseconds(endFrameStartTime, std::chrono::steady_clock::now());
+
             this->_keyboardInput->Tick();
 
             this->_timer->IncrementFrame();
-            this->_debugInformation->OnFrame();
+
+            auto frameEndTime = std::chrono::steady_clock::now();
+
+            this->_debugInformation->OnFrame(GetMicroseconds(frameStartTime, frameEndTime),
+                                             GetMicroseconds(frameStartTime, renderStartTime),
+                                             renderTime);
 		}
 	}
 
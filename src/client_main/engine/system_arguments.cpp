@@ -30,6 +30,14 @@ namespace projectfarm::engine
 			{
 				this->_shouldStartServer = true;
 			}
+			else if (pfu::startsWith(arg, "-profileticks"))
+			{
+				this->_profileTicks = true;
+			}
+			else if (pfu::startsWith(arg, "-frametrace"))
+			{
+				this->_frameTrace = true;
+			}
             else if (pfu::startsWith(arg, "-username"))
             {
                 auto parts = pfu::split("=", arg);
@@ -26,6 +26,21 @@ namespace projectfarm::engine
 			return this->_shouldStartServer;
 		}
 
+        // record the tick profiler zones, exported as a Chrome trace on exit
+        [[nodiscard]]
+        bool GetProfileTicks() const noexcept
+        {
+            return this->_profileTicks;
+        }
+
+        // write the latest frame statistics, with their allocations, as a CSV after
+        // a slow frame and on exit
+        [[nodiscard]]
+        bool GetFrameTrace() const noexcept
+        {
+            return this->_frameTrace;
+        }
+
         [[nodiscard]]
         const std::string& GetUserName() const noexcept
         {
@@ -42,6 +57,8 @@ namespace projectfarm::engine
 		std::filesystem::path _binaryPath;
 
 		bool _shouldStartServer = false;
+		bool _profileTicks = false;
+		bool _frameTrace = false;
 
 		std::string _userName;
 		std::string _password;
@@ -1,4 +1,6 @@
 #include <algorithm>
+#include <optional>
+#include <string>
 
 #include "island.h"
 #include "utils/util.h"
@@ -6,6 +8,13 @@
 
 namespace projectfarm::engine::world
 {
+    namespace
+    {
+        // activating a chunk is cheap, but bound it so warping in does not stall a frame
+        constexpr uint32_t MaxChunkActivationsPerFrame {4u};
+        constexpr uint64_t MaxChunkActivationMicrosecondsPerFrame {2000u};
+    }
+
     bool Island::LoadFromJson(const nlohmann::json& jsonFile,
             const std::shared_ptr<Plots>& plots)
     {
@@ -26,38 +35,11 @@ namespace projectfarm::engine::world
         this->_widthInMeters = this->_widthInTiles * this->_tileWidth;
         this->_heightInMeters = this->_heightInTiles * this->_tileHeight;
 
-        this->_tileMap = std::make_shared<graphics::TileMap>();
-        this->_tileMap->SetDataProvider(this->_dataProvider);
-        this->_tileMap->SetGraphics(this->GetGraphics());
-        this->_tileMap->SetRenderManager(this->_renderManager);
-        this->_tileMap->SetTimer(this->GetTimer());
-
         auto layersJson = jsonFile["layers"];
 
         auto layers = this->BuildLayers(layersJson);
 
-        auto tileWidthInPixels = static_cast<uint32_t>(this->GetGraphics()->MetersToPixels(this->_tileWidth));
-        auto tileHeightInPixels = static_cast<uint32_t>(this->GetGraphics()->MetersToPixels(this->_tileHeight));
-
-        if (!this->_tileMap->LoadDirect(static_cast<uint8_t>(layers.size()),
-                                        this->_widthInTiles, this->_heightInTiles,
-                                        tileWidthInPixels, tileHeightInPixels))
-        {
-            shared::api::logging::Log("Failed to load tilemap.");
-            return false;
-        }
-
-        this->_tileMap->SetRenderToWorldSpace(this->_renderToWorldSpace);
-
-        this->ReconfirmPixelSizes();
-
-        if (!this->RefreshTileSet(layers))
-        {
-            shared::api::logging::Log("Failed to refresh tile set.");
-            return false;
-        }
-
-        return true;
+        return this->LoadTileMap(std::move(layers));
     }
 
     bool Island::LoadFromBinary(std::ifstream& fs, const std::shared_ptr<Plots>& plots) noexcept
@@ -78,12 +60,59 @@ namespace projectfarm::engine::world
 
         auto layers = this->BuildLayers(fs);
 
+        return this->LoadTileMap(std::move(layers));
+    }
+
+    bool Island::LoadFromBinaryWorld(const shared::BinaryWorldFile::IslandView& island,
+                                     const std::shared_ptr<Plots>& plots) noexcept
+    {
+        this->_plots = plots;
+
+        this->_positionX = island.PositionX;
+        this->_positionY = island.PositionY;
+
+        this->_tileWidth = island.TileWidthInMeters;
+        this->_tileHeight = island.TileHeightInMeters;
+
+        this->_widthInTiles = island.WidthInTiles;
+        this->_heightInTiles = island.HeightInTiles;
+
+        this->_widthInMeters = this->_widthInTiles * this->_tileWidth;
+        this->_heightInMeters = this->_heightInTiles * this->_tileHeight;
+
+        static_assert(shared::BinaryWorldFile::EmptyPlotIndex == Plots::EmptyIndex);
+
+        Island::LayersType layers;
+        layers.reserve(island.Layers.size());
+
+        for (const auto& layerView : island.Layers)
+        {
+            Island::LayerType layer(this->_heightInTiles);
+
+            // each row is copied as a whole out of the mapped file
+            for (auto y = 0u; y < this->_heightInTiles; ++y)
+            {
+                layer[y].resize(this->_widthInTiles);
+                layerView.CopyTo(layer[y].data(), static_cast<uint64_t>(y) * this->_widthInTiles, this->_widthInTiles);
+            }
+
+            layers.push_back({layerView.IsOverhead(), std::move(layer)});
+        }
+
+        return this->LoadTileMap(std::move(layers));
+    }
+
+    bool Island::LoadTileMap(Island::LayersType layers) noexcept
+    {
         this->_tileMap = std::make_shared<graphics::TileMap>();
         this->_tileMap->SetDataProvider(this->_dataProvider);
         this->_tileMap->SetGraphics(this->GetGraphics());
         this->_tileMap->SetRenderManager(this->_renderManager);
         this->_tileMap->SetTimer(this->GetTimer());
 
+        // the island's layers only change as chunks are streamed in, so they are kept on the GPU
+        this->_tileMap->SetUseStaticChunks(true);
+
         auto tileWidthInPixels = static_cast<uint32_t>(this->GetGraphics()->MetersToPixels(this->_tileWidth));
         auto tileHeightInPixels = static_cast<uint32_t>(this->GetGraphics()->MetersToPixels(this->_tileHeight));
 
@@ -99,17 +128,109 @@ namespace projectfarm::engine::world
 
         this->ReconfirmPixelSizes();
 
-        if (!this->RefreshTileSet(layers))
+        if (!this->IndexTileSets())
+        {
+            shared::api::logging::Log("Failed to index tile sets.");
+            return false;
+        }
+
+        if (!this->BuildPlotTileIndexes())
         {
-            shared::api::logging::Log("Failed to refresh tile set.");
+            shared::api::logging::Log("Failed to build plot tile indexes.");
             return false;
         }
 
+        for (auto layerIndex = 0u; layerIndex < layers.size(); ++layerIndex)
+        {
+            auto groupIndex = static_cast<uint8_t>(layers[layerIndex].first ? 1u : 0u);
+            this->_tileMap->SetLayerGroup(static_cast<uint8_t>(layerIndex), groupIndex);
+        }
+
+        {
+            std::scoped_lock lock(this->_layersMutex);
+            this->_layers = std::move(layers);
+        }
+
+        if (!this->_chunkThreadPool)
+        {
+            this->_chunkThreadPool = std::make_shared<shared::concurrency::ThreadPool>(1u);
+        }
+
+        // the tile map is filled a chunk at a time around the camera, rather than all at
+        // once on load, which would stall the frame
+        this->_chunkStreamer = std::make_unique<shared::game::world::ChunkStreamer>(
+            this->_chunkThreadPool, this->_widthInTiles, this->_heightInTiles);
+
+        this->_chunkStreamer->SetUpdateBudget(MaxChunkActivationsPerFrame, MaxChunkActivationMicrosecondsPerFrame);
+
+        this->_chunkStreamer->SetPrepareChunk([this](auto& chunk) { return this->PrepareChunk(chunk); });
+        this->_chunkStreamer->SetActivateChunk([this](const auto& chunk) { this->ActivateChunk(chunk); });
+        this->_chunkStreamer->SetEvictChunk([this](const auto& chunk) { this->EvictChunk(chunk); });
+
+        if (!this->_streamChunks)
+        {
+            this->_chunkStreamer->LoadAll();
+        }
+
         return true;
     }
 
+    bool Island::PrepareChunk(shared::game::world::WorldChunk& chunk) const noexcept
+    {
+        std::scoped_lock lock(this->_layersMutex);
+
+        chunk.Layers.reserve(this->_layers.size());
+
+        for (const auto& layer : this->_layers)
+        {
+            std::vector<uint16_t> tileIndexes;
+            tileIndexes.reserve(static_cast<size_t>(chunk.WidthInTiles) * chunk.HeightInTiles);
+
+            for (auto y = chunk.TileY; y < chunk.TileY + chunk.HeightInTiles; ++y)
+            {
+                const auto& row = layer.second[y];
+
+                for (auto x = chunk.TileX; x < chunk.TileX + chunk.WidthInTiles; ++x)
+                {
+                    auto plotIndex = row[x];
+
+                    tileIndexes.push_back(plotIndex == Plots::EmptyIndex ?
+                                          graphics::TileMap::EmptyTileIndex :
+                                          this->_plotTileIndexes[plotIndex]);
+                }
+            }
+
+            chunk.Layers.emplace_back(std::move(tileIndexes));
+        }
+
+        return true;
+    }
+
+    void Island::ActivateChunk(const shared::game::world::WorldChunk& chunk) noexcept
+    {
+        for (auto layerIndex = 0u; layerIndex < chunk.Layers.size(); ++layerIndex)
+        {
+            this->_tileMap->SetTiles(static_cast<uint8_t>(layerIndex), chunk.TileX, chunk.TileY,
+                                     chunk.WidthInTiles, chunk.HeightInTiles, chunk.Layers[layerIndex].data());
+        }
+    }
+
+    void Island::EvictChunk(const shared::game::world::WorldChunk& chunk) noexcept
+    {
+        for (auto layerIndex = 0u; layerIndex < this->_tileMap->GetNumberOfLayers(); ++layerIndex)
+        {
+            this->_tileMap->ClearTiles(static_cast<uint8_t>(layerIndex), chunk.TileX, chunk.TileY,
+                                       chunk.WidthInTiles, chunk.HeightInTiles);
+        }
+    }
+
     void Island::Shutdown()
     {
+        if (this->_chunkStreamer)
+        {
+            this->_chunkStreamer->Shutdown();
+        }
+
         this->_tileMap->Shutdown();
     }
 
@@ -255,20 +376,19 @@ namespace projectfarm::engine::world
     {
         Island::LayerType layer;
 
+        // read a row at a time rather than a tile at a time
+        std::vector<int32_t> plotIndexes(this->_widthInTiles);
+
         for (auto y = 0u; y < this->_heightInTiles; ++y)
         {
-            std::vector<uint16_t> row;
-            row.reserve(this->_widthInTiles);
+            fs.read(reinterpret_cast<char*>(plotIndexes.data()),
+                    static_cast<std::streamsize>(plotIndexes.size() * sizeof(int32_t)));
+
+            std::vector<uint16_t> row(this->_widthInTiles);
 
             for (auto x = 0u; x < this->_widthInTiles; ++x)
             {
-                auto plotIndex = pfu::ReadInt32FromBinaryFile(fs);
-                if (plotIndex == -1)
-                {
-                    plotIndex = Plots::EmptyIndex;
-                }
-
-                row.push_back(static_cast<uint16_t>(plotIndex));
+                row[x] = plotIndexes[x] == -1 ? Plots::EmptyIndex : static_cast<uint16_t>(plotIndexes[x]);
             }
 
             layer.emplace_back(std::move(row));
@@ -315,44 +435,31 @@ namespace projectfarm::engine::world
         return true;
     }
 
-    bool Island::RefreshTileSet(const Island::LayersType& layers)
+    bool Island::BuildPlotTileIndexes() noexcept
     {
-        if (!this->IndexTileSets())
-        {
-            shared::api::logging::Log("Failed to index tile sets.");
-            return false;
-        }
+        this->_plotTileIndexes.clear();
 
-        for (auto layerIndex = 0u; layerIndex < layers.size(); ++layerIndex)
+        for (const auto& plot : this->_plots->GetPlots())
         {
-            auto& [_, layer] = layers[layerIndex];
+            std::optional<uint16_t> tileIndex;
 
-            for (auto y = 0u; y < this->_heightInTiles; ++y)
+            if (plot->GetNumberOfFrames() > 1)
             {
-                for (auto x = 0u; x < this->_widthInTiles; ++x)
-                {
-                    const auto& plotIndex = layer[y][x];
-
-                    if (plotIndex == Plots::EmptyIndex)
-                    {
-                        continue;
-                    }
-
-                    if (!this->UpdatePlotOnTileMap(plotIndex, static_cast<uint8_t>(layerIndex), x, y))
-                    {
-                        shared::api::logging::Log("Failed to update plot on tilemap.");
-                        return false;
-                    }
-                }
+                tileIndex = this->_tileMap->AddTile(this->GetAnimationInfoFromPlot(plot));
+            }
+            else
+            {
+                auto tileSetId { static_cast<uint8_t>(this->_tileMapIndexes[plot->GetName()]) };
+                tileIndex = this->_tileMap->AddTile(tileSetId, plot->GetAbsoluteIndex(0));
             }
-        }
 
-        for (auto layerIndex = 0u; layerIndex < layers.size(); ++layerIndex)
-        {
-            auto& [isOverhead, _] = layers[layerIndex];
+            if (!tileIndex)
+            {
+                shared::api::logging::Log("Failed to add tile for plot: " + plot->GetName());
+                return false;
+            }
 
-            auto groupIndex = static_cast<uint8_t>(isOverhead ? 1u : 0u);
-            this->_tileMap->SetLayerGroup(static_cast<uint8_t>(layerIndex), groupIndex);
+            this->_plotTileIndexes.push_back(*tileIndex);
         }
 
         return true;
@@ -361,33 +468,34 @@ namespace projectfarm::engine::world
     auto Island::UpdatePlotOnTileMap(uint16_t plotIndex, uint8_t layer,
                                      uint32_t x, uint32_t y) noexcept -> bool
     {
-        auto& plot = this->_plots->GetByIndex(plotIndex);
-
-        if (plot->GetNumberOfFrames() > 1)
+        if (layer >= this->_layers.size() || x >= this->_widthInTiles || y >= this->_heightInTiles)
         {
-            auto animationData = this->GetAnimationInfoFromPlot(plot);
+            shared::api::logging::Log("Invalid plot position: " + std::to_string(layer) + ", " +
+                                      std::to_string(x) + ", " + std::to_string(y));
+            return false;
+        }
 
-            if (!this->_tileMap->SetTileIndex(layer, x, y,
-                                              animationData))
-            {
-                shared::api::logging::Log("Failed to set tile index.");
-                return false;
-            }
+        if (plotIndex != Plots::EmptyIndex && plotIndex >= this->_plotTileIndexes.size())
+        {
+            shared::api::logging::Log("Invalid plot index: " + std::to_string(plotIndex));
+            return false;
         }
-        else
+
         {
-            auto tileSetId { static_cast<uint8_t>(this->_tileMapIndexes[plot->GetName()]) };
-            if (!this->_tileMap->SetTileIndex(tileSetId,
-                                              layer, x, y,
-                                              plot->GetAbsoluteIndex(0)))
-            {
-                shared::api::logging::Log("Failed to set tile index.");
-                return false;
-            }
+            std::scoped_lock lock(this->_layersMutex);
+            this->_layers[layer].second[y][x] = plotIndex;
         }
 
-        auto tileIndex = this->_tileMap->GetTile(layer, x, y);
-        this->_tileMapPlotMap[tileIndex] = plotIndex;
+        this->_chunkStreamer->Invalidate(x, y);
+
+        // chunks that are not active pick up the change when they are next prepared
+        if (this->_chunkStreamer->IsTileActive(x, y))
+        {
+            auto tileIndex = plotIndex == Plots::EmptyIndex ?
+                             graphics::TileMap::EmptyTileIndex : this->_plotTileIndexes[plotIndex];
+
+            this->_tileMap->SetTiles(layer, x, y, 1, 1, &tileIndex);
+        }
 
         return true;
     }
@@ -446,17 +554,54 @@ namespace projectfarm::engine::world
 
         this->SetRenderBounds(static_cast<uint32_t>(tileX), static_cast<uint32_t>(tileY),
                               widthInTiles, heightInTiles);
+
+        if (this->_streamChunks && this->_chunkStreamer)
+        {
+            auto tileWidthInPixels = std::max(this->GetGraphics()->MetersToPixels(this->_tileWidth), 1);
+            auto tileHeightInPixels = std::max(this->GetGraphics()->MetersToPixels(this->_tileHeight), 1);
+
+            auto centerX = (viewport.x + viewport.w / 2 - this->_renderX) / tileWidthInPixels;
+            auto centerY = (viewport.y + viewport.h / 2 - this->_renderY) / tileHeightInPixels;
+
+            // enough chunks to cover the viewport wherever the center is within its chunk
+            auto radiusInTiles = static_cast<uint32_t>(std::max(viewport.w / tileWidthInPixels,
+                                                                viewport.h / tileHeightInPixels) / 2 + 1);
+            auto radiusInChunks = radiusInTiles / shared::game::world::ChunkStreamer::DefaultChunkSizeInTiles + 1u;
+
+            this->_chunkStreamer->SetLoadRadius(radiusInChunks);
+            this->_chunkStreamer->Update(centerX, centerY);
+        }
     }
 
     void Island::ProcessPlotUpdate(uint8_t layerIndex, uint32_t tileX, uint32_t tileY,
                                    uint64_t updateTime, uint16_t plotIndex) noexcept
     {
-        this->_lastPlotUpdateTime = updateTime;
+        // chunks sent on load and the entity updates can arrive in any order, so an
+        // older change, such as a resent chunk, must not revert a newer one
+        auto key = (static_cast<uint64_t>(layerIndex) << 48u) |
+                   (static_cast<uint64_t>(tileY) << 24u) |
+                   static_cast<uint64_t>(tileX);
+
+        if (auto iter = this->_plotUpdates.find(key); iter != this->_plotUpdates.end())
+        {
+            const auto& lastUpdate = iter->second;
+
+            if (updateTime < lastUpdate.Time ||
+                (updateTime == lastUpdate.Time && plotIndex == lastUpdate.PlotIndex))
+            {
+                return;
+            }
+        }
 
         if (!this->UpdatePlotOnTileMap(plotIndex, layerIndex, tileX, tileY))
         {
             shared::api::logging::Log("Failed to update plot.");
+            return;
         }
+
+        this->_plotUpdates[key] = { updateTime, plotIndex };
+
+        this->_lastPlotUpdateTime = std::max(this->_lastPlotUpdateTime, updateTime);
     }
 
     uint16_t Island::GetPlotIndexAtWorldPosition(float x, float y) const noexcept
@@ -473,18 +618,20 @@ namespace projectfarm::engine::world
         auto tileX = static_cast<uint32_t>(dx / this->_tileWidth);
         auto tileY = static_cast<uint32_t>(dy / this->_tileHeight);
 
-        auto topLayer = this->_tileMap->GetNumberOfLayers();
+        if (tileX >= this->_widthInTiles || tileY >= this->_heightInTiles)
+        {
+            return Plots::EmptyIndex;
+        }
 
-        while (topLayer--)
+        // read from the plot data rather than the tile map, as the tile may not be in an active chunk
+        for (auto layer = this->_layers.rbegin(); layer != this->_layers.rend(); ++layer)
         {
-            auto index = this->_tileMap->GetTile(topLayer, tileX, tileY);
+            auto index = layer->second[tileY][tileX];
 
-            if (index == Plots::EmptyIndex)
+            if (index != Plots::EmptyIndex)
             {
-                continue;
+                return index;
             }
-
-            return this->_tileMapPlotMap.at(index);
         }
 
         return Plots::EmptyIndex;
@@ -7,6 +7,7 @@
 #include <fstream>
 #include <unordered_map>
 #include <utility>
+#include <mutex>
 #include <nlohmann/json.hpp>
 
 #include "time/consume_timer.h"
@@ -16,6 +17,9 @@
 #include "graphics/consume_render_manager.h"
 #include "graphics/consume_tile_set_pool.h"
 #include "graphics/renderable.h"
+#include "data/binary_world.h"
+#include "concurrency/thread_pool.h"
+#include "game/world/chunk_streamer.h"
 #include "plots.h"
 #include "graphics/graphics.h"
 
@@ -34,10 +38,23 @@ namespace projectfarm::engine::world
         Island() = default;
         ~Island() override = default;
 
+        void SetChunkThreadPool(const std::shared_ptr<shared::concurrency::ThreadPool>& threadPool) noexcept
+        {
+            this->_chunkThreadPool = threadPool;
+        }
+
+        // when not streamed, every chunk is loaded with the island
+        void SetStreamChunks(bool streamChunks) noexcept
+        {
+            this->_streamChunks = streamChunks;
+        }
+
         [[nodiscard]] bool LoadFromJson(const nlohmann::json& jsonFile,
                                         const std::shared_ptr<Plots>& plots);
         [[nodiscard]] bool LoadFromBinary(std::ifstream& fs,
                                           const std::shared_ptr<Plots>& plots) noexcept;
+        [[nodiscard]] bool LoadFromBinaryWorld(const shared::BinaryWorldFile::IslandView& island,
+                                               const std::shared_ptr<Plots>& plots) noexcept;
 
         void Shutdown();
 
@@ -104,7 +121,26 @@ namespace projectfarm::engine::world
         std::shared_ptr<Plots> _plots;
 
         std::shared_ptr<graphics::TileMap> _tileMap;
-        std::unordered_map<uint16_t, uint16_t> _tileMapPlotMap;
+
+        // the plot indexes of every tile, read by the chunk threads
+        LayersType _layers;
+        mutable std::mutex _layersMutex;
+
+        // the tile map tile index of each plot, by plot index
+        std::vector<uint16_t> _plotTileIndexes;
+
+        struct PlotUpdate
+        {
+            uint64_t Time {0u};
+            uint16_t PlotIndex {0u};
+        };
+
+        // the last update applied to each tile, keyed by layer, row then column
+        std::unordered_map<uint64_t, PlotUpdate> _plotUpdates;
+
+        std::shared_ptr<shared::concurrency::ThreadPool> _chunkThreadPool;
+        std::unique_ptr<shared::game::world::ChunkStreamer> _chunkStreamer;
+        bool _streamChunks {true};
 
         void RenderRegionToLayer(uint16_t plotIndex,
                                  uint32_t x, uint32_t y,
@@ -121,7 +157,13 @@ namespace projectfarm::engine::world
 
         bool IndexTileSets();
 
-        bool RefreshTileSet(const LayersType& layers);
+        [[nodiscard]] bool BuildPlotTileIndexes() noexcept;
+
+        [[nodiscard]] bool LoadTileMap(LayersType layers) noexcept;
+
+        [[nodiscard]] bool PrepareChunk(shared::game::world::WorldChunk& chunk) const noexcept;
+        void ActivateChunk(const shared::game::world::WorldChunk& chunk) noexcept;
+        void EvictChunk(const shared::game::world::WorldChunk& chunk) noexcept;
 
         [[nodiscard]] auto UpdatePlotOnTileMap(uint16_t plotIndex,
                                                uint8_t layer, uint32_t x, uint32_t y) noexcept -> bool;
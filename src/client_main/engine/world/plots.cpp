@@ -1,5 +1,3 @@
-#include <fstream>
-
 #include "plots.h"
 #include "api/logging/logging.h"
 
@@ -10,18 +8,15 @@ namespace projectfarm::engine::world
         auto plotsFileName = this->_dataProvider->ResolveFileName(shared::DataProviderLocations::SharedWorlds,
             worldName / "plots.json");
 
-        std::ifstream file(plotsFileName);
+        auto jsonFile = this->_dataProvider->LoadJsonAsset(plotsFileName);
 
-        if (!file.is_open())
+        if (!jsonFile)
         {
             shared::api::logging::Log("Failed to open file: " + plotsFileName.u8string());
             return false;
         }
 
-        nlohmann::json jsonFile;
-        file >> jsonFile;
-
-        auto plotsJson = jsonFile["plots"];
+        auto plotsJson = (*jsonFile)["plots"];
 
         for (const auto& plotJson : plotsJson)
         {
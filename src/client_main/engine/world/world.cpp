@@ -39,7 +39,14 @@ namespace projectfarm::engine::world
 
     bool World::Load(const std::filesystem::path& filePath)
     {
-        if (filePath.extension() == ".bin")
+        // a cooked world already has its plot names resolved to indexes
+        if (auto cookedFile = this->_dataProvider->OpenCookedAsset(filePath);
+            cookedFile && shared::BinaryWorldFile::IsBinaryWorldData(cookedFile->GetData()))
+        {
+            shared::BinaryWorldFile file;
+            return file.Open(cookedFile->GetData()) && this->LoadFromBinaryWorld(file);
+        }
+        else if (filePath.extension() == ".bin")
         {
             return this->LoadFromBinaryFile(filePath);
         }
@@ -51,6 +58,11 @@ namespace projectfarm::engine::world
 
     bool World::LoadFromBinaryFile(const std::filesystem::path& filePath)
     {
+        if (shared::BinaryWorldFile::IsBinaryWorldFile(filePath))
+        {
+            return this->LoadFromBinaryWorldFile(filePath);
+        }
+
         std::ifstream fs(filePath, std::ios::binary);
 
         if (!fs.is_open())
@@ -67,6 +79,7 @@ namespace projectfarm::engine::world
         island->SetRenderManager(this->_renderManager);
         island->SetTileSetPool(this->_tileSetPool);
         island->SetTimer(this->GetTimer());
+        island->SetChunkThreadPool(this->_chunkThreadPool);
 
         if (!island->LoadFromBinary(fs, this->_plots))
         {
@@ -79,18 +92,64 @@ namespace projectfarm::engine::world
         return true;
     }
 
+    bool World::LoadFromBinaryWorldFile(const std::filesystem::path& filePath) noexcept
+    {
+        shared::BinaryWorldFile file;
+        if (!file.Open(filePath))
+        {
+            shared::api::logging::Log("Failed to open binary world: " + filePath.u8string());
+            return false;
+        }
+
+        return this->LoadFromBinaryWorld(file);
+    }
+
+    bool World::LoadFromBinaryWorld(const shared::BinaryWorldFile& file) noexcept
+    {
+        this->_name = file.GetName();
+
+        for (const auto& islandView : file.GetIslands())
+        {
+            auto island = std::make_shared<Island>();
+            island->SetDataProvider(this->_dataProvider);
+            island->SetGraphics(this->GetGraphics());
+            island->SetRenderManager(this->_renderManager);
+            island->SetTileSetPool(this->_tileSetPool);
+            island->SetTimer(this->GetTimer());
+            island->SetChunkThreadPool(this->_chunkThreadPool);
+
+            if (!island->LoadFromBinaryWorld(islandView, this->_plots))
+            {
+                shared::api::logging::Log("Failed to load island.");
+                return false;
+            }
+
+            this->_islands.emplace_back(std::move(island));
+        }
+
+        if (const auto& background = file.GetBackgroundIsland(); background)
+        {
+            if (!this->LoadBackgroundIsland(*background))
+            {
+                shared::api::logging::Log("Failed to load background.");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     bool World::LoadFromJsonFile(const std::filesystem::path& filePath)
     {
-        std::ifstream file(filePath);
+        auto json = this->_dataProvider->LoadJsonAsset(filePath);
 
-        if (!file.is_open())
+        if (!json)
         {
             shared::api::logging::Log("Failed to open world file: " + filePath.u8string());
             return false;
         }
 
-        nlohmann::json jsonFile;
-        file >> jsonFile;
+        auto& jsonFile = *json;
 
         this->_name = jsonFile["name"].get<std::string>();
 
@@ -104,6 +163,7 @@ namespace projectfarm::engine::world
             island->SetRenderManager(this->_renderManager);
             island->SetTileSetPool(this->_tileSetPool);
             island->SetTimer(this->GetTimer());
+            island->SetChunkThreadPool(this->_chunkThreadPool);
 
             if (!island->LoadFromJson(islandJson, this->_plots))
             {
@@ -232,6 +292,36 @@ namespace projectfarm::engine::world
     }
 
     bool World::LoadBackgroundIsland(const nlohmann::json& islandJson)
+    {
+        this->CreateBackgroundIsland();
+
+        if (!this->_backgroundIsland->LoadFromJson(islandJson, this->_plots))
+        {
+            shared::api::logging::Log("Failed to load island.");
+            return false;
+        }
+
+        this->SetBackgroundRenderDetails();
+
+        return true;
+    }
+
+    bool World::LoadBackgroundIsland(const shared::BinaryWorldFile::IslandView& islandView) noexcept
+    {
+        this->CreateBackgroundIsland();
+
+        if (!this->_backgroundIsland->LoadFromBinaryWorld(islandView, this->_plots))
+        {
+            shared::api::logging::Log("Failed to load island.");
+            return false;
+        }
+
+        this->SetBackgroundRenderDetails();
+
+        return true;
+    }
+
+    void World::CreateBackgroundIsland() noexcept
     {
         this->_backgroundIsland = std::make_shared<Island>();
         this->_backgroundIsland->SetDataProvider(this->_dataProvider);
@@ -239,21 +329,19 @@ namespace projectfarm::engine::world
         this->_backgroundIsland->SetRenderManager(this->_renderManager);
         this->_backgroundIsland->SetTileSetPool(this->_tileSetPool);
         this->_backgroundIsland->SetTimer(this->GetTimer());
+        this->_backgroundIsland->SetChunkThreadPool(this->_chunkThreadPool);
 
+        // the background is drawn repeatedly across the screen, so is loaded as a whole
         this->_backgroundIsland->SetRenderToWorldSpace(false);
+        this->_backgroundIsland->SetStreamChunks(false);
+    }
 
-        if (!this->_backgroundIsland->LoadFromJson(islandJson, this->_plots))
-        {
-            shared::api::logging::Log("Failed to load island.");
-            return false;
-        }
-
+    void World::SetBackgroundRenderDetails() noexcept
+    {
         this->_backgroundIsland->SetRenderDetails(0, 0,
                                                   this->_backgroundIsland->GetWidthInPixels(),
                                                   this->_backgroundIsland->GetHeightInPixels(),
                                                   graphics::RenderOriginPoints::TopLeft);
-
-        return true;
     }
 
     void World::UpdateEntities()
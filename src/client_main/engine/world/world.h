@@ -10,6 +10,7 @@
 
 #include "time/consume_timer.h"
 #include "data/consume_data_provider.h"
+#include "concurrency/thread_pool.h"
 #include "graphics/consume_graphics.h"
 #include "graphics/consume_render_manager.h"
 #include "graphics/consume_tile_set_pool.h"
@@ -41,6 +42,7 @@ namespace projectfarm::engine::world
         World()
         {
             this->_plots = std::make_shared<Plots>();
+            this->_chunkThreadPool = std::make_shared<shared::concurrency::ThreadPool>(World::NumberOfChunkThreads);
         }
         ~World() override = default;
 
@@ -73,6 +75,11 @@ namespace projectfarm::engine::world
 
         void RemoveEntity(uint32_t entityId) noexcept;
 
+        [[nodiscard]] uint64_t GetNumberOfEntities() const noexcept
+        {
+            return this->_entities.size();
+        }
+
         void ReconfirmPixelSizes() noexcept override;
 
         [[nodiscard]] uint16_t GetPlotIndexFromWorldPosition(float x, float y) const noexcept;
@@ -81,19 +88,29 @@ namespace projectfarm::engine::world
         [[nodiscard]] std::optional<std::shared_ptr<entities::Character>> GetCharacterByEntityId(uint32_t entityId) const noexcept;
 
     private:
+        static constexpr uint32_t NumberOfChunkThreads {2u};
+
         std::string _name;
 
         std::shared_ptr<Plots> _plots;
         std::vector<std::shared_ptr<Island>> _islands;
         std::shared_ptr<Island> _backgroundIsland;
 
+        // prepares island chunks off the main thread
+        std::shared_ptr<shared::concurrency::ThreadPool> _chunkThreadPool;
+
         std::list<std::shared_ptr<entities::Entity>> _entities;
 
         [[nodiscard]] bool LoadFromJsonFile(const std::filesystem::path& filePath);
         [[nodiscard]] bool LoadFromBinaryFile(const std::filesystem::path& filePath);
+        [[nodiscard]] bool LoadFromBinaryWorldFile(const std::filesystem::path& filePath) noexcept;
+        [[nodiscard]] bool LoadFromBinaryWorld(const shared::BinaryWorldFile& file) noexcept;
 
         [[nodiscard]] bool LoadBackground(const nlohmann::json& backgroundJson);
         [[nodiscard]] bool LoadBackgroundIsland(const nlohmann::json& islandJson);
+        [[nodiscard]] bool LoadBackgroundIsland(const shared::BinaryWorldFile::IslandView& islandView) noexcept;
+        void CreateBackgroundIsland() noexcept;
+        void SetBackgroundRenderDetails() noexcept;
 
         void UpdateEntities();
 
@@ -111,10 +111,18 @@ namespace projectfarm::graphics
 
         this->_texturePool->SetDebugInformation(this->GetDebugInformation());
         this->_texturePool->SetGraphics(this->shared_from_this());
+        this->_texturePool->SetDataProvider(this->_dataProvider);
 
         this->_tileSetPool->SetDataProvider(this->_dataProvider);
         this->_tileSetPool->SetGraphics(this->shared_from_this());
 
+        if (!this->_tileSetPool->LoadAtlas())
+        {
+            shared::api::logging::Log("Failed to load the tileset atlas. Tilesets will use their own textures.");
+        }
+
+        this->GetDebugInformation()->SetNumberOfAtlasPages(this->_tileSetPool->GetAtlas()->GetNumberOfPages());
+
         this->_renderManager->SetGraphics(this->shared_from_this());
 		if (!this->_renderManager->Load())
         {
@@ -163,7 +171,8 @@ namespace projectfarm::graphics
                 return false;
             }
 
-            this->_materials[name] = material;
+            this->_materialIds[name] = static_cast<uint32_t>(this->_materials.size());
+            this->_materials.push_back(material);
         }
 
         this->_mesh.SetGraphics(this->shared_from_this());
@@ -187,13 +196,13 @@ namespace projectfarm::graphics
 
 		for (auto& material : this->_materials)
 		{
-			material.second->Destroy();
+			material->Destroy();
 		}
 		
 		this->_mesh.Destroy();
         this->_shapeMesh.Destroy();
 
-		this->_tileSetPool->Empty();
+		this->_tileSetPool->Shutdown();
 		this->_texturePool->Empty();
 
         if (this->_renderManager)
@@ -229,23 +238,35 @@ namespace projectfarm::graphics
         auto numberOfShapesRendered = this->_shapeMesh.Render();
 
         this->GetDebugInformation()->AddDrawCall(numberOfMeshesRendered + numberOfShapesRendered);
+        this->GetDebugInformation()->AddDrawnRenderLayer(this->_mesh.GetLastNumberOfRenderLayers());
+        this->GetDebugInformation()->SetTextureMemory(this->_texturePool->GetTextureMemoryInBytes());
 
 	    this->EndRender();
 	}
 
     void Graphics::BindMaterial(const std::string& name) noexcept
     {
-        if (name == this->_currentlyBoundMaterialName)
+        auto materialId = this->GetMaterialId(name);
+        if (!materialId)
         {
+            shared::api::logging::Log("Failed to find material with name: " + name);
             return;
         }
 
-        this->_currentlyBoundMaterialName = name;
+        this->BindMaterial(*materialId);
+    }
 
-        auto material = this->_materials.find(name);
-        if (material == this->_materials.end())
+    void Graphics::BindMaterial(uint32_t materialId) noexcept
+    {
+        if (materialId >= this->_materials.size())
+        {
+            shared::api::logging::Log("Failed to find material with id: " + std::to_string(materialId));
+            return;
+        }
+
+        const auto& material = this->_materials[materialId];
+        if (material == this->_currentlyBoundMaterial)
         {
-            shared::api::logging::Log("Failed to find material with name: " + name);
             return;
         }
 
@@ -254,7 +275,7 @@ namespace projectfarm::graphics
             this->_currentlyBoundMaterial->Unbind();
         }
 
-        this->_currentlyBoundMaterial = material->second;
+        this->_currentlyBoundMaterial = material;
 
         this->_currentlyBoundMaterial->Bind();
     }
@@ -373,6 +394,12 @@ namespace projectfarm::graphics
 	                            renderLayerIndex);
     }
 
+    void Graphics::PushChunkToRender(const TileMapChunk& chunk, const SDL_Rect& screenSpace,
+                                     uint32_t renderLayerIndex)
+    {
+        this->_mesh.AddChunk(chunk, screenSpace, renderLayerIndex);
+    }
+
     void Graphics::PushShapeToRender(const shapes::Rectangle& shape,
                                      const SDL_Rect& screenSpace,
                                      uint32_t renderLayerIndex)
@@ -389,6 +416,7 @@ namespace projectfarm::graphics
 
 	    this->_currentRenderLayer = 0;
 
+	    this->_texturePool->ProcessUploads();
 	    this->_texturePool->Cleanup(10min);
     }
 
@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <vector>
+#include <optional>
 #include <unordered_map>
 #include <SDL.h>
 
@@ -83,6 +84,10 @@ namespace projectfarm::graphics
 		                      SDL_Rect* source, SDL_Rect* dest,
 		                      uint32_t renderLayerIndex);
 
+        // `screenSpace` is where the chunk is drawn, which is the whole of its positions
+        void PushChunkToRender(const TileMapChunk& chunk, const SDL_Rect& screenSpace,
+                               uint32_t renderLayerIndex);
+
         void PushShapeToRender(const shapes::Rectangle& shape,
                                const SDL_Rect& screenSpace,
                                uint32_t renderLayerIndex);
@@ -130,6 +135,20 @@ namespace projectfarm::graphics
         }
 
         void BindMaterial(const std::string& name) noexcept;
+        void BindMaterial(uint32_t materialId) noexcept;
+
+        // ids are from 0 in the order the materials were loaded, so can be used to sort draws
+        [[nodiscard]]
+        std::optional<uint32_t> GetMaterialId(const std::string& name) const noexcept
+        {
+            auto materialId = this->_materialIds.find(name);
+            if (materialId == this->_materialIds.end())
+            {
+                return {};
+            }
+
+            return materialId->second;
+        }
 
         [[nodiscard]]
         const std::shared_ptr<Material>& GetCurrentlyBoundMaterial() const noexcept
@@ -164,9 +183,9 @@ namespace projectfarm::graphics
         std::unordered_map<std::string, std::shared_ptr<Shader>> _vertexShaders;
         std::unordered_map<std::string, std::shared_ptr<Shader>> _fragmentShaders;
 
-        std::string _currentlyBoundMaterialName;
         std::shared_ptr<Material> _currentlyBoundMaterial;
-        std::unordered_map<std::string, std::shared_ptr<Material>> _materials;
+        std::unordered_map<std::string, uint32_t> _materialIds;
+        std::vector<std::shared_ptr<Material>> _materials;
 
         std::shared_ptr<TexturePool> _texturePool;
         std::shared_ptr<TileSetPool> _tileSetPool;
@@ -49,6 +49,9 @@ namespace projectfarm::graphics
                 return false;
             }
 
+            this->_colorLocation = this->_shaderProgram.GetUniformLocation("color");
+            this->_isColorSet = false;
+
             auto colorName = jsonFile["color"].get<std::string>();
             if (auto c = shared::graphics::colors::FromString(colorName); c)
             {
@@ -62,8 +65,7 @@ namespace projectfarm::graphics
             for (auto i = 0u; i < this->_numberOfTextures; ++i)
             {
                 auto name = "texture" + std::to_string(i);
-                auto location = glGetUniformLocation(this->_shaderProgram.GetProgramId(), name.c_str());
-                glUniform1i(location, i);
+                glUniform1i(this->_shaderProgram.GetUniformLocation(name), i);
             }
             this->Unbind();
         }
@@ -81,6 +83,9 @@ namespace projectfarm::graphics
     void Material::Destroy() noexcept
     {
         this->_shaderProgram.Destroy();
+
+        this->_colorLocation = -1;
+        this->_isColorSet = false;
     }
 
     bool Material::LoadShader(const std::string& vertexShaderName, const std::string& fragmentShaderName) noexcept
@@ -118,10 +123,16 @@ namespace projectfarm::graphics
 
     void Material::SetColor(const shared::graphics::colors::Color& color) noexcept
     {
+        if (this->_isColorSet && color == this->_color)
+        {
+            return;
+        }
+
         this->_color = color;
+        this->_isColorSet = true;
 
         this->_shaderProgram.Use();
-        this->_shaderProgram.SetUniformVec4("color",
+        this->_shaderProgram.SetUniformVec4(this->_colorLocation,
                                             {
                                                     this->_color.r / 255.0f,
                                                     this->_color.g / 255.0f,
@@ -37,6 +37,10 @@ namespace projectfarm::graphics
     private:
         ShaderProgram _shaderProgram;
         shared::graphics::colors::Color _color {shared::graphics::colors::White};
+
+        // the uniform keeps its value in the program, so it is only set when the color changes
+        GLint _colorLocation {-1};
+        bool _isColorSet {false};
         uint32_t _numberOfTextures {0};
 
         [[nodiscard]]
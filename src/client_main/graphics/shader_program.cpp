@@ -24,6 +24,7 @@ namespace projectfarm::graphics
         }
 
         this->_isLinked = false;
+        this->_uniformLocations.clear();
     }
 
     bool ShaderProgram::AttachShader(const std::shared_ptr<Shader>& shader) noexcept
@@ -87,11 +88,28 @@ namespace projectfarm::graphics
         delete[] log;
     }
 
+    GLint ShaderProgram::GetUniformLocation(const std::string& name) const noexcept
+    {
+        if (auto location = this->_uniformLocations.find(name); location != this->_uniformLocations.end())
+        {
+            return location->second;
+        }
+
+        auto location = glGetUniformLocation(this->_programId, name.c_str());
+        this->_uniformLocations[name] = location;
+
+        return location;
+    }
+
     void ShaderProgram::SetUniformVec4(const std::string& name, std::array<float, 4> data) const noexcept
+    {
+        this->SetUniformVec4(this->GetUniformLocation(name), data);
+    }
+
+    void ShaderProgram::SetUniformVec4(GLint location, std::array<float, 4> data) const noexcept
     {
         static_assert(data.size() == 4);
 
-        auto location = glGetUniformLocation(this->_programId, name.c_str());
         glUniform4fv(location, 1, data.data());
     }
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include <string>
 #include <array>
+#include <unordered_map>
 
 #include "graphics_dependencies.h"
 #include "shader.h"
@@ -38,12 +39,18 @@ namespace projectfarm::graphics
             glUseProgram(0);
         }
 
+        // looked up once, as each lookup is a string compare in the driver
+        [[nodiscard]] GLint GetUniformLocation(const std::string& name) const noexcept;
+
         void SetUniformVec4(const std::string& name, std::array<float, 4> data) const noexcept;
+        void SetUniformVec4(GLint location, std::array<float, 4> data) const noexcept;
 
     private:
         GLuint _programId {0};
         bool _isLinked {false};
 
+        mutable std::unordered_map<std::string, GLint> _uniformLocations;
+
         void LogErrors() noexcept;
     };
 }
@@ -74,11 +74,11 @@ namespace projectfarm::graphics
                 glBufferData(GL_ARRAY_BUFFER, verticies.size() * sizeof(GLfloat), &verticies[0], GL_DYNAMIC_DRAW);
 
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->_indexBOId[this->_currentBufferIndex]);
-                glBufferData(GL_ELEMENT_ARRAY_BUFFER, indicies.size() * sizeof(GLushort), &indicies[0], GL_DYNAMIC_DRAW);
+                glBufferData(GL_ELEMENT_ARRAY_BUFFER, indicies.size() * sizeof(GLuint), &indicies[0], GL_DYNAMIC_DRAW);
 
                 glBindVertexArray(this->_vaoId[this->_currentBufferIndex]);
 
-                glDrawElements(GL_LINES, static_cast<GLsizei>(indicies.size()), GL_UNSIGNED_SHORT, nullptr);
+                glDrawElements(GL_LINES, static_cast<GLsizei>(indicies.size()), GL_UNSIGNED_INT, nullptr);
 
                 glBindVertexArray(0);
 
@@ -155,7 +155,7 @@ namespace projectfarm::graphics
         verticiesMap.emplace_back(ssLeftX);
         verticiesMap.emplace_back(ssTopY);
 
-        auto size = static_cast<GLushort>(indiciesMap.size());
+        auto size = static_cast<GLuint>(indiciesMap.size());
         indiciesMap.emplace_back(size++); // 0 + x
         indiciesMap.emplace_back(size++); // 1 + x
         indiciesMap.emplace_back(size++); // 2 + x
@@ -37,7 +37,7 @@ namespace projectfarm::graphics
         struct LayerDetails
         {
             std::vector<GLfloat> _vertexData;
-            std::vector<GLushort> _indexData;
+            std::vector<GLuint> _indexData;
         };
 
         uint8_t _currentBufferIndex {0};
@@ -19,10 +19,43 @@ namespace projectfarm::graphics
         this->_textureHeight = data.Height;
 
         this->_loadedDirect = false;
+        this->_isPending = false;
 
         return true;
 	}
 
+    bool Texture::LoadAsync(const std::filesystem::path& path) noexcept
+    {
+        auto data = this->GetGraphics()->GetTexturePool()->GetAsync(path.u8string());
+        if (data.TextureId == 0)
+        {
+            shared::api::logging::Log("Failed to create texture.");
+            return false;
+        }
+
+        this->_textureId = data.TextureId;
+        this->_textureWidth = data.Width;
+        this->_textureHeight = data.Height;
+
+        this->_loadedDirect = false;
+        this->_isPending = data.IsPending;
+
+        return true;
+    }
+
+    void Texture::RefreshPendingTexture() noexcept
+    {
+        auto data = this->GetGraphics()->GetTexturePool()->GetData(this->_textureId);
+
+        this->_isPending = data.IsPending;
+
+        if (!this->_isPending)
+        {
+            this->_textureWidth = data.Width;
+            this->_textureHeight = data.Height;
+        }
+    }
+
     bool Texture::LoadFromSurface(const std::shared_ptr<SDLFreeableSurface>& surface) noexcept
     {
 	    this->Destroy();
@@ -40,6 +73,7 @@ namespace projectfarm::graphics
         this->_textureHeight = data.Height;
 
         this->_loadedDirect = true;
+        this->_isPending = false;
 
         return true;
     }
@@ -63,6 +97,7 @@ namespace projectfarm::graphics
 	    this->_textureId = 0;
 
 	    this->_loadedDirect = false;
+	    this->_isPending = false;
 
 	    CHECK_OPENGL_ERROR
 
@@ -71,6 +106,11 @@ namespace projectfarm::graphics
 	
 	void Texture::Render(uint32_t renderLayerIndex)
 	{
+	    if (this->_isPending)
+        {
+	        this->RefreshPendingTexture();
+        }
+
         // TODO: Setting the dest and source rect seems like it doesn't have to be done on each render call
 	    SDL_Rect destRect;
 	    destRect.x = this->_renderX;
@@ -26,6 +26,10 @@ namespace projectfarm::graphics
 		[[nodiscard]]
         bool Load(const std::filesystem::path& path) noexcept;
 
+		// the texture is a placeholder, with the size of the placeholder, until the pool has uploaded it
+		[[nodiscard]]
+        bool LoadAsync(const std::filesystem::path& path) noexcept;
+
 		[[nodiscard]]
         bool LoadFromSurface(const std::shared_ptr<SDLFreeableSurface>& surface) noexcept;
 
@@ -40,6 +44,18 @@ namespace projectfarm::graphics
 
 		void Bind() const noexcept;
 
+        // false while the texture is a placeholder waiting on the pool, when its size is not yet known
+        [[nodiscard]]
+        bool IsReady() noexcept
+        {
+            if (this->_isPending)
+            {
+                this->RefreshPendingTexture();
+            }
+
+            return !this->_isPending;
+        }
+
         [[nodiscard]]
         GLuint GetTextureId() const noexcept
         {
@@ -110,6 +126,11 @@ namespace projectfarm::graphics
 		// not from the texture pool, so we will need to manually delete the texture
 		bool _loadedDirect {false};
 
+		// loaded with `LoadAsync` and not yet uploaded by the texture pool
+		bool _isPending {false};
+
+		void RefreshPendingTexture() noexcept;
+
         std::string _materialName = "single_texture";
 
         shared::graphics::colors::Color _color {shared::graphics::colors::White};
@@ -1,5 +1,7 @@
 #include <algorithm>
+#include <cstring>
 #include <list>
+#include <vector>
 
 #include "texture_pool.h"
 #include "engine/debug_information.h"
@@ -8,12 +10,32 @@
 
 namespace projectfarm::graphics
 {
+    namespace
+    {
+        // a transparent pixel shown until the image has been uploaded
+        const shared::graphics::DecodedImage PlaceholderImage {1u, 1u, std::vector<std::byte>(4u)};
+    }
+
     TexturePoolData TexturePool::Get(const std::string& name)
     {
         if (this->_textures.count(name) > 0)
         {
-            this->_textures[name].ReferenceCount++;
-            return this->_textures[name];
+            auto& data = this->_textures[name];
+
+            // the caller needs the real texture, so finish it now
+            if (data.IsPending)
+            {
+                data.IsPending = false;
+
+                auto image = this->_decoder->Decode(name);
+                if (!image || !this->UploadImage(data, *image))
+                {
+                    shared::api::logging::Log("Failed to load the texture: " + name);
+                }
+            }
+
+            data.ReferenceCount++;
+            return data;
         }
 
         auto data = this->Create(name);
@@ -29,26 +51,68 @@ namespace projectfarm::graphics
         return this->_textures[name];
     }
 
+    TexturePoolData TexturePool::GetAsync(const std::string& name)
+    {
+        if (this->_textures.count(name) > 0)
+        {
+            this->_textures[name].ReferenceCount++;
+            return this->_textures[name];
+        }
+
+        // nothing to wait for
+        if (this->_decoder->IsCached(name))
+        {
+            return this->Get(name);
+        }
+
+        TexturePoolData data;
+
+        if (!this->GenerateTexture(data, PlaceholderImage))
+        {
+            shared::api::logging::Log("Failed to create placeholder texture for: " + name);
+            return {};
+        }
+
+        data.IsPending = true;
+
+        (void)this->_decoder->Request(name);
+
+        this->_textures[name] = data;
+        this->_textures[name].ReferenceCount++;
+
+        return this->_textures[name];
+    }
+
+    TexturePoolData TexturePool::GetData(GLuint textureId) const noexcept
+    {
+        auto iter = std::find_if(this->_textures.begin(), this->_textures.end(), [textureId](const auto& it)
+        {
+            return it.second.TextureId == textureId;
+        });
+
+        if (iter == this->_textures.end())
+        {
+            return {};
+        }
+
+        return iter->second;
+    }
+
     TexturePoolData TexturePool::Create(const std::filesystem::path& path)
     {
         TexturePoolData data;
 
         auto imagePath = path.u8string();
-        SDL_Surface* surface = IMG_Load(imagePath.c_str());
-        if (surface == nullptr)
+
+        auto image = this->_decoder->Decode(imagePath);
+        if (!image)
         {
             shared::api::logging::Log("Failed to load the texture:");
             shared::api::logging::Log(imagePath);
-            shared::api::logging::Log(IMG_GetError());
             return data;
         }
 
-        data = this->CreateTexture(surface);
-
-        SDL_FreeSurface(surface);
-        surface = nullptr;
-
-        if (data.TextureId == 0)
+        if (!this->GenerateTexture(data, *image))
         {
             shared::api::logging::Log("Failed to create texture.");
         }
@@ -60,6 +124,95 @@ namespace projectfarm::graphics
         return data;
     }
 
+    TexturePoolData TexturePool::CreateFromImage(const std::string& name, const shared::graphics::DecodedImage& image)
+    {
+        if (this->_textures.count(name) > 0)
+        {
+            shared::api::logging::Log("A texture already exists with name: " + name);
+            return {};
+        }
+
+        TexturePoolData data;
+
+        if (!this->GenerateTexture(data, image))
+        {
+            shared::api::logging::Log("Failed to create texture with name: " + name);
+            return {};
+        }
+
+        this->GetDebugInformation()->AddNumberOfTexturesLoaded(1);
+
+        this->_textures[name] = data;
+
+        return data;
+    }
+
+    void TexturePool::ProcessUploads()
+    {
+        for (const auto& upload : this->_decoder->TakeUploads(TexturePool::MaxUploadSizeInBytesPerFrame))
+        {
+            auto texture = this->_textures.find(upload.Path);
+
+            // released before it was decoded, or needed straight away and loaded by `Get`
+            if (texture == this->_textures.end() || !texture->second.IsPending)
+            {
+                continue;
+            }
+
+            auto& data = texture->second;
+            data.IsPending = false;
+
+            // the placeholder is kept
+            if (!upload.Image || !this->UploadImage(data, *upload.Image))
+            {
+                shared::api::logging::Log("Failed to load the texture: " + upload.Path);
+                continue;
+            }
+
+            this->GetDebugInformation()->AddNumberOfTexturesLoaded(1);
+        }
+    }
+
+    shared::graphics::DecodedImagePtr TexturePool::DecodeImage(const std::string& path) const noexcept
+    {
+        // the image may be in the asset archive
+        auto file = this->_dataProvider->OpenFile(path);
+        if (!file)
+        {
+            shared::api::logging::Log("Failed to open the texture: " + path);
+            return {};
+        }
+
+        auto fileData = file->GetData();
+        SDL_Surface* surface = IMG_Load_RW(SDL_RWFromConstMem(fileData.data(), static_cast<int>(fileData.size())), 1);
+        if (surface == nullptr)
+        {
+            shared::api::logging::Log("Failed to decode the texture: " + path);
+            shared::api::logging::Log(IMG_GetError());
+            return {};
+        }
+
+        auto image = TexturePool::ConvertSurface(surface);
+
+        SDL_FreeSurface(surface);
+        surface = nullptr;
+
+        return image;
+    }
+
+    uint64_t TexturePool::GetTextureMemoryInBytes() const noexcept
+    {
+        uint64_t textureMemoryInBytes {0u};
+
+        for (const auto& [_, texture] : this->_textures)
+        {
+            // RGBA, and the mipmaps add a third again
+            textureMemoryInBytes += static_cast<uint64_t>(texture.Width) * texture.Height * 4u * 4u / 3u;
+        }
+
+        return textureMemoryInBytes;
+    }
+
     void TexturePool::Release(GLuint textureId)
     {
         auto iter = std::find_if(this->_textures.begin(), this->_textures.end(), [textureId](const auto& it)
@@ -102,12 +255,12 @@ namespace projectfarm::graphics
 
     void TexturePool::Cleanup(const std::chrono::duration<uint64_t, std::milli>& when)
     {
-        auto now = std::chrono::steady_clock::now();
+        auto now = shared::time::MonotonicClock::GetMilliseconds();
 
         if (now >= this->_nextCleanupTime)
         {
             this->_lastCleanupTime = this->_nextCleanupTime;
-            this->_nextCleanupTime = now + when;
+            this->_nextCleanupTime = now + when.count();
 
             this->PerformCleanup();
         }
@@ -115,6 +268,8 @@ namespace projectfarm::graphics
 
     void TexturePool::Empty()
     {
+        this->_decoder->Clear();
+
         for (const auto&[_, texture] : this->_textures)
         {
             this->Destroy(texture.TextureId, false);
@@ -127,10 +282,14 @@ namespace projectfarm::graphics
     {
         TexturePoolData data;
 
-        data.Width = static_cast<uint32_t>(surface->w);
-        data.Height = static_cast<uint32_t>(surface->h);
+        auto image = TexturePool::ConvertSurface(surface);
+        if (!image)
+        {
+            shared::api::logging::Log("Failed to convert surface.");
+            return data;
+        }
 
-        if (!this->GenerateTexture(data, surface))
+        if (!this->GenerateTexture(data, *image))
         {
             shared::api::logging::Log("Failed to generate texture.");
             return data;
@@ -139,7 +298,43 @@ namespace projectfarm::graphics
         return data;
     }
 
-    bool TexturePool::GenerateTexture(TexturePoolData& data, SDL_Surface* surface)
+    shared::graphics::DecodedImagePtr TexturePool::ConvertSurface(SDL_Surface* surface) noexcept
+    {
+        // RGBA32 is the byte order R, G, B, A whatever the endianness
+        SDL_Surface* rgbaSurface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+        if (rgbaSurface == nullptr)
+        {
+            shared::api::logging::Log("Failed to convert surface:");
+            shared::api::logging::Log(SDL_GetError());
+            return {};
+        }
+
+        auto image = std::make_shared<shared::graphics::DecodedImage>();
+        image->Width = static_cast<uint32_t>(rgbaSurface->w);
+        image->Height = static_cast<uint32_t>(rgbaSurface->h);
+
+        auto rowSize = static_cast<size_t>(image->Width) * 4u;
+        image->Pixels.resize(rowSize * image->Height);
+
+        SDL_LockSurface(rgbaSurface);
+
+        // rows may be padded in the surface, but are tightly packed in the image
+        for (auto y = 0u; y < image->Height; ++y)
+        {
+            std::memcpy(image->Pixels.data() + y * rowSize,
+                        static_cast<const std::byte*>(rgbaSurface->pixels) + y * rgbaSurface->pitch,
+                        rowSize);
+        }
+
+        SDL_UnlockSurface(rgbaSurface);
+
+        SDL_FreeSurface(rgbaSurface);
+        rgbaSurface = nullptr;
+
+        return image;
+    }
+
+    bool TexturePool::GenerateTexture(TexturePoolData& data, const shared::graphics::DecodedImage& image)
     {
         glGenTextures(1, &data.TextureId);
         glBindTexture(GL_TEXTURE_2D, data.TextureId);
@@ -153,34 +348,20 @@ namespace projectfarm::graphics
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
         CHECK_OPENGL_ERROR
 
-        GLenum format = surface->format->BytesPerPixel == 4 ? GL_RGBA : GL_RGB;
-        uint32_t bitDepth = surface->format->BitsPerPixel;
-
-#if SDL_BYTEORDER == SDL_BIG_ENDIAN
-        uint32_t rMask = 0xff000000;
-        uint32_t gMask = 0x00ff0000;
-        uint32_t bMask = 0x0000ff00;
-        uint32_t aMask = 0x000000ff;
-#else
-        uint32_t rMask = 0x000000ff;
-        uint32_t gMask = 0x0000ff00;
-        uint32_t bMask = 0x00ff0000;
-        uint32_t aMask = 0xff000000;
-#endif
-
-        SDL_Surface* newSurface = SDL_CreateRGBSurface(0, data.Width, data.Height,
-                                                       bitDepth, rMask, gMask, bMask, aMask);
-
-        SDL_BlitSurface(surface, nullptr, newSurface, nullptr);
-        CHECK_OPENGL_ERROR
+        return this->UploadImage(data, image);
+    }
 
-        glTexImage2D(GL_TEXTURE_2D, 0, format,
-                     data.Width, data.Height,
-                     0, format, GL_UNSIGNED_BYTE, newSurface->pixels);
+    bool TexturePool::UploadImage(TexturePoolData& data, const shared::graphics::DecodedImage& image)
+    {
+        data.Width = image.Width;
+        data.Height = image.Height;
 
-        SDL_FreeSurface(newSurface);
-        newSurface = nullptr;
+        glBindTexture(GL_TEXTURE_2D, data.TextureId);
+        CHECK_OPENGL_ERROR
 
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA,
+                     data.Width, data.Height,
+                     0, GL_RGBA, GL_UNSIGNED_BYTE, image.Pixels.data());
         CHECK_OPENGL_ERROR
 
         glGenerateMipmap(GL_TEXTURE_2D);
@@ -3,27 +3,42 @@
 
 #include <map>
 #include <string>
+#include <memory>
 #include <filesystem>
 #include <chrono>
+#include <future>
 
 #include <SDL.h>
 #include <SDL_image.h>
 
 #include "consume_graphics.h"
 #include "engine/consume_debug_information.h"
+#include "data/consume_data_provider.h"
+#include "concurrency/thread_pool.h"
+#include "time/monotonic_clock.h"
+#include "graphics/texture_decoder.h"
 #include "texture_pool_data.h"
 #include "graphics_dependencies.h"
 
 namespace projectfarm::graphics
 {
     class TexturePool final : public ConsumeGraphics,
-                              public engine::ConsumeDebugInformation
+                              public engine::ConsumeDebugInformation,
+                              public shared::ConsumeDataProvider
     {
     public:
         TexturePool()
         {
-            this->_lastCleanupTime = std::chrono::steady_clock::now();
+            this->_lastCleanupTime = shared::time::MonotonicClock::GetMilliseconds();
             this->_nextCleanupTime = this->_lastCleanupTime;
+
+            this->_decodeThreadPool = std::make_shared<shared::concurrency::ThreadPool>(
+                TexturePool::NumberOfDecodeThreads);
+
+            this->_decoder = std::make_unique<shared::graphics::TextureDecoder>(
+                this->_decodeThreadPool,
+                [this](const auto& path) { return this->DecodeImage(path); },
+                TexturePool::MaxDecodedCacheSizeInBytes);
         }
 
         ~TexturePool() override = default;
@@ -37,9 +52,36 @@ namespace projectfarm::graphics
         [[nodiscard]]
         TexturePoolData Get(const std::string& name);
 
+        // returns a placeholder texture straight away. The image is decoded on another thread
+        // and uploaded to the same texture by `ProcessUploads`, after which the returned
+        // data is out of date, so check `GetData` while it is pending
+        [[nodiscard]]
+        TexturePoolData GetAsync(const std::string& name);
+
+        [[nodiscard]]
+        TexturePoolData GetData(GLuint textureId) const noexcept;
+
         [[nodiscard]]
         TexturePoolData Create(const std::filesystem::path& path);
 
+        // adds an image that was built in memory, such as an atlas page, so it can be found with `Get`
+        [[nodiscard]]
+        TexturePoolData CreateFromImage(const std::string& name, const shared::graphics::DecodedImage& image);
+
+        // decodes an image on the decode threads without creating a texture for it
+        [[nodiscard]]
+        std::shared_future<shared::graphics::DecodedImagePtr> RequestDecode(const std::string& path)
+        {
+            return this->_decoder->Request(path, false);
+        }
+
+        // uploads decoded images to their pending textures, within a per frame budget
+        void ProcessUploads();
+
+        // of the pooled textures, with their mipmaps, as the driver is likely to store them
+        [[nodiscard]]
+        uint64_t GetTextureMemoryInBytes() const noexcept;
+
         void Release(GLuint textureId);
         void Destroy(GLuint textureId, bool removeFromMap = true);
 
@@ -51,15 +93,33 @@ namespace projectfarm::graphics
         TexturePoolData CreateTexture(SDL_Surface* surface);
 
     private:
+        static constexpr uint32_t NumberOfDecodeThreads {2u};
+        static constexpr uint64_t MaxDecodedCacheSizeInBytes {64u * 1024u * 1024u};
+        static constexpr uint64_t MaxUploadSizeInBytesPerFrame {4u * 1024u * 1024u};
+
+        std::shared_ptr<shared::concurrency::ThreadPool> _decodeThreadPool;
+        std::unique_ptr<shared::graphics::TextureDecoder> _decoder;
+
+        // run on the decode threads
+        [[nodiscard]]
+        shared::graphics::DecodedImagePtr DecodeImage(const std::string& path) const noexcept;
+
+        [[nodiscard]]
+        static shared::graphics::DecodedImagePtr ConvertSurface(SDL_Surface* surface) noexcept;
+
+        [[nodiscard]]
+        bool GenerateTexture(TexturePoolData& data, const shared::graphics::DecodedImage& image);
+
         [[nodiscard]]
-        bool GenerateTexture(TexturePoolData& data, SDL_Surface* surface);
+        bool UploadImage(TexturePoolData& data, const shared::graphics::DecodedImage& image);
 
         void PerformCleanup();
 
         std::map<std::string, TexturePoolData> _textures;
 
-        std::chrono::time_point<std::chrono::steady_clock> _lastCleanupTime;
-        std::chrono::time_point<std::chrono::steady_clock> _nextCleanupTime;
+        // of `MonotonicClock`, in milliseconds
+        uint64_t _lastCleanupTime {0};
+        uint64_t _nextCleanupTime {0};
     };
 }
 
@@ -21,6 +21,9 @@ namespace projectfarm::graphics
         uint32_t Width {0};
         uint32_t Height {0};
         uint32_t ReferenceCount {0};
+
+        // the texture is a placeholder until its image has been decoded and uploaded
+        bool IsPending {false};
     };
 }
 
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <fstream>
 #include <vector>
 #include <nlohmann/json.hpp>
@@ -5,8 +6,10 @@
 #include "tile_map.h"
 #include "tile_set_pool.h"
 #include "graphics.h"
+#include "engine/debug_information.h"
 #include "time/timer.h"
 #include "api/logging/logging.h"
+#include "profiling/profiler.h"
 
 namespace projectfarm::graphics
 {
@@ -74,6 +77,7 @@ namespace projectfarm::graphics
         shared::api::logging::Log("Shutting down tile map...");
 
         this->_tileLayers.clear();
+        this->ResetChunks();
 
         this->ClearTileSets();
 
@@ -94,6 +98,8 @@ namespace projectfarm::graphics
             this->GetGraphics()->GetTileSetPool()->Release(kv.second->GetName());
         }
         this->_tileSets.clear();
+
+        this->SetChunksDirty();
     }
 
     void TileMap::Tick()
@@ -127,50 +133,278 @@ namespace projectfarm::graphics
 
     void TileMap::RenderLayer(uint8_t layerIndex) noexcept
     {
-        auto& layer = this->_tileLayers[layerIndex];
+        PROFILE_ZONE("TileMap::RenderLayer");
 
         auto renderLayer = this->GetGraphics()->BumpRenderLayer();
 
-        auto x = this->_renderX + (this->_renderBoundsX * this->_tileWidth);
+        if (this->_useStaticChunks)
+        {
+            this->RenderLayerChunks(layerIndex, renderLayer);
+            return;
+        }
 
         auto renderWidth = this->_renderBoundsW == 0 ? this->_widthInTiles :
                            std::min(this->_renderBoundsX + this->_renderBoundsW, this->_widthInTiles);
+        auto renderHeight = this->_renderBoundsH == 0 ? this->_heightInTiles :
+                            std::min(this->_renderBoundsY + this->_renderBoundsH, this->_heightInTiles);
+
         for (auto tileX = this->_renderBoundsX; tileX < renderWidth; ++tileX)
         {
-            auto y = this->_renderY + (this->_renderBoundsY * this->_tileHeight);
-
-            auto renderHeight = this->_renderBoundsH == 0 ? this->_heightInTiles :
-                                std::min(this->_renderBoundsY + this->_renderBoundsH, this->_heightInTiles);
             for (auto tileY = this->_renderBoundsY; tileY < renderHeight; ++tileY)
             {
-                auto tileIndex = layer->GetTile(tileX, tileY);
+                this->RenderTile(layerIndex, tileX, tileY, renderLayer);
+            }
+        }
+    }
+
+    void TileMap::RenderLayerChunks(uint8_t layerIndex, uint32_t renderLayer) noexcept
+    {
+        if (this->_chunks.empty())
+        {
+            return;
+        }
+
+        const auto& graphics = this->GetGraphics();
+        const auto& camera = graphics->GetCamera();
 
-                if (tileIndex != TileMap::EmptyTileIndex)
+        auto renderWidth = this->_renderBoundsW == 0 ? this->_widthInTiles :
+                           std::min(this->_renderBoundsX + this->_renderBoundsW, this->_widthInTiles);
+        auto renderHeight = this->_renderBoundsH == 0 ? this->_heightInTiles :
+                            std::min(this->_renderBoundsY + this->_renderBoundsH, this->_heightInTiles);
+
+        auto toChunkX = std::min((renderWidth + this->_chunkSizeInTiles - 1u) / this->_chunkSizeInTiles,
+                                 this->_widthInChunks);
+        auto toChunkY = std::min((renderHeight + this->_chunkSizeInTiles - 1u) / this->_chunkSizeInTiles,
+                                 this->_heightInChunks);
+
+        for (auto chunkY = this->_renderBoundsY / this->_chunkSizeInTiles; chunkY < toChunkY; ++chunkY)
+        {
+            for (auto chunkX = this->_renderBoundsX / this->_chunkSizeInTiles; chunkX < toChunkX; ++chunkX)
+            {
+                auto tileX = chunkX * this->_chunkSizeInTiles;
+                auto tileY = chunkY * this->_chunkSizeInTiles;
+
+                SDL_Rect chunkSpace
                 {
-                    const auto& tile = this->_tiles[tileIndex];
+                    this->_renderX + static_cast<int32_t>(tileX * this->_tileWidth),
+                    this->_renderY + static_cast<int32_t>(tileY * this->_tileHeight),
+                    static_cast<int32_t>(std::min(this->_chunkSizeInTiles, this->_widthInTiles - tileX) * this->_tileWidth),
+                    static_cast<int32_t>(std::min(this->_chunkSizeInTiles, this->_heightInTiles - tileY) * this->_tileHeight),
+                };
 
-                    if (!tile->IsIndexAbsoluteEmpty())
+                if (this->_renderToWorldSpace)
+                {
+                    if (!SDL_HasIntersection(&camera->GetViewport(), &chunkSpace))
                     {
-                        auto index = tile->GetIndexAbsolute();
-                        auto tileSetId = tile->GetTileSetId();
-
-                        if (this->_tileSets[tileSetId] == nullptr)
-                        {
-                            continue;
-                        }
-
-                        this->_tileSets[tileSetId]->RenderTile(index,
-                                                               x, y,
-                                                               this->_tileWidth, this->_tileHeight,
-                                                               this->_renderToWorldSpace,
-                                                               renderLayer);
+                        continue;
                     }
+
+                    chunkSpace = camera->WorldSpaceToScreenSpace(chunkSpace);
                 }
 
-                y += this->_tileHeight;
+                auto& chunk = this->GetChunk(layerIndex, chunkX, chunkY);
+
+                if (chunk.IsDirty())
+                {
+                    this->BuildChunk(layerIndex, chunkX, chunkY, chunk);
+                }
+
+                graphics->PushChunkToRender(chunk, chunkSpace, renderLayer);
+                graphics->GetDebugInformation()->AddDrawnTile(chunk.GetNumberOfTiles());
+
+                for (const auto& [animatedTileX, animatedTileY] : chunk.GetAnimatedTiles())
+                {
+                    this->RenderTile(layerIndex, animatedTileX, animatedTileY, renderLayer);
+                }
             }
+        }
+    }
+
+    void TileMap::RenderTile(uint8_t layerIndex, uint32_t tileX, uint32_t tileY, uint32_t renderLayer) noexcept
+    {
+        auto tileIndex = this->_tileLayers[layerIndex]->GetTile(tileX, tileY);
+        if (tileIndex == TileMap::EmptyTileIndex)
+        {
+            return;
+        }
+
+        const auto& tile = this->_tiles[tileIndex];
+        if (tile->IsIndexAbsoluteEmpty())
+        {
+            return;
+        }
+
+        const auto& tileSet = this->_tileSets[tile->GetTileSetId()];
+        if (tileSet == nullptr)
+        {
+            return;
+        }
+
+        tileSet->RenderTile(tile->GetIndexAbsolute(),
+                            this->_renderX + static_cast<int32_t>(tileX * this->_tileWidth),
+                            this->_renderY + static_cast<int32_t>(tileY * this->_tileHeight),
+                            this->_tileWidth, this->_tileHeight,
+                            this->_renderToWorldSpace,
+                            renderLayer);
+    }
+
+    void TileMap::BuildChunk(uint8_t layerIndex, uint32_t chunkX, uint32_t chunkY, TileMapChunk& chunk) noexcept
+    {
+        PROFILE_ZONE("TileMap::BuildChunk");
+
+        const auto& layer = this->_tileLayers[layerIndex];
+
+        auto fromTileX = chunkX * this->_chunkSizeInTiles;
+        auto fromTileY = chunkY * this->_chunkSizeInTiles;
+        auto toTileX = std::min(fromTileX + this->_chunkSizeInTiles, this->_widthInTiles);
+        auto toTileY = std::min(fromTileY + this->_chunkSizeInTiles, this->_heightInTiles);
+
+        this->_chunkBuilder.Begin((toTileX - fromTileX) * this->_tileWidth, (toTileY - fromTileY) * this->_tileHeight);
+        this->_chunkTextures.clear();
+
+        chunk.ClearAnimatedTiles();
+
+        auto isComplete = true;
+
+        for (auto tileY = fromTileY; tileY < toTileY; ++tileY)
+        {
+            for (auto tileX = fromTileX; tileX < toTileX; ++tileX)
+            {
+                auto tileIndex = layer->GetTile(tileX, tileY);
+                if (tileIndex == TileMap::EmptyTileIndex)
+                {
+                    continue;
+                }
+
+                const auto& tile = this->_tiles[tileIndex];
+
+                if (tile->GetNumberOfFrames() > 1u)
+                {
+                    chunk.AddAnimatedTile(tileX, tileY);
+                    continue;
+                }
+
+                if (tile->IsIndexAbsoluteEmpty())
+                {
+                    continue;
+                }
+
+                auto tileSet = this->_tileSets.find(tile->GetTileSetId());
+                if (tileSet == this->_tileSets.end() || tileSet->second == nullptr)
+                {
+                    continue;
+                }
+
+                const auto& texture = tileSet->second->GetTexture();
+
+                // the texture coordinates need its size, so the chunk is built again once it is loaded
+                if (!texture->IsReady())
+                {
+                    isComplete = false;
+                    continue;
+                }
+
+                auto textureIter = std::find(this->_chunkTextures.begin(), this->_chunkTextures.end(), texture);
+                auto textureKey = static_cast<uint32_t>(std::distance(this->_chunkTextures.begin(), textureIter));
+
+                if (textureIter == this->_chunkTextures.end())
+                {
+                    this->_chunkTextures.push_back(texture);
+                }
+
+                auto source = tileSet->second->GetTileSource(tile->GetIndexAbsolute());
+
+                this->_chunkBuilder.AddTile(textureKey, texture->GetTextureWidth(), texture->GetTextureHeight(),
+                                            {
+                                                static_cast<float>(source.x),
+                                                static_cast<float>(source.y),
+                                                static_cast<float>(source.w),
+                                                static_cast<float>(source.h),
+                                            },
+                                            {
+                                                static_cast<float>((tileX - fromTileX) * this->_tileWidth),
+                                                static_cast<float>((tileY - fromTileY) * this->_tileHeight),
+                                                static_cast<float>(this->_tileWidth),
+                                                static_cast<float>(this->_tileHeight),
+                                            });
+            }
+        }
+
+        chunk.Upload(this->_chunkBuilder, this->_chunkTextures);
+        chunk.SetIsDirty(!isComplete);
+    }
+
+    void TileMap::SetTileSize(uint32_t tileWidth, uint32_t tileHeight) noexcept
+    {
+        if (tileWidth == this->_tileWidth && tileHeight == this->_tileHeight)
+        {
+            return;
+        }
+
+        this->_tileWidth = tileWidth;
+        this->_tileHeight = tileHeight;
+
+        this->ResetChunks();
+    }
+
+    void TileMap::SetUseStaticChunks(bool useStaticChunks) noexcept
+    {
+        this->_useStaticChunks = useStaticChunks;
+
+        this->ResetChunks();
+    }
+
+    void TileMap::ResetChunks() noexcept
+    {
+        this->_chunks.clear();
+        this->_widthInChunks = 0;
+        this->_heightInChunks = 0;
+
+        if (!this->_useStaticChunks || this->_tileWidth == 0 || this->_tileHeight == 0)
+        {
+            return;
+        }
+
+        this->_chunkSizeInTiles = std::clamp(TileMap::MaxChunkSizeInPixels / std::max(this->_tileWidth, this->_tileHeight),
+                                             1u, TileMap::MaxChunkSizeInTiles);
 
-            x += this->_tileWidth;
+        this->_widthInChunks = (this->_widthInTiles + this->_chunkSizeInTiles - 1u) / this->_chunkSizeInTiles;
+        this->_heightInChunks = (this->_heightInTiles + this->_chunkSizeInTiles - 1u) / this->_chunkSizeInTiles;
+
+        auto numberOfChunks = this->_tileLayers.size() * this->_widthInChunks * this->_heightInChunks;
+
+        this->_chunks.reserve(numberOfChunks);
+        for (auto i = 0u; i < numberOfChunks; ++i)
+        {
+            this->_chunks.emplace_back(std::make_unique<TileMapChunk>());
+        }
+    }
+
+    void TileMap::SetChunksDirty() noexcept
+    {
+        for (auto& chunk : this->_chunks)
+        {
+            chunk->SetIsDirty(true);
+        }
+    }
+
+    void TileMap::SetChunksDirty(uint8_t layerIndex, uint32_t tileX, uint32_t tileY,
+                                 uint32_t width, uint32_t height) noexcept
+    {
+        if (this->_chunks.empty() || width == 0 || height == 0)
+        {
+            return;
+        }
+
+        auto toChunkX = std::min((tileX + width - 1u) / this->_chunkSizeInTiles, this->_widthInChunks - 1u);
+        auto toChunkY = std::min((tileY + height - 1u) / this->_chunkSizeInTiles, this->_heightInChunks - 1u);
+
+        for (auto chunkY = tileY / this->_chunkSizeInTiles; chunkY <= toChunkY; ++chunkY)
+        {
+            for (auto chunkX = tileX / this->_chunkSizeInTiles; chunkX <= toChunkX; ++chunkX)
+            {
+                this->GetChunk(layerIndex, chunkX, chunkY).SetIsDirty(true);
+            }
         }
     }
 
@@ -200,6 +434,8 @@ namespace projectfarm::graphics
         this->_tileWidth = tileWidth;
         this->_tileHeight = tileHeight;
 
+        this->ResetChunks();
+
         return true;
     }
 
@@ -218,29 +454,66 @@ namespace projectfarm::graphics
 
         this->_tileSets[tileSetId] = tileSet;
 
+        this->SetChunksDirty();
+
         return true;
     }
 
     bool TileMap::SetTileIndex(uint8_t tileSetId, uint32_t layer,
                                uint32_t tileX, uint32_t tileY, uint32_t indexAbsolute)
     {
-        if (this->_tileSets.count(tileSetId) <= 0)
+        if (layer >= this->_tileLayers.size())
         {
-            shared::api::logging::Log("Failed to find tile set with id: " + std::to_string(tileSetId));
+            shared::api::logging::Log("Invalid tilemap layer id: " + std::to_string(layer));
             return false;
         }
 
+        auto tileIndex = this->AddTile(tileSetId, indexAbsolute);
+        if (!tileIndex)
+        {
+            return false;
+        }
+
+        this->_tileLayers[layer]->SetTile(tileX, tileY, *tileIndex);
+        this->SetChunksDirty(static_cast<uint8_t>(layer), tileX, tileY, 1, 1);
+
+        return true;
+    }
+
+    bool TileMap::SetTileIndex(uint32_t layer, uint32_t tileX, uint32_t tileY,
+                               const std::vector<TileMapTileAnimationData>& animationData)
+    {
         if (layer >= this->_tileLayers.size())
         {
             shared::api::logging::Log("Invalid tilemap layer id: " + std::to_string(layer));
             return false;
         }
 
+        auto tileIndex = this->AddTile(animationData);
+        if (!tileIndex)
+        {
+            return false;
+        }
+
+        this->_tileLayers[layer]->SetTile(tileX, tileY, *tileIndex);
+        this->SetChunksDirty(static_cast<uint8_t>(layer), tileX, tileY, 1, 1);
+
+        return true;
+    }
+
+    std::optional<uint16_t> TileMap::AddTile(uint8_t tileSetId, uint32_t indexAbsolute)
+    {
+        if (this->_tileSets.count(tileSetId) <= 0)
+        {
+            shared::api::logging::Log("Failed to find tile set with id: " + std::to_string(tileSetId));
+            return {};
+        }
+
         if (!this->_tileSets[tileSetId]->IsAbsoluteIndexValid(indexAbsolute))
         {
             shared::api::logging::Log("Invalid absolute index: " + std::to_string(tileSetId) +
                                 "for tileset: " + std::to_string(indexAbsolute));
-            return false;
+            return {};
         }
 
         auto tileIter = std::find_if(this->_tiles.begin(), this->_tiles.end(),
@@ -250,93 +523,102 @@ namespace projectfarm::graphics
                                               it->GetIndexAbsolute() == indexAbsolute;
                                      });
 
-        uint16_t tileIndex {0u};
-
-        if (tileIter == this->_tiles.end())
+        if (tileIter != this->_tiles.end())
         {
-            std::shared_ptr<TileMapTile> tile {std::make_shared<TileMapTile>(1)};
+            return static_cast<uint16_t>(std::distance(this->_tiles.begin(), tileIter));
+        }
 
-            tile->SetFrame(0, tileSetId, indexAbsolute, 0);
+        std::shared_ptr<TileMapTile> tile {std::make_shared<TileMapTile>(1)};
 
-            this->_tiles.emplace_back(std::move(tile));
+        tile->SetFrame(0, tileSetId, indexAbsolute, 0);
 
-            tileIndex = static_cast<uint16_t>(this->_tiles.size() - 1);
-        }
-        else
-        {
-            tileIndex = static_cast<uint16_t>(std::distance(this->_tiles.begin(), tileIter));
-        }
-
-        this->_tileLayers[layer]->SetTile(tileX, tileY, tileIndex);
+        this->_tiles.emplace_back(std::move(tile));
 
-        return true;
+        return static_cast<uint16_t>(this->_tiles.size() - 1);
     }
 
-    bool TileMap::SetTileIndex(uint32_t layer, uint32_t tileX, uint32_t tileY,
-                               const std::vector<TileMapTileAnimationData>& animationData)
+    std::optional<uint16_t> TileMap::AddTile(const std::vector<TileMapTileAnimationData>& animationData)
     {
-        if (layer >= this->_tileLayers.size())
-        {
-            shared::api::logging::Log("Invalid tilemap layer id: " + std::to_string(layer));
-            return false;
-        }
-
-        auto& tileMapLayer = this->_tileLayers[layer];
-
         auto tileIter = std::find_if(this->_tiles.begin(), this->_tiles.end(),
-                                     [animationData](const auto& it)
+                                     [&animationData](const auto& it)
                                      {
                                          return *it == animationData;
                                      });
 
-        uint16_t tileIndex {0u};
+        if (tileIter != this->_tiles.end())
+        {
+            return static_cast<uint16_t>(std::distance(this->_tiles.begin(), tileIter));
+        }
+
+        auto tile = std::make_shared<TileMapTile>(static_cast<uint32_t>(animationData.size()));
 
-        if (tileIter == this->_tiles.end())
+        auto frame = 0u;
+        for (const auto& data : animationData)
         {
-            auto tile = std::make_shared<TileMapTile>(static_cast<uint32_t>(animationData.size()));
+            auto tileSetId = data.GetTileSetId();
 
-            auto frame = 0u;
-            for (const auto& data : animationData)
+            if (this->_tileSets.count(tileSetId) <= 0)
             {
-                auto tileSetId = data.GetTileSetId();
+                shared::api::logging::Log("Failed to find tile set with id: " + std::to_string(data.GetTileSetId()));
+                return {};
+            }
 
-                if (this->_tileSets.count(tileSetId) <= 0)
-                {
-                    shared::api::logging::Log("Failed to find tile set with id: " + std::to_string(data.GetTileSetId()));
-                    return false;
-                }
+            if (!this->_tileSets[tileSetId]->IsAbsoluteIndexValid(data.GetIndexAbsolute()))
+            {
+                shared::api::logging::Log("Invalid absolute index: " + std::to_string(data.GetIndexAbsolute()) +
+                                 " for tileset: " + std::to_string(data.GetTileSetId()));
+                return {};
+            }
 
-                if (!this->_tileSets[tileSetId]->IsAbsoluteIndexValid(data.GetIndexAbsolute()))
-                {
-                    shared::api::logging::Log("Invalid absolute index: " + std::to_string(data.GetIndexAbsolute()) +
-                                     " for tileset: " + std::to_string(data.GetTileSetId()));
-                    return false;
-                }
+            if (frame >= tile->GetNumberOfFrames())
+            {
+                shared::api::logging::Log("Frame: " + std::to_string(frame) +
+                                 " is greater than number of frames in tile: " + std::to_string(tile->GetNumberOfFrames()));
+                return {};
+            }
 
-                if (frame >= tile->GetNumberOfFrames())
-                {
-                    shared::api::logging::Log("Frame: " + std::to_string(frame) +
-                                     " is greater than number of frames in tile: " + std::to_string(tile->GetNumberOfFrames()));
-                    return false;
-                }
+            tile->SetFrame(frame++, data.GetTileSetId(), data.GetIndexAbsolute(), data.GetMilliseconds());
+        }
 
-                tile->SetFrame(frame++, data.GetTileSetId(), data.GetIndexAbsolute(), data.GetMilliseconds());
-            }
+        this->_tiles.emplace_back(std::move(tile));
 
-            this->_tiles.emplace_back(std::move(tile));
+        auto tileIndex = static_cast<uint16_t>(this->_tiles.size() - 1);
 
-            tileIndex = static_cast<uint16_t>(this->_tiles.size() - 1);
+        this->_animatedTileIndexes.push_back(tileIndex);
 
-            this->_animatedTileIndexes.push_back(tileIndex);
-        }
-        else
+        return tileIndex;
+    }
+
+    void TileMap::SetTiles(uint8_t layerIndex, uint32_t tileX, uint32_t tileY,
+                           uint32_t width, uint32_t height, const uint16_t* tileIndexes) noexcept
+    {
+        auto& layer = this->_tileLayers[layerIndex];
+
+        for (auto y = 0u; y < height; ++y)
         {
-            tileIndex = static_cast<uint16_t>(std::distance(this->_tiles.begin(), tileIter));
+            for (auto x = 0u; x < width; ++x)
+            {
+                layer->SetTile(tileX + x, tileY + y, tileIndexes[y * width + x]);
+            }
         }
 
-        tileMapLayer->SetTile(tileX, tileY, tileIndex);
+        this->SetChunksDirty(layerIndex, tileX, tileY, width, height);
+    }
 
-        return true;
+    void TileMap::ClearTiles(uint8_t layerIndex, uint32_t tileX, uint32_t tileY,
+                             uint32_t width, uint32_t height) noexcept
+    {
+        auto& layer = this->_tileLayers[layerIndex];
+
+        for (auto y = 0u; y < height; ++y)
+        {
+            for (auto x = 0u; x < width; ++x)
+            {
+                layer->SetTile(tileX + x, tileY + y, TileMap::EmptyTileIndex);
+            }
+        }
+
+        this->SetChunksDirty(layerIndex, tileX, tileY, width, height);
     }
 
     bool TileMap::LoadTileSet(const nlohmann::json& tileSetJson)
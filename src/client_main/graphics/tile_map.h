@@ -5,6 +5,7 @@
 #include <memory>
 #include <map>
 #include <unordered_map>
+#include <optional>
 #include <nlohmann/json.hpp>
 
 #include "time/consume_timer.h"
@@ -14,6 +15,8 @@
 #include "graphics/texture.h"
 #include "data/consume_data_provider.h"
 #include "tile_set.h"
+#include "tile_map_chunk.h"
+#include "graphics/tile_mesh_builder.h"
 
 namespace projectfarm::graphics
 {
@@ -58,11 +61,23 @@ namespace projectfarm::graphics
         [[nodiscard]] bool SetTileIndex(uint32_t layer, uint32_t tileX, uint32_t tileY,
                                         const std::vector<TileMapTileAnimationData>& animationData);
 
-        void SetTileSize(uint32_t tileWidth, uint32_t tileHeight) noexcept
-        {
-            this->_tileWidth = tileWidth;
-            this->_tileHeight = tileHeight;
-        }
+        // returns the index of the tile, adding it if it does not exist, which can be passed to `SetTiles`
+        [[nodiscard]] std::optional<uint16_t> AddTile(uint8_t tileSetId, uint32_t indexAbsolute);
+        [[nodiscard]] std::optional<uint16_t> AddTile(const std::vector<TileMapTileAnimationData>& animationData);
+
+        // `tileIndexes` is `width` * `height` tile indexes in row order
+        void SetTiles(uint8_t layerIndex, uint32_t tileX, uint32_t tileY,
+                      uint32_t width, uint32_t height, const uint16_t* tileIndexes) noexcept;
+
+        void ClearTiles(uint8_t layerIndex, uint32_t tileX, uint32_t tileY,
+                        uint32_t width, uint32_t height) noexcept;
+
+        void SetTileSize(uint32_t tileWidth, uint32_t tileHeight) noexcept;
+
+        // Draws the layers from meshes kept for each chunk, which are only rebuilt when their
+        // tiles change, rather than a tile at a time each frame. For maps that mostly don't
+        // change, such as islands.
+        void SetUseStaticChunks(bool useStaticChunks) noexcept;
 
         const std::shared_ptr<TileMapTile>& GetTile(uint8_t tileIndex) const noexcept
         {
@@ -107,10 +122,42 @@ namespace projectfarm::graphics
 
         std::vector<uint16_t> _animatedTileIndexes;
 
+        // no larger than the smallest maximum viewport OpenGL ES allows, as a chunk is drawn to its own viewport
+        static constexpr uint32_t MaxChunkSizeInPixels {2048u};
+        static constexpr uint32_t MaxChunkSizeInTiles {16u};
+
+        bool _useStaticChunks {false};
+
+        uint32_t _chunkSizeInTiles {MaxChunkSizeInTiles};
+        uint32_t _widthInChunks {0};
+        uint32_t _heightInChunks {0};
+
+        // by layer, then row, then column
+        std::vector<std::unique_ptr<TileMapChunk>> _chunks;
+
+        shared::graphics::TileChunkMeshBuilder _chunkBuilder;
+        std::vector<std::shared_ptr<Texture>> _chunkTextures;
+
         [[nodiscard]] bool LoadTileSet(const nlohmann::json& tileSetJson);
         [[nodiscard]] bool LoadTile(const nlohmann::json& tile);
 
         void RenderLayer(uint8_t layerIndex) noexcept;
+        void RenderLayerChunks(uint8_t layerIndex, uint32_t renderLayer) noexcept;
+
+        void RenderTile(uint8_t layerIndex, uint32_t tileX, uint32_t tileY, uint32_t renderLayer) noexcept;
+
+        void ResetChunks() noexcept;
+        void SetChunksDirty() noexcept;
+        void SetChunksDirty(uint8_t layerIndex, uint32_t tileX, uint32_t tileY,
+                            uint32_t width, uint32_t height) noexcept;
+
+        [[nodiscard]]
+        TileMapChunk& GetChunk(uint8_t layerIndex, uint32_t chunkX, uint32_t chunkY) noexcept
+        {
+            return *this->_chunks[(layerIndex * this->_heightInChunks + chunkY) * this->_widthInChunks + chunkX];
+        }
+
+        void BuildChunk(uint8_t layerIndex, uint32_t chunkX, uint32_t chunkY, TileMapChunk& chunk) noexcept;
     };
 }
 
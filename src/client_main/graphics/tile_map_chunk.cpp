@@ -0,0 +1,97 @@
+#include "tile_map_chunk.h"
+
+namespace projectfarm::graphics
+{
+    void TileMapChunk::Upload(const shared::graphics::TileChunkMeshBuilder& builder,
+                              const std::vector<std::shared_ptr<Texture>>& textures) noexcept
+    {
+        auto numberOfMeshes = builder.GetNumberOfMeshes();
+
+        while (this->_meshes.size() > numberOfMeshes)
+        {
+            TileMapChunk::DestroyMesh(this->_meshes.back());
+            this->_meshes.pop_back();
+        }
+
+        // the buffer objects are reused, as a chunk usually has the same textures when it changes
+        while (this->_meshes.size() < numberOfMeshes)
+        {
+            TileMapChunk::CreateMesh(this->_meshes.emplace_back());
+        }
+
+        for (auto i = 0u; i < numberOfMeshes; ++i)
+        {
+            const auto& data = builder.GetMesh(i);
+            auto& mesh = this->_meshes[i];
+
+            mesh.TileSetTexture = textures[builder.GetTextureKey(i)];
+            mesh.NumberOfIndexes = static_cast<GLsizei>(data.Indexes.size());
+
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.VertexBOId);
+            glBufferData(GL_ARRAY_BUFFER, data.Positions.size() * sizeof(GLfloat),
+                         data.Positions.data(), GL_STATIC_DRAW);
+
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.TextureBOId);
+            glBufferData(GL_ARRAY_BUFFER, data.TextureCoordinates.size() * sizeof(GLfloat),
+                         data.TextureCoordinates.data(), GL_STATIC_DRAW);
+
+            // the index buffer is part of the vertex array's state
+            glBindVertexArray(mesh.VaoId);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.IndexBOId);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, data.Indexes.size() * sizeof(GLuint),
+                         data.Indexes.data(), GL_STATIC_DRAW);
+            glBindVertexArray(0);
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        this->_numberOfTiles = builder.GetNumberOfTiles();
+    }
+
+    void TileMapChunk::Destroy() noexcept
+    {
+        for (auto& mesh : this->_meshes)
+        {
+            TileMapChunk::DestroyMesh(mesh);
+        }
+
+        this->_meshes.clear();
+        this->_animatedTiles.clear();
+
+        this->_numberOfTiles = 0;
+        this->_isDirty = true;
+    }
+
+    void TileMapChunk::CreateMesh(TileMapChunkMesh& mesh) noexcept
+    {
+        glGenVertexArrays(1, &mesh.VaoId);
+        glGenBuffers(1, &mesh.VertexBOId);
+        glGenBuffers(1, &mesh.TextureBOId);
+        glGenBuffers(1, &mesh.IndexBOId);
+
+        // the same layout as `TilingMesh`, so the tile materials can draw either
+        glBindVertexArray(mesh.VaoId);
+
+        glBindBuffer(GL_ARRAY_BUFFER, mesh.VertexBOId);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), nullptr);
+
+        glBindBuffer(GL_ARRAY_BUFFER, mesh.TextureBOId);
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), nullptr);
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.IndexBOId);
+
+        glBindVertexArray(0);
+    }
+
+    void TileMapChunk::DestroyMesh(TileMapChunkMesh& mesh) noexcept
+    {
+        glDeleteVertexArrays(1, &mesh.VaoId);
+        glDeleteBuffers(1, &mesh.VertexBOId);
+        glDeleteBuffers(1, &mesh.TextureBOId);
+        glDeleteBuffers(1, &mesh.IndexBOId);
+
+        mesh = {};
+    }
+}
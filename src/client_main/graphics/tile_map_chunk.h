@@ -0,0 +1,100 @@
+#ifndef PROJECTFARM_TILE_MAP_CHUNK_H
+#define PROJECTFARM_TILE_MAP_CHUNK_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <utility>
+
+#include "graphics_dependencies.h"
+#include "texture.h"
+#include "graphics/tile_mesh_builder.h"
+
+namespace projectfarm::graphics
+{
+    struct TileMapChunkMesh
+    {
+        std::shared_ptr<Texture> TileSetTexture;
+
+        GLuint VaoId {0};
+        GLuint VertexBOId {0};
+        GLuint TextureBOId {0};
+        GLuint IndexBOId {0};
+
+        GLsizei NumberOfIndexes {0};
+    };
+
+    // The meshes of a chunk of one tile map layer, which are kept on the GPU and only
+    // uploaded again when the chunk's tiles change
+    class TileMapChunk final
+    {
+    public:
+        TileMapChunk() = default;
+        ~TileMapChunk()
+        {
+            this->Destroy();
+        }
+
+        TileMapChunk(const TileMapChunk&) = delete;
+        TileMapChunk(TileMapChunk&&) = delete;
+
+        // `textures` are indexed by the builder's texture keys
+        void Upload(const shared::graphics::TileChunkMeshBuilder& builder,
+                    const std::vector<std::shared_ptr<Texture>>& textures) noexcept;
+
+        void Destroy() noexcept;
+
+        [[nodiscard]]
+        const std::vector<TileMapChunkMesh>& GetMeshes() const noexcept
+        {
+            return this->_meshes;
+        }
+
+        [[nodiscard]]
+        uint32_t GetNumberOfTiles() const noexcept
+        {
+            return this->_numberOfTiles;
+        }
+
+        [[nodiscard]]
+        bool IsDirty() const noexcept
+        {
+            return this->_isDirty;
+        }
+
+        void SetIsDirty(bool isDirty) noexcept
+        {
+            this->_isDirty = isDirty;
+        }
+
+        // animated tiles aren't in the meshes, as they change too often, so are drawn a tile at a time
+        [[nodiscard]]
+        const std::vector<std::pair<uint32_t, uint32_t>>& GetAnimatedTiles() const noexcept
+        {
+            return this->_animatedTiles;
+        }
+
+        void ClearAnimatedTiles() noexcept
+        {
+            this->_animatedTiles.clear();
+        }
+
+        void AddAnimatedTile(uint32_t tileX, uint32_t tileY) noexcept
+        {
+            this->_animatedTiles.emplace_back(tileX, tileY);
+        }
+
+    private:
+        std::vector<TileMapChunkMesh> _meshes;
+        std::vector<std::pair<uint32_t, uint32_t>> _animatedTiles;
+
+        uint32_t _numberOfTiles {0};
+
+        bool _isDirty {true};
+
+        static void CreateMesh(TileMapChunkMesh& mesh) noexcept;
+        static void DestroyMesh(TileMapChunkMesh& mesh) noexcept;
+    };
+}
+
+#endif
@@ -1,5 +1,4 @@
 #include <nlohmann/json.hpp>
-#include <fstream>
 
 #include "tile_set.h"
 #include "api/logging/logging.h"
@@ -8,17 +7,15 @@ namespace projectfarm::graphics
 {
     bool TileSet::Load(const std::filesystem::path& filePath)
     {
-        std::ifstream file(filePath);
+        auto json = this->_dataProvider->LoadJsonAsset(filePath);
 
-        if (!file.is_open())
+        if (!json)
         {
             shared::api::logging::Log("Failed to open tileset file: " + filePath.u8string());
             return false;
         }
 
-        nlohmann::json jsonFile;
-
-        file >> jsonFile;
+        auto& jsonFile = *json;
 
         auto name = jsonFile["name"].get<std::string>();
         auto imagePathString = jsonFile["imagePath"].get<std::string>();
@@ -50,12 +47,31 @@ namespace projectfarm::graphics
 
         this->_texture->SetGraphics(this->GetGraphics());
 
+        if (this->_atlasEntry)
+        {
+            if (!this->_texture->Load(this->_atlasEntry->PageTextureName))
+            {
+                shared::api::logging::Log("Failed to load tileset atlas page: " + this->_atlasEntry->PageTextureName);
+                return false;
+            }
+
+            this->_imageX = this->_atlasEntry->X;
+            this->_imageY = this->_atlasEntry->Y;
+            this->_imageHeight = this->_atlasEntry->Height;
+
+            return true;
+        }
+
         if (!this->_texture->Load(imagePath))
         {
             shared::api::logging::Log("Failed to load tileset texture: " + imagePath.string());
             return false;
         }
 
+        this->_imageX = 0;
+        this->_imageY = 0;
+        this->_imageHeight = this->_texture->GetTextureHeight();
+
         return true;
     }
 
@@ -68,16 +84,29 @@ namespace projectfarm::graphics
                                          targetTileWidth, targetTileHeight,
                                          RenderOriginPoints::TopLeft);
 
-        auto [tileX, tileY] = this->GetXYFromAbsoluteIndex(index);
+        auto source = this->GetTileSource(index);
 
-        this->_texture->SetOriginDetails(tileX * this->_tileWidth, tileY * this->_tileHeight,
-                                         this->_tileWidth, this->_tileHeight);
+        this->_texture->SetOriginDetails(static_cast<uint32_t>(source.x), static_cast<uint32_t>(source.y),
+                                         static_cast<uint32_t>(source.w), static_cast<uint32_t>(source.h));
 
         this->_texture->SetRenderToWorldSpace(renderToWorldSpace);
 
         this->_texture->Render(renderLayerIndex);
     }
 
+    SDL_Rect TileSet::GetTileSource(uint32_t index) const noexcept
+    {
+        auto [tileX, tileY] = this->GetXYFromAbsoluteIndex(index);
+
+        return
+        {
+            static_cast<int>(this->_imageX + tileX * this->_tileWidth),
+            static_cast<int>(this->_imageY + tileY * this->_tileHeight),
+            static_cast<int>(this->_tileWidth),
+            static_cast<int>(this->_tileHeight),
+        };
+    }
+
     void TileSet::Shutdown()
     {
         this->_texture->Destroy();
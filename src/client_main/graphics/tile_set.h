@@ -3,10 +3,12 @@
 
 #include <filesystem>
 #include <tuple>
+#include <optional>
 
 #include "data/consume_data_provider.h"
 #include "consume_graphics.h"
 #include "texture.h"
+#include "tile_set_atlas.h"
 
 namespace projectfarm::graphics
 {
@@ -17,6 +19,12 @@ namespace projectfarm::graphics
         TileSet() = default;
         ~TileSet() override = default;
 
+        // when set, the tile set is loaded from its place in the atlas instead of its own image
+        void SetAtlasEntry(std::optional<TileSetAtlasEntry> atlasEntry) noexcept
+        {
+            this->_atlasEntry = std::move(atlasEntry);
+        }
+
         [[nodiscard]] bool Load(const std::filesystem::path& filePath);
         [[nodiscard]] bool LoadDirect(const std::string& name,
                                       const std::filesystem::path& imagePath,
@@ -28,6 +36,14 @@ namespace projectfarm::graphics
                         bool renderToWorldSpace,
                         uint32_t renderLayerIndex);
 
+        // where tile `index` is in the texture, in pixels
+        [[nodiscard]] SDL_Rect GetTileSource(uint32_t index) const noexcept;
+
+        [[nodiscard]] const std::shared_ptr<Texture>& GetTexture() const noexcept
+        {
+            return this->_texture;
+        }
+
         [[nodiscard]] std::string GetName() const noexcept
         {
             return this->_name;
@@ -51,7 +67,7 @@ namespace projectfarm::graphics
             auto [x, y] = this->GetXYFromAbsoluteIndex(absoluteIndex);
 
             return x < this->_numberOfColumns &&
-                   y < (this->_texture->GetTextureHeight() / this->_tileHeight);
+                   y < (this->_imageHeight / this->_tileHeight);
         }
 
     private:
@@ -63,6 +79,13 @@ namespace projectfarm::graphics
         uint32_t _tileWidth {0};
         uint32_t _tileHeight {0};
 
+        std::optional<TileSetAtlasEntry> _atlasEntry;
+
+        // where the image is in the texture, which is not at the origin in an atlas
+        uint32_t _imageX {0};
+        uint32_t _imageY {0};
+        uint32_t _imageHeight {0};
+
         void Shutdown();
 
         friend class TileSetPool;
@@ -0,0 +1,156 @@
+#include <future>
+#include <unordered_map>
+
+#include "tile_set_atlas.h"
+#include "graphics.h"
+#include "data/cooked_asset.h"
+#include "data/data_provider_locations.h"
+#include "api/logging/logging.h"
+
+namespace projectfarm::graphics
+{
+    bool TileSetAtlas::Load()
+    {
+        this->Unload();
+
+        const auto& texturePool = this->GetGraphics()->GetTexturePool();
+
+        std::unordered_map<std::string, std::shared_future<shared::graphics::DecodedImagePtr>> requests;
+
+        // start every decode before waiting for any of them
+        for (const auto& [name, filePath] : this->_dataProvider->GetTileSetLocations())
+        {
+            auto json = this->_dataProvider->LoadJsonAsset(filePath);
+            if (!json || !json->contains("imagePath"))
+            {
+                shared::api::logging::Log("Failed to load tileset file for the atlas: " + filePath.u8string());
+                return false;
+            }
+
+            auto imagePath = this->_dataProvider->NormalizePath((*json)["imagePath"].get<std::string>());
+
+            requests[name] = texturePool->RequestDecode(imagePath.u8string());
+        }
+
+        std::unordered_map<std::string, shared::graphics::DecodedImagePtr> images;
+        std::vector<shared::graphics::AtlasImage> atlasImages;
+
+        for (const auto& [name, request] : requests)
+        {
+            auto image = request.get();
+            if (!image)
+            {
+                shared::api::logging::Log("Failed to decode tileset image for the atlas: " + name);
+                return false;
+            }
+
+            images[name] = image;
+            atlasImages.push_back({ name, image->Width, image->Height });
+        }
+
+        if (!this->LoadLayout(atlasImages))
+        {
+            return false;
+        }
+
+        for (auto i = 0u; i < this->_layout.GetPages().size(); ++i)
+        {
+            auto pageImage = shared::graphics::ComposeAtlasPage(this->_layout, i, images);
+            if (!pageImage)
+            {
+                shared::api::logging::Log("Failed to compose tileset atlas page: " + std::to_string(i));
+                this->Unload();
+                return false;
+            }
+
+            auto pageName = TileSetAtlas::GetPageTextureName(i);
+
+            if (texturePool->CreateFromImage(pageName, *pageImage).TextureId == 0)
+            {
+                this->Unload();
+                return false;
+            }
+
+            auto page = std::make_shared<Texture>();
+            page->SetGraphics(this->GetGraphics());
+
+            if (!page->Load(pageName))
+            {
+                shared::api::logging::Log("Failed to load tileset atlas page: " + pageName);
+                this->Unload();
+                return false;
+            }
+
+            this->_pages.push_back(page);
+        }
+
+        shared::api::logging::Log("Packed " + std::to_string(images.size()) + " tileset(s) into " +
+                                  std::to_string(this->_pages.size()) + " atlas page(s).");
+
+        return true;
+    }
+
+    void TileSetAtlas::Unload()
+    {
+        for (auto& page : this->_pages)
+        {
+            page->Destroy();
+        }
+
+        this->_pages.clear();
+        this->_layout.Clear();
+    }
+
+    std::optional<TileSetAtlasEntry> TileSetAtlas::Find(const std::string& tileSetName) const noexcept
+    {
+        // the layout may be loaded without its pages
+        if (this->_pages.empty())
+        {
+            return {};
+        }
+
+        const auto* entry = this->_layout.Find(tileSetName);
+        if (!entry)
+        {
+            return {};
+        }
+
+        return TileSetAtlasEntry
+        {
+            TileSetAtlas::GetPageTextureName(entry->Page),
+            entry->X, entry->Y,
+            entry->Width, entry->Height,
+        };
+    }
+
+    bool TileSetAtlas::LoadLayout(const std::vector<shared::graphics::AtlasImage>& images)
+    {
+        auto layoutFilePath = this->_dataProvider->ResolveFileName(shared::DataProviderLocations::ClientTileSets,
+                                                                   shared::graphics::TileSetAtlasLayoutFileName);
+
+        if (this->_dataProvider->FileExists(shared::GetCookedAssetPath(layoutFilePath)))
+        {
+            auto json = this->_dataProvider->LoadJsonAsset(layoutFilePath);
+
+            if (json && this->_layout.FromJson(*json) && this->_layout.Matches(images))
+            {
+                return true;
+            }
+
+            shared::api::logging::Log("The cooked tileset atlas layout is out of date. Building the layout...");
+        }
+
+        if (!this->_layout.Build(images))
+        {
+            shared::api::logging::Log("Failed to build the tileset atlas layout.");
+            return false;
+        }
+
+        return true;
+    }
+
+    std::string TileSetAtlas::GetPageTextureName(uint32_t pageIndex)
+    {
+        return "tileset_atlas_page_" + std::to_string(pageIndex);
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef PROJECTFARM_TILE_SET_ATLAS_H
+#define PROJECTFARM_TILE_SET_ATLAS_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <optional>
+
+#include "consume_graphics.h"
+#include "data/consume_data_provider.h"
+#include "graphics/texture_atlas.h"
+#include "texture.h"
+
+namespace projectfarm::graphics
+{
+    struct TileSetAtlasEntry
+    {
+        // the name of the page in the texture pool
+        std::string PageTextureName;
+
+        uint32_t X {0};
+        uint32_t Y {0};
+        uint32_t Width {0};
+        uint32_t Height {0};
+    };
+
+    // Every tile set, including the character appearance sprites, packed into a few
+    // large textures, so tiles from different tile sets can be drawn together. The
+    // layout is written by the asset cooker, or built here if there is no cooked
+    // layout or it is out of date.
+    class TileSetAtlas final : public ConsumeGraphics,
+                               public shared::ConsumeDataProvider
+    {
+    public:
+        TileSetAtlas() = default;
+        ~TileSetAtlas() override = default;
+
+        // if this fails, tile sets use their own textures
+        [[nodiscard]]
+        bool Load();
+
+        void Unload();
+
+        [[nodiscard]]
+        std::optional<TileSetAtlasEntry> Find(const std::string& tileSetName) const noexcept;
+
+        [[nodiscard]]
+        uint32_t GetNumberOfPages() const noexcept
+        {
+            return static_cast<uint32_t>(this->_pages.size());
+        }
+
+    private:
+        shared::graphics::TextureAtlasLayout _layout;
+
+        // keeps the pages in the texture pool
+        std::vector<std::shared_ptr<Texture>> _pages;
+
+        [[nodiscard]]
+        bool LoadLayout(const std::vector<shared::graphics::AtlasImage>& images);
+
+        [[nodiscard]]
+        static std::string GetPageTextureName(uint32_t pageIndex);
+    };
+}
+
+#endif
@@ -5,6 +5,14 @@
 
 namespace projectfarm::graphics
 {
+    bool TileSetPool::LoadAtlas()
+    {
+        this->_atlas->SetGraphics(this->GetGraphics());
+        this->_atlas->SetDataProvider(this->_dataProvider);
+
+        return this->_atlas->Load();
+    }
+
     std::shared_ptr<TileSet> TileSetPool::Get(const std::string& name)
     {
         if (this->_items.count(name) == 0)
@@ -12,6 +20,7 @@ namespace projectfarm::graphics
             auto tileSet = std::make_shared<graphics::TileSet>();
             tileSet->SetGraphics(this->GetGraphics());
             tileSet->SetDataProvider(this->_dataProvider);
+            tileSet->SetAtlasEntry(this->_atlas->Find(name));
 
             auto tileSetPath = this->_dataProvider->GetTileSetPathFromName(name);
 
@@ -53,4 +62,11 @@ namespace projectfarm::graphics
     {
         this->_items.clear();
     }
+
+    void TileSetPool::Shutdown()
+    {
+        this->Empty();
+
+        this->_atlas->Unload();
+    }
 }
\ No newline at end of file
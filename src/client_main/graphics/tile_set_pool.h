@@ -6,6 +6,7 @@
 #include <unordered_map>
 
 #include "tile_set_pool_data.h"
+#include "tile_set_atlas.h"
 #include "consume_graphics.h"
 #include "data/consume_data_provider.h"
 
@@ -17,18 +18,37 @@ namespace projectfarm::graphics
                               public shared::ConsumeDataProvider
     {
     public:
-        TileSetPool() = default;
+        TileSetPool()
+        {
+            this->_atlas = std::make_shared<TileSetAtlas>();
+        }
+
         ~TileSetPool() override = default;
 
+        // tile sets loaded after this are drawn from the atlas
+        [[nodiscard]]
+        bool LoadAtlas();
+
+        [[nodiscard]]
+        const std::shared_ptr<TileSetAtlas>& GetAtlas() const noexcept
+        {
+            return this->_atlas;
+        }
+
         [[nodiscard]]
         std::shared_ptr<TileSet> Get(const std::string& name);
 
         void Release(const std::string& name);
 
+        // the atlas is kept, as it has every tile set
         void Empty();
 
+        void Shutdown();
+
     private:
         std::unordered_map<std::string, TileSetPoolData> _items;
+
+        std::shared_ptr<TileSetAtlas> _atlas;
     };
 }
 
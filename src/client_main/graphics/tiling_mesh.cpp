@@ -61,161 +61,203 @@ namespace projectfarm::graphics
 
     uint32_t TilingMesh::Render()
     {
-        auto numberOfMeshesRendered {0u};
+        this->_commands.Clear();
+        this->_draws.clear();
 
-        for (const auto&[_, renderLayer] : this->_meshMap)
+        for (const auto&[renderLayerIndex, chunks] : this->_chunkMap)
         {
-            for (const auto&[__, textureMap] : renderLayer)
+            for (const auto& details : chunks)
             {
-                if (!textureMap._texture)
+                for (const auto& mesh : details._chunk->GetMeshes())
+                {
+                    this->AddDraw(renderLayerIndex, TilingMesh::ChunkOrder, mesh.TileSetTexture,
+                                  {mesh.TileSetTexture.get(), nullptr, &details, &mesh});
+                }
+            }
+        }
+
+        for (const auto&[renderLayerIndex, renderLayer] : this->_meshMap)
+        {
+            for (const auto&[_, layerDetails] : renderLayer)
+            {
+                if (!layerDetails._texture)
                 {
                     // this must be a buffered element not used in this frame
                     continue;
                 }
 
-                const auto& verticies = textureMap._vertexData;
-                const auto& textureCoordinates = textureMap._textureCoordinateData;
-                const auto& indicies = textureMap._indexData;
-                const auto& texture = textureMap._texture;
-
-                auto materialName = texture->GetMaterialName();
-                this->GetGraphics()->BindMaterial(materialName);
+                this->AddDraw(renderLayerIndex, TilingMesh::TileOrder, layerDetails._texture,
+                              {layerDetails._texture.get(), &layerDetails, nullptr, nullptr});
+            }
+        }
 
-                auto material = this->GetGraphics()->GetCurrentlyBoundMaterial();
-                material->SetColor(texture->GetColor());
+        this->_commands.Sort();
 
-                glBindBuffer(GL_ARRAY_BUFFER, this->_vertexBOId[this->_currentBufferIndex]);
-                glBufferData(GL_ARRAY_BUFFER, verticies.size() * sizeof(GLfloat), &verticies[0], GL_DYNAMIC_DRAW);
+        auto statistics = this->_commands.Submit(*this);
 
-                glBindBuffer(GL_ARRAY_BUFFER, this->_textureBOId[this->_currentBufferIndex]);
-                glBufferData(GL_ARRAY_BUFFER, textureCoordinates.size() * sizeof(GLfloat), &textureCoordinates[0], GL_DYNAMIC_DRAW);
+        glBindVertexArray(0);
 
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->_indexBOId[this->_currentBufferIndex]);
-                glBufferData(GL_ELEMENT_ARRAY_BUFFER, indicies.size() * sizeof(GLushort), &indicies[0], GL_DYNAMIC_DRAW);
+        if (this->_viewportChunk)
+        {
+            const auto& viewport = this->GetGraphics()->GetCamera()->GetViewport();
+            glViewport(0, 0, viewport.w, viewport.h);
 
-                texture->Bind();
+            this->_viewportChunk = nullptr;
+        }
 
-                glBindVertexArray(this->_vaoId[this->_currentBufferIndex]);
+        this->_lastNumberOfRenderLayers = statistics.RenderLayers;
 
-                glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indicies.size()), GL_UNSIGNED_SHORT, nullptr);
+        return statistics.Draws;
+    }
 
-                glBindVertexArray(0);
+    void TilingMesh::AddDraw(uint32_t renderLayerIndex, uint8_t order,
+                             const std::shared_ptr<Texture>& texture, const DrawDetails& draw)
+    {
+        // a material that didn't load fails the graphics loading, so this is only a texture's typo
+        auto materialId = this->GetGraphics()->GetMaterialId(texture->GetMaterialName());
+        if (!materialId)
+        {
+            return;
+        }
 
-                ++numberOfMeshesRendered;
+        shared::graphics::RenderCommand command;
+        command.RenderLayer = renderLayerIndex;
+        command.Order = order;
+        command.MaterialId = *materialId;
+        command.TextureId = texture->GetTextureId();
+        command.Color = texture->GetColor().ToInt();
+        command.DrawIndex = static_cast<uint32_t>(this->_draws.size());
 
-                // double buffer the buffer objects
-                this->_currentBufferIndex++;
-                if (this->_currentBufferIndex >= NumberOfBuffers)
-                {
-                    this->_currentBufferIndex = 0;
-                }
-            }
-        }
+        this->_draws.push_back(draw);
+        this->_commands.Add(command);
+    }
 
-        return numberOfMeshesRendered;
+    void TilingMesh::BindMaterial(const shared::graphics::RenderCommand& command) noexcept
+    {
+        this->GetGraphics()->BindMaterial(command.MaterialId);
     }
 
-    void TilingMesh::ClearRender()
+    void TilingMesh::BindTexture(const shared::graphics::RenderCommand& command) noexcept
     {
-        glBindVertexArray(0);
+        this->_draws[command.DrawIndex]._texture->Bind();
     }
 
-    void TilingMesh::AddTileData(const std::shared_ptr<Texture>& texture,
-                                 float sx, float sy, float sw, float sh,
-                                 float dx, float dy, float dw, float dh,
-                                 uint32_t screenWidth, uint32_t screenHeight,
-                                 uint32_t renderLayer)
+    void TilingMesh::SetColor(const shared::graphics::RenderCommand& command) noexcept
     {
-        if (!texture)
+        const auto& material = this->GetGraphics()->GetCurrentlyBoundMaterial();
+        if (material)
         {
-            shared::api::logging::Log("Null texture.");
-            return;
+            material->SetColor(this->_draws[command.DrawIndex]._texture->GetColor());
         }
+    }
 
-        // -1  1    1  1
-        // -1 -1    1 -1
-
-        // get the position data between 0..1
-        GLfloat normalizedW = 1.0f / screenWidth * dw;
-        GLfloat normalizedH = 1.0f / screenHeight * dh;
-
-        GLfloat leftX = 1.0f / screenWidth * dx;
-        GLfloat topY = 1.0f - (1.0f / screenHeight * dy);
+    void TilingMesh::Draw(const shared::graphics::RenderCommand& command) noexcept
+    {
+        const auto& draw = this->_draws[command.DrawIndex];
 
-        GLfloat rightX = leftX + normalizedW;
-        GLfloat bottomY = topY - normalizedH;
+        if (draw._chunk)
+        {
+            this->DrawChunkMesh(*draw._chunk, *draw._chunkMesh);
+        }
+        else
+        {
+            this->DrawMesh(*draw._layer);
+        }
+    }
 
-        // get into screen space -1..1
-        GLfloat ssLeftX = (leftX * 2.0f) - 1.0f;
-        GLfloat ssRightX = (rightX * 2.0f) - 1.0f;
+    void TilingMesh::DrawMesh(const LayerDetails& layerDetails) noexcept
+    {
+        if (this->_viewportChunk)
+        {
+            const auto& viewport = this->GetGraphics()->GetCamera()->GetViewport();
+            glViewport(0, 0, viewport.w, viewport.h);
 
-        GLfloat ssTopY = (topY * 2.0f) - 1.0f;
-        GLfloat ssBottomY = (bottomY * 2.0f) - 1.0f;
+            this->_viewportChunk = nullptr;
+        }
 
-        // normalize the texture coords
-        GLfloat normalizedTextureX = sx / texture->GetTextureWidth();
-        GLfloat normalizedTextureY = sy / texture->GetTextureHeight();
+        const auto& verticies = layerDetails._meshData.Positions;
+        const auto& textureCoordinates = layerDetails._meshData.TextureCoordinates;
+        const auto& indicies = layerDetails._meshData.Indexes;
 
-        GLfloat normalizedTextureW = sw / texture->GetTextureWidth();
-        GLfloat normalizedTextureH = sh / texture->GetTextureHeight();
+        // bound first, as the element buffer binding is part of whichever vertex array is bound
+        glBindVertexArray(this->_vaoId[this->_currentBufferIndex]);
 
-        GLfloat normalizedTextureX2 = normalizedTextureX + normalizedTextureW;
-        GLfloat normalizedTextureY2 = normalizedTextureY + normalizedTextureH;
+        glBindBuffer(GL_ARRAY_BUFFER, this->_vertexBOId[this->_currentBufferIndex]);
+        glBufferData(GL_ARRAY_BUFFER, verticies.size() * sizeof(GLfloat), &verticies[0], GL_DYNAMIC_DRAW);
 
-        GLuint textureId = texture->GetTextureId();
+        glBindBuffer(GL_ARRAY_BUFFER, this->_textureBOId[this->_currentBufferIndex]);
+        glBufferData(GL_ARRAY_BUFFER, textureCoordinates.size() * sizeof(GLfloat), &textureCoordinates[0], GL_DYNAMIC_DRAW);
 
-        // if textureId == 0, then we are likely rendering a solid color
-        auto& meshMap = this->_meshMap[renderLayer][textureId];
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->_indexBOId[this->_currentBufferIndex]);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indicies.size() * sizeof(GLuint), &indicies[0], GL_DYNAMIC_DRAW);
 
-        auto& verticiesMap = meshMap._vertexData;
-        auto& textureCoordinatesMap = meshMap._textureCoordinateData;
-        auto& indiciesMap = meshMap._indexData;
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indicies.size()), GL_UNSIGNED_INT, nullptr);
 
-        meshMap._texture = texture;
+        // double buffer the buffer objects
+        this->_currentBufferIndex++;
+        if (this->_currentBufferIndex >= NumberOfBuffers)
+        {
+            this->_currentBufferIndex = 0;
+        }
+    }
 
-        verticiesMap.emplace_back(ssLeftX); //CCW
-        verticiesMap.emplace_back(ssTopY);
+    void TilingMesh::DrawChunkMesh(const ChunkDetails& chunkDetails, const TileMapChunkMesh& mesh) noexcept
+    {
+        // a chunk's positions are relative to the chunk, so rather than moving each
+        // vertex by the camera, the viewport is moved to where the chunk is on the screen
+        if (this->_viewportChunk != &chunkDetails)
+        {
+            const auto& viewport = this->GetGraphics()->GetCamera()->GetViewport();
+            const auto& screenSpace = chunkDetails._screenSpace;
 
-        verticiesMap.emplace_back(ssLeftX);
-        verticiesMap.emplace_back(ssBottomY);
+            glViewport(screenSpace.x, viewport.h - (screenSpace.y + screenSpace.h), screenSpace.w, screenSpace.h);
 
-        verticiesMap.emplace_back(ssRightX);
-        verticiesMap.emplace_back(ssTopY);
+            this->_viewportChunk = &chunkDetails;
+        }
 
-        verticiesMap.emplace_back(ssRightX);
-        verticiesMap.emplace_back(ssTopY);
+        glBindVertexArray(mesh.VaoId);
 
-        verticiesMap.emplace_back(ssLeftX);
-        verticiesMap.emplace_back(ssBottomY);
+        glDrawElements(GL_TRIANGLES, mesh.NumberOfIndexes, GL_UNSIGNED_INT, nullptr);
+    }
 
-        verticiesMap.emplace_back(ssRightX);
-        verticiesMap.emplace_back(ssBottomY);
+    void TilingMesh::ClearRender()
+    {
+        glBindVertexArray(0);
+    }
 
-        textureCoordinatesMap.emplace_back(normalizedTextureX);
-        textureCoordinatesMap.emplace_back(normalizedTextureY);
+    void TilingMesh::AddTileData(const std::shared_ptr<Texture>& texture,
+                                 float sx, float sy, float sw, float sh,
+                                 float dx, float dy, float dw, float dh,
+                                 uint32_t screenWidth, uint32_t screenHeight,
+                                 uint32_t renderLayer)
+    {
+        if (!texture)
+        {
+            shared::api::logging::Log("Null texture.");
+            return;
+        }
 
-        textureCoordinatesMap.emplace_back(normalizedTextureX);
-        textureCoordinatesMap.emplace_back(normalizedTextureY2);
+        GLuint textureId = texture->GetTextureId();
 
-        textureCoordinatesMap.emplace_back(normalizedTextureX2);
-        textureCoordinatesMap.emplace_back(normalizedTextureY);
+        // if textureId == 0, then we are likely rendering a solid color
+        auto& meshMap = this->_meshMap[renderLayer][textureId];
 
-        textureCoordinatesMap.emplace_back(normalizedTextureX2);
-        textureCoordinatesMap.emplace_back(normalizedTextureY);
+        meshMap._texture = texture;
 
-        textureCoordinatesMap.emplace_back(normalizedTextureX);
-        textureCoordinatesMap.emplace_back(normalizedTextureY2);
+        meshMap._meshData.AddTile({sx, sy, sw, sh},
+                                  texture->GetTextureWidth(), texture->GetTextureHeight(),
+                                  {dx, dy, dw, dh},
+                                  screenWidth, screenHeight);
+    }
 
-        textureCoordinatesMap.emplace_back(normalizedTextureX2);
-        textureCoordinatesMap.emplace_back(normalizedTextureY2);
+    void TilingMesh::AddChunk(const TileMapChunk& chunk, const SDL_Rect& screenSpace, uint32_t renderLayerIndex)
+    {
+        if (chunk.GetMeshes().empty())
+        {
+            return;
+        }
 
-        auto size = static_cast<GLushort>(indiciesMap.size());
-        indiciesMap.emplace_back(size++); // 0 + x
-        indiciesMap.emplace_back(size++); // 1 + x
-        indiciesMap.emplace_back(size++); // 2 + x
-        indiciesMap.emplace_back(size++); // 3 + x
-        indiciesMap.emplace_back(size++); // 4 + x
-        indiciesMap.emplace_back(size); // 5 + x
+        this->_chunkMap[renderLayerIndex].push_back({&chunk, screenSpace});
     }
 
     void TilingMesh::ClearTileData()
@@ -227,10 +269,13 @@ namespace projectfarm::graphics
             for (auto&[__, subLayer] : layer)
             {
                 subLayer._texture = nullptr;
-                subLayer._vertexData.clear();
-                subLayer._textureCoordinateData.clear();
-                subLayer._indexData.clear();
+                subLayer._meshData.Clear();
             }
         }
+
+        for (auto&[_, chunks] : this->_chunkMap)
+        {
+            chunks.clear();
+        }
     }
 }
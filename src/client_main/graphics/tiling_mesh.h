@@ -6,13 +6,21 @@
 #include <map>
 #include <tuple>
 
+#include <SDL.h>
+
 #include "graphics_dependencies.h"
 #include "texture.h"
+#include "tile_map_chunk.h"
 #include "consume_graphics.h"
+#include "graphics/tile_mesh_builder.h"
+#include "graphics/render_command_buffer.h"
 
 namespace projectfarm::graphics
 {
-    class TilingMesh final : public ConsumeGraphics
+    // Draws are sorted by render layer, material, texture and color each frame,
+    // so the state is only changed when the next draw needs something else.
+    class TilingMesh final : public ConsumeGraphics,
+                             private shared::graphics::RenderBackend
     {
     public:
         TilingMesh() = default;
@@ -30,17 +38,43 @@ namespace projectfarm::graphics
                          uint32_t screenWidth, uint32_t screenHeight,
                          uint32_t renderLayerIndex);
 
+        // the chunk is drawn to `screenSpace`, and must live until the frame is rendered
+        void AddChunk(const TileMapChunk& chunk, const SDL_Rect& screenSpace, uint32_t renderLayerIndex);
+
         void ClearTileData();
 
+        [[nodiscard]]
+        uint32_t GetLastNumberOfRenderLayers() const noexcept
+        {
+            return this->_lastNumberOfRenderLayers;
+        }
+
     private:
         struct LayerDetails
         {
             std::shared_ptr<Texture> _texture;
-            std::vector<GLfloat> _vertexData;
-            std::vector<GLfloat> _textureCoordinateData;
-            std::vector<GLushort> _indexData;
+            shared::graphics::TileMeshData _meshData;
         };
 
+        struct ChunkDetails
+        {
+            const TileMapChunk* _chunk;
+            SDL_Rect _screenSpace;
+        };
+
+        // either the tiles pushed this frame, or one of a chunk's meshes
+        struct DrawDetails
+        {
+            const Texture* _texture;
+            const LayerDetails* _layer;
+            const ChunkDetails* _chunk;
+            const TileMapChunkMesh* _chunkMesh;
+        };
+
+        // a chunk's tiles are under the tiles drawn a tile at a time in the same layer
+        static constexpr uint8_t ChunkOrder {0u};
+        static constexpr uint8_t TileOrder {1u};
+
         uint8_t _currentBufferIndex {0};
         const static uint8_t NumberOfBuffers {2};
 
@@ -50,8 +84,28 @@ namespace projectfarm::graphics
         GLuint _indexBOId[NumberOfBuffers] = {0};
 
         std::map<uint32_t, std::map<uint32_t, LayerDetails>> _meshMap;
+        std::map<uint32_t, std::vector<ChunkDetails>> _chunkMap;
+
+        shared::graphics::RenderCommandBuffer _commands;
+        std::vector<DrawDetails> _draws;
+
+        // the chunk the viewport was moved to, or null if it covers the screen
+        const ChunkDetails* _viewportChunk {nullptr};
+
+        uint32_t _lastNumberOfRenderLayers {0};
 
         bool _loaded {false};
+
+        void AddDraw(uint32_t renderLayerIndex, uint8_t order,
+                     const std::shared_ptr<Texture>& texture, const DrawDetails& draw);
+
+        void BindMaterial(const shared::graphics::RenderCommand& command) noexcept override;
+        void BindTexture(const shared::graphics::RenderCommand& command) noexcept override;
+        void SetColor(const shared::graphics::RenderCommand& command) noexcept override;
+        void Draw(const shared::graphics::RenderCommand& command) noexcept override;
+
+        void DrawMesh(const LayerDetails& layerDetails) noexcept;
+        void DrawChunkMesh(const ChunkDetails& chunkDetails, const TileMapChunkMesh& mesh) noexcept;
     };
 }
 
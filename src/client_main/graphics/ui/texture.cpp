@@ -23,7 +23,8 @@ namespace projectfarm::graphics::ui
         else
         {
             auto texturePath = this->_style->Textures[this->_textureIndex];
-            if (!this->_backgroundTexture->Load(texturePath))
+            // decoded in the background, so loading a screen does not wait on every image
+            if (!this->_backgroundTexture->LoadAsync(texturePath))
             {
                 shared::api::logging::Log("Failed to load texture: " + texturePath.u8string());
                 return false;
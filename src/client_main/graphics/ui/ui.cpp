@@ -1,5 +1,3 @@
-#include <fstream>
-
 #include "ui.h"
 #include "texture.h"
 #include "label.h"
@@ -8,6 +6,8 @@
 #include "engine/game.h"
 #include "scripting/script_system.h"
 #include "api/logging/logging.h"
+#include "profiling/profiler.h"
+#include "profiling/allocation_tracker.h"
 
 using namespace std::literals;
 
@@ -41,16 +41,15 @@ namespace projectfarm::graphics::ui
         {
             auto filePath = this->_dataProvider->GetUILocationFromName(name);
 
-            std::ifstream file(filePath);
+            auto json = this->_dataProvider->LoadJsonAsset(filePath);
 
-            if (!file.is_open())
+            if (!json)
             {
                 shared::api::logging::Log("Failed to open ui file: " + filePath.u8string());
                 return false;
             }
 
-            nlohmann::json jsonFile;
-            file >> jsonFile;
+            auto& jsonFile = *json;
 
             const auto& controls = jsonFile["controls"];
 
@@ -116,6 +115,9 @@ namespace projectfarm::graphics::ui
 
 	void UI::Render() const noexcept
 	{
+        PROFILE_ZONE("UI::Render");
+        ALLOCATION_SCOPE(UI);
+
 	    this->_baseCanvas->Render();
 	}
 
@@ -12,8 +12,13 @@
 #include "networking/packets/server_client_character_set_details.h"
 #include "networking/packets/client_server_chatbox_message.h"
 #include "networking/packets/server_client_chatbox_message.h"
+#include "networking/packets/server_client_world_changes_chunk.h"
+#include "networking/packets/client_server_ping.h"
+#include "networking/packets/server_client_pong.h"
+#include "game/world/world_change_log.h"
 #include "engine/action_input_sources/action_input_source_keyboard.h"
 #include "time/clock.h"
+#include "time/monotonic_clock.h"
 #include "engine/device_capabilities.h"
 #include "graphics/screen_resolution.h"
 #include "api/logging/logging.h"
@@ -22,6 +27,16 @@ using namespace std::literals;
 
 namespace projectfarm::scenes::implemented_scenes
 {
+    namespace
+    {
+        // only compared with itself, on this client. Read rather than cached, as the
+        // round trip is often shorter than a frame
+        uint64_t GetPingTime() noexcept
+        {
+            return shared::time::MonotonicClock::ReadMicroseconds();
+        }
+    }
+
     void WorldScene::UpdateInput()
     {
         auto input = this->GetSceneManager()->GetGame()->GetKeyboardInput();
@@ -80,6 +95,14 @@ namespace projectfarm::scenes::implemented_scenes
         {
             this->HandleServerClientChatboxMessagePacket(packet);
         }
+        else if (packetType == shared::networking::PacketTypes::ServerClientWorldChangesChunk)
+        {
+            this->HandleServerClientWorldChangesChunkPacket(packet);
+        }
+        else if (packetType == shared::networking::PacketTypes::ServerClientPong)
+        {
+            this->HandleServerClientPongPacket(packet);
+        }
     }
 
     bool WorldScene::ValidatePacket(const std::shared_ptr<shared::networking::Packet>& packet) const
@@ -94,7 +117,9 @@ namespace projectfarm::scenes::implemented_scenes
             packetType == shared::networking::PacketTypes::ServerClientPlayerLeftWorld ||
             packetType == shared::networking::PacketTypes::ServerClientRemoveEntityFromWorld ||
             packetType == shared::networking::PacketTypes::ServerClientCharacterSetDetails ||
-            packetType == shared::networking::PacketTypes::ServerClientChatboxMessage)
+            packetType == shared::networking::PacketTypes::ServerClientChatboxMessage ||
+            packetType == shared::networking::PacketTypes::ServerClientWorldChangesChunk ||
+            packetType == shared::networking::PacketTypes::ServerClientPong)
         {
             isValid = true;
         }
@@ -251,6 +276,45 @@ namespace projectfarm::scenes::implemented_scenes
         this->_ui->SendMessage("chatbox", { message, username, serverTimeString });
     }
 
+    void WorldScene::HandleServerClientWorldChangesChunkPacket(const std::shared_ptr<shared::networking::Packet>& packet)
+    {
+        const auto serverClientWorldChangesChunk
+                { std::static_pointer_cast<shared::networking::packets::ServerClientWorldChangesChunkPacket>(packet) };
+
+        if (serverClientWorldChangesChunk->GetWorldName() != this->_world->GetName())
+        {
+            shared::api::logging::Log("Received world changes for another world: " +
+                                      serverClientWorldChangesChunk->GetWorldName());
+            return;
+        }
+
+        auto& islands = this->_world->GetIslands();
+
+        auto islandIndex = serverClientWorldChangesChunk->GetIslandIndex();
+        if (islandIndex >= islands.size())
+        {
+            shared::api::logging::Log("Received world changes for an invalid island: " + std::to_string(islandIndex));
+            return;
+        }
+
+        uint32_t index {0};
+        std::vector<shared::game::world::WorldChangeLogEntry> changes;
+
+        if (!shared::game::world::DecodeWorldChanges(serverClientWorldChangesChunk->GetData(), index, changes))
+        {
+            shared::api::logging::Log("Failed to decode world changes chunk: " +
+                                      std::to_string(serverClientWorldChangesChunk->GetChunkIndex()));
+            return;
+        }
+
+        const auto& island = islands[islandIndex];
+
+        for (const auto& change : changes)
+        {
+            island->ProcessPlotUpdate(change.LayerIndex, change.TileX, change.TileY, change.Time, change.PlotIndex);
+        }
+    }
+
     bool WorldScene::Initialize()
     {
         shared::api::logging::Log("Initializing main game scene.");
@@ -344,6 +408,13 @@ namespace projectfarm::scenes::implemented_scenes
 
         this->UpdateUI();
 
+        this->GetDebugInformation()->SetNumberOfEntities(this->_world->GetNumberOfEntities());
+
+        if (this->_computeDebugInfo || this->GetDebugInformation()->IsWritingFrameTrace())
+        {
+            this->SendPing();
+        }
+
         this->UpdateDebugInfo();
     }
 
@@ -397,7 +468,26 @@ namespace projectfarm::scenes::implemented_scenes
         ss << "FPS: " << this->GetTimer()->GetFPS() << std::endl;
         ss << "Draw Calls: " << this->GetDebugInformation()->GetLastFrameDrawCalls() << std::endl;
         ss << "Drawn Tiles: " << this->GetDebugInformation()->GetLastFrameTilesDrawn() << std::endl;
-        ss << "Pooled Textures: " << this->GetDebugInformation()->GetNumberOfTexturesLoaded();
+        ss << "Drawn Render Layers: " << this->GetDebugInformation()->GetLastFrameRenderLayersDrawn() << std::endl;
+        ss << "Atlas Pages: " << this->GetDebugInformation()->GetNumberOfAtlasPages() << std::endl;
+        ss << "Pooled Textures: " << this->GetDebugInformation()->GetNumberOfTexturesLoaded() << std::endl;
+
+        const auto& frameStatistics = this->GetDebugInformation()->GetFrameStatistics();
+        const auto& lastFrame = frameStatistics.GetLastFrame();
+
+        auto frameTimes = frameStatistics.GetPercentiles(shared::profiling::FrameTimings::Frame);
+        auto updateTimes = frameStatistics.GetPercentiles(shared::profiling::FrameTimings::Update);
+        auto renderTimes = frameStatistics.GetPercentiles(shared::profiling::FrameTimings::Render);
+
+        ss << "Frame p50/p95/p99: " << frameTimes.P50 << "/" << frameTimes.P95 << "/" << frameTimes.P99 << "us" << std::endl;
+        ss << "Update p50/p95/p99: " << updateTimes.P50 << "/" << updateTimes.P95 << "/" << updateTimes.P99 << "us" << std::endl;
+        ss << "Render p50/p95/p99: " << renderTimes.P50 << "/" << renderTimes.P95 << "/" << renderTimes.P99 << "us" << std::endl;
+        ss << "Slow Frames: " << frameStatistics.GetNumberOfSlowFrames() << std::endl;
+        ss << "Frame Allocations: " << lastFrame.Allocations << std::endl;
+        ss << "Round Trip: " << lastFrame.RoundTripTimeInMicroseconds / 1000u << "ms" << std::endl;
+        ss << "Packets Per Second: " << static_cast<uint64_t>(frameStatistics.GetPacketsPerSecond()) << std::endl;
+        ss << "Entities: " << lastFrame.NumberOfEntities << std::endl;
+        ss << "Texture Memory: " << lastFrame.TextureMemoryInBytes / (1024u * 1024u) << "MB" << std::endl;
         ss << std::endl;
         ss << "Device Capabilities:" << std::endl;
         ss << "Has Physical Keyboard: " << deviceCaps.HasPhysicalKeyboard << std::endl;
@@ -412,6 +502,36 @@ namespace projectfarm::scenes::implemented_scenes
         this->_ui->SetSimpleBinding("debug_info", debugInfo);
     }
 
+    void WorldScene::SendPing() noexcept
+    {
+        auto now = shared::time::MonotonicClock::GetMicroseconds();
+        if (std::chrono::microseconds(now - this->_lastPingTime) < WorldScene::PingInterval)
+        {
+            return;
+        }
+
+        this->_lastPingTime = now;
+
+        const auto clientServerPingPacket = std::static_pointer_cast<shared::networking::packets::ClientServerPingPacket>(
+                shared::networking::PacketFactory::CreatePacket(shared::networking::PacketTypes::ClientServerPing));
+
+        clientServerPingPacket->SetClientTime(GetPingTime());
+
+        this->GetSceneManager()->SendPacketToServer(clientServerPingPacket);
+    }
+
+    void WorldScene::HandleServerClientPongPacket(const std::shared_ptr<shared::networking::Packet>& packet)
+    {
+        const auto serverClientPong
+            { std::static_pointer_cast<shared::networking::packets::ServerClientPongPacket>(packet) };
+
+        // includes waiting for this frame's packets to be handled, as that is the delay players see
+        auto pingTime = GetPingTime();
+        auto clientTime = serverClientPong->GetClientTime();
+
+        this->GetDebugInformation()->SetRoundTripTime(pingTime > clientTime ? pingTime - clientTime : 0u);
+    }
+
     void WorldScene::TellServerWorldHasBeenLoaded()
     {
         const auto clientServerWorldLoadedPacket = shared::networking::PacketFactory::CreatePacket(
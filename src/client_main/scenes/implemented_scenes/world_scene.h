@@ -1,6 +1,7 @@
 #ifndef PROJECTFARM_WORLD_SCENE_H
 #define PROJECTFARM_WORLD_SCENE_H
 
+#include <chrono>
 #include <filesystem>
 #include <unordered_map>
 
@@ -60,6 +61,9 @@ namespace projectfarm::scenes::implemented_scenes
 
         bool _computeDebugInfo {false};
 
+        static constexpr std::chrono::seconds PingInterval {1};
+        uint64_t _lastPingTime {0};
+
         [[nodiscard]]
         bool ValidatePacket(const std::shared_ptr<shared::networking::Packet>& packet) const;
 
@@ -70,6 +74,8 @@ namespace projectfarm::scenes::implemented_scenes
         void HandleServerClientRemoveEntityFromWorldPacket(const std::shared_ptr<shared::networking::Packet>& packet);
         void HandleServerClientCharacterSetDetailsPacket(const std::shared_ptr<shared::networking::Packet>& packet);
         void HandleServerClientChatboxMessagePacket(const std::shared_ptr<shared::networking::Packet>& packet);
+        void HandleServerClientWorldChangesChunkPacket(const std::shared_ptr<shared::networking::Packet>& packet);
+        void HandleServerClientPongPacket(const std::shared_ptr<shared::networking::Packet>& packet);
 
         [[nodiscard]]
         bool SetupUI();
@@ -83,6 +89,9 @@ namespace projectfarm::scenes::implemented_scenes
 
         void UpdateDebugInfo();
 
+        // measures the round trip to the server for the debug information
+        void SendPing() noexcept;
+
         [[nodiscard]]
         std::string ProcessChatboxCommand(const std::string& command,
                                           const std::vector<std::string>& parameters) noexcept;
@@ -0,0 +1,128 @@
+#include <iostream>
+#include <string>
+#include <memory>
+#include <filesystem>
+
+#include "platform/platform_id.h"
+#if !defined(IS_IOS)
+#include "version.h"
+#endif
+#include "world_benchmark.h"
+
+using namespace projectfarm;
+
+// usage: server_benchmarks -charactertype=<character type> [-world=<world name>] [-spawntile=<action tile type>]
+//                          [-characters=<number of characters>] [-players=<number of players>]
+//                          [-ticks=<number of ticks>] [-tickduration=<microseconds>] [-seed=<non-zero seed>]
+//                          [-json=<results file>]
+// the same seed and arguments give the same state hash, so a change can be checked
+// to not have changed what the world does, as well as how fast it does it
+int main(int argc, char* argv[])
+{
+    std::cout << "Starting world benchmark..." << std::endl;
+#if !defined(IS_IOS)
+    std::cout << "Project Name: " << PROJECT_NAME << std::endl;
+    std::cout << "Project Version: " << PROJECT_VERSION << std::endl;
+#endif
+
+    server::benchmarks::WorldBenchmarkOptions options;
+    options.BinaryPath = std::filesystem::path(argv[0]).remove_filename();
+
+    std::filesystem::path jsonFilePath;
+
+    for (auto i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+
+        if (arg.rfind("-charactertype=", 0) == 0)
+        {
+            options.CharacterType = arg.substr(15);
+        }
+        else if (arg.rfind("-world=", 0) == 0)
+        {
+            options.WorldName = arg.substr(7);
+        }
+        else if (arg.rfind("-spawntile=", 0) == 0)
+        {
+            options.SpawnTileType = arg.substr(11);
+        }
+        else if (arg.rfind("-characters=", 0) == 0)
+        {
+            options.NumberOfCharacters = static_cast<uint32_t>(std::stoul(arg.substr(12)));
+        }
+        else if (arg.rfind("-players=", 0) == 0)
+        {
+            options.NumberOfPlayers = static_cast<uint32_t>(std::stoul(arg.substr(9)));
+        }
+        else if (arg.rfind("-ticks=", 0) == 0)
+        {
+            options.NumberOfTicks = static_cast<uint32_t>(std::stoul(arg.substr(7)));
+        }
+        else if (arg.rfind("-tickduration=", 0) == 0)
+        {
+            options.TickDurationInMicroseconds = std::stoull(arg.substr(14));
+        }
+        else if (arg.rfind("-seed=", 0) == 0)
+        {
+            options.Seed = std::stoull(arg.substr(6));
+        }
+        else if (arg.rfind("-json=", 0) == 0)
+        {
+            jsonFilePath = arg.substr(6);
+        }
+        else
+        {
+            std::cout << "Unknown argument: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    if (options.CharacterType.empty())
+    {
+        std::cout << "The character type must be given." << std::endl;
+        return 1;
+    }
+
+    if (options.TickDurationInMicroseconds == 0u)
+    {
+        std::cout << "The tick duration must not be 0." << std::endl;
+        return 1;
+    }
+
+    auto benchmark = std::make_shared<server::benchmarks::WorldBenchmark>(options);
+
+    if (!benchmark->Initialize())
+    {
+        std::cout << "Failed to initialize the world benchmark." << std::endl;
+        benchmark->Shutdown();
+        return 1;
+    }
+
+    std::cout << "Running " << options.NumberOfTicks << " ticks..." << std::endl;
+
+    server::benchmarks::WorldBenchmarkResults results;
+    if (!benchmark->Run(results))
+    {
+        std::cout << "Failed to run the world benchmark." << std::endl;
+        benchmark->Shutdown();
+        return 1;
+    }
+
+    benchmark->Shutdown();
+
+    std::cout << std::endl;
+    results.WriteReport(std::cout, options);
+
+    if (!jsonFilePath.empty())
+    {
+        if (!results.WriteJson(jsonFilePath, options))
+        {
+            std::cout << "Failed to write results to: " << jsonFilePath.u8string() << std::endl;
+            return 1;
+        }
+
+        std::cout << "Wrote results to: " << jsonFilePath.u8string() << std::endl;
+    }
+
+    return 0;
+}
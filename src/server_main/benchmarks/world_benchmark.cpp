@@ -0,0 +1,458 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <string_view>
+#include <nlohmann/json.hpp>
+
+#include "world_benchmark.h"
+#include "server/client.h"
+#include "engine/player_load_details.h"
+#include "networking/network_metrics.h"
+#include "metrics/metrics.h"
+#include "profiling/allocation_tracker.h"
+#include "api/logging/logging.h"
+
+namespace projectfarm::server::benchmarks
+{
+    namespace
+    {
+        constexpr uint64_t FnvOffsetBasis {14695981039346656037u};
+        constexpr uint64_t FnvPrime {1099511628211u};
+
+        void HashByte(uint64_t& hash, std::byte b) noexcept
+        {
+            hash ^= static_cast<uint64_t>(b);
+            hash *= FnvPrime;
+        }
+
+        void AddZoneTotals(std::vector<shared::profiling::ProfileZoneTotal>& phases,
+                           const std::vector<shared::profiling::ProfileZoneTotal>& zoneTotals) noexcept
+        {
+            for (const auto& zoneTotal : zoneTotals)
+            {
+                auto phase = std::find_if(phases.begin(), phases.end(), [&zoneTotal](const auto& p)
+                {
+                    return std::string_view(p.Name) == zoneTotal.Name;
+                });
+
+                if (phase == phases.end())
+                {
+                    phases.push_back(zoneTotal);
+                    continue;
+                }
+
+                phase->NumberOfEvents += zoneTotal.NumberOfEvents;
+                phase->TotalNanoseconds += zoneTotal.TotalNanoseconds;
+                phase->MaxNanoseconds = std::max(phase->MaxNanoseconds, zoneTotal.MaxNanoseconds);
+            }
+        }
+
+        double PerSecond(uint64_t value, uint64_t durationInMicroseconds) noexcept
+        {
+            if (durationInMicroseconds == 0u)
+            {
+                return 0.0;
+            }
+
+            return static_cast<double>(value) * 1'000'000.0 / static_cast<double>(durationInMicroseconds);
+        }
+    }
+
+    double WorldBenchmarkResults::GetTicksPerSecond() const noexcept
+    {
+        return PerSecond(this->NumberOfTicks, this->DurationInMicroseconds);
+    }
+
+    void WorldBenchmarkResults::WriteReport(std::ostream& stream, const WorldBenchmarkOptions& options) const noexcept
+    {
+        auto ticks = std::max<uint64_t>(this->NumberOfTicks, 1u);
+
+        stream << std::fixed << std::setprecision(2)
+               << "World: " << this->WorldName << '\n'
+               << "Characters: " << options.NumberOfCharacters << ", players: " << options.NumberOfPlayers << '\n'
+               << "Ticks: " << this->NumberOfTicks << " of " << options.TickDurationInMicroseconds << "us\n"
+               << "Seed: " << options.Seed << '\n'
+               << "Duration: " << static_cast<double>(this->DurationInMicroseconds) / 1000.0 << "ms\n"
+               << "Ticks/s: " << this->GetTicksPerSecond() << '\n'
+               << "Tick p50/p99/max: " << this->TickP50InMicroseconds << "/" << this->TickP99InMicroseconds
+               << "/" << this->TickMaxInMicroseconds << "us\n"
+               << "Sent: " << this->PacketsSent << " packets, " << this->BytesSent << " bytes ("
+               << this->BytesSent / ticks << " bytes per tick)\n"
+               << "State hash: " << std::hex << std::setw(16) << std::setfill('0') << this->StateHash
+               << std::dec << std::setfill(' ') << '\n';
+
+        if (this->Phases.empty())
+        {
+            stream << "No phases, as the profiler was not compiled in.\n";
+            return;
+        }
+
+        // zones inside other zones are also counted in the outer zone
+        stream << "Phases (total ms, us per tick, events, max us):\n";
+
+        for (const auto& phase : this->Phases)
+        {
+            stream << "  " << std::left << std::setw(40) << phase.Name << std::right
+                   << std::setw(12) << static_cast<double>(phase.TotalNanoseconds) / 1'000'000.0
+                   << std::setw(12) << static_cast<double>(phase.TotalNanoseconds) / 1000.0 / static_cast<double>(ticks)
+                   << std::setw(12) << phase.NumberOfEvents
+                   << std::setw(12) << static_cast<double>(phase.MaxNanoseconds) / 1000.0 << '\n';
+        }
+    }
+
+    bool WorldBenchmarkResults::WriteJson(const std::filesystem::path& filePath,
+                                          const WorldBenchmarkOptions& options) const noexcept
+    {
+        nlohmann::json json;
+        json["world"] = this->WorldName;
+        json["characters"] = options.NumberOfCharacters;
+        json["players"] = options.NumberOfPlayers;
+        json["tickDurationMicroseconds"] = options.TickDurationInMicroseconds;
+        json["seed"] = options.Seed;
+        json["ticks"] = this->NumberOfTicks;
+        json["durationMicroseconds"] = this->DurationInMicroseconds;
+        json["ticksPerSecond"] = this->GetTicksPerSecond();
+        json["tickMicroseconds"] = {
+            {"p50", this->TickP50InMicroseconds},
+            {"p99", this->TickP99InMicroseconds},
+            {"max", this->TickMaxInMicroseconds},
+        };
+        json["packetsSent"] = this->PacketsSent;
+        json["bytesSent"] = this->BytesSent;
+        json["stateHash"] = this->StateHash;
+
+        auto& phases = json["phases"];
+        phases = nlohmann::json::array();
+
+        for (const auto& phase : this->Phases)
+        {
+            phases.push_back({
+                {"name", phase.Name},
+                {"totalNanoseconds", phase.TotalNanoseconds},
+                {"maxNanoseconds", phase.MaxNanoseconds},
+                {"events", phase.NumberOfEvents},
+            });
+        }
+
+        std::ofstream fp(filePath, std::ios::trunc);
+        if (!fp.is_open())
+        {
+            return false;
+        }
+
+        fp << json.dump(4) << '\n';
+
+        return static_cast<bool>(fp);
+    }
+
+    WorldBenchmark::WorldBenchmark(WorldBenchmarkOptions options)
+        : _options {std::move(options)}
+    {
+        this->_packetSender = std::make_shared<shared::networking::PacketSender>();
+        this->_scriptSystem = std::make_shared<shared::scripting::ScriptSystem>();
+        this->_scriptFactory = std::make_shared<engine::scripting::ServerScriptFactory>();
+        this->_randomEngine = std::make_shared<shared::math::RandomEngine>();
+        this->_actionAnimationsManager = std::make_shared<engine::entities::ActionAnimationsManager>();
+        this->_dataManager = std::make_shared<engine::data::DataManager>();
+    }
+
+    bool WorldBenchmark::Initialize() noexcept
+    {
+        if (this->_options.Seed == 0u)
+        {
+            shared::api::logging::Log("The seed must not be 0, as the run would not be repeatable.");
+            return false;
+        }
+
+        this->_dataProvider = std::make_shared<shared::DataProvider>(this->_options.BinaryPath);
+        if (!this->_dataProvider->SetupServer())
+        {
+            shared::api::logging::Log("Failed to setup data provider.");
+            return false;
+        }
+
+        this->_randomEngine->Initialize(this->_options.Seed);
+
+        // the players are made up, so are never kept
+        this->_dataManager->SetDataProvider(this->_dataProvider);
+        this->_dataManager->SetIsPlayerDatabaseInMemory(true);
+        if (!this->_dataManager->Initialize())
+        {
+            shared::api::logging::Log("Failed to initialize data manager.");
+            return false;
+        }
+
+        this->_packetSender->SetDiscardPackets(true);
+        this->_packetSender->SetSerializeDiscardedPackets(true);
+        if (!this->_packetSender->Initialize())
+        {
+            shared::api::logging::Log("Failed to initialize packet sender.");
+            return false;
+        }
+
+        this->_scriptSystem->SetScriptFactory(this->_scriptFactory);
+        this->_scriptSystem->SetDataProvider(this->_dataProvider);
+        this->_scriptSystem->SetRandomEngine(this->_randomEngine);
+        if (!this->_scriptSystem->Initialize(this->_options.BinaryPath))
+        {
+            shared::api::logging::Log("Failed to initialize script system.");
+            return false;
+        }
+
+        this->_actionAnimationsManager->SetDataProvider(this->_dataProvider);
+        this->_actionAnimationsManager->SetRandomEngine(this->_randomEngine);
+        if (!this->_actionAnimationsManager->Load())
+        {
+            shared::api::logging::Log("Failed to load the action animation manager.");
+            return false;
+        }
+
+        if (!this->CreateWorld())
+        {
+            shared::api::logging::Log("Failed to create world.");
+            return false;
+        }
+
+        if (!this->AddPlayers())
+        {
+            shared::api::logging::Log("Failed to add players.");
+            return false;
+        }
+
+        if (!this->AddCharacters())
+        {
+            shared::api::logging::Log("Failed to add characters.");
+            return false;
+        }
+
+        return true;
+    }
+
+    bool WorldBenchmark::Run(WorldBenchmarkResults& results) noexcept
+    {
+        results = {};
+        results.WorldName = this->_world->GetName();
+
+        shared::metrics::Histogram tickDurations;
+
+        auto packetsSent = shared::networking::GetNumberOfPacketsSent();
+        auto bytesSent = shared::networking::GetNumberOfPacketBytesSent();
+
+        shared::profiling::Profiler::Clear();
+        shared::profiling::Profiler::SetEnabled(true);
+
+        for (auto i = 0u; i < this->_options.NumberOfTicks; ++i)
+        {
+            auto startTime = std::chrono::steady_clock::now();
+
+            {
+                ALLOCATION_SCOPE(WorldTick);
+                this->_world->Tick();
+            }
+
+            auto tickDuration = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - startTime).count());
+
+            tickDurations.Record(tickDuration);
+            results.DurationInMicroseconds += tickDuration;
+
+            // drained each tick, outside of the tick's time, so a busy world can't
+            // wrap the profiler's buffer
+            AddZoneTotals(results.Phases, shared::profiling::Profiler::GetZoneTotals());
+            shared::profiling::Profiler::Clear();
+        }
+
+        shared::profiling::Profiler::SetEnabled(false);
+
+        std::sort(results.Phases.begin(), results.Phases.end(), [](const auto& a, const auto& b)
+        {
+            return a.TotalNanoseconds > b.TotalNanoseconds;
+        });
+
+        results.NumberOfTicks = this->_options.NumberOfTicks;
+        results.TickP50InMicroseconds = tickDurations.GetValueAtPercentile(50.0);
+        results.TickP99InMicroseconds = tickDurations.GetValueAtPercentile(99.0);
+        results.TickMaxInMicroseconds = tickDurations.GetMax();
+        results.PacketsSent = shared::networking::GetNumberOfPacketsSent() - packetsSent;
+        results.BytesSent = shared::networking::GetNumberOfPacketBytesSent() - bytesSent;
+        results.StateHash = this->GetStateHash();
+
+        return true;
+    }
+
+    void WorldBenchmark::Shutdown() noexcept
+    {
+        // the world holds on to this as its host
+        if (this->_world)
+        {
+            this->_world->Shutdown();
+            this->_world.reset();
+        }
+
+        this->_players.clear();
+
+        this->_scriptSystem->Shutdown();
+        this->_packetSender->Shutdown();
+        this->_dataManager->Shutdown();
+    }
+
+    std::shared_ptr<engine::Player> WorldBenchmark::GetPlayerById(uint32_t playerId) const noexcept
+    {
+        auto player = std::find_if(this->_players.begin(), this->_players.end(),
+                                   [playerId](const auto& p) { return p->GetPlayerId() == playerId; });
+
+        if (player == this->_players.end())
+        {
+            shared::api::logging::Log("Failed to find player with id: " + std::to_string(playerId));
+            return nullptr;
+        }
+
+        return *player;
+    }
+
+    bool WorldBenchmark::AddPlayerToWorld(uint32_t playerId, uint32_t entityId,
+                                          const std::string& destinationWorldName) noexcept
+    {
+        if (destinationWorldName != this->_world->GetName())
+        {
+            shared::api::logging::Log("Only one world is benchmarked, so can't add a player to: " +
+                                      destinationWorldName);
+            return false;
+        }
+
+        auto player = this->GetPlayerById(playerId);
+
+        return player && this->_world->AddPlayer(player, entityId);
+    }
+
+    bool WorldBenchmark::AddCharacterToWorld(const std::string& characterType,
+                                             const std::string& destinationWorldName,
+                                             const std::string& destinationTileType,
+                                             uint32_t entityId, uint32_t playerId) noexcept
+    {
+        if (destinationWorldName != this->_world->GetName())
+        {
+            shared::api::logging::Log("Only one world is benchmarked, so can't add a character to: " +
+                                      destinationWorldName);
+            return false;
+        }
+
+        return this->_world->AddCharacter(characterType, destinationTileType, entityId, playerId) != nullptr;
+    }
+
+    bool WorldBenchmark::CreateWorld() noexcept
+    {
+        const auto& locations = this->_dataProvider->GetWorldLocations();
+
+        if (locations.empty())
+        {
+            shared::api::logging::Log("There are no worlds to benchmark.");
+            return false;
+        }
+
+        // the locations are unordered, so the first by name is used to always get the same world
+        if (this->_options.WorldName.empty())
+        {
+            this->_options.WorldName = std::min_element(locations.begin(), locations.end(),
+                                                        [](const auto& a, const auto& b)
+                                                        {
+                                                            return a.first < b.first;
+                                                        })->first;
+        }
+
+        auto location = locations.find(this->_options.WorldName);
+        if (location == locations.end())
+        {
+            shared::api::logging::Log("Failed to find world: " + this->_options.WorldName);
+            return false;
+        }
+
+        this->_world = std::make_shared<engine::world::World>();
+        this->_world->SetDataProvider(this->_dataProvider);
+        this->_world->SetWorldHost(this->shared_from_this());
+        this->_world->SetPacketSender(this->_packetSender);
+        this->_world->SetScriptSystem(this->_scriptSystem);
+        this->_world->SetActionAnimationsManager(this->_actionAnimationsManager);
+        this->_world->SetDataManager(this->_dataManager);
+        this->_world->SetFixedTickDurationInMicroseconds(this->_options.TickDurationInMicroseconds);
+
+        if (!this->_world->Load(location->first, location->second))
+        {
+            shared::api::logging::Log("Failed to load world: " + location->second.u8string());
+            return false;
+        }
+
+        return true;
+    }
+
+    bool WorldBenchmark::AddPlayers() noexcept
+    {
+        for (auto i = 0u; i < this->_options.NumberOfPlayers; ++i)
+        {
+            auto userName = "benchmark" + std::to_string(i);
+
+            uint32_t playerId {0u};
+            if (!this->_dataManager->InsertPlayer(userName, "", playerId))
+            {
+                shared::api::logging::Log("Failed to insert player: " + userName);
+                return false;
+            }
+
+            auto loadDetails = std::make_shared<engine::PlayerLoadDetails>();
+            loadDetails->CharacterType = this->_options.CharacterType;
+
+            // no socket, so only the packets' bytes are counted
+            auto player = std::make_shared<engine::Player>(std::make_shared<Client>(nullptr, nullptr));
+            player->SetPlayerId(playerId);
+            player->SetUsername(userName);
+            player->SetLoadDetails(loadDetails);
+
+            this->_players.push_back(player);
+
+            if (!this->_world->AddPlayer(player, 0u))
+            {
+                shared::api::logging::Log("Failed to add player: " + userName);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool WorldBenchmark::AddCharacters() noexcept
+    {
+        for (auto i = 0u; i < this->_options.NumberOfCharacters; ++i)
+        {
+            if (!this->_world->AddCharacter(this->_options.CharacterType, this->_options.SpawnTileType, 0u, 0u))
+            {
+                shared::api::logging::Log("Failed to add character: " + this->_options.CharacterType +
+                                          " at tile type: " + this->_options.SpawnTileType);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    uint64_t WorldBenchmark::GetStateHash() const noexcept
+    {
+        auto hash = FnvOffsetBasis;
+
+        for (const auto& entity : this->_world->GetEntities())
+        {
+            auto entityId = entity->GetEntityId();
+            for (auto i = 0u; i < sizeof(entityId); ++i)
+            {
+                HashByte(hash, static_cast<std::byte>(entityId >> (i * 8u)));
+            }
+
+            for (auto b : entity->GetEntityData())
+            {
+                HashByte(hash, b);
+            }
+        }
+
+        return hash;
+    }
+}
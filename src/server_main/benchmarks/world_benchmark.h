@@ -0,0 +1,141 @@
+#ifndef PROJECTFARM_WORLD_BENCHMARK_H
+#define PROJECTFARM_WORLD_BENCHMARK_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <filesystem>
+
+#include "engine/world/world.h"
+#include "engine/world/world_host.h"
+#include "engine/player.h"
+#include "engine/entities/action_animations_manager.h"
+#include "engine/data/data_manager.h"
+#include "engine/scripting/server_script_factory.h"
+#include "data/data_provider.h"
+#include "networking/packet_sender.h"
+#include "scripting/script_system.h"
+#include "math/random_engine.h"
+#include "profiling/profiler.h"
+
+namespace projectfarm::server::benchmarks
+{
+    struct WorldBenchmarkOptions
+    {
+        // where the data folder is found, as for the server
+        std::filesystem::path BinaryPath;
+
+        // the first world by name if empty
+        std::string WorldName;
+
+        std::string CharacterType;
+        std::string SpawnTileType {"playerspawn"};
+
+        uint32_t NumberOfCharacters {100u};
+
+        // socketless players, so the entity updates have someone to be sent to
+        uint32_t NumberOfPlayers {10u};
+
+        uint32_t NumberOfTicks {1000u};
+        uint64_t TickDurationInMicroseconds {16'667u};
+
+        // 0 is not allowed, as the random engine would seed from the clock
+        uint64_t Seed {1u};
+    };
+
+    struct WorldBenchmarkResults
+    {
+        std::string WorldName;
+
+        uint64_t NumberOfTicks {0u};
+
+        // only the ticks, not the setup or the reporting
+        uint64_t DurationInMicroseconds {0u};
+
+        uint64_t TickP50InMicroseconds {0u};
+        uint64_t TickP99InMicroseconds {0u};
+        uint64_t TickMaxInMicroseconds {0u};
+
+        uint64_t PacketsSent {0u};
+        uint64_t BytesSent {0u};
+
+        // of every entity's state at the end, so two runs with the same seed can be compared
+        uint64_t StateHash {0u};
+
+        std::vector<shared::profiling::ProfileZoneTotal> Phases;
+
+        [[nodiscard]]
+        double GetTicksPerSecond() const noexcept;
+
+        void WriteReport(std::ostream& stream, const WorldBenchmarkOptions& options) const noexcept;
+
+        [[nodiscard]]
+        bool WriteJson(const std::filesystem::path& filePath, const WorldBenchmarkOptions& options) const noexcept;
+    };
+
+    // Runs a single world on the calling thread, with a fixed tick duration and a seeded
+    // random engine, and packets that are serialized then thrown away. It stands in
+    // for the server as the world's host, so there are no sockets, SDL or clients.
+    class WorldBenchmark final : public engine::world::WorldHost,
+                                 public std::enable_shared_from_this<WorldBenchmark>
+    {
+    public:
+        explicit WorldBenchmark(WorldBenchmarkOptions options);
+        ~WorldBenchmark() override = default;
+
+        WorldBenchmark(const WorldBenchmark&) = delete;
+        WorldBenchmark(WorldBenchmark&&) = delete;
+
+        [[nodiscard]]
+        bool Initialize() noexcept;
+
+        [[nodiscard]]
+        bool Run(WorldBenchmarkResults& results) noexcept;
+
+        void Shutdown() noexcept;
+
+        [[nodiscard]]
+        std::shared_ptr<engine::Player> GetPlayerById(uint32_t playerId) const noexcept override;
+
+        // there is only the one world, so players and characters can't leave it
+        [[nodiscard]]
+        bool AddPlayerToWorld(uint32_t playerId, uint32_t entityId,
+                              const std::string& destinationWorldName) noexcept override;
+
+        [[nodiscard]]
+        bool AddCharacterToWorld(const std::string& characterType,
+                                 const std::string& destinationWorldName,
+                                 const std::string& destinationTileType,
+                                 uint32_t entityId, uint32_t playerId) noexcept override;
+
+    private:
+        WorldBenchmarkOptions _options;
+
+        std::shared_ptr<shared::DataProvider> _dataProvider;
+        std::shared_ptr<shared::networking::PacketSender> _packetSender;
+        std::shared_ptr<shared::scripting::ScriptSystem> _scriptSystem;
+        std::shared_ptr<engine::scripting::ServerScriptFactory> _scriptFactory;
+        std::shared_ptr<shared::math::RandomEngine> _randomEngine;
+        std::shared_ptr<engine::entities::ActionAnimationsManager> _actionAnimationsManager;
+        std::shared_ptr<engine::data::DataManager> _dataManager;
+
+        std::shared_ptr<engine::world::World> _world;
+        std::vector<std::shared_ptr<engine::Player>> _players;
+
+        [[nodiscard]]
+        bool CreateWorld() noexcept;
+
+        [[nodiscard]]
+        bool AddPlayers() noexcept;
+
+        [[nodiscard]]
+        bool AddCharacters() noexcept;
+
+        [[nodiscard]]
+        uint64_t GetStateHash() const noexcept;
+    };
+}
+
+#endif
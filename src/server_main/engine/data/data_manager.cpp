@@ -62,18 +62,31 @@ namespace projectfarm::engine::data
         auto databasePath = this->_dataProvider->ResolveFileName(shared::DataProviderLocations::ServerDatabases,
                                                                  "player.db");
 #endif
-        if (!this->_playerDatabase->Open(databasePath, false))
-        {
-            shared::api::logging::Log("Failed to open the player database.");
-            return false;
-        }
-
         auto createPath = this->_dataProvider->ResolveFileName(shared::DataProviderLocations::ServerDatabases,
                                                                "create_player_database.sql");
-        if (!this->_playerDatabase->RunSQLFromFile(createPath))
+
+        if (this->_isPlayerDatabaseInMemory)
         {
-            shared::api::logging::Log("Failed to run sql file: " + createPath.u8string());
-            return false;
+            // opening in memory runs the create script
+            if (!this->_playerDatabase->Open(createPath, true))
+            {
+                shared::api::logging::Log("Failed to open the player database in memory.");
+                return false;
+            }
+        }
+        else
+        {
+            if (!this->_playerDatabase->Open(databasePath, false))
+            {
+                shared::api::logging::Log("Failed to open the player database.");
+                return false;
+            }
+
+            if (!this->_playerDatabase->RunSQLFromFile(createPath))
+            {
+                shared::api::logging::Log("Failed to run sql file: " + createPath.u8string());
+                return false;
+            }
         }
 
         if (!this->CreatePlayerDatabaseStatements())
@@ -28,6 +28,13 @@ namespace projectfarm::engine::data
 
         void Shutdown() noexcept;
 
+        // starts with no players and keeps nothing, so a run doesn't touch `player.db`.
+        // This must be set before `Initialize`
+        void SetIsPlayerDatabaseInMemory(bool isPlayerDatabaseInMemory) noexcept
+        {
+            this->_isPlayerDatabaseInMemory = isPlayerDatabaseInMemory;
+        }
+
         [[nodiscard]] bool UpdateEntityAppearance(uint32_t entityId,
                                                   const shared::entities::CharacterAppearanceDetails& appearanceDetails,
                                                   bool insert = false) const noexcept;
@@ -62,6 +69,8 @@ namespace projectfarm::engine::data
         [[nodiscard]] bool GetPosByPlayerId(uint32_t playerId, uint32_t& xPos, uint32_t& yPos) const noexcept;
 
     private:
+        bool _isPlayerDatabaseInMemory {false};
+
         std::shared_ptr<shared::persistence::Database> _serverCacheDatabase;
         std::shared_ptr<shared::persistence::Database> _playerDatabase;
 
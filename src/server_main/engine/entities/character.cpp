@@ -1,4 +1,4 @@
-#include <fstream>
+#include <utility>
 #include <nlohmann/json.hpp>
 
 #include "character.h"
@@ -11,21 +11,47 @@
 
 namespace projectfarm::engine::entities
 {
-    void Character::OnTick() noexcept
+    namespace
     {
-        this->_scriptStopwatch.Tick();
+        template <typename T>
+        std::vector<shared::game::world::CheckpointStateItem> CaptureStates(const T& stateMachine) noexcept
+        {
+            std::vector<shared::game::world::CheckpointStateItem> states;
 
-        this->ProcessBehaviourState();
+            for (const auto& state : stateMachine.GetStates())
+            {
+                if (!state.GetShouldCancel())
+                {
+                    states.push_back({static_cast<uint8_t>(state.GetKey()), static_cast<uint8_t>(state.GetValue())});
+                }
+            }
 
-        this->ProcessState();
+            return states;
+        }
 
-        if (this->IsPlayer())
+        template <typename T>
+        void RestoreStates(T& stateMachine, const std::vector<shared::game::world::CheckpointStateItem>& states) noexcept
         {
-            // persist the latest state if needed
-            this->_playerTickStopwatch.Tick();
+            using KeyType = decltype(std::declval<typename T::StateItemType>().GetKey());
+            using ValueType = decltype(std::declval<typename T::StateItemType>().GetValue());
+
+            stateMachine.ClearStates();
+
+            // the states are stored top first, so are pushed from the bottom up
+            for (auto state = states.rbegin(); state != states.rend(); ++state)
+            {
+                stateMachine.PushState({static_cast<KeyType>(state->Key), static_cast<ValueType>(state->Value)});
+            }
         }
     }
 
+    void Character::OnTick() noexcept
+    {
+        this->ProcessBehaviourState();
+
+        this->ProcessState();
+    }
+
     // this data is being sent to the client
     std::vector<std::byte> Character::GetEntityData() const noexcept
     {
@@ -83,16 +109,15 @@ namespace projectfarm::engine::entities
         // nlohmann::json can throw exceptions
         try
         {
-            std::ifstream file(filePath);
+            auto json = this->_dataProvider->LoadJsonAsset(filePath);
 
-            if (!file.is_open())
+            if (!json)
             {
                 shared::api::logging::Log("Failed to open character file: " + filePath.u8string());
                 return false;
             }
 
-            nlohmann::json jsonFile;
-            file >> jsonFile;
+            auto& jsonFile = *json;
 
             this->_type = jsonFile["type"].get<std::string>();
             this->_walkSpeed = jsonFile["walk_speed"].get<float>();
@@ -152,6 +177,37 @@ namespace projectfarm::engine::entities
         this->_moveToDestinationY = y;
     }
 
+    shared::game::world::EntityCheckpoint Character::CaptureCheckpoint() const noexcept
+    {
+        shared::game::world::EntityCheckpoint checkpoint;
+        checkpoint.CharacterType = this->_type;
+
+        checkpoint.PositionX = this->_positionX;
+        checkpoint.PositionY = this->_positionY;
+
+        checkpoint.MoveToDestinationX = this->_moveToDestinationX;
+        checkpoint.MoveToDestinationY = this->_moveToDestinationY;
+
+        checkpoint.States = CaptureStates(*this->_stateMachine);
+        checkpoint.BehaviourStates = CaptureStates(*this->_behaviourStateMachine);
+
+        return checkpoint;
+    }
+
+    void Character::RestoreCheckpoint(const shared::game::world::EntityCheckpoint& checkpoint) noexcept
+    {
+        this->_positionX = checkpoint.PositionX;
+        this->_positionY = checkpoint.PositionY;
+
+        this->_moveToDestinationX = checkpoint.MoveToDestinationX;
+        this->_moveToDestinationY = checkpoint.MoveToDestinationY;
+
+        RestoreStates(*this->_stateMachine, checkpoint.States);
+        RestoreStates(*this->_behaviourStateMachine, checkpoint.BehaviourStates);
+
+        this->_lerpPositionChangeOnClient = false;
+    }
+
     void Character::Warp(float worldX, float worldY) noexcept
     {
         this->_positionX = worldX;
@@ -363,6 +419,10 @@ namespace projectfarm::engine::entities
         }
 
         auto newPlot = world->GetPlotIndexFromWorldPosition(newX, newY);
+        if (newPlot == world::Plots::EmptyIndex)
+        {
+            return;
+        }
 
         auto plots = world->GetPlots();
         auto plot = plots->GetPlot(newPlot);
@@ -387,8 +447,33 @@ namespace projectfarm::engine::entities
 
     void Character::SetScriptUpdateInterval(uint32_t interval) noexcept
     {
-        this->_scriptStopwatch.Reset();
-        this->_scriptStopwatch.SetTargetMilliseconds(interval);
+        this->_scriptUpdateInterval = interval;
+
+        this->ScheduleScriptUpdateTimer();
+    }
+
+    void Character::SetPlayerId(uint32_t playerId) noexcept
+    {
+        this->_playerId = playerId;
+
+        this->SchedulePersistPlayerStateTimer();
+    }
+
+    void Character::ScheduleScriptUpdateTimer() noexcept
+    {
+        const auto& timerWheel = this->GetTimerWheel();
+        if (!timerWheel)
+        {
+            return;
+        }
+
+        timerWheel->Cancel(this->_scriptUpdateTimer);
+        this->_scriptUpdateTimer = shared::time::TimerWheel::InvalidHandle;
+
+        if (this->_scriptUpdateInterval == 0)
+        {
+            return;
+        }
 
         auto onTick = [this]()
         {
@@ -399,24 +484,25 @@ namespace projectfarm::engine::entities
           }
         };
 
-        this->_scriptStopwatch.SetOnTick(onTick);
-
-        this->_scriptStopwatch.Start();
+        this->_scriptUpdateTimer = timerWheel->ScheduleRecurring(this->_scriptUpdateInterval, onTick);
     }
 
-    void Character::SetPlayerId(uint32_t playerId) noexcept
+    void Character::SchedulePersistPlayerStateTimer() noexcept
     {
-        this->_playerId = playerId;
+        const auto& timerWheel = this->GetTimerWheel();
+        if (!timerWheel)
+        {
+            return;
+        }
+
+        timerWheel->Cancel(this->_persistPlayerStateTimer);
+        this->_persistPlayerStateTimer = shared::time::TimerWheel::InvalidHandle;
 
         if (!this->IsPlayer())
         {
             return;
         }
 
-        this->_playerTickStopwatch.Reset();
-        // TODO: Have this value in a config setting perhaps?
-        this->_playerTickStopwatch.SetTargetMilliseconds(1000);
-
         auto onTick = [this]()
         {
           if (!this->PersistPlayerState())
@@ -426,9 +512,23 @@ namespace projectfarm::engine::entities
           }
         };
 
-        this->_playerTickStopwatch.SetOnTick(onTick);
+        // TODO: Have this value in a config setting perhaps?
+        this->_persistPlayerStateTimer = timerWheel->ScheduleRecurring(1000, onTick);
+    }
+
+    void Character::CancelTimers() noexcept
+    {
+        const auto& timerWheel = this->GetTimerWheel();
+        if (!timerWheel)
+        {
+            return;
+        }
+
+        timerWheel->Cancel(this->_scriptUpdateTimer);
+        timerWheel->Cancel(this->_persistPlayerStateTimer);
 
-        this->_playerTickStopwatch.Start();
+        this->_scriptUpdateTimer = shared::time::TimerWheel::InvalidHandle;
+        this->_persistPlayerStateTimer = shared::time::TimerWheel::InvalidHandle;
     }
 
     bool Character::PersistPlayerState() const noexcept
@@ -20,7 +20,8 @@
 #include "scripting/consume_script_system.h"
 #include "action_animations_manager.h"
 #include "entities/character_appearance_details.h"
-#include "time/stopwatch.h"
+#include "time/timer_wheel.h"
+#include "game/world/world_checkpoint.h"
 
 namespace projectfarm::engine::world
 {
@@ -47,7 +48,10 @@ namespace projectfarm::engine::entities
             this->_stateMachine = std::make_shared<StateMachineType>(StateIdle);
             this->_behaviourStateMachine = std::make_shared<BehaviourStateMachineType>(BehaviourStateIdle);
         }
-        ~Character() override = default;
+        ~Character() override
+        {
+            this->CancelTimers();
+        }
 
         [[nodiscard]] shared::entities::EntityTypes GetEntityType() const noexcept override
         {
@@ -119,6 +123,9 @@ namespace projectfarm::engine::entities
             this->_lerpPositionChangeOnClient = lerpPositionChangeOnClient;
         }
 
+        [[nodiscard]] shared::game::world::EntityCheckpoint CaptureCheckpoint() const noexcept;
+        void RestoreCheckpoint(const shared::game::world::EntityCheckpoint& checkpoint) noexcept;
+
     protected:
         void OnTick() noexcept override;
 
@@ -127,6 +134,18 @@ namespace projectfarm::engine::entities
             this->_lerpPositionChangeOnClient = true;
         }
 
+        // the timers are cancelled when deactivated, so are scheduled again
+        void OnActivate() noexcept override
+        {
+            this->ScheduleScriptUpdateTimer();
+            this->SchedulePersistPlayerStateTimer();
+        }
+
+        void OnDeactivate() noexcept override
+        {
+            this->CancelTimers();
+        }
+
     private:
         static inline const StateMachineType::StateItemType StateIdle
             {shared::entities::CharacterStates::Idle, shared::entities::CharacterStateValues::None};
@@ -185,6 +204,10 @@ namespace projectfarm::engine::entities
 
         [[nodiscard]] bool PersistPlayerState() const noexcept;
 
+        void ScheduleScriptUpdateTimer() noexcept;
+        void SchedulePersistPlayerStateTimer() noexcept;
+        void CancelTimers() noexcept;
+
         float _moveToDestinationX {0.0f};
         float _moveToDestinationY {0.0f};
 
@@ -204,8 +227,11 @@ namespace projectfarm::engine::entities
 
         std::shared_ptr<shared::scripting::Script> _script;
 
-        shared::time::Stopwatch _scriptStopwatch;
-        shared::time::Stopwatch _playerTickStopwatch;
+        // 0 until the script sets it
+        uint32_t _scriptUpdateInterval {0};
+
+        shared::time::TimerHandle _scriptUpdateTimer {shared::time::TimerWheel::InvalidHandle};
+        shared::time::TimerHandle _persistPlayerStateTimer {shared::time::TimerWheel::InvalidHandle};
 
         std::shared_ptr<projectfarm::engine::world::World> _currentWorld;
     };
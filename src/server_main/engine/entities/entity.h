@@ -6,11 +6,13 @@
 #include <vector>
 
 #include "time/consume_timer.h"
+#include "time/consume_timer_wheel.h"
 #include "entities/entity_types.h"
 
 namespace projectfarm::engine::entities
 {
-    class Entity : public shared::time::ConsumeTimer
+    class Entity : public shared::time::ConsumeTimer,
+                   public shared::time::ConsumeTimerWheel
     {
     public:
         Entity() = default;
@@ -19,11 +21,15 @@ namespace projectfarm::engine::entities
         void Activate() noexcept
         {
             this->_isActivated = true;
+
+            this->OnActivate();
         }
 
         void Deactivate() noexcept
         {
             this->_isActivated = false;
+
+            this->OnDeactivate();
         }
 
         void Tick() noexcept;
@@ -104,6 +110,14 @@ namespace projectfarm::engine::entities
 
         virtual void OnTick() noexcept = 0;
 
+        virtual void OnActivate() noexcept
+        {
+        }
+
+        virtual void OnDeactivate() noexcept
+        {
+        }
+
         uint32_t _entityId = Entity::GlobalId++;
 
         uint64_t _lastUpdateTime {0};
@@ -19,6 +19,12 @@ namespace projectfarm::engine::scripting
 
         globalTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "add_character").ToLocalChecked(),
                             v8::FunctionTemplate::New(this->_isolate, &WorldScript::AddCharacter));
+
+        globalTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "set_checkpoint_state").ToLocalChecked(),
+                            v8::FunctionTemplate::New(this->_isolate, &WorldScript::SetCheckpointState));
+
+        globalTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "get_checkpoint_state").ToLocalChecked(),
+                            v8::FunctionTemplate::New(this->_isolate, &WorldScript::GetCheckpointState));
     }
 
     void WorldScript::GetActionTilesByProperty(const v8::FunctionCallbackInfo<v8::Value>& args)
@@ -103,4 +109,38 @@ namespace projectfarm::engine::scripting
 
         args.GetReturnValue().Set(success);
     }
-}
\ No newline at end of file
+
+    void WorldScript::SetCheckpointState(const v8::FunctionCallbackInfo<v8::Value>& args)
+    {
+        auto isolate = args.GetIsolate();
+
+        v8::HandleScope handScope(isolate);
+
+        auto self = args.Holder();
+
+        auto wrap = v8::Local<v8::External>::Cast(self->GetInternalField(1));
+        auto world = static_cast<world::World*>(wrap->Value());
+
+        if (args.Length() != 1)
+        {
+            shared::api::logging::Log("Invalid number of arguments for 'SetCheckpointState'.");
+            return;
+        }
+
+        world->SetScriptCheckpointState(Script::ArgumentToString(isolate, args, 0));
+    }
+
+    void WorldScript::GetCheckpointState(const v8::FunctionCallbackInfo<v8::Value>& args)
+    {
+        auto isolate = args.GetIsolate();
+
+        v8::HandleScope handScope(isolate);
+
+        auto self = args.Holder();
+
+        auto wrap = v8::Local<v8::External>::Cast(self->GetInternalField(1));
+        auto world = static_cast<world::World*>(wrap->Value());
+
+        args.GetReturnValue().Set(v8::String::NewFromUtf8(isolate, world->GetScriptCheckpointState().c_str()).ToLocalChecked());
+    }
+}
@@ -19,6 +19,8 @@ namespace projectfarm::engine::scripting
 
         static void GetActionTilesByProperty(const v8::FunctionCallbackInfo<v8::Value>& args);
         static void AddCharacter(const v8::FunctionCallbackInfo<v8::Value>& args);
+        static void SetCheckpointState(const v8::FunctionCallbackInfo<v8::Value>& args);
+        static void GetCheckpointState(const v8::FunctionCallbackInfo<v8::Value>& args);
     };
 }
 
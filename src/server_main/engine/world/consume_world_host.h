@@ -0,0 +1,31 @@
+#ifndef PROJECTFARM_CONSUME_WORLD_HOST_H
+#define PROJECTFARM_CONSUME_WORLD_HOST_H
+
+#include <memory>
+
+#include "world_host.h"
+
+namespace projectfarm::engine::world
+{
+	class ConsumeWorldHost
+	{
+	public:
+		ConsumeWorldHost() = default;
+		virtual ~ConsumeWorldHost() = default;
+
+		[[nodiscard]] const std::shared_ptr<WorldHost>& GetWorldHost() const
+		{
+			return this->_worldHost;
+		}
+
+		void SetWorldHost(const std::shared_ptr<WorldHost>& worldHost)
+		{
+			this->_worldHost = worldHost;
+		}
+
+	private:
+		std::shared_ptr<WorldHost> _worldHost;
+	};
+}
+
+#endif
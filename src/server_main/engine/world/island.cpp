@@ -73,28 +73,71 @@ namespace projectfarm::engine::world
         return true;
     }
 
-    bool Island::LoadLayerFromJson(const nlohmann::json& json)
+    bool Island::LoadFromBinaryWorld(const shared::BinaryWorldFile& file,
+                                     const shared::BinaryWorldFile::IslandView& island,
+                                     const std::shared_ptr<Plots>& plots) noexcept
     {
-        std::vector<std::vector<uint16_t>> layer;
+        this->_plots = plots;
 
-        auto defaultPlotIter = json.find("defaultPlot");
-        auto defaultPlot = defaultPlotIter == json.end() ? "" : (*defaultPlotIter).get<std::string>();
+        this->_positionX = island.PositionX;
+        this->_positionY = island.PositionY;
+
+        this->_widthInTiles = island.WidthInTiles;
+        this->_heightInTiles = island.HeightInTiles;
+
+        this->_tileWidthInMeters = island.TileWidthInMeters;
+        this->_tileHeightInMeters = island.TileHeightInMeters;
+
+        this->_widthInMeters = this->_widthInTiles * this->_tileWidthInMeters;
+        this->_heightInMeters = this->_heightInTiles * this->_tileHeightInMeters;
 
-        layer.resize(this->_heightInTiles);
+        // the file uses the same empty index as we do, so the layers can be copied as they are
+        static_assert(shared::BinaryWorldFile::EmptyPlotIndex == Plots::EmptyIndex);
 
-        for (auto y = 0u; y < this->_heightInTiles; ++y)
+        this->_layers.reserve(island.Layers.size());
+
+        for (const auto& layerView : island.Layers)
+        {
+            std::vector<uint16_t> layer(layerView.GetNumberOfTiles());
+            layerView.CopyTo(layer.data(), 0u, layer.size());
+
+            this->_layers.emplace_back(std::move(layer));
+        }
+
+        auto actionTiles = file.ReadActionTiles(island);
+        if (!actionTiles)
         {
-            layer[y].resize(this->_widthInTiles);
+            shared::api::logging::Log("Failed to read action tiles.");
+            return false;
+        }
+
+        for (auto& tile : *actionTiles)
+        {
+            ActionTile actionTile;
+            actionTile.X = tile.X;
+            actionTile.Y = tile.Y;
 
-            for (auto x = 0u; x < this->_widthInTiles; ++x)
+            for (auto& [name, value] : tile.Properties)
             {
-                if (!defaultPlot.empty())
-                {
-                    layer[y][x] = this->_plots->GetPlotIndexByName(defaultPlot);
-                }
+                actionTile.Properties[name] = std::move(value);
             }
+
+            this->_actionTiles.emplace_back(std::move(actionTile));
         }
 
+        return true;
+    }
+
+    bool Island::LoadLayerFromJson(const nlohmann::json& json)
+    {
+        auto defaultPlotIter = json.find("defaultPlot");
+        auto defaultPlot = defaultPlotIter == json.end() ? "" : (*defaultPlotIter).get<std::string>();
+
+        // a layer without a default plot is empty, the same as in the client and in binary worlds
+        std::vector<uint16_t> layer(static_cast<size_t>(this->_widthInTiles) * this->_heightInTiles,
+                                    defaultPlot.empty() ? Plots::EmptyIndex
+                                                        : this->_plots->GetPlotIndexByName(defaultPlot));
+
         auto regionsJson = json["regions"];
 
         for (const auto& regionJson : regionsJson)
@@ -105,11 +148,13 @@ namespace projectfarm::engine::world
             auto w = regionJson["w"].get<uint32_t>();
             auto h = regionJson["h"].get<uint32_t>();
 
+            auto plotIndex = this->_plots->GetPlotIndexByName(name);
+
             for (auto yPos = y; yPos < std::min(y + h, this->_heightInTiles); ++yPos)
             {
                 for (auto xPos = x; xPos < std::min(x + w, this->_widthInTiles); ++xPos)
                 {
-                    layer[yPos][xPos] = this->_plots->GetPlotIndexByName(name);
+                    layer[yPos * this->_widthInTiles + xPos] = plotIndex;
                 }
             }
         }
@@ -122,7 +167,7 @@ namespace projectfarm::engine::world
             auto x = plotJson["x"].get<uint32_t>();
             auto y = plotJson["y"].get<uint32_t>();
 
-            layer[y][x] = this->_plots->GetPlotIndexByName(name);
+            layer[y * this->_widthInTiles + x] = this->_plots->GetPlotIndexByName(name);
         }
 
         this->_layers.emplace_back(std::move(layer));
@@ -132,27 +177,26 @@ namespace projectfarm::engine::world
 
     bool Island::LoadLayerFromBinary(std::ifstream& fs) noexcept
     {
-        std::vector<std::vector<uint16_t>> layer;
-
         // is overhead layer
         ReadBoolFromBinaryFile(fs);
 
-        layer.resize(this->_heightInTiles);
+        auto numberOfTiles = static_cast<size_t>(this->_widthInTiles) * this->_heightInTiles;
+
+        std::vector<int32_t> plotIndexes(numberOfTiles);
+        fs.read(reinterpret_cast<char*>(plotIndexes.data()),
+                static_cast<std::streamsize>(numberOfTiles * sizeof(int32_t)));
 
-        for (auto y = 0u; y < this->_heightInTiles; ++y)
+        if (!fs)
         {
-            layer[y].resize(this->_widthInTiles);
+            shared::api::logging::Log("Layer is truncated.");
+            return false;
+        }
 
-            for (auto x = 0u; x < this->_widthInTiles; ++x)
-            {
-                auto plotIndex = ReadInt32FromBinaryFile(fs);
-                if (plotIndex == -1)
-                {
-                    plotIndex = Plots::EmptyIndex;
-                }
+        std::vector<uint16_t> layer(numberOfTiles);
 
-                layer[y][x] = static_cast<uint16_t>(plotIndex);
-            }
+        for (auto i = 0u; i < numberOfTiles; ++i)
+        {
+            layer[i] = plotIndexes[i] == -1 ? Plots::EmptyIndex : static_cast<uint16_t>(plotIndexes[i]);
         }
 
         // I can't see any reason why the server needs treat overhead layers any
@@ -194,6 +238,60 @@ namespace projectfarm::engine::world
 
     void Island::Shutdown() noexcept
     {
+        this->_changeLog.Clear();
+        this->_uncheckpointedChanges.clear();
+    }
+
+    bool Island::SetPlotIndex(uint8_t layerIndex, uint32_t tileX, uint32_t tileY,
+                              uint16_t plotIndex, uint64_t time) noexcept
+    {
+        shared::game::world::WorldChangeLogEntry entry;
+        entry.LayerIndex = layerIndex;
+        entry.TileX = tileX;
+        entry.TileY = tileY;
+        entry.Time = time;
+        entry.PlotIndex = plotIndex;
+
+        if (!this->ApplyChange(entry))
+        {
+            return false;
+        }
+
+        if (this->_isCheckpointing)
+        {
+            this->_uncheckpointedChanges.push_back(entry);
+        }
+
+        return true;
+    }
+
+    void Island::RestoreChanges(const std::vector<shared::game::world::WorldChangeLogEntry>& changes) noexcept
+    {
+        for (const auto& change : changes)
+        {
+            // the island may have changed since the checkpoint, in which case the change is skipped
+            static_cast<void>(this->ApplyChange(change));
+        }
+    }
+
+    bool Island::ApplyChange(const shared::game::world::WorldChangeLogEntry& entry) noexcept
+    {
+        if (entry.LayerIndex >= this->_layers.size() || entry.TileX >= this->_widthInTiles ||
+            entry.TileY >= this->_heightInTiles)
+        {
+            shared::api::logging::Log("Tile is not on the island: " + std::to_string(entry.LayerIndex) + ", " +
+                                      std::to_string(entry.TileX) + ", " + std::to_string(entry.TileY));
+            return false;
+        }
+
+        if (!this->_changeLog.Add(entry))
+        {
+            return false;
+        }
+
+        this->_layers[entry.LayerIndex][entry.TileY * this->_widthInTiles + entry.TileX] = entry.PlotIndex;
+
+        return true;
     }
 
     uint16_t Island::GetPlotIndexAtWorldPosition(float x, float y) const noexcept
@@ -210,11 +308,17 @@ namespace projectfarm::engine::world
         auto tileX = static_cast<uint32_t>(dx / this->_tileWidthInMeters);
         auto tileY = static_cast<uint32_t>(dy / this->_tileHeightInMeters);
 
+        // a position on the far edge of the island is not on any tile
+        if (tileX >= this->_widthInTiles || tileY >= this->_heightInTiles)
+        {
+            return Plots::EmptyIndex;
+        }
+
         auto topLayer = this->_layers.size();
 
         while (topLayer--)
         {
-            auto index = this->_layers[topLayer][tileY][tileX];
+            auto index = this->_layers[topLayer][tileY * this->_widthInTiles + tileX];
 
             if (index == Plots::EmptyIndex)
             {
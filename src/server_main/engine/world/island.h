@@ -3,11 +3,13 @@
 
 #include <cstdint>
 #include <vector>
+#include <utility>
 #include <fstream>
 #include <nlohmann/json.hpp>
 
+#include "data/binary_world.h"
 #include "plots.h"
-#include "world_change_log_entry.h"
+#include "game/world/world_change_log.h"
 #include "time/consume_timer.h"
 #include "time/timer.h"
 #include "action_tile.h"
@@ -22,6 +24,9 @@ namespace projectfarm::engine::world
 
         [[nodiscard]] bool LoadFromJson(const nlohmann::json& json, const std::shared_ptr<Plots>& plots);
         [[nodiscard]] bool LoadFromBinary(std::ifstream& fs, const std::shared_ptr<Plots>& plots) noexcept;
+        [[nodiscard]] bool LoadFromBinaryWorld(const shared::BinaryWorldFile& file,
+                                               const shared::BinaryWorldFile::IslandView& island,
+                                               const std::shared_ptr<Plots>& plots) noexcept;
 
         void Shutdown() noexcept;
 
@@ -30,11 +35,29 @@ namespace projectfarm::engine::world
             return this->_heightInTiles;
         }
 
-        [[nodiscard]] const std::vector<WorldChangeLogEntry>& GetChangeLog() const noexcept
+        [[nodiscard]] const shared::game::world::WorldChangeLog& GetChangeLog() const noexcept
         {
             return this->_changeLog;
         }
 
+        // changes the plot of a tile and records the change, so it is sent to clients
+        [[nodiscard]] bool SetPlotIndex(uint8_t layerIndex, uint32_t tileX, uint32_t tileY,
+                                        uint16_t plotIndex, uint64_t time) noexcept;
+
+        // reapplies changes from a checkpoint, which are not checkpointed again
+        void RestoreChanges(const std::vector<shared::game::world::WorldChangeLogEntry>& changes) noexcept;
+
+        void SetIsCheckpointing(bool isCheckpointing) noexcept
+        {
+            this->_isCheckpointing = isCheckpointing;
+        }
+
+        // the changes since this was last called
+        [[nodiscard]] std::vector<shared::game::world::WorldChangeLogEntry> TakeUncheckpointedChanges() noexcept
+        {
+            return std::exchange(this->_uncheckpointedChanges, {});
+        }
+
         [[nodiscard]] uint16_t GetPlotIndexAtWorldPosition(float x, float y) const noexcept;
         [[nodiscard]] std::pair<int32_t, int32_t> GetTileIndexesFromWorldPosition(float x, float y) const noexcept;
         [[nodiscard]] std::pair<float, float> GetWorldPositionFromTileCoordinate(uint32_t x, uint32_t y) const noexcept;
@@ -63,9 +86,15 @@ namespace projectfarm::engine::world
 
         std::shared_ptr<Plots> _plots;
 
-        std::vector<WorldChangeLogEntry> _changeLog;
+        shared::game::world::WorldChangeLog _changeLog;
+
+        bool _isCheckpointing {false};
+        std::vector<shared::game::world::WorldChangeLogEntry> _uncheckpointedChanges;
+
+        // each layer is stored row by row
+        std::vector<std::vector<uint16_t>> _layers;
 
-        std::vector<std::vector<std::vector<uint16_t>>> _layers;
+        [[nodiscard]] bool ApplyChange(const shared::game::world::WorldChangeLogEntry& entry) noexcept;
 
         [[nodiscard]] bool LoadLayerFromJson(const nlohmann::json& json);
         [[nodiscard]] bool LoadLayerFromBinary(std::ifstream& fs) noexcept;
@@ -1,6 +1,7 @@
 #include <fstream>
 #include <random>
 #include <cmath>
+#include <chrono>
 
 #include "world.h"
 #include "engine/entities/world_entity.h"
@@ -15,18 +16,40 @@
 #include "networking/packets/server_client_character_set_details.h"
 #include "networking/packets/client_server_chatbox_message.h"
 #include "networking/packets/server_client_chatbox_message.h"
+#include "networking/packets/server_client_world_changes_chunk.h"
 #include "action_tile_actions/warp.h"
-#include "server/server.h"
 #include "time/clock.h"
 #include "api/logging/logging.h"
+#include "profiling/profiler.h"
+#include "metrics/metrics_registry.h"
 
 using namespace std::literals;
 
 namespace projectfarm::engine::world
 {
+    namespace
+    {
+        // the world entity update only carries recent changes. Older changes are
+        // sent in chunks when a player loads the world
+        constexpr uint64_t RecentChangesWindowInMicroseconds {10'000'000u};
+
+        constexpr uint32_t MaxChangesPerChunk {4096u};
+
+        constexpr uint64_t CheckpointIntervalInMilliseconds {5000u};
+
+        // capturing a checkpoint should not be noticeable in a tick
+        constexpr int64_t MaxCheckpointCaptureInMicroseconds {1000};
+    }
+
     bool World::Load(const std::string& name, const std::filesystem::path& filePath)
+    {
+        return this->LoadData(name, filePath) && this->Start();
+    }
+
+    bool World::LoadData(const std::string& name, const std::filesystem::path& filePath) noexcept
     {
         this->_timer = std::make_shared<shared::time::Timer>();
+        this->_timerWheel = std::make_shared<shared::time::TimerWheel>();
 
         this->_plots->SetDataProvider(this->_dataProvider);
         if (!this->_plots->Load(name))
@@ -41,20 +64,226 @@ namespace projectfarm::engine::world
             return false;
         }
 
+        return true;
+    }
+
+    bool World::Start() noexcept
+    {
+        this->CreateMetrics();
+
+        if (!this->InitiateScript())
+        {
+            shared::api::logging::Log("Failed to initiate script for world: " + this->_name);
+            return false;
+        }
+
         if (!this->AddWorldEntity())
         {
             shared::api::logging::Log("Failed to add world entity for world: " + this->_name);
             return false;
         }
 
+        this->RestoreCharacters();
+        this->StartCheckpoints();
+
         shared::api::logging::Log("Loaded world file: " + this->_name);
 
         return true;
     }
 
+    bool World::LoadCheckpoint() noexcept
+    {
+        if (this->_checkpointDirectory.empty())
+        {
+            shared::api::logging::Log("No checkpoint folder set for world: " + this->_name);
+            return false;
+        }
+
+        shared::game::world::WorldCheckpointStore store(this->_checkpointDirectory, this->_name);
+
+        auto checkpoint = store.Restore();
+        if (!checkpoint)
+        {
+            shared::api::logging::Log("Failed to find checkpoint: " + store.GetBaseFilePath().u8string());
+            return false;
+        }
+
+        if (checkpoint->IslandChanges.size() > this->_islands.size())
+        {
+            shared::api::logging::Log("Checkpoint has more islands than the world: " + this->_name);
+            return false;
+        }
+
+        for (auto i = 0u; i < checkpoint->IslandChanges.size(); ++i)
+        {
+            this->_islands[i]->RestoreChanges(checkpoint->IslandChanges[i]);
+        }
+
+        // the game time carries on, so restored changes stay older than any new change
+        this->_timer->Reset(checkpoint->GameTime);
+        this->_timerWheel = std::make_shared<shared::time::TimerWheel>(checkpoint->GameTime / 1000u);
+
+        this->_scriptCheckpointState = checkpoint->ScriptState;
+
+        shared::api::logging::Log("Restored world: " + this->_name + " from checkpoint: " +
+                                  std::to_string(checkpoint->Sequence));
+
+        this->_restoredCheckpoint = std::move(checkpoint);
+
+        return true;
+    }
+
+    void World::RestoreCharacters() noexcept
+    {
+        if (!this->_restoredCheckpoint)
+        {
+            return;
+        }
+
+        // the world script adds the same characters in the same order each time it starts,
+        // so each is matched to the next checkpoint of its type
+        const auto& entities = this->_restoredCheckpoint->Entities;
+        auto nextEntity = entities.begin();
+
+        for (const auto& entity : this->_entities)
+        {
+            if (entity->GetEntityType() != shared::entities::EntityTypes::Character || entity->IsPlayer())
+            {
+                continue;
+            }
+
+            auto character = std::static_pointer_cast<entities::Character>(entity);
+
+            auto entityIt = std::find_if(nextEntity, entities.end(), [&character](const auto& e)
+            {
+                return e.CharacterType == character->GetCharacterType();
+            });
+
+            if (entityIt == entities.end())
+            {
+                shared::api::logging::Log("Failed to find checkpoint for character of type: " +
+                                          character->GetCharacterType());
+                continue;
+            }
+
+            character->RestoreCheckpoint(*entityIt);
+            nextEntity = std::next(entityIt);
+        }
+    }
+
+    void World::CreateMetrics() noexcept
+    {
+        auto& registry = shared::metrics::MetricsRegistry::GetGlobal();
+
+        this->_tickDuration = &registry.GetHistogram("projectfarm_world_tick_duration_microseconds",
+                                                     "How long a world's tick takes.", {{"world", this->_name}});
+        this->_numberOfPlayers = &registry.GetGauge("projectfarm_world_players",
+                                                    "Players in a world.", {{"world", this->_name}});
+    }
+
+    void World::StartCheckpoints() noexcept
+    {
+        if (this->_checkpointDirectory.empty())
+        {
+            return;
+        }
+
+        this->_checkpointWriter = std::make_unique<shared::game::world::WorldCheckpointWriter>(
+                this->_checkpointDirectory, this->_name);
+
+        if (this->_restoredCheckpoint)
+        {
+            this->_checkpointWriter->Seed(*this->_restoredCheckpoint);
+            this->_restoredCheckpoint.reset();
+        }
+
+        if (!this->_checkpointWriter->Start())
+        {
+            shared::api::logging::Log("Failed to start checkpoints for world: " + this->_name);
+            this->_checkpointWriter.reset();
+            return;
+        }
+
+        for (auto& island : this->_islands)
+        {
+            island->SetIsCheckpointing(true);
+        }
+
+        this->_checkpointTimer = this->_timerWheel->ScheduleRecurring(CheckpointIntervalInMilliseconds, [this]()
+        {
+            this->SubmitCheckpoint();
+        });
+    }
+
+    void World::StopCheckpoints() noexcept
+    {
+        if (!this->_checkpointWriter)
+        {
+            return;
+        }
+
+        this->_timerWheel->Cancel(this->_checkpointTimer);
+        this->_checkpointTimer = shared::time::TimerWheel::InvalidHandle;
+
+        // the latest state is written before the writer stops
+        this->SubmitCheckpoint();
+
+        this->_checkpointWriter->Stop();
+        this->_checkpointWriter.reset();
+    }
+
+    void World::SubmitCheckpoint() noexcept
+    {
+        auto startTime = std::chrono::steady_clock::now();
+
+        shared::game::world::WorldCheckpoint checkpoint;
+        checkpoint.WorldName = this->_name;
+        checkpoint.GameTime = this->_timer->GetTotalGameDurationInMicroseconds();
+
+        checkpoint.IslandChanges.reserve(this->_islands.size());
+        for (auto& island : this->_islands)
+        {
+            checkpoint.IslandChanges.emplace_back(island->TakeUncheckpointedChanges());
+        }
+
+        // players are persisted by the data manager
+        for (const auto& entity : this->_entities)
+        {
+            if (entity->GetEntityType() == shared::entities::EntityTypes::Character && !entity->IsPlayer())
+            {
+                checkpoint.Entities.emplace_back(
+                        std::static_pointer_cast<entities::Character>(entity)->CaptureCheckpoint());
+            }
+        }
+
+        checkpoint.ScriptState = this->_scriptCheckpointState;
+
+        this->_checkpointWriter->Submit(std::move(checkpoint));
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - startTime).count();
+
+        if (elapsed > MaxCheckpointCaptureInMicroseconds)
+        {
+            shared::api::logging::Log("Checkpoint for world: " + this->_name + " took " +
+                                      std::to_string(elapsed) + "us.");
+        }
+    }
+
     bool World::LoadFromFile(const std::filesystem::path& filePath) noexcept
     {
-        if (filePath.extension() == ".bin")
+        // a cooked world already has its plot names resolved to indexes
+        if (auto cookedFile = this->_dataProvider->OpenCookedAsset(filePath);
+            cookedFile && shared::BinaryWorldFile::IsBinaryWorldData(cookedFile->GetData()))
+        {
+            shared::BinaryWorldFile file;
+            if (!file.Open(cookedFile->GetData()) || !this->LoadFromBinaryWorld(file))
+            {
+                shared::api::logging::Log("Failed to load world from cooked file for: " + filePath.u8string());
+                return false;
+            }
+        }
+        else if (filePath.extension() == ".bin")
         {
             if (!this->LoadFromBinaryFile(filePath))
             {
@@ -71,17 +300,16 @@ namespace projectfarm::engine::world
             }
         }
 
-        if (!this->InitiateScript())
-        {
-            shared::api::logging::Log("Failed to initiate script");
-            return false;
-        }
-
         return true;
     }
 
     bool World::LoadFromBinaryFile(const std::filesystem::path& filePath)
     {
+        if (shared::BinaryWorldFile::IsBinaryWorldFile(filePath))
+        {
+            return this->LoadFromBinaryWorldFile(filePath);
+        }
+
         std::ifstream fs(filePath, std::ios::binary);
 
         if (!fs.is_open())
@@ -101,21 +329,51 @@ namespace projectfarm::engine::world
         return true;
     }
 
+    bool World::LoadFromBinaryWorldFile(const std::filesystem::path& filePath) noexcept
+    {
+        shared::BinaryWorldFile file;
+        if (!file.Open(filePath))
+        {
+            shared::api::logging::Log("Failed to open binary world: " + filePath.u8string());
+            return false;
+        }
+
+        return this->LoadFromBinaryWorld(file);
+    }
+
+    bool World::LoadFromBinaryWorld(const shared::BinaryWorldFile& file) noexcept
+    {
+        this->_name = file.GetName();
+
+        for (const auto& islandView : file.GetIslands())
+        {
+            auto island = std::make_shared<Island>();
+            if (!island->LoadFromBinaryWorld(file, islandView, this->_plots))
+            {
+                shared::api::logging::Log("Failed to load island from binary world: " + this->_name);
+                return false;
+            }
+
+            this->_islands.emplace_back(std::move(island));
+        }
+
+        return true;
+    }
+
     bool World::LoadFromJsonFile(const std::filesystem::path& filePath)
     {
         // nlohmann::json can throw exceptions
         try
         {
-            std::ifstream file(filePath);
+            auto json = this->_dataProvider->LoadJsonAsset(filePath);
 
-            if (!file.is_open())
+            if (!json)
             {
                 shared::api::logging::Log("Failed to open world file: " + filePath.u8string());
                 return false;
             }
 
-            nlohmann::json jsonFile;
-            file >> jsonFile;
+            auto& jsonFile = *json;
 
             this->_name = jsonFile["name"].get<std::string>();
 
@@ -195,6 +453,8 @@ namespace projectfarm::engine::world
 
     void World::Shutdown()
     {
+        this->StopCheckpoints();
+
         for (auto& entity : this->_entities)
         {
             entity->Deactivate();
@@ -271,6 +531,7 @@ namespace projectfarm::engine::world
     {
         auto entity = std::make_shared<T>(args...);
         entity->SetTimer(this->_timer);
+        entity->SetTimerWheel(this->_timerWheel);
 
         if (entityId > 0)
         {
@@ -282,15 +543,37 @@ namespace projectfarm::engine::world
 
     void World::Tick()
     {
+        PROFILE_ZONE("World::Tick");
+
+        std::optional<shared::metrics::ScopedTimer> tickTimer;
+        if (this->_tickDuration)
+        {
+            tickTimer.emplace(*this->_tickDuration);
+        }
+
+        {
+            PROFILE_ZONE("World::AdvanceTimers");
+            this->_timerWheel->Advance(this->_timer->GetTotalGameDurationInMicroseconds() / 1000u);
+        }
+
         this->UpdateEntities();
 
         this->ProcessActionTileActions();
 
-        this->_timer->IncrementFrame();
+        if (this->_fixedTickDurationInMicroseconds > 0u)
+        {
+            this->_timer->IncrementFrame(this->_fixedTickDurationInMicroseconds);
+        }
+        else
+        {
+            this->_timer->IncrementFrame();
+        }
     }
 
     void World::UpdateEntities()
     {
+        PROFILE_ZONE("World::UpdateEntities");
+
         for (auto& entity : this->_entities)
         {
             entity->Tick();
@@ -306,24 +589,41 @@ namespace projectfarm::engine::world
     {
         std::vector<std::byte> data;
 
+        auto currentTime = this->_timer->GetTotalGameDurationInMicroseconds();
+        auto sinceTime = currentTime > RecentChangesWindowInMicroseconds ?
+                         currentTime - RecentChangesWindowInMicroseconds : 0u;
+
         pfu::WriteUInt32(data, static_cast<uint32_t>(this->_islands.size()));
         for (const auto& island : this->_islands)
         {
-            auto changeLog = island->GetChangeLog();
+            shared::game::world::EncodeWorldChanges(island->GetChangeLog().GetChanges(sinceTime), data);
+        }
+
+        return data;
+    }
 
-            pfu::WriteUInt32(data, static_cast<uint32_t>(changeLog.size()));
+    void World::SendWorldChangesToPlayer(const std::shared_ptr<engine::Player>& player) const noexcept
+    {
+        for (auto islandIndex = 0u; islandIndex < this->_islands.size(); ++islandIndex)
+        {
+            auto chunks = shared::game::world::EncodeWorldChangeChunks(
+                    this->_islands[islandIndex]->GetChangeLog().GetChanges(), MaxChangesPerChunk);
 
-            for (auto log = changeLog.rbegin(); log != changeLog.rend(); ++log)
+            for (auto chunkIndex = 0u; chunkIndex < chunks.size(); ++chunkIndex)
             {
-                pfu::WriteUInt8(data, log->LayerIndex);
-                pfu::WriteUInt32(data, log->TileX);
-                pfu::WriteUInt32(data, log->TileY);
-                pfu::WriteUInt64(data, log->Time);
-                pfu::WriteUInt16(data, log->PlotIndex);
+                const auto packet = std::static_pointer_cast<shared::networking::packets::ServerClientWorldChangesChunkPacket>(
+                        shared::networking::PacketFactory::CreatePacket(
+                                shared::networking::PacketTypes::ServerClientWorldChangesChunk));
+
+                packet->SetWorldName(this->_name);
+                packet->SetIslandIndex(static_cast<uint8_t>(islandIndex));
+                packet->SetChunkIndex(chunkIndex);
+                packet->SetNumberOfChunks(static_cast<uint32_t>(chunks.size()));
+                packet->SetData(std::move(chunks[chunkIndex]));
+
+                this->_packetSender->AddPacketToSend(player->GetNetworkClient()->GetSocket(), packet);
             }
         }
-
-        return data;
     }
 
     bool World::AddPlayer(const std::shared_ptr<engine::Player>& player,
@@ -388,6 +688,11 @@ namespace projectfarm::engine::world
 
         this->_players.push_back(player->GetPlayerId());
 
+        if (this->_numberOfPlayers)
+        {
+            this->_numberOfPlayers->Set(static_cast<int64_t>(this->_players.size()));
+        }
+
         // we need to start the world load on the client before they receive the
         // character details packet
         const auto serverClientLoadWorldPacket = std::static_pointer_cast<shared::networking::packets::ServerClientLoadWorldPacket>(
@@ -411,7 +716,7 @@ namespace projectfarm::engine::world
 
         this->SendPacketToAllPlayers(serverClientPlayerLeftWorld, playerId);
 
-        auto player = this->GetServer()->GetPlayerById(playerId);
+        auto player = this->GetWorldHost()->GetPlayerById(playerId);
         if (!player)
         {
             shared::api::logging::Log("Failed to get player with id: " + std::to_string(playerId));
@@ -423,6 +728,11 @@ namespace projectfarm::engine::world
 
         this->_players.remove(playerId);
 
+        if (this->_numberOfPlayers)
+        {
+            this->_numberOfPlayers->Set(static_cast<int64_t>(this->_players.size()));
+        }
+
         if (!this->RemoveWorldEntity(player->GetCharacter()))
         {
             shared::api::logging::Log("Failed to remove player's character with player id: " + std::to_string(playerId));
@@ -437,7 +747,7 @@ namespace projectfarm::engine::world
     {
         this->RemovePlayer(playerId);
 
-        if (!this->GetServer()->AddPlayerToWorld(playerId, entityId, destinationWorldName))
+        if (!this->GetWorldHost()->AddPlayerToWorld(playerId, entityId, destinationWorldName))
         {
             shared::api::logging::Log("Failed to move player with id: " + std::to_string(playerId) +
                              " to world: " + destinationWorldName +
@@ -466,7 +776,7 @@ namespace projectfarm::engine::world
             return false;
         }
 
-        if (!this->GetServer()->AddCharacterToWorld(character->GetCharacterType(),
+        if (!this->GetWorldHost()->AddCharacterToWorld(character->GetCharacterType(),
                                                     destinationWorldName, destinationTileType,
                                                     character->GetEntityId(),
                                                     character->GetPlayerId()))
@@ -556,6 +866,8 @@ namespace projectfarm::engine::world
     void World::BroadcastEntityState(const std::shared_ptr<engine::entities::Entity>& entity,
             uint64_t currentTime) const noexcept
     {
+        PROFILE_ZONE("World::BroadcastEntityState");
+
         const auto serverClientEntityUpdatePacket = std::static_pointer_cast<shared::networking::packets::ServerClientEntityUpdatePacket>(
                 shared::networking::PacketFactory::CreatePacket(
                         shared::networking::PacketTypes::ServerClientEntityUpdate));
@@ -602,7 +914,7 @@ namespace projectfarm::engine::world
                 continue;
             }
 
-            auto player = this->GetServer()->GetPlayerById(playerId);
+            auto player = this->GetWorldHost()->GetPlayerById(playerId);
             if (!player)
             {
                 shared::api::logging::Log("Failed to get player with id: " + std::to_string(playerId));
@@ -777,6 +1089,8 @@ namespace projectfarm::engine::world
 
         this->SendPacketToAllPlayers(serverClientPlayerJoinedWorld);
 
+        this->SendWorldChangesToPlayer(player);
+
         auto character = player->GetCharacter();
 
         // perhaps the world on the client took a while to load
@@ -929,6 +1243,8 @@ namespace projectfarm::engine::world
 
     void World::ProcessActionTileActions() noexcept
     {
+        PROFILE_ZONE("World::ProcessActionTileActions");
+
         for (const auto& action : this->_actionTileActions)
         {
             if (!action->Run())
@@ -9,12 +9,13 @@
 #include <memory>
 #include <map>
 #include <tuple>
+#include <optional>
 #include <nlohmann/json.hpp>
 
 #include "data/consume_data_provider.h"
 #include "engine/entities/entity.h"
 #include "time/timer.h"
-#include "server/consume_server.h"
+#include "consume_world_host.h"
 #include "island.h"
 #include "plots.h"
 #include "engine/player.h"
@@ -23,16 +24,19 @@
 #include "engine/entities/character.h"
 #include "engine/entities/consume_action_animations_manager.h"
 #include "time/consume_timer.h"
+#include "time/timer_wheel.h"
 #include "scripting/script.h"
 #include "scripting/script_system.h"
 #include "scripting/consume_script_system.h"
 #include "engine/world/action_tile_actions/action_tile_action_base.h"
 #include "engine/data/consume_data_manager.h"
+#include "game/world/world_checkpoint.h"
+#include "metrics/metrics.h"
 
 namespace projectfarm::engine::world
 {
     class World final : public shared::ConsumeDataProvider,
-                        public server::ConsumeServer,
+                        public ConsumeWorldHost,
                         public shared::networking::ConsumePacketSender,
                         public shared::scripting::ConsumeScriptSystem,
                         public shared::time::ConsumeTimer,
@@ -48,8 +52,40 @@ namespace projectfarm::engine::world
         ~World() override = default;
 
         [[nodiscard]] bool Load(const std::string& name, const std::filesystem::path& filePath);
+
+        // loads the plots and islands, and can be called from any thread
+        [[nodiscard]] bool LoadData(const std::string& name, const std::filesystem::path& filePath) noexcept;
+
+        // restores the islands and game time from the latest checkpoint, so must be called
+        // after `LoadData` and before `Start`. The characters are restored in `Start`
+        [[nodiscard]] bool LoadCheckpoint() noexcept;
+
+        // runs the world script, so must be called from the script thread after `LoadData`
+        [[nodiscard]] bool Start() noexcept;
         void Shutdown();
 
+        // each tick moves the game time on by this much, rather than by how long the
+        // last tick took, so a run can be repeated. 0 uses the clock
+        void SetFixedTickDurationInMicroseconds(uint64_t fixedTickDurationInMicroseconds) noexcept
+        {
+            this->_fixedTickDurationInMicroseconds = fixedTickDurationInMicroseconds;
+        }
+
+        void SetCheckpointDirectory(const std::filesystem::path& checkpointDirectory) noexcept
+        {
+            this->_checkpointDirectory = checkpointDirectory;
+        }
+
+        [[nodiscard]] const std::string& GetScriptCheckpointState() const noexcept
+        {
+            return this->_scriptCheckpointState;
+        }
+
+        void SetScriptCheckpointState(const std::string& state) noexcept
+        {
+            this->_scriptCheckpointState = state;
+        }
+
         [[nodiscard]] const std::string& GetName() const noexcept
         {
             return this->_name;
@@ -104,6 +140,11 @@ namespace projectfarm::engine::world
                              const std::string& destinationTileType,
                              uint32_t entityId, uint32_t playerId) noexcept;
 
+        [[nodiscard]] const std::list<std::shared_ptr<entities::Entity>>& GetEntities() const noexcept
+        {
+            return this->_entities;
+        }
+
         [[nodiscard]] std::vector<std::shared_ptr<Island>>& GetIslands() noexcept
         {
             return this->_islands;
@@ -115,6 +156,8 @@ namespace projectfarm::engine::world
 
         [[nodiscard]] bool LoadFromJsonFile(const std::filesystem::path& filePath);
         [[nodiscard]] bool LoadFromBinaryFile(const std::filesystem::path& filePath);
+        [[nodiscard]] bool LoadFromBinaryWorldFile(const std::filesystem::path& filePath) noexcept;
+        [[nodiscard]] bool LoadFromBinaryWorld(const shared::BinaryWorldFile& file) noexcept;
 
         [[nodiscard]] bool LoadFromFile(const std::filesystem::path& filePath) noexcept;
         [[nodiscard]] bool LoadIsland(const nlohmann::json& islandJson); // can throw
@@ -135,16 +178,44 @@ namespace projectfarm::engine::world
         void SendPacketToAllPlayers(const std::shared_ptr<shared::networking::Packet>& packet,
                                     uint32_t exceptPlayerId = 0, uint64_t milliseconds = 0,
                                     bool forcePacketVital = false) const noexcept;
+        void SendWorldChangesToPlayer(const std::shared_ptr<engine::Player>& player) const noexcept;
 
         std::list<std::shared_ptr<entities::Entity>> _entities;
         std::list<uint32_t> _players;
 
         std::shared_ptr<shared::time::Timer> _timer;
+        uint64_t _fixedTickDurationInMicroseconds {0u};
+
+        // script update intervals, persistence intervals and delayed actions for this world
+        std::shared_ptr<shared::time::TimerWheel> _timerWheel;
 
         std::shared_ptr<Plots> _plots;
 
         std::shared_ptr<shared::scripting::Script> _script;
 
+        std::filesystem::path _checkpointDirectory;
+        std::unique_ptr<shared::game::world::WorldCheckpointWriter> _checkpointWriter;
+        shared::time::TimerHandle _checkpointTimer {shared::time::TimerWheel::InvalidHandle};
+
+        // kept from `LoadCheckpoint` until the characters are restored in `Start`
+        std::optional<shared::game::world::WorldCheckpoint> _restoredCheckpoint;
+
+        std::string _scriptCheckpointState;
+
+        // in the global metrics registry, labelled with this world's name
+        shared::metrics::Histogram* _tickDuration {nullptr};
+        shared::metrics::Gauge* _numberOfPlayers {nullptr};
+
+        void CreateMetrics() noexcept;
+
+        void RestoreCharacters() noexcept;
+
+        void StartCheckpoints() noexcept;
+        void StopCheckpoints() noexcept;
+
+        // only copies what changed since the last checkpoint, as it runs during a tick
+        void SubmitCheckpoint() noexcept;
+
         [[nodiscard]]
         std::shared_ptr<entities::Character> CreateCharacter(const std::string& type,
                                                              uint32_t entityId, uint32_t playerId = 0) noexcept;
@@ -0,0 +1,38 @@
+#ifndef PROJECTFARM_WORLD_HOST_H
+#define PROJECTFARM_WORLD_HOST_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace projectfarm::engine
+{
+    class Player;
+}
+
+namespace projectfarm::engine::world
+{
+    // what a world needs from whatever runs it, which is the server, or a benchmark
+    // running a world on its own
+    class WorldHost
+    {
+    public:
+        WorldHost() = default;
+        virtual ~WorldHost() = default;
+
+        [[nodiscard]]
+        virtual std::shared_ptr<engine::Player> GetPlayerById(uint32_t playerId) const noexcept = 0;
+
+        [[nodiscard]]
+        virtual bool AddPlayerToWorld(uint32_t playerId, uint32_t entityId,
+                                      const std::string& destinationWorldName) noexcept = 0;
+
+        [[nodiscard]]
+        virtual bool AddCharacterToWorld(const std::string& characterType,
+                                         const std::string& destinationWorldName,
+                                         const std::string& destinationTileType,
+                                         uint32_t entityId, uint32_t playerId) noexcept = 0;
+    };
+}
+
+#endif
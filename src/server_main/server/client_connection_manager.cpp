@@ -1,6 +1,7 @@
 #include "client_connection_manager.h"
 #include "server.h"
 #include "api/logging/logging.h"
+#include "profiling/profiler.h"
 
 namespace projectfarm::server
 {
@@ -39,6 +40,13 @@ namespace projectfarm::server
             this->_clientConnectionManagerWorker->StopThread();
         }
 
+		if (this->_captureWriter.IsOpen())
+        {
+		    shared::api::logging::Log("Captured " + std::to_string(this->_captureWriter.GetNumberOfRecords()) +
+		                              " packets and connections.");
+		    this->_captureWriter.Close();
+        }
+
 		shared::api::logging::Log("Shut down session client manager");
 	}
 
@@ -51,10 +59,18 @@ namespace projectfarm::server
 
 	    std::scoped_lock<std::mutex> lock(this->_itemsMutex);
 
+	    // everything given to the server in a tick has the same time, so a replay can do the same
+	    auto captureTime = this->_captureWriter.IsOpen() ? this->GetCaptureTime() : 0u;
+
 	    for (const auto& client : this->_clientsToAdd)
         {
 	        shared::api::logging::Log("Added client: " + client->IPAddressAsString());
 
+	        if (this->_captureWriter.IsOpen())
+            {
+	            this->_captureWriter.WriteClientAdded(captureTime, this->GetCaptureClientId(client));
+            }
+
 	        server->OnClientAdd(client);
         }
 
@@ -64,6 +80,12 @@ namespace projectfarm::server
         {
             shared::api::logging::Log("Removed client: " + client->IPAddressAsString());
 
+            if (this->_captureWriter.IsOpen())
+            {
+                this->_captureWriter.WriteClientRemoved(captureTime, this->GetCaptureClientId(client));
+                this->_captureClientIds.erase(client.get());
+            }
+
             server->OnClientRemove(client);
         }
 
@@ -71,6 +93,22 @@ namespace projectfarm::server
 
         for (const auto& item : this->_packetsToProcess)
         {
+            PROFILE_ZONE("ClientConnectionManager::OnPacketReceive");
+
+            if (this->_captureWriter.IsOpen())
+            {
+                if (item._client)
+                {
+                    this->_captureWriter.WriteTCPPacket(captureTime, this->GetCaptureClientId(item._client),
+                                                        *item._packet);
+                }
+                else
+                {
+                    this->_captureWriter.WriteUDPPacket(captureTime, item._ipAddress.host,
+                                                        item._ipAddress.port, *item._packet);
+                }
+            }
+
             server->OnReceivePacket(item._packet, item._client, item._ipAddress);
         }
 
@@ -79,6 +117,39 @@ namespace projectfarm::server
 	    this->_hasItemsToProcess = false;
     }
 
+    bool ClientConnectionManager::StartCapture(const std::filesystem::path& filePath) noexcept
+    {
+        if (!this->_captureWriter.Open(filePath))
+        {
+            return false;
+        }
+
+        this->_captureStartTime = std::chrono::steady_clock::now();
+        this->_captureClientIds.clear();
+        this->_nextCaptureClientId = 1u;
+
+        shared::api::logging::Log("Capturing packets to: " + filePath.u8string());
+
+        return true;
+    }
+
+    uint64_t ClientConnectionManager::GetCaptureTime() const noexcept
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - this->_captureStartTime).count());
+    }
+
+    uint32_t ClientConnectionManager::GetCaptureClientId(const std::shared_ptr<Client>& client) noexcept
+    {
+        auto [it, added] = this->_captureClientIds.try_emplace(client.get(), this->_nextCaptureClientId);
+        if (added)
+        {
+            ++this->_nextCaptureClientId;
+        }
+
+        return it->second;
+    }
+
     void ClientConnectionManager::OnClientAdd(const std::shared_ptr<Client> &client) noexcept
     {
         std::scoped_lock<std::mutex> lock(this->_itemsMutex);
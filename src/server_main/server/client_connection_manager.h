@@ -5,11 +5,15 @@
 #include <atomic>
 #include <mutex>
 #include <vector>
+#include <chrono>
+#include <filesystem>
+#include <unordered_map>
 
 #include <SDL_net.h>
 
 #include "client.h"
 #include "networking/packet_sender.h"
+#include "networking/packet_capture.h"
 #include "client_connection_manager_worker.h"
 #include "server_config.h"
 
@@ -28,11 +32,15 @@ namespace projectfarm::server
 
         void Shutdown() noexcept;
 
-        // we have to pass the server in here rather than use `consume_server`
+        // we have to pass the server in here rather than keep hold of it, as a world does with its host,
         // as otherwise on shutdown there will be memory leaks.
         // this seems to to be due to a cyclic shutdown dependency
         void Tick(const std::shared_ptr<Server>& server) noexcept;
 
+        // records everything given to the server, in the order it is given, so it can be replayed
+        [[nodiscard]]
+        bool StartCapture(const std::filesystem::path& filePath) noexcept;
+
     private:
         std::unique_ptr<ClientConnectionManagerWorker> _clientConnectionManagerWorker;
 
@@ -56,6 +64,18 @@ namespace projectfarm::server
         std::vector<std::shared_ptr<Client>> _clientsToAdd;
         std::vector<std::shared_ptr<Client>> _clientsToRemove;
         std::vector<PacketToProcessType> _packetsToProcess;
+
+        // only used from `Tick`
+        shared::networking::PacketCaptureWriter _captureWriter;
+        std::chrono::steady_clock::time_point _captureStartTime;
+        std::unordered_map<const Client*, uint32_t> _captureClientIds;
+        uint32_t _nextCaptureClientId {1u};
+
+        [[nodiscard]]
+        uint64_t GetCaptureTime() const noexcept;
+
+        [[nodiscard]]
+        uint32_t GetCaptureClientId(const std::shared_ptr<Client>& client) noexcept;
 	};
 }
 
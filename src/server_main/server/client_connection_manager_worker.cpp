@@ -1,6 +1,7 @@
 #include "client_connection_manager_worker.h"
 #include "networking/packet_factory.h"
 #include "api/logging/logging.h"
+#include "profiling/allocation_tracker.h"
 
 namespace projectfarm::server
 {
@@ -32,6 +33,8 @@ namespace projectfarm::server
     {
         shared::api::logging::Log("In worker thread for client connection manager");
 
+        ALLOCATION_SCOPE(Networking);
+
         if (!this->Initialize())
         {
             shared::api::logging::Log("Failed to initialize client connection manager worker.");
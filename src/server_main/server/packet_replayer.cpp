@@ -0,0 +1,123 @@
+#include "packet_replayer.h"
+#include "server.h"
+#include "api/logging/logging.h"
+#include "profiling/profiler.h"
+
+namespace projectfarm::server
+{
+    bool PacketReplayer::Open(const std::filesystem::path& filePath, double speed) noexcept
+    {
+        if (!this->_reader.Open(filePath))
+        {
+            return false;
+        }
+
+        this->_speed = speed;
+
+        this->_hasNextRecord = this->_reader.ReadNext(this->_nextRecord);
+        if (!this->_hasNextRecord)
+        {
+            shared::api::logging::Log("Packet capture is empty: " + filePath.u8string());
+            return false;
+        }
+
+        this->_hasStarted = false;
+        this->_firstRecordTime = this->_nextRecord.TimeInMicroseconds;
+        this->_lastRecordTime = this->_firstRecordTime;
+        this->_numberOfRecordsReplayed = 0u;
+        this->_clients.clear();
+
+        shared::api::logging::Log("Replaying packets from: " + filePath.u8string());
+
+        return true;
+    }
+
+    bool PacketReplayer::Tick(const std::shared_ptr<Server>& server) noexcept
+    {
+        PROFILE_ZONE("PacketReplayer::Tick");
+
+        if (!this->_hasNextRecord)
+        {
+            return false;
+        }
+
+        // the capture starts when the first record is due, not when the server did
+        if (!this->_hasStarted)
+        {
+            this->_startTime = std::chrono::steady_clock::now();
+            this->_hasStarted = true;
+        }
+
+        uint64_t dueTime {this->_nextRecord.TimeInMicroseconds};
+        if (this->_speed > 0.0)
+        {
+            auto elapsed = std::chrono::duration<double, std::micro>(
+                    std::chrono::steady_clock::now() - this->_startTime).count();
+
+            dueTime = this->_firstRecordTime + static_cast<uint64_t>(elapsed * this->_speed);
+        }
+
+        while (this->_hasNextRecord && this->_nextRecord.TimeInMicroseconds <= dueTime)
+        {
+            this->Replay(server, this->_nextRecord);
+
+            this->_lastRecordTime = this->_nextRecord.TimeInMicroseconds;
+            ++this->_numberOfRecordsReplayed;
+
+            this->_hasNextRecord = this->_reader.ReadNext(this->_nextRecord);
+        }
+
+        return this->_hasNextRecord;
+    }
+
+    void PacketReplayer::Replay(const std::shared_ptr<Server>& server,
+                                const shared::networking::PacketCaptureRecord& record) noexcept
+    {
+        switch (record.Type)
+        {
+            case shared::networking::PacketCaptureRecordTypes::ClientAdded:
+            {
+                auto client = std::make_shared<Client>(nullptr, nullptr);
+                this->_clients[record.ClientId] = client;
+
+                server->OnClientAdd(client);
+                break;
+            }
+            case shared::networking::PacketCaptureRecordTypes::ClientRemoved:
+            {
+                auto client = this->_clients.find(record.ClientId);
+                if (client == this->_clients.end())
+                {
+                    shared::api::logging::Log("Replayed client was not added: " + std::to_string(record.ClientId));
+                    break;
+                }
+
+                server->OnClientRemove(client->second);
+
+                this->_clients.erase(client);
+                break;
+            }
+            case shared::networking::PacketCaptureRecordTypes::TCPPacket:
+            {
+                auto client = this->_clients.find(record.ClientId);
+                if (client == this->_clients.end())
+                {
+                    shared::api::logging::Log("Replayed client was not added: " + std::to_string(record.ClientId));
+                    break;
+                }
+
+                server->OnReceivePacket(record.ReceivedPacket, client->second, {});
+                break;
+            }
+            case shared::networking::PacketCaptureRecordTypes::UDPPacket:
+            {
+                IPaddress ipAddress {};
+                ipAddress.host = record.Host;
+                ipAddress.port = record.Port;
+
+                server->OnReceivePacket(record.ReceivedPacket, nullptr, ipAddress);
+                break;
+            }
+        }
+    }
+}
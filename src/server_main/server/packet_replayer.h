@@ -0,0 +1,79 @@
+#ifndef PROJECTFARM_PACKET_REPLAYER_H
+#define PROJECTFARM_PACKET_REPLAYER_H
+
+#include <cstdint>
+#include <memory>
+#include <chrono>
+#include <filesystem>
+#include <unordered_map>
+
+#include "client.h"
+#include "networking/packet_capture.h"
+
+namespace projectfarm::server
+{
+    class Server;
+
+    // Gives the server a capture from `ClientConnectionManager` in place of real clients.
+    // The clients have no sockets, so the packet sender should be discarding packets.
+    class PacketReplayer final
+    {
+    public:
+        PacketReplayer() = default;
+        ~PacketReplayer() = default;
+
+        PacketReplayer(const PacketReplayer&) = delete;
+        PacketReplayer(PacketReplayer&&) = delete;
+
+        // `speed` is how much faster than it was captured to replay. At 0, each tick
+        // gets what one captured tick did, as fast as the server can go.
+        [[nodiscard]]
+        bool Open(const std::filesystem::path& filePath, double speed) noexcept;
+
+        // gives the server everything that is due, false once the capture is finished
+        [[nodiscard]]
+        bool Tick(const std::shared_ptr<Server>& server) noexcept;
+
+        [[nodiscard]]
+        bool HasError() const noexcept
+        {
+            return this->_reader.HasError();
+        }
+
+        [[nodiscard]]
+        uint64_t GetNumberOfRecordsReplayed() const noexcept
+        {
+            return this->_numberOfRecordsReplayed;
+        }
+
+        // from the first record to the last one replayed
+        [[nodiscard]]
+        uint64_t GetCaptureDurationInMicroseconds() const noexcept
+        {
+            return this->_lastRecordTime - this->_firstRecordTime;
+        }
+
+    private:
+        shared::networking::PacketCaptureReader _reader;
+
+        shared::networking::PacketCaptureRecord _nextRecord;
+        bool _hasNextRecord {false};
+
+        double _speed {1.0};
+
+        bool _hasStarted {false};
+        std::chrono::steady_clock::time_point _startTime;
+
+        uint64_t _firstRecordTime {0u};
+        uint64_t _lastRecordTime {0u};
+        uint64_t _numberOfRecordsReplayed {0u};
+
+        // by the id they were captured with
+        std::unordered_map<uint32_t, std::shared_ptr<Client>> _clients;
+
+        void Replay(const std::shared_ptr<Server>& server,
+                    const shared::networking::PacketCaptureRecord& record) noexcept;
+    };
+}
+
+#endif
@@ -1,5 +1,8 @@
 #include <string>
+#include <map>
 #include <thread>
+#include <chrono>
+#include <csignal>
 #include <SDL_net.h>
 
 #include "server.h"
@@ -9,12 +12,31 @@
 #include "networking/packets/client_server_player_authenticate.h"
 #include "networking/packets/client_server_request_hashed_password.h"
 #include "networking/packets/server_client_send_hashed_password.h"
+#include "networking/packets/client_server_ping.h"
+#include "networking/packets/server_client_pong.h"
 #include "api/logging/logging.h"
+#include "platform/platform_id.h"
+#include "concurrency/startup_loader.h"
+#include "profiling/profiler.h"
+#include "metrics/metrics_registry.h"
+
+namespace
+{
+    // set from the signal handler, so must only be a `sig_atomic_t`
+    volatile std::sig_atomic_t exportProfilesRequested {0};
+
+    void RequestProfilesExport(int)
+    {
+        exportProfilesRequested = 1;
+    }
+}
 
 namespace projectfarm::server
 {
 	void Server::Run(int argc, char* argv[])
 	{
+		shared::api::logging::InstallLogCrashHandlers();
+
 		shared::api::logging::Log("Starting server...");
 
         this->_systemArguments.SetArguments(argc, argv);
@@ -36,6 +58,15 @@ namespace projectfarm::server
 	{
 		shared::api::logging::Log("Initializing server...");
 
+		// this is the cold start time, which cooked assets are meant to reduce
+		auto startTime = std::chrono::steady_clock::now();
+
+		if (this->_systemArguments.GetTrackAllocations())
+        {
+		    shared::profiling::AllocationTracker::SetEnabled(true);
+		    this->_allocationMetrics = std::make_unique<shared::profiling::AllocationMetrics>();
+        }
+
 		if (SDL_Init(SDL_INIT_EVENTS) < 0)
         {
 		    shared::api::logging::Log("Failed to init SDL.");
@@ -63,6 +94,12 @@ namespace projectfarm::server
 		    return false;
         }
 
+        if (!this->StartMetricsServer())
+        {
+            shared::api::logging::Log("Failed to start metrics server.");
+            return false;
+        }
+
 		this->_randomEngine->Initialize();
 
 		this->_dataManager->SetDataProvider(this->_dataProvider);
@@ -78,16 +115,38 @@ namespace projectfarm::server
 			return false;
 		}
 
+		// a replay has no clients to send to, and nothing to receive but the capture
+		this->_packetSender->SetDiscardPackets(this->IsReplaying());
+
 		if (!this->_packetSender->Initialize())
 		{
 			shared::api::logging::Log("Failed to initialize packet sender.");
 			return false;
 		}
 
-        if (!this->_clientConnectionManager.Initialize(this->_serverConfig))
+		if (this->IsReplaying())
         {
-            shared::api::logging::Log("Failed to initialize client connection manager.");
-            return false;
+		    if (!this->_packetReplayer.Open(this->_systemArguments.GetReplayPath(),
+		                                    this->_systemArguments.GetReplaySpeed()))
+            {
+		        shared::api::logging::Log("Failed to open packet capture.");
+		        return false;
+            }
+        }
+		else
+        {
+            if (!this->_clientConnectionManager.Initialize(this->_serverConfig))
+            {
+                shared::api::logging::Log("Failed to initialize client connection manager.");
+                return false;
+            }
+
+            if (const auto& capturePath = this->_systemArguments.GetCapturePacketsPath();
+                !capturePath.empty() && !this->_clientConnectionManager.StartCapture(capturePath))
+            {
+                shared::api::logging::Log("Failed to start packet capture.");
+                return false;
+            }
         }
 
         this->_scriptSystem->SetScriptFactory(this->_scriptFactory);
@@ -99,6 +158,26 @@ namespace projectfarm::server
             return false;
         }
 
+        if (this->_systemArguments.GetProfileScripts())
+        {
+            this->_scriptSystem->StartProfiling();
+        }
+
+        if (this->_systemArguments.GetProfileTicks())
+        {
+            shared::profiling::Profiler::SetThreadName("main");
+            shared::profiling::Profiler::SetEnabled(true);
+        }
+
+#if !defined(IS_WINDOWS)
+        if (this->_systemArguments.GetProfileScripts() || this->_systemArguments.GetProfileTicks())
+        {
+            // the server has no console, so `kill -USR1 <pid>` is used to ask for a profile
+            std::signal(SIGUSR1, &RequestProfilesExport);
+            shared::api::logging::Log("Send SIGUSR1 to export the profiles.");
+        }
+#endif
+
         this->_actionAnimationsManager->SetDataProvider(this->_dataProvider);
         this->_actionAnimationsManager->SetRandomEngine(this->_randomEngine);
         if (!this->_actionAnimationsManager->Load())
@@ -115,7 +194,10 @@ namespace projectfarm::server
 
 		this->_shouldQuit = false;
 
-		shared::api::logging::Log("Initialized server.");
+		auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+		        std::chrono::steady_clock::now() - startTime).count();
+
+		shared::api::logging::Log("Initialized server in " + std::to_string(elapsed) + "ms.");
 
 		return true;
 	}
@@ -126,16 +208,142 @@ namespace projectfarm::server
 
         auto thisServer = this->shared_from_this();
 
+        auto& tickDuration = shared::metrics::MetricsRegistry::GetGlobal().GetHistogram(
+                "projectfarm_server_tick_duration_microseconds", "How long a server tick takes, for every world.");
+
+        auto startTime = std::chrono::steady_clock::now();
+
 		while (!this->_shouldQuit)
 		{
-		    this->HandleEvents();
+            PROFILE_ZONE("Server::Tick");
+            shared::metrics::ScopedTimer tickTimer(tickDuration);
 
-            this->_clientConnectionManager.Tick(thisServer);
+            {
+                PROFILE_ZONE("Server::HandleEvents");
+                this->HandleEvents();
+            }
+
+            if (this->IsReplaying())
+            {
+                ALLOCATION_SCOPE(Networking);
+
+                if (!this->_packetReplayer.Tick(thisServer))
+                {
+                    this->TellServerToQuit();
+                }
+            }
+            else
+            {
+                PROFILE_ZONE("ClientConnectionManager::Tick");
+                ALLOCATION_SCOPE(Networking);
+                this->_clientConnectionManager.Tick(thisServer);
+            }
 
             this->UpdateWorlds();
+
+            if (exportProfilesRequested)
+            {
+                exportProfilesRequested = 0;
+                this->ExportProfiles();
+            }
+
+            if (this->_allocationMetrics)
+            {
+                this->_allocationMetrics->Record();
+            }
 		}
+
+		if (this->IsReplaying())
+        {
+		    this->LogReplayResults(std::chrono::steady_clock::now() - startTime);
+        }
 	}
 
+    void Server::LogAllocations() const noexcept
+    {
+        auto snapshot = shared::profiling::AllocationTracker::GetSnapshot();
+
+        for (auto i = 0u; i < shared::profiling::NumberOfAllocationTags; ++i)
+        {
+            auto tag = static_cast<shared::profiling::AllocationTags>(i);
+
+            shared::api::logging::Log("Allocations for " +
+                                      std::string(shared::profiling::AllocationTracker::GetTagName(tag)) + ": " +
+                                      std::to_string(snapshot[i].Allocations) + " allocations, " +
+                                      std::to_string(snapshot[i].Bytes) + " bytes.");
+        }
+    }
+
+    void Server::LogReplayResults(std::chrono::steady_clock::duration replayDuration) const noexcept
+    {
+        const auto& tickDuration = shared::metrics::MetricsRegistry::GetGlobal().GetHistogram(
+                "projectfarm_server_tick_duration_microseconds", "How long a server tick takes, for every world.");
+
+        auto count = tickDuration.GetCount();
+        auto mean = count > 0u ? tickDuration.GetSum() / count : 0u;
+
+        auto captureMilliseconds = this->_packetReplayer.GetCaptureDurationInMicroseconds() / 1000u;
+        auto replayMilliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(replayDuration).count();
+
+        shared::api::logging::Log((this->_packetReplayer.HasError() ? "Replay stopped at a corrupt record. " : "") +
+                                  std::string("Replayed ") +
+                                  std::to_string(this->_packetReplayer.GetNumberOfRecordsReplayed()) +
+                                  " records captured over " + std::to_string(captureMilliseconds) + "ms in " +
+                                  std::to_string(replayMilliseconds) + "ms.");
+
+        shared::api::logging::Log("Ticks: " + std::to_string(count) +
+                                  ", mean: " + std::to_string(mean) + "us" +
+                                  ", p50: " + std::to_string(tickDuration.GetValueAtPercentile(50.0)) + "us" +
+                                  ", p90: " + std::to_string(tickDuration.GetValueAtPercentile(90.0)) + "us" +
+                                  ", p99: " + std::to_string(tickDuration.GetValueAtPercentile(99.0)) + "us" +
+                                  ", p99.9: " + std::to_string(tickDuration.GetValueAtPercentile(99.9)) + "us" +
+                                  ", max: " + std::to_string(tickDuration.GetMax()) + "us.");
+    }
+
+    bool Server::StartMetricsServer() noexcept
+    {
+        auto port = this->_serverConfig->GetMetricsPort();
+        const auto& file = this->_serverConfig->GetMetricsFile();
+
+        if (port == 0 && file.empty())
+        {
+            return true;
+        }
+
+        this->_metricsServer = std::make_unique<shared::metrics::MetricsServer>(
+                shared::metrics::MetricsRegistry::GetGlobal());
+
+        if (port > 0)
+        {
+            this->_metricsServer->SetListenPort(port);
+        }
+
+        if (!file.empty())
+        {
+            this->_metricsServer->SetDumpFile(this->_systemArguments.GetBinaryPath() / file,
+                                              this->_serverConfig->GetMetricsDumpIntervalInSeconds() * 1000u);
+        }
+
+        return this->_metricsServer->Start();
+    }
+
+    void Server::ExportProfiles() noexcept
+    {
+        auto profilesPath = this->_systemArguments.GetBinaryPath() / "profiles";
+
+        if (this->_systemArguments.GetProfileScripts() &&
+            !this->_scriptSystem->ExportProfile(profilesPath))
+        {
+            shared::api::logging::Log("Failed to export script profile.");
+        }
+
+        if (this->_systemArguments.GetProfileTicks() &&
+            !shared::profiling::Profiler::ExportChromeTrace(profilesPath / "ticks.trace.json"))
+        {
+            shared::api::logging::Log("Failed to export tick profile.");
+        }
+    }
+
 	void Server::HandleEvents()
     {
 	    SDL_Event event;
@@ -158,6 +366,9 @@ namespace projectfarm::server
 
     void Server::UpdateWorlds()
     {
+        PROFILE_ZONE("Server::UpdateWorlds");
+        ALLOCATION_SCOPE(WorldTick);
+
 	    for (const auto& world : this->_worlds)
         {
             world->Tick();
@@ -181,6 +392,21 @@ namespace projectfarm::server
 
         this->_players.clear();
 
+        if (this->_systemArguments.GetProfileScripts() || this->_systemArguments.GetProfileTicks())
+        {
+            this->ExportProfiles();
+        }
+
+        if (this->_allocationMetrics)
+        {
+            this->LogAllocations();
+        }
+
+        if (this->_metricsServer)
+        {
+            this->_metricsServer->Stop();
+        }
+
         this->_scriptSystem->Shutdown();
 		this->_packetSender->Shutdown();
         this->_clientConnectionManager.Shutdown();
@@ -192,45 +418,71 @@ namespace projectfarm::server
 		shared::api::logging::Log("Shut down server...");
 	}
 
-	bool Server::CreateWorld(const std::string& name, const std::filesystem::path& worldFilePath)
+	std::shared_ptr<engine::world::World> Server::CreateWorld()
 	{
 		auto world = std::make_shared<engine::world::World>();
         world->SetDataProvider(this->_dataProvider);
-        world->SetServer(this->GetPtr());
+        world->SetWorldHost(this->GetPtr());
         world->SetPacketSender(this->_packetSender);
         world->SetScriptSystem(this->_scriptSystem);
         world->SetActionAnimationsManager(this->_actionAnimationsManager);
         world->SetDataManager(this->_dataManager);
 
-		if (!world->Load(name, worldFilePath))
-		{
-			shared::api::logging::Log("Failed to load world: " + worldFilePath.u8string());
-			return false;
-		}
-
-		this->_worlds.emplace_back(std::move(world));
-
-		return true;
+		return world;
 	}
 
 	bool Server::CreateWorlds()
     {
-	    auto locations = this->_dataProvider->GetWorldLocations();
+	    const auto& locations = this->_dataProvider->GetWorldLocations();
+
+	    // worlds are independent, so their files are loaded in parallel, but
+	    // their scripts are started here on the script thread
+	    shared::concurrency::StartupLoader loader;
+	    std::map<std::string, std::shared_ptr<engine::world::World>> worlds;
 
-        auto result = std::all_of(locations.begin(), locations.end(), [this](const auto& locationsItem)
+	    auto warmStart = this->_systemArguments.GetWarmStart();
+	    auto checkpointDirectory = this->_systemArguments.GetBinaryPath() / "checkpoints";
+
+	    for (const auto& [name, location] : locations)
         {
-            auto& [name, location] = locationsItem;
+	        auto world = this->CreateWorld();
+	        world->SetCheckpointDirectory(checkpointDirectory);
+	        worlds[name] = world;
 
-            if (!this->CreateWorld(name, location))
-            {
-                shared::api::logging::Log("Failed to create session with location: " + location.u8string());
-                return false;
-            }
+	        loader.Add({name,
+	                    [world, name = name, location = location, warmStart]()
+	                    {
+	                        if (!world->LoadData(name, location))
+                            {
+	                            shared::api::logging::Log("Failed to load world: " + location.u8string());
+	                            return false;
+                            }
 
-            return true;
-        });
+	                        // without a usable checkpoint the world starts as it is in its file
+	                        if (warmStart && !world->LoadCheckpoint())
+                            {
+	                            shared::api::logging::Log("Starting world without a checkpoint: " + name);
+                            }
+
+	                        return true;
+	                    },
+	                    [world]()
+	                    {
+	                        return world->Start();
+	                    }});
+        }
+
+	    if (!loader.Run("worlds"))
+        {
+	        return false;
+        }
 
-	    return result;
+	    for (auto& [_, world] : worlds)
+        {
+	        this->_worlds.emplace_back(std::move(world));
+        }
+
+	    return true;
     }
 
     void Server::OnClientAdd(const std::shared_ptr<Client>& client) noexcept
@@ -289,6 +541,10 @@ namespace projectfarm::server
         else if (packetType == shared::networking::PacketTypes::ClientServerTestUdp)
         {
             this->HandleClientServerTestUdpPacket(packet, ipAddress, player);
+        }
+        else if (packetType == shared::networking::PacketTypes::ClientServerPing)
+        {
+            this->HandleClientServerPingPacket(packet, player);
         }
 	    else
         {
@@ -519,6 +775,11 @@ namespace projectfarm::server
     void Server::HandleClientServerPlayerAuthenticatePacket(const std::shared_ptr<shared::networking::Packet>& packet,
                                                             std::shared_ptr<engine::Player>& player) noexcept
     {
+        static auto& authenticateDuration = shared::metrics::MetricsRegistry::GetGlobal().GetHistogram(
+                "projectfarm_authenticate_duration_microseconds", "How long authenticating a player takes.");
+
+        shared::metrics::ScopedTimer timer(authenticateDuration);
+
         auto clientServerPlayerAuthenticatePacket = std::static_pointer_cast<
                 shared::networking::packets::ClientServerPlayerAuthenticatePacket>(packet);
 
@@ -591,7 +852,7 @@ namespace projectfarm::server
             this->_unauthenticatedPlayers.erase(playerIt);
         }
 
-        this->_players.push_back(*playerIt);
+        this->_players.push_back(player);
     }
 
     void Server::HandleClientServerRequestHashedPasswordPacket(const std::shared_ptr<shared::networking::Packet>& packet,
@@ -618,4 +879,17 @@ namespace projectfarm::server
 
         this->_packetSender->AddPacketToSend(player->GetNetworkClient()->GetSocket(), serverClientSendHashedPasswordPacket);
     }
+
+    void Server::HandleClientServerPingPacket(const std::shared_ptr<shared::networking::Packet>& packet,
+                                              const std::shared_ptr<engine::Player>& player) noexcept
+    {
+        auto clientServerPingPacket = std::static_pointer_cast<shared::networking::packets::ClientServerPingPacket>(packet);
+
+        const auto serverClientPongPacket = std::static_pointer_cast<shared::networking::packets::ServerClientPongPacket>(
+                shared::networking::PacketFactory::CreatePacket(shared::networking::PacketTypes::ServerClientPong));
+
+        serverClientPongPacket->SetClientTime(clientServerPingPacket->GetClientTime());
+
+        this->_packetSender->AddPacketToSend(player->GetNetworkClient()->GetSocket(), serverClientPongPacket);
+    }
 }
@@ -14,6 +14,7 @@
 #include "system_arguments.h"
 #include "server_config.h"
 #include "client_connection_manager.h"
+#include "packet_replayer.h"
 #include "engine/player.h"
 #include "engine/player_load_details.h"
 #include "scripting/script_system.h"
@@ -22,10 +23,13 @@
 #include "engine/entities/action_animations_manager.h"
 #include "engine/data/data_manager.h"
 #include "crypto/crypto_provider.h"
+#include "metrics/metrics_server.h"
+#include "profiling/allocation_tracker.h"
 
 namespace projectfarm::server
 {
-	class Server final : public std::enable_shared_from_this<Server>
+	class Server final : public engine::world::WorldHost,
+	                     public std::enable_shared_from_this<Server>
 	{
 	public:
 		Server()
@@ -39,7 +43,7 @@ namespace projectfarm::server
 			this->_dataManager = std::make_shared<engine::data::DataManager>();
 			this->_cryptoProvider = std::make_shared<projectfarm::shared::crypto::CryptoProvider>();
 		}
-		~Server() = default;
+		~Server() override = default;
 
 		Server(Server&) = delete;
 		Server(Server&&) = delete;
@@ -59,20 +63,21 @@ namespace projectfarm::server
                              const IPaddress& ipAddress) noexcept;
 
 		bool AddPlayerToWorld(uint32_t playerId, uint32_t entityId,
-                              const std::string& destinationWorldName) noexcept;
+                              const std::string& destinationWorldName) noexcept override;
 
 		bool AddCharacterToWorld(const std::string& characterType,
                                  const std::string& destinationWorldName,
                                  const std::string& destinationTileType,
-                                 uint32_t entityId, uint32_t playerId) noexcept;
+                                 uint32_t entityId, uint32_t playerId) noexcept override;
 
-		[[nodiscard]] std::shared_ptr<engine::Player> GetPlayerById(uint32_t playerId) const noexcept;
+		[[nodiscard]] std::shared_ptr<engine::Player> GetPlayerById(uint32_t playerId) const noexcept override;
 
 	private:
 	    SystemArguments _systemArguments;
 	    std::shared_ptr<ServerConfig> _serverConfig;
 
 	    ClientConnectionManager _clientConnectionManager;
+	    PacketReplayer _packetReplayer;
 
 		projectfarm::shared::networking::Networking _networking;
 		std::shared_ptr<projectfarm::shared::networking::PacketSender> _packetSender;
@@ -84,7 +89,10 @@ namespace projectfarm::server
         std::shared_ptr<engine::data::DataManager> _dataManager;
         std::shared_ptr<projectfarm::shared::crypto::CryptoProvider> _cryptoProvider;
 
-		[[nodiscard]] bool CreateWorld(const std::string& name, const std::filesystem::path& worldFilePath);
+        std::unique_ptr<projectfarm::shared::metrics::MetricsServer> _metricsServer;
+        std::unique_ptr<projectfarm::shared::profiling::AllocationMetrics> _allocationMetrics;
+
+		[[nodiscard]] std::shared_ptr<engine::world::World> CreateWorld();
 		[[nodiscard]] bool CreateWorlds();
 
 		std::vector<std::shared_ptr<engine::world::World>> _worlds;
@@ -95,10 +103,23 @@ namespace projectfarm::server
 
 		bool Initialize();
 
+        [[nodiscard]] bool StartMetricsServer() noexcept;
+
 		void MainLoop();
         void HandleEvents();
         void UpdateWorlds();
 
+        [[nodiscard]] bool IsReplaying() const noexcept
+        {
+            return !this->_systemArguments.GetReplayPath().empty();
+        }
+
+        void LogAllocations() const noexcept;
+
+        void LogReplayResults(std::chrono::steady_clock::duration replayDuration) const noexcept;
+
+        void ExportProfiles() noexcept;
+
 		void TellServerToQuit();
 		void Shutdown();
 
@@ -119,6 +140,9 @@ namespace projectfarm::server
         void HandleClientServerRequestHashedPasswordPacket(const std::shared_ptr<shared::networking::Packet>& packet,
                                                            std::shared_ptr<engine::Player>& player) noexcept;
 
+        void HandleClientServerPingPacket(const std::shared_ptr<shared::networking::Packet>& packet,
+                                          const std::shared_ptr<engine::Player>& player) noexcept;
+
 		[[nodiscard]] std::shared_ptr<engine::PlayerLoadDetails> GetPlayerLoadDetails(uint32_t playerId) const noexcept;
 
 		static void InitializePlayer(std::shared_ptr<engine::Player>& player,
@@ -30,6 +30,12 @@ namespace projectfarm::server
         this->_serverUdpPort = jsonFile["serverUdpPort"].get<uint16_t>();
         this->_startingWorld = jsonFile["startingWorld"].get<std::string>();
 
+        // the metrics are optional
+        this->_metricsPort = jsonFile.value("metricsPort", uint16_t {0});
+        this->_metricsFile = jsonFile.value("metricsFile", std::string {});
+        this->_metricsDumpIntervalInSeconds = jsonFile.value("metricsDumpIntervalInSeconds",
+                                                             this->_metricsDumpIntervalInSeconds);
+
         shared::api::logging::Log("Loaded server config.");
 
         return true;
@@ -35,11 +35,35 @@ namespace projectfarm::server
             return this->_startingWorld;
         }
 
+        // the loopback port metrics are served on, or 0 to not serve them
+        [[nodiscard]]
+        uint16_t GetMetricsPort() const noexcept
+        {
+            return this->_metricsPort;
+        }
+
+        // relative to the binary, or empty to not dump the metrics
+        [[nodiscard]]
+        const std::string& GetMetricsFile() const noexcept
+        {
+            return this->_metricsFile;
+        }
+
+        [[nodiscard]]
+        uint32_t GetMetricsDumpIntervalInSeconds() const noexcept
+        {
+            return this->_metricsDumpIntervalInSeconds;
+        }
+
     private:
         uint16_t _tcpPort {0};
         uint16_t _serverUdpPort {0};
 
         std::string _startingWorld;
+
+        uint16_t _metricsPort {0};
+        std::string _metricsFile;
+        uint32_t _metricsDumpIntervalInSeconds {10};
     };
 }
 
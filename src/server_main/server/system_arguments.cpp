@@ -1,5 +1,9 @@
+#include <algorithm>
+#include <cstdlib>
+
 #include "system_arguments.h"
 #include "api/logging/logging.h"
+#include "utils/util.h"
 
 namespace projectfarm::server
 {
@@ -17,6 +21,34 @@ namespace projectfarm::server
                 std::filesystem::path binaryFullPath = arg;
                 this->_binaryPath = binaryFullPath.remove_filename();
             }
+            else if (pfu::startsWith(arg, "-profilescripts"))
+            {
+                this->_profileScripts = true;
+            }
+            else if (pfu::startsWith(arg, "-profileticks"))
+            {
+                this->_profileTicks = true;
+            }
+            else if (pfu::startsWith(arg, "--warm-start"))
+            {
+                this->_warmStart = true;
+            }
+            else if (pfu::startsWith(arg, "-trackallocations"))
+            {
+                this->_trackAllocations = true;
+            }
+            else if (pfu::startsWith(arg, "-capturepackets="))
+            {
+                this->_capturePacketsPath = arg.substr(arg.find('=') + 1);
+            }
+            else if (pfu::startsWith(arg, "-replayspeed="))
+            {
+                this->_replaySpeed = std::max(std::strtod(arg.c_str() + arg.find('=') + 1, nullptr), 0.0);
+            }
+            else if (pfu::startsWith(arg, "-replay="))
+            {
+                this->_replayPath = arg.substr(arg.find('=') + 1);
+            }
         }
     }
 }
\ No newline at end of file
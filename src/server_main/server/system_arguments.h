@@ -19,8 +19,65 @@ namespace projectfarm::server
             return this->_binaryPath;
         }
 
+        [[nodiscard]]
+        bool GetProfileScripts() const
+        {
+            return this->_profileScripts;
+        }
+
+        // record the tick profiler zones, exported as a Chrome trace
+        [[nodiscard]]
+        bool GetProfileTicks() const
+        {
+            return this->_profileTicks;
+        }
+
+        // restore each world from its latest checkpoint
+        [[nodiscard]]
+        bool GetWarmStart() const
+        {
+            return this->_warmStart;
+        }
+
+        // count allocations by subsystem and tick, into the metrics
+        [[nodiscard]]
+        bool GetTrackAllocations() const
+        {
+            return this->_trackAllocations;
+        }
+
+        // record the connections and packets the server receives, empty to not capture
+        [[nodiscard]]
+        const std::filesystem::path& GetCapturePacketsPath() const
+        {
+            return this->_capturePacketsPath;
+        }
+
+        // run a capture through the server without opening any sockets, empty to run normally
+        [[nodiscard]]
+        const std::filesystem::path& GetReplayPath() const
+        {
+            return this->_replayPath;
+        }
+
+        // how much faster than it was captured to replay, where 0 is as fast as possible
+        [[nodiscard]]
+        double GetReplaySpeed() const
+        {
+            return this->_replaySpeed;
+        }
+
     private:
         std::filesystem::path _binaryPath;
+
+        bool _profileScripts {false};
+        bool _profileTicks {false};
+        bool _warmStart {false};
+        bool _trackAllocations {false};
+
+        std::filesystem::path _capturePacketsPath;
+        std::filesystem::path _replayPath;
+        double _replaySpeed {1.0};
     };
 }
 
@@ -0,0 +1,37 @@
+#include "log_buffer.h"
+
+namespace projectfarm::shared::api::logging
+{
+    LogBuffer::LogBuffer(uint32_t capacity) noexcept
+    {
+        // a power of two, so an index is masked rather than divided
+        uint32_t size {1u};
+        while (size < capacity)
+        {
+            size <<= 1u;
+        }
+
+        this->_entries.resize(size);
+        this->_mask = size - 1u;
+    }
+
+    bool LogBuffer::TryPush(uint64_t time, LogLevels level, std::string_view message) noexcept
+    {
+        auto head = this->_head.load(std::memory_order_relaxed);
+
+        if (head - this->_tail.load(std::memory_order_acquire) >= this->_entries.size())
+        {
+            this->_numberOfDropped.fetch_add(1u, std::memory_order_relaxed);
+            return false;
+        }
+
+        auto& entry = this->_entries[head & this->_mask];
+        entry.Time = time;
+        entry.Level = level;
+        entry.Message.assign(message);
+
+        this->_head.store(head + 1u, std::memory_order_release);
+
+        return true;
+    }
+}
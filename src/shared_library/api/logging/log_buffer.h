@@ -0,0 +1,92 @@
+#ifndef PROJECTFARM_LOG_BUFFER_H
+#define PROJECTFARM_LOG_BUFFER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <atomic>
+
+#include "log_levels.h"
+
+namespace projectfarm::shared::api::logging
+{
+    struct LogEntry
+    {
+        uint64_t Time {0u};
+        LogLevels Level {LogLevels::Info};
+
+        // keeps its capacity between messages, so a full buffer stops allocating
+        std::string Message;
+    };
+
+    // A ring of log entries with a single producer and a single consumer, so neither
+    // takes a lock. When it is full, messages are dropped and counted rather than
+    // making the producer wait.
+    class LogBuffer final
+    {
+    public:
+        static constexpr uint32_t DefaultCapacity {4096u};
+
+        explicit LogBuffer(uint32_t capacity = DefaultCapacity) noexcept;
+        ~LogBuffer() = default;
+
+        LogBuffer(const LogBuffer&) = delete;
+        LogBuffer(LogBuffer&&) = delete;
+
+        // must only be called from the producer thread
+        [[nodiscard]]
+        bool TryPush(uint64_t time, LogLevels level, std::string_view message) noexcept;
+
+        // must only be called from the consumer thread. `onEntry` is called for each
+        // entry in the order they were pushed
+        template <typename F>
+        uint32_t Consume(F&& onEntry) noexcept
+        {
+            auto tail = this->_tail.load(std::memory_order_relaxed);
+            auto head = this->_head.load(std::memory_order_acquire);
+
+            auto numberOfEntries = static_cast<uint32_t>(head - tail);
+
+            for (; tail != head; ++tail)
+            {
+                onEntry(static_cast<const LogEntry&>(this->_entries[tail & this->_mask]));
+            }
+
+            this->_tail.store(tail, std::memory_order_release);
+
+            return numberOfEntries;
+        }
+
+        [[nodiscard]]
+        bool IsEmpty() const noexcept
+        {
+            return this->_head.load(std::memory_order_acquire) == this->_tail.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]]
+        uint32_t GetCapacity() const noexcept
+        {
+            return static_cast<uint32_t>(this->_entries.size());
+        }
+
+        // the number of messages dropped since this was last called
+        [[nodiscard]]
+        uint64_t TakeNumberOfDropped() noexcept
+        {
+            return this->_numberOfDropped.exchange(0u, std::memory_order_relaxed);
+        }
+
+    private:
+        std::vector<LogEntry> _entries;
+        uint64_t _mask {0u};
+
+        // on their own cache lines, so the producer and consumer don't contend
+        alignas(64) std::atomic<uint64_t> _head {0u};
+        alignas(64) std::atomic<uint64_t> _tail {0u};
+
+        std::atomic<uint64_t> _numberOfDropped {0u};
+    };
+}
+
+#endif
@@ -5,9 +5,13 @@
 
 namespace projectfarm::shared::api::logging
 {
+    // in order of severity, so a minimum level filters out everything before it
     enum class LogLevels : uint8_t
     {
+        Debug,
         Info,
+        Warning,
+        Error,
     };
 }
 
@@ -1,19 +1,546 @@
+#include <algorithm>
 #include <iostream>
 #include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <exception>
+#include <cstring>
+#include <cerrno>
 
 #include "logging.h"
+#include "log_buffer.h"
 #include "time/clock.h"
+#include "platform/platform_id.h"
+
+#if defined(IS_WINDOWS)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 
 namespace projectfarm::shared::api::logging
 {
-    void Log(std::string_view message, LogLevels) noexcept
+    namespace
+    {
+        constexpr std::chrono::milliseconds WriteInterval {10};
+
+        std::atomic<LogLevels> minimumLogLevel {LogLevels::Info};
+
+        std::terminate_handler previousTerminateHandler {nullptr};
+
+        [[nodiscard]]
+        const char* GetLogLevelName(LogLevels level) noexcept
+        {
+            switch (level)
+            {
+                case LogLevels::Debug:
+                    return "Debug";
+                case LogLevels::Info:
+                    return "Info";
+                case LogLevels::Warning:
+                    return "Warning";
+                case LogLevels::Error:
+                    return "Error";
+            }
+
+            return "";
+        }
+
+        // Batches a line into a fixed buffer and writes it straight to a file descriptor,
+        // so it allocates nothing and takes no locks. Only for use while crashing.
+        class CrashWriter final
+        {
+        public:
+            explicit CrashWriter(int fileDescriptor) noexcept
+                : _fileDescriptor {fileDescriptor}
+            {
+            }
+
+            ~CrashWriter()
+            {
+                this->Flush();
+            }
+
+            CrashWriter(const CrashWriter&) = delete;
+            CrashWriter(CrashWriter&&) = delete;
+
+            void Append(const char* text, size_t size) noexcept
+            {
+                if (this->_size + size > sizeof(this->_buffer))
+                {
+                    this->Flush();
+
+                    if (size > sizeof(this->_buffer))
+                    {
+                        this->WriteAll(text, size);
+                        return;
+                    }
+                }
+
+                std::memcpy(this->_buffer + this->_size, text, size);
+                this->_size += size;
+            }
+
+            void Append(const char* text) noexcept
+            {
+                this->Append(text, std::strlen(text));
+            }
+
+            void Append(uint64_t number) noexcept
+            {
+                char digits[20];
+                auto start = sizeof(digits);
+
+                do
+                {
+                    digits[--start] = static_cast<char>('0' + number % 10u);
+                    number /= 10u;
+                } while (number > 0u);
+
+                this->Append(digits + start, sizeof(digits) - start);
+            }
+
+            void Flush() noexcept
+            {
+                this->WriteAll(this->_buffer, this->_size);
+                this->_size = 0u;
+            }
+
+        private:
+            int _fileDescriptor {-1};
+
+            char _buffer[4096];
+            size_t _size {0u};
+
+            void WriteAll(const char* text, size_t size) const noexcept
+            {
+                while (size > 0u)
+                {
+#if defined(IS_WINDOWS)
+                    auto written = ::_write(this->_fileDescriptor, text, static_cast<unsigned int>(size));
+#else
+                    auto written = ::write(this->_fileDescriptor, text, size);
+#endif
+                    if (written <= 0)
+                    {
+                        // interrupted writes are retried, anything else is given up on
+                        if (written < 0 && errno == EINTR)
+                        {
+                            continue;
+                        }
+
+                        return;
+                    }
+
+                    text += written;
+                    size -= static_cast<size_t>(written);
+                }
+            }
+        };
+
+        class Logger final
+        {
+        public:
+            Logger()
+            {
+                this->_thread = std::thread(&Logger::ThreadWorker, this);
+            }
+
+            // never destroyed, so logging from static destructors is safe
+            ~Logger() = delete;
+
+            [[nodiscard]]
+            std::shared_ptr<LogBuffer> CreateBuffer() noexcept
+            {
+                auto buffer = std::make_shared<LogBuffer>();
+
+                std::scoped_lock lock(this->_buffersMutex);
+                this->_buffers.push_back(buffer);
+
+                return buffer;
+            }
+
+            void Write(LogBuffer& buffer, uint64_t time, LogLevels level, std::string_view message) noexcept
+            {
+                // once stopped there is no thread to write the buffers
+                if (this->_isStopped)
+                {
+                    std::scoped_lock lock(this->_writeMutex);
+
+                    this->Format(time, level, message);
+                    this->WriteOutput();
+
+                    return;
+                }
+
+                if (!buffer.TryPush(time, level, message) || level == LogLevels::Error)
+                {
+                    this->_mutexCV.notify_one();
+                }
+            }
+
+            void Flush() noexcept
+            {
+                std::scoped_lock lock(this->_writeMutex);
+
+                this->WriteBuffers();
+            }
+
+            // Called from signal handlers, so nothing here may allocate, use the output
+            // stream or wait. The crashed thread may be part way through a write, in which
+            // case nothing is written.
+            void FlushOnCrash() noexcept
+            {
+                std::unique_lock writeLock(this->_writeMutex, std::try_to_lock);
+                if (!writeLock)
+                {
+                    return;
+                }
+
+                std::unique_lock buffersLock(this->_buffersMutex, std::try_to_lock);
+                if (!buffersLock)
+                {
+                    return;
+                }
+
+                CrashWriter writer(this->_crashFileDescriptor);
+
+                for (const auto& buffer : this->_buffers)
+                {
+                    buffer->Consume([this, &writer](const LogEntry& entry)
+                    {
+                        // the time string can't be made without allocating, so a
+                        // different minute is written as milliseconds since the epoch
+                        if (entry.Time / 60000u == this->_timeStringMinute)
+                        {
+                            writer.Append(this->_timeString.data(), this->_timeString.size());
+                        }
+                        else
+                        {
+                            writer.Append(entry.Time);
+                        }
+
+                        writer.Append(": ");
+
+                        if (entry.Level != LogLevels::Info)
+                        {
+                            writer.Append("[");
+                            writer.Append(GetLogLevelName(entry.Level));
+                            writer.Append("] ");
+                        }
+
+                        writer.Append(entry.Message.data(), entry.Message.size());
+                        writer.Append("\n");
+                    });
+                }
+            }
+
+            void Stop() noexcept
+            {
+                {
+                    std::scoped_lock lock(this->_mutex);
+                    this->_runThread = false;
+                }
+
+                this->_mutexCV.notify_one();
+
+                if (this->_thread.joinable())
+                {
+                    this->_thread.join();
+                }
+
+                std::scoped_lock lock(this->_writeMutex);
+
+                this->_isStopped = true;
+                this->WriteBuffers();
+            }
+
+            void SetOutput(std::ostream& output) noexcept
+            {
+                std::scoped_lock lock(this->_writeMutex);
+
+                this->WriteBuffers();
+                this->_output = &output;
+
+                // a crash can't write to a stream, so anything but stdout goes to stderr
+                this->_crashFileDescriptor = &output == &std::cout ? 1 : 2;
+            }
+
+            [[nodiscard]]
+            uint64_t GetNumberOfDropped() const noexcept
+            {
+                return this->_numberOfDropped;
+            }
+
+        private:
+            std::thread _thread;
+            bool _runThread {true};
+            std::atomic_bool _isStopped {false};
+
+            std::mutex _mutex;
+            std::condition_variable _mutexCV;
+
+            std::mutex _buffersMutex;
+            std::vector<std::shared_ptr<LogBuffer>> _buffers;
+
+            // held while consuming the buffers and writing the output
+            std::mutex _writeMutex;
+            std::ostream* _output {&std::cout};
+            int _crashFileDescriptor {1};
+            std::string _text;
+            std::vector<std::shared_ptr<LogBuffer>> _buffersToWrite;
+
+            uint64_t _timeStringMinute {UINT64_MAX};
+            std::string _timeString;
+
+            std::atomic<uint64_t> _numberOfDropped {0u};
+
+            void ThreadWorker() noexcept
+            {
+                std::unique_lock lock(this->_mutex);
+
+                while (this->_runThread)
+                {
+                    this->_mutexCV.wait_for(lock, WriteInterval);
+
+                    lock.unlock();
+                    this->Flush();
+                    lock.lock();
+                }
+            }
+
+            void WriteBuffers() noexcept
+            {
+                {
+                    std::scoped_lock lock(this->_buffersMutex);
+
+                    // a buffer no longer used by its thread is removed once it is written
+                    this->_buffers.erase(std::remove_if(this->_buffers.begin(), this->_buffers.end(), [](const auto& b)
+                    {
+                        return b.use_count() == 1 && b->IsEmpty();
+                    }), this->_buffers.end());
+
+                    this->_buffersToWrite = this->_buffers;
+                }
+
+                for (const auto& buffer : this->_buffersToWrite)
+                {
+                    buffer->Consume([this](const LogEntry& entry)
+                    {
+                        this->Format(entry.Time, entry.Level, entry.Message);
+                    });
+
+                    if (auto numberOfDropped = buffer->TakeNumberOfDropped(); numberOfDropped > 0u)
+                    {
+                        this->_numberOfDropped += numberOfDropped;
+
+                        this->Format(time::Clock::MillisecondsSinceEpoch(), LogLevels::Warning,
+                                     "Dropped " + std::to_string(numberOfDropped) + " log messages.");
+                    }
+                }
+
+                this->_buffersToWrite.clear();
+
+                this->WriteOutput();
+            }
+
+            void Format(uint64_t time, LogLevels level, std::string_view message) noexcept
+            {
+                // the time is only shown to the minute
+                if (auto minute = time / 60000u; minute != this->_timeStringMinute)
+                {
+                    this->_timeStringMinute = minute;
+                    this->_timeString = time::Clock::LocalTimeAsLongString(time);
+                }
+
+                this->_text += this->_timeString;
+                this->_text += ": ";
+
+                if (level != LogLevels::Info)
+                {
+                    this->_text += '[';
+                    this->_text += GetLogLevelName(level);
+                    this->_text += "] ";
+                }
+
+                this->_text += message;
+                this->_text += '\n';
+            }
+
+            void WriteOutput() noexcept
+            {
+                if (this->_text.empty())
+                {
+                    return;
+                }
+
+                this->_output->write(this->_text.data(), static_cast<std::streamsize>(this->_text.size()));
+                this->_output->flush();
+
+                this->_text.clear();
+            }
+        };
+
+        Logger& GetLogger() noexcept
+        {
+            static auto logger = []()
+            {
+                auto newLogger = new Logger();
+
+                std::atexit([]() { GetLogger().Stop(); });
+
+                return newLogger;
+            }();
+
+            return *logger;
+        }
+
+        // each thread's buffer, and the message it last logged for rate limiting
+        class ThreadLog final
+        {
+        public:
+            ThreadLog()
+                : _buffer {GetLogger().CreateBuffer()}
+            {
+            }
+
+            ~ThreadLog()
+            {
+                this->WriteNumberOfRepeats(time::Clock::MillisecondsSinceEpoch());
+            }
+
+            void Log(std::string_view message, LogLevels level) noexcept
+            {
+                // the time is only shown to the minute, so the coarse clock is plenty
+                auto time = time::Clock::CoarseMillisecondsSinceEpoch();
+
+                if (level == this->_lastLevel && message == this->_lastMessage &&
+                    time - this->_windowStartTime < RepeatedMessageWindowInMilliseconds)
+                {
+                    if (++this->_numberOfRepeats >= MaxRepeatedMessages)
+                    {
+                        ++this->_numberOfSkipped;
+                        return;
+                    }
+                }
+                else
+                {
+                    this->WriteNumberOfRepeats(time);
+
+                    this->_lastLevel = level;
+                    this->_lastMessage.assign(message);
+                    this->_windowStartTime = time;
+                    this->_numberOfRepeats = 0u;
+                }
+
+                GetLogger().Write(*this->_buffer, time, level, message);
+            }
+
+        private:
+            std::shared_ptr<LogBuffer> _buffer;
+
+            LogLevels _lastLevel {LogLevels::Info};
+            std::string _lastMessage;
+            uint64_t _windowStartTime {0u};
+            uint32_t _numberOfRepeats {0u};
+            uint32_t _numberOfSkipped {0u};
+
+            void WriteNumberOfRepeats(uint64_t time) noexcept
+            {
+                if (this->_numberOfSkipped == 0u)
+                {
+                    return;
+                }
+
+                GetLogger().Write(*this->_buffer, time, this->_lastLevel,
+                                  "Previous message repeated " + std::to_string(this->_numberOfSkipped) +
+                                  " more times.");
+
+                this->_numberOfSkipped = 0u;
+            }
+        };
+
+        void OnTerminate()
+        {
+            GetLogger().FlushOnCrash();
+
+            if (previousTerminateHandler)
+            {
+                previousTerminateHandler();
+            }
+
+            std::abort();
+        }
+
+        void OnCrashSignal(int signal)
+        {
+            GetLogger().FlushOnCrash();
+
+            std::signal(signal, SIG_DFL);
+            std::raise(signal);
+        }
+    }
+
+    void Log(std::string_view message, LogLevels level) noexcept
     {
-        static std::mutex mutex;
+        if (!IsLogLevelEnabled(level))
+        {
+            return;
+        }
 
-        std::scoped_lock<std::mutex> lock(mutex);
+        thread_local ThreadLog threadLog;
+
+        threadLog.Log(message, level);
+    }
 
-        auto currentTime = time::Clock::LocalTimeAsLongString();
+    bool IsLogLevelEnabled(LogLevels level) noexcept
+    {
+        return level >= minimumLogLevel.load(std::memory_order_relaxed);
+    }
+
+    void SetMinimumLogLevel(LogLevels level) noexcept
+    {
+        minimumLogLevel = level;
+    }
+
+    LogLevels GetMinimumLogLevel() noexcept
+    {
+        return minimumLogLevel;
+    }
+
+    void FlushLog() noexcept
+    {
+        GetLogger().Flush();
+    }
+
+    void SetLogOutput(std::ostream& output) noexcept
+    {
+        GetLogger().SetOutput(output);
+    }
+
+    uint64_t GetNumberOfDroppedLogMessages() noexcept
+    {
+        auto& logger = GetLogger();
+
+        // dropped messages are counted as they are written
+        logger.Flush();
+
+        return logger.GetNumberOfDropped();
+    }
+
+    void InstallLogCrashHandlers() noexcept
+    {
+        previousTerminateHandler = std::set_terminate(&OnTerminate);
 
-        std::cout << currentTime << ": " << message << '\n';
+        for (auto signal : {SIGSEGV, SIGABRT, SIGFPE, SIGILL})
+        {
+            std::signal(signal, &OnCrashSignal);
+        }
     }
 }
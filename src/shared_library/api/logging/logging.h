@@ -1,13 +1,56 @@
 #ifndef PROJECTFARM_LOGGING_H
 #define PROJECTFARM_LOGGING_H
 
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <ostream>
+#include <type_traits>
 
 #include "log_levels.h"
 
+// Messages are pushed to a buffer owned by the logging thread and written by a
+// background thread, so logging never waits on another thread or on the output.
+// The same message logged over and over by a thread is only written
+// `MaxRepeatedMessages` times a second, followed by how many were left out.
+
 namespace projectfarm::shared::api::logging
 {
+    inline constexpr uint32_t MaxRepeatedMessages {5u};
+    inline constexpr uint64_t RepeatedMessageWindowInMilliseconds {1000u};
+
     void Log(std::string_view message, LogLevels level = LogLevels::Info) noexcept;
+
+    [[nodiscard]] bool IsLogLevelEnabled(LogLevels level) noexcept;
+
+    // `makeMessage` is only called if `level` is logged, so an expensive message
+    // costs nothing when it is filtered out
+    template <typename F, typename = std::enable_if_t<std::is_invocable_r_v<std::string, F>>>
+    void Log(F&& makeMessage, LogLevels level = LogLevels::Info) noexcept
+    {
+        if (IsLogLevelEnabled(level))
+        {
+            std::string message = makeMessage();
+            Log(std::string_view(message), level);
+        }
+    }
+
+    void SetMinimumLogLevel(LogLevels level) noexcept;
+    [[nodiscard]] LogLevels GetMinimumLogLevel() noexcept;
+
+    // writes everything logged so far before returning
+    void FlushLog() noexcept;
+
+    // where messages are written, which is `std::cout` unless set. The stream must
+    // outlive any logging, or be replaced first
+    void SetLogOutput(std::ostream& output) noexcept;
+
+    // across every thread, because their buffers were full
+    [[nodiscard]] uint64_t GetNumberOfDroppedLogMessages() noexcept;
+
+    // flushes the log when the process terminates or crashes. This is best effort, as
+    // a crash can leave the log in any state
+    void InstallLogCrashHandlers() noexcept;
 }
 
 #endif
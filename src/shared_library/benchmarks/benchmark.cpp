@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <nlohmann/json.hpp>
+
+#include "benchmark.h"
+#include "profiling/allocation_tracker.h"
+
+namespace
+{
+    struct RegisteredBenchmark
+    {
+        std::string Name;
+        projectfarm::shared::benchmarks::BenchmarkFunction Function;
+        uint64_t BytesPerOperation {0u};
+    };
+
+    std::vector<RegisteredBenchmark>& GetBenchmarks() noexcept
+    {
+        static std::vector<RegisteredBenchmark> benchmarks;
+        return benchmarks;
+    }
+
+    // returns the time taken in nanoseconds
+    double RunIterations(const projectfarm::shared::benchmarks::BenchmarkFunction& function,
+                         uint64_t iterations) noexcept
+    {
+        auto startTime = std::chrono::steady_clock::now();
+
+        function(iterations);
+
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - startTime).count());
+    }
+}
+
+namespace projectfarm::shared::benchmarks
+{
+    void RegisterBenchmark(const std::string& name, BenchmarkFunction function,
+                           uint64_t bytesPerOperation) noexcept
+    {
+        GetBenchmarks().push_back({name, std::move(function), bytesPerOperation});
+    }
+
+    uint64_t GetNumberOfAllocations() noexcept
+    {
+        return profiling::AllocationTracker::GetNumberOfAllocations();
+    }
+
+    std::vector<BenchmarkResult> RunBenchmarks(const BenchmarkOptions& options,
+                                               std::ostream& progress) noexcept
+    {
+        std::vector<BenchmarkResult> results;
+
+        auto sampleTime = static_cast<double>(options.MinimumTimeInMilliseconds) * 1'000'000.0 /
+                          static_cast<double>(std::max(options.NumberOfSamples, 1u));
+
+        for (const auto& benchmark : GetBenchmarks())
+        {
+            if (benchmark.Name.find(options.Filter) == std::string::npos)
+            {
+                continue;
+            }
+
+            progress << "Running " << benchmark.Name << "..." << std::endl;
+
+            // find how many iterations fill a sample, which also warms up the caches
+            uint64_t iterations {1u};
+            while (true)
+            {
+                auto time = RunIterations(benchmark.Function, iterations);
+                if (time >= sampleTime)
+                {
+                    break;
+                }
+
+                // aim a little over the sample time, but grow by at most 10 times
+                auto scale = time > 0.0 ? std::min(sampleTime * 1.2 / time, 10.0) : 10.0;
+                iterations = std::max(iterations + 1u, static_cast<uint64_t>(static_cast<double>(iterations) * scale));
+            }
+
+            std::vector<double> samples;
+            auto allocationsBefore = GetNumberOfAllocations();
+
+            for (auto i = 0u; i < std::max(options.NumberOfSamples, 1u); ++i)
+            {
+                samples.push_back(RunIterations(benchmark.Function, iterations) / static_cast<double>(iterations));
+            }
+
+            auto allocations = GetNumberOfAllocations() - allocationsBefore;
+
+            std::sort(samples.begin(), samples.end());
+
+            BenchmarkResult result;
+            result.Name = benchmark.Name;
+            result.Iterations = iterations;
+            result.NanosecondsPerOperation = samples[samples.size() / 2u];
+            result.AllocationsPerOperation = static_cast<double>(allocations) /
+                                             static_cast<double>(iterations * samples.size());
+            result.BytesPerOperation = benchmark.BytesPerOperation;
+
+            if (result.BytesPerOperation > 0u && result.NanosecondsPerOperation > 0.0)
+            {
+                // bytes per nanosecond is GB/s
+                result.MegabytesPerSecond = static_cast<double>(result.BytesPerOperation) /
+                                            result.NanosecondsPerOperation * 1000.0;
+            }
+
+            results.push_back(result);
+        }
+
+        return results;
+    }
+
+    void WriteResultsTable(std::ostream& stream, const std::vector<BenchmarkResult>& results) noexcept
+    {
+        auto nameWidth = std::string("benchmark").size();
+        for (const auto& result : results)
+        {
+            nameWidth = std::max(nameWidth, result.Name.size());
+        }
+
+        stream << std::left << std::setw(static_cast<int>(nameWidth)) << "benchmark"
+               << std::right << std::setw(14) << "ns/op"
+               << std::setw(14) << "allocs/op"
+               << std::setw(14) << "MB/s"
+               << std::setw(14) << "iterations" << '\n';
+
+        for (const auto& result : results)
+        {
+            stream << std::left << std::setw(static_cast<int>(nameWidth)) << result.Name
+                   << std::right << std::fixed
+                   << std::setw(14) << std::setprecision(2) << result.NanosecondsPerOperation
+                   << std::setw(14) << std::setprecision(2) << result.AllocationsPerOperation;
+
+            if (result.MegabytesPerSecond > 0.0)
+            {
+                stream << std::setw(14) << std::setprecision(1) << result.MegabytesPerSecond;
+            }
+            else
+            {
+                stream << std::setw(14) << "-";
+            }
+
+            stream << std::setw(14) << result.Iterations << '\n';
+        }
+    }
+
+    bool WriteResultsJson(const std::filesystem::path& filePath, const std::string& version,
+                          const std::vector<BenchmarkResult>& results) noexcept
+    {
+        nlohmann::json json;
+        json["version"] = version;
+        json["benchmarks"] = nlohmann::json::array();
+
+        for (const auto& result : results)
+        {
+            json["benchmarks"].push_back({
+                {"name", result.Name},
+                {"iterations", result.Iterations},
+                {"nsPerOp", result.NanosecondsPerOperation},
+                {"allocsPerOp", result.AllocationsPerOperation},
+                {"bytesPerOp", result.BytesPerOperation},
+                {"megabytesPerSecond", result.MegabytesPerSecond},
+            });
+        }
+
+        std::ofstream fp(filePath, std::ios::trunc);
+        if (!fp.is_open())
+        {
+            return false;
+        }
+
+        fp << json.dump(4) << '\n';
+
+        return fp.good();
+    }
+}
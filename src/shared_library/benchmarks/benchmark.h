@@ -0,0 +1,82 @@
+#ifndef PROJECTFARM_BENCHMARK_H
+#define PROJECTFARM_BENCHMARK_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <functional>
+#include <ostream>
+#include <filesystem>
+
+namespace projectfarm::shared::benchmarks
+{
+    // runs the operation being measured `iterations` times
+    using BenchmarkFunction = std::function<void(uint64_t iterations)>;
+
+    struct BenchmarkResult
+    {
+        std::string Name;
+
+        uint64_t Iterations {0u};
+
+        double NanosecondsPerOperation {0.0};
+        double AllocationsPerOperation {0.0};
+
+        // only set for benchmarks that process a known number of bytes
+        uint64_t BytesPerOperation {0u};
+        double MegabytesPerSecond {0.0};
+    };
+
+    struct BenchmarkOptions
+    {
+        // only run benchmarks with this in their name
+        std::string Filter;
+
+        uint32_t MinimumTimeInMilliseconds {250u};
+
+        // the median sample is reported
+        uint32_t NumberOfSamples {5u};
+    };
+
+    // `name` is `<area>/<operation>`, such as `stream/WriteUInt32`
+    void RegisterBenchmark(const std::string& name, BenchmarkFunction function,
+                           uint64_t bytesPerOperation = 0u) noexcept;
+
+    [[nodiscard]]
+    std::vector<BenchmarkResult> RunBenchmarks(const BenchmarkOptions& options,
+                                               std::ostream& progress) noexcept;
+
+    void WriteResultsTable(std::ostream& stream, const std::vector<BenchmarkResult>& results) noexcept;
+
+    [[nodiscard]]
+    bool WriteResultsJson(const std::filesystem::path& filePath, const std::string& version,
+                          const std::vector<BenchmarkResult>& results) noexcept;
+
+    // the number of times `operator new` has been called in this process
+    [[nodiscard]]
+    uint64_t GetNumberOfAllocations() noexcept;
+
+    // stops the compiler from optimizing away a value that is never used
+    template <typename T>
+    inline void DoNotOptimize(const T& value) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink {nullptr};
+        sink = &value;
+#endif
+    }
+
+    // each area's benchmarks, registered from `main`
+    void RegisterStreamBenchmarks() noexcept;
+    void RegisterPacketBenchmarks() noexcept;
+    void RegisterChannelBenchmarks() noexcept;
+    void RegisterCSSBenchmarks() noexcept;
+    void RegisterMarkdownBenchmarks() noexcept;
+    void RegisterStringsBenchmarks() noexcept;
+    void RegisterLerperBenchmarks() noexcept;
+    void RegisterStateMachineBenchmarks() noexcept;
+}
+
+#endif
@@ -0,0 +1,67 @@
+#include <atomic>
+#include <thread>
+
+#include "benchmark.h"
+#include "concurrency/channel.h"
+
+namespace projectfarm::shared::benchmarks
+{
+    void RegisterChannelBenchmarks() noexcept
+    {
+        RegisterBenchmark("channel/Push", [](uint64_t iterations)
+        {
+            concurrency::channel<uint64_t> channel;
+
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                channel.Push(i);
+            }
+
+            DoNotOptimize(channel.GetAll());
+        });
+
+        // the consumer's pattern: check, then take everything pushed since the last check
+        RegisterBenchmark("channel/Push x16 + GetAll", [](uint64_t iterations)
+        {
+            concurrency::channel<uint64_t> channel;
+
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                for (auto v = 0u; v < 16u; ++v)
+                {
+                    channel.Push(v);
+                }
+
+                if (channel.HasValues())
+                {
+                    DoNotOptimize(channel.GetAll());
+                }
+            }
+        });
+
+        RegisterBenchmark("channel/Push contended by a consumer thread", [](uint64_t iterations)
+        {
+            concurrency::channel<uint64_t> channel;
+            std::atomic_bool isRunning {true};
+
+            std::thread consumer([&channel, &isRunning]()
+            {
+                while (isRunning)
+                {
+                    if (channel.HasValues())
+                    {
+                        DoNotOptimize(channel.GetAll());
+                    }
+                }
+            });
+
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                channel.Push(i);
+            }
+
+            isRunning = false;
+            consumer.join();
+        });
+    }
+}
@@ -0,0 +1,86 @@
+import sys
+import json
+import argparse
+
+# compares two result files written with `-json=`, and fails if any benchmark got slower,
+# or allocates more, than the threshold allows
+
+
+def configure_arguments():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("baseline", help="results to compare against")
+    parser.add_argument("current", help="results to check")
+    parser.add_argument("-t", "--threshold", type=float, default=10.0, required=False,
+                        help="percentage ns/op can increase by before it is a regression")
+    parser.add_argument("-at", "--allocation-threshold", type=float, default=0.5, required=False,
+                        help="how many more allocs/op are allowed before it is a regression")
+    args = parser.parse_args()
+
+    return args
+
+
+def load_results(file_path):
+    with open(file_path) as f:
+        results = json.load(f)
+
+    return {benchmark["name"]: benchmark for benchmark in results["benchmarks"]}
+
+
+def compare(baseline, current, threshold, allocation_threshold):
+    regressions = []
+
+    name_width = max([len(name) for name in current] + [len("benchmark")])
+
+    print(f"{'benchmark':<{name_width}} {'base ns/op':>14} {'ns/op':>14} {'change':>9} {'base allocs':>12} {'allocs':>10}")
+
+    for name, result in current.items():
+        if name not in baseline:
+            print(f"{name:<{name_width}} {'-':>14} {result['nsPerOp']:>14.2f} {'new':>9}")
+            continue
+
+        base = baseline[name]
+
+        change = 0.0
+        if base["nsPerOp"] > 0.0:
+            change = (result["nsPerOp"] - base["nsPerOp"]) / base["nsPerOp"] * 100.0
+
+        flags = []
+        if change > threshold:
+            flags.append("SLOWER")
+
+        if result["allocsPerOp"] - base["allocsPerOp"] > allocation_threshold:
+            flags.append("MORE ALLOCATIONS")
+
+        print(f"{name:<{name_width}} {base['nsPerOp']:>14.2f} {result['nsPerOp']:>14.2f} {change:>+8.1f}% "
+              f"{base['allocsPerOp']:>12.2f} {result['allocsPerOp']:>10.2f} {' '.join(flags)}")
+
+        if flags:
+            regressions.append(name)
+
+    for name in baseline:
+        if name not in current:
+            print(f"{name:<{name_width}} missing from the current results")
+
+    return regressions
+
+
+def main():
+    args = configure_arguments()
+
+    baseline = load_results(args.baseline)
+    current = load_results(args.current)
+
+    regressions = compare(baseline, current, args.threshold, args.allocation_threshold)
+
+    if regressions:
+        print(f"\n{len(regressions)} regression(s) beyond the threshold:")
+        for name in regressions:
+            print(f"  {name}")
+        return 1
+
+    print("\nNo regressions.")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,52 @@
+#include <string>
+
+#include "benchmark.h"
+#include "css/css.h"
+#include "css/tokenizer.h"
+
+namespace projectfarm::shared::benchmarks
+{
+    namespace
+    {
+        // about the size of one of the UI's style sheets
+        std::string CreateStyleSheet() noexcept
+        {
+            std::string css;
+
+            for (auto i = 0u; i < 32u; ++i)
+            {
+                auto n = std::to_string(i);
+
+                css += "label-" + n + ", .button-" + n + ", #panel-" + n + " {\n"
+                       "    color: #12345678;\n"
+                       "    font: medium;\n"
+                       "    margin-left: " + n + "px;\n"
+                       "    background-image: ui/panel_" + n + ".png;\n"
+                       "}\n\n";
+            }
+
+            return css;
+        }
+    }
+
+    void RegisterCSSBenchmarks() noexcept
+    {
+        auto css = CreateStyleSheet();
+
+        RegisterBenchmark("css/ParseTokens", [css](uint64_t iterations)
+        {
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                DoNotOptimize(css::ParseTokens(css));
+            }
+        }, css.size());
+
+        RegisterBenchmark("css/LoadFromRaw", [css](uint64_t iterations)
+        {
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                DoNotOptimize(css::LoadFromRaw(css));
+            }
+        }, css.size());
+    }
+}
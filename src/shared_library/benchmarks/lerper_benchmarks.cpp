@@ -0,0 +1,42 @@
+#include "benchmark.h"
+#include "math/lerper.h"
+
+namespace projectfarm::shared::benchmarks
+{
+    void RegisterLerperBenchmarks() noexcept
+    {
+        RegisterBenchmark("lerper/Get float", [](uint64_t iterations)
+        {
+            math::Lerper<float> lerper;
+            lerper.Set(0.0f, 100.0f, 1000u);
+
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                auto [value, isFinished] = lerper.Get(16u);
+                if (isFinished)
+                {
+                    lerper.Set(0.0f, 100.0f, 1000u);
+                }
+
+                DoNotOptimize(value);
+            }
+        });
+
+        RegisterBenchmark("lerper/Get int32", [](uint64_t iterations)
+        {
+            math::Lerper<int32_t> lerper;
+            lerper.Set(100, -100, 1000u);
+
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                auto [value, isFinished] = lerper.Get(16u);
+                if (isFinished)
+                {
+                    lerper.Set(100, -100, 1000u);
+                }
+
+                DoNotOptimize(value);
+            }
+        });
+    }
+}
@@ -0,0 +1,84 @@
+#include <iostream>
+#include <string>
+#include <filesystem>
+#include <SDL.h>
+
+#include "platform/platform_id.h"
+#if !defined(IS_IOS)
+#include "version.h"
+#endif
+#include "benchmark.h"
+#include "profiling/allocation_tracker.h"
+
+using namespace projectfarm::shared;
+
+// usage: shared_benchmarks [-filter=<part of a name>] [-json=<results file>]
+//                          [-mintime=<milliseconds per benchmark>] [-samples=<number of samples>]
+int main(int argc, char* argv[])
+{
+    benchmarks::BenchmarkOptions options;
+    std::filesystem::path jsonFilePath;
+
+    for (auto i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+
+        if (arg.rfind("-filter=", 0) == 0)
+        {
+            options.Filter = arg.substr(8);
+        }
+        else if (arg.rfind("-json=", 0) == 0)
+        {
+            jsonFilePath = arg.substr(6);
+        }
+        else if (arg.rfind("-mintime=", 0) == 0)
+        {
+            options.MinimumTimeInMilliseconds = static_cast<uint32_t>(std::stoul(arg.substr(9)));
+        }
+        else if (arg.rfind("-samples=", 0) == 0)
+        {
+            options.NumberOfSamples = static_cast<uint32_t>(std::stoul(arg.substr(9)));
+        }
+        else
+        {
+            std::cout << "Unknown argument: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    // for the allocations per operation
+    profiling::AllocationTracker::SetEnabled(true);
+
+    benchmarks::RegisterStreamBenchmarks();
+    benchmarks::RegisterPacketBenchmarks();
+    benchmarks::RegisterChannelBenchmarks();
+    benchmarks::RegisterCSSBenchmarks();
+    benchmarks::RegisterMarkdownBenchmarks();
+    benchmarks::RegisterStringsBenchmarks();
+    benchmarks::RegisterLerperBenchmarks();
+    benchmarks::RegisterStateMachineBenchmarks();
+
+    auto results = benchmarks::RunBenchmarks(options, std::cout);
+
+    std::cout << std::endl;
+    benchmarks::WriteResultsTable(std::cout, results);
+
+    if (!jsonFilePath.empty())
+    {
+#if !defined(IS_IOS)
+        std::string version = PROJECT_VERSION;
+#else
+        std::string version;
+#endif
+
+        if (!benchmarks::WriteResultsJson(jsonFilePath, version, results))
+        {
+            std::cout << "Failed to write results to: " << jsonFilePath.u8string() << std::endl;
+            return 1;
+        }
+
+        std::cout << "Wrote results to: " << jsonFilePath.u8string() << std::endl;
+    }
+
+    return 0;
+}
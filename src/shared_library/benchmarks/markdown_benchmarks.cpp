@@ -0,0 +1,32 @@
+#include <string>
+
+#include "benchmark.h"
+#include "markdown/markdown.h"
+
+namespace projectfarm::shared::benchmarks
+{
+    void RegisterMarkdownBenchmarks() noexcept
+    {
+        const std::string plainText {"Welcome to the farm. The shop opens at eight and closes at six."};
+
+        RegisterBenchmark("markdown/GetTextParts plain", [plainText](uint64_t iterations)
+        {
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                DoNotOptimize(markdown::GetTextParts(plainText));
+            }
+        }, plainText.size());
+
+        // a chat message with every kind of markdown
+        const std::string markdownText {"(red)Welcome(#12345678) to the _farm_. The *shop* opens at $eight$ "
+                                        "and closes at \\_six\\_. (green)Don't be _late_!"};
+
+        RegisterBenchmark("markdown/GetTextParts markdown", [markdownText](uint64_t iterations)
+        {
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                DoNotOptimize(markdown::GetTextParts(markdownText));
+            }
+        }, markdownText.size());
+    }
+}
@@ -0,0 +1,119 @@
+#include <array>
+#include <memory>
+#include <vector>
+#include <string>
+
+#include "benchmark.h"
+#include "networking/packet_factory.h"
+#include "networking/packets/server_client_entity_update.h"
+#include "networking/packets/server_client_chatbox_message.h"
+#include "networking/packets/server_client_world_changes_chunk.h"
+
+using namespace std::literals;
+
+namespace projectfarm::shared::benchmarks
+{
+    namespace
+    {
+        // in the order of `PacketTypes`
+        constexpr std::array<const char*, 18> PacketNames
+        {
+            "ServerClientLoadWorld",
+            "ClientServerWorldLoaded",
+            "ServerClientEntityUpdate",
+            "ServerClientSetPlayerDetails",
+            "ClientServerTestUdp",
+            "ClientServerEntityUpdate",
+            "ServerClientPlayerJoinedWorld",
+            "ServerClientPlayerLeftWorld",
+            "ServerClientRemoveEntityFromWorld",
+            "ServerClientCharacterSetDetails",
+            "ClientServerPlayerAuthenticate",
+            "ClientServerRequestHashedPassword",
+            "ServerClientSendHashedPassword",
+            "ClientServerChatboxMessage",
+            "ServerClientChatboxMessage",
+            "ServerClientWorldChangesChunk",
+            "ClientServerPing",
+            "ServerClientPong",
+        };
+
+        // gives the packets that carry a payload a typical one, the rest keep their defaults
+        void FillPacket(const std::shared_ptr<networking::Packet>& packet) noexcept
+        {
+            using namespace networking::packets;
+
+            switch (packet->GetPacketType())
+            {
+                case networking::PacketTypes::ServerClientEntityUpdate:
+                {
+                    auto entityUpdate = std::static_pointer_cast<ServerClientEntityUpdatePacket>(packet);
+                    entityUpdate->SetEntityId(1234u);
+                    entityUpdate->SetPlayerId(56u);
+                    entityUpdate->SetWorldName("farm");
+                    entityUpdate->SetTimeOfUpdate(123456789u);
+                    entityUpdate->SetEntityData(std::vector<std::byte>(64u, std::byte {7}));
+                    break;
+                }
+                case networking::PacketTypes::ServerClientChatboxMessage:
+                {
+                    auto chatboxMessage = std::static_pointer_cast<ServerClientChatboxMessagePacket>(packet);
+                    chatboxMessage->SetUsername("player");
+                    chatboxMessage->SetMessage("Hello, is anyone selling turnips today?");
+                    chatboxMessage->SetServerTime(123456789u);
+                    break;
+                }
+                case networking::PacketTypes::ServerClientWorldChangesChunk:
+                {
+                    auto worldChangesChunk = std::static_pointer_cast<ServerClientWorldChangesChunkPacket>(packet);
+                    worldChangesChunk->SetWorldName("farm");
+                    worldChangesChunk->SetNumberOfChunks(4u);
+                    worldChangesChunk->SetData(std::vector<std::byte>(4096u, std::byte {3}));
+                    break;
+                }
+                default:
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    void RegisterPacketBenchmarks() noexcept
+    {
+        for (auto i = 0u; i < static_cast<uint32_t>(PacketNames.size()); ++i)
+        {
+            auto packet = networking::PacketFactory::CreatePacket(static_cast<networking::PacketTypes>(i));
+            if (!packet)
+            {
+                continue;
+            }
+
+            FillPacket(packet);
+
+            // `GetBytes` calls `SerializeBytes` after writing the packet's header
+            auto bytes = packet->GetBytes();
+
+            RegisterBenchmark("packet/"s + PacketNames[i] + "::SerializeBytes", [packet](uint64_t iterations)
+            {
+                for (auto iteration = 0u; iteration < iterations; ++iteration)
+                {
+                    DoNotOptimize(packet->GetBytes());
+                }
+            }, bytes.size());
+
+            // `FromBytes` is given what follows the header, as the packet receiver does
+            constexpr auto headerSize = sizeof(uint32_t) + sizeof(uint8_t);
+            std::vector<std::byte> body(bytes.begin() + headerSize, bytes.end());
+
+            RegisterBenchmark("packet/"s + PacketNames[i] + "::FromBytes", [packet, body](uint64_t iterations)
+            {
+                for (auto iteration = 0u; iteration < iterations; ++iteration)
+                {
+                    packet->FromBytes(body);
+                    DoNotOptimize(packet);
+                }
+            }, body.size());
+        }
+    }
+}
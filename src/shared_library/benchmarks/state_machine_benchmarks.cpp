@@ -0,0 +1,54 @@
+#include <cstdint>
+
+#include "benchmark.h"
+#include "state/state_machine.h"
+
+namespace projectfarm::shared::benchmarks
+{
+    namespace
+    {
+        enum class CharacterStates : uint8_t
+        {
+            Idle,
+            Walk,
+            Jump,
+        };
+
+        using CharacterStateMachine = state::StateMachine<CharacterStates, uint8_t>;
+    }
+
+    void RegisterStateMachineBenchmarks() noexcept
+    {
+        // start walking, jump while walking, stop walking, then land
+        RegisterBenchmark("state_machine/walk, jump, land", [](uint64_t iterations)
+        {
+            CharacterStateMachine stateMachine({CharacterStates::Idle, 0u});
+
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                stateMachine.PushState({CharacterStates::Walk, 1u});
+                DoNotOptimize(stateMachine.GetCurrentState().GetKey());
+
+                stateMachine.PushState({CharacterStates::Jump, 2u});
+                stateMachine.CancelState(CharacterStates::Walk);
+                DoNotOptimize(stateMachine.GetCurrentState().GetKey());
+
+                stateMachine.CancelState(CharacterStates::Jump);
+                DoNotOptimize(stateMachine.GetCurrentState().GetKey());
+            }
+        });
+
+        // pushing the current state again only updates its value
+        RegisterBenchmark("state_machine/PushState same state", [](uint64_t iterations)
+        {
+            CharacterStateMachine stateMachine({CharacterStates::Idle, 0u});
+            stateMachine.PushState({CharacterStates::Walk, 0u});
+
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                stateMachine.PushState({CharacterStates::Walk, static_cast<uint8_t>(i)});
+                DoNotOptimize(stateMachine.GetCurrentState().GetValue());
+            }
+        });
+    }
+}
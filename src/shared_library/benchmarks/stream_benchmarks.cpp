@@ -0,0 +1,110 @@
+#include <vector>
+#include <string>
+
+#include "benchmark.h"
+#include "utils/stream.h"
+
+namespace projectfarm::shared::benchmarks
+{
+    namespace
+    {
+        // each operation writes or reads this many values, so the buffer's reserve isn't timed
+        constexpr uint32_t ValuesPerOperation {1024u};
+
+        template <typename T, typename Write>
+        void RegisterWrite(const std::string& name, Write write)
+        {
+            RegisterBenchmark("stream/" + name + " x1024", [write](uint64_t iterations)
+            {
+                std::vector<std::byte> bytes;
+                bytes.reserve(ValuesPerOperation * sizeof(T));
+
+                for (auto i = 0u; i < iterations; ++i)
+                {
+                    bytes.clear();
+
+                    for (auto v = 0u; v < ValuesPerOperation; ++v)
+                    {
+                        write(bytes, static_cast<T>(v));
+                    }
+
+                    DoNotOptimize(bytes.data());
+                }
+            }, ValuesPerOperation * sizeof(T));
+        }
+
+        template <typename T, typename Write, typename Read>
+        void RegisterRead(const std::string& name, Write write, Read read)
+        {
+            std::vector<std::byte> bytes;
+            for (auto v = 0u; v < ValuesPerOperation; ++v)
+            {
+                write(bytes, static_cast<T>(v));
+            }
+
+            RegisterBenchmark("stream/" + name + " x1024", [bytes, read](uint64_t iterations)
+            {
+                for (auto i = 0u; i < iterations; ++i)
+                {
+                    uint32_t index {0u};
+
+                    for (auto v = 0u; v < ValuesPerOperation; ++v)
+                    {
+                        DoNotOptimize(read(bytes, index));
+                    }
+                }
+            }, bytes.size());
+        }
+    }
+
+    void RegisterStreamBenchmarks() noexcept
+    {
+        namespace pfu = utils;
+
+        RegisterWrite<uint8_t>("WriteUInt8", &pfu::WriteUInt8);
+        RegisterWrite<uint16_t>("WriteUInt16", &pfu::WriteUInt16);
+        RegisterWrite<uint32_t>("WriteUInt32", &pfu::WriteUInt32);
+        RegisterWrite<uint64_t>("WriteUInt64", &pfu::WriteUInt64);
+        RegisterWrite<uint64_t>("WriteVarUInt64", &pfu::WriteVarUInt64);
+
+        RegisterRead<uint8_t>("ReadUInt8", &pfu::WriteUInt8, &pfu::ReadUInt8);
+        RegisterRead<uint16_t>("ReadUInt16", &pfu::WriteUInt16, &pfu::ReadUInt16);
+        RegisterRead<uint32_t>("ReadUInt32", &pfu::WriteUInt32, &pfu::ReadUInt32);
+        RegisterRead<uint64_t>("ReadUInt64", &pfu::WriteUInt64, &pfu::ReadUInt64);
+        RegisterRead<uint64_t>("ReadVarUInt64", &pfu::WriteVarUInt64,
+                               [](const std::vector<std::byte>& bytes, uint32_t& index)
+                               {
+                                   uint64_t value {0u};
+                                   return pfu::ReadVarUInt64(bytes, index, value) ? value : 0u;
+                               });
+
+        const std::string text {"the quick brown fox jumps over the lazy dog"};
+        auto length = static_cast<uint32_t>(text.size());
+
+        RegisterBenchmark("stream/WriteString", [text, length](uint64_t iterations)
+        {
+            std::vector<std::byte> bytes;
+            bytes.reserve(sizeof(uint32_t) + text.size());
+
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                bytes.clear();
+                pfu::WriteString(bytes, text, length);
+
+                DoNotOptimize(bytes.data());
+            }
+        }, sizeof(uint32_t) + text.size());
+
+        std::vector<std::byte> stringBytes;
+        pfu::WriteString(stringBytes, text, length);
+
+        RegisterBenchmark("stream/ReadString", [stringBytes](uint64_t iterations)
+        {
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                uint32_t index {0u};
+                DoNotOptimize(pfu::ReadString(stringBytes, index));
+            }
+        }, stringBytes.size());
+    }
+}
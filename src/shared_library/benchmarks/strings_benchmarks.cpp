@@ -0,0 +1,40 @@
+#include <string>
+
+#include "benchmark.h"
+#include "utils/strings.h"
+
+namespace projectfarm::shared::benchmarks
+{
+    void RegisterStringsBenchmarks() noexcept
+    {
+        const std::string csv {"grass,dirt,water,sand,stone,wood,fence,crop,tree,rock,path,bridge"};
+
+        RegisterBenchmark("strings/split", [csv](uint64_t iterations)
+        {
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                DoNotOptimize(utils::split(",", csv));
+            }
+        }, csv.size());
+
+        const std::string padded {"  \t  -username=farmer  \r\n"};
+
+        RegisterBenchmark("strings/trim", [padded](uint64_t iterations)
+        {
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                DoNotOptimize(utils::trim(padded));
+            }
+        }, padded.size());
+
+        const std::string unpadded {"-username=farmer"};
+
+        RegisterBenchmark("strings/trim nothing to trim", [unpadded](uint64_t iterations)
+        {
+            for (auto i = 0u; i < iterations; ++i)
+            {
+                DoNotOptimize(utils::trim(unpadded));
+            }
+        }, unpadded.size());
+    }
+}
@@ -2,6 +2,7 @@
 #define PROJECTFARM_CHANNEL_H
 
 #include <vector>
+#include <mutex>
 #include <shared_mutex>
 
 namespace projectfarm::shared::concurrency
@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <chrono>
+#include <future>
+
+#include "startup_loader.h"
+#include "thread_pool.h"
+#include "api/logging/logging.h"
+
+namespace projectfarm::shared::concurrency
+{
+    void StartupLoader::Add(StartupTask task) noexcept
+    {
+        this->_tasks.emplace_back(std::move(task));
+    }
+
+    bool StartupLoader::Run(const std::string& description) noexcept
+    {
+        this->_failedTasks.clear();
+        this->_loadMicroseconds = 0u;
+        this->_startMicroseconds = 0u;
+
+        std::stable_sort(this->_tasks.begin(), this->_tasks.end(), [](const auto& a, const auto& b)
+        {
+            return a.Name < b.Name;
+        });
+
+        auto loadStartTime = std::chrono::steady_clock::now();
+
+        std::vector<bool> results(this->_tasks.size(), false);
+        uint32_t numberOfThreads {0u};
+
+        {
+            ThreadPool threadPool(static_cast<uint32_t>(std::min<size_t>(
+                this->_numberOfThreads == 0u ? ThreadPool::GetDefaultNumberOfThreads() : this->_numberOfThreads,
+                std::max<size_t>(this->_tasks.size(), 1u))));
+
+            numberOfThreads = threadPool.GetNumberOfThreads();
+
+            std::vector<std::future<bool>> futures;
+            futures.reserve(this->_tasks.size());
+
+            for (auto& task : this->_tasks)
+            {
+                futures.emplace_back(threadPool.Enqueue([&task]()
+                {
+                    return !task.Load || task.Load();
+                }));
+            }
+
+            for (auto i = 0u; i < futures.size(); ++i)
+            {
+                try
+                {
+                    results[i] = futures[i].get();
+                }
+                catch (const std::exception& ex)
+                {
+                    api::logging::Log("Exception while loading: " + this->_tasks[i].Name + " - " + ex.what());
+                    results[i] = false;
+                }
+            }
+        }
+
+        this->_loadMicroseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - loadStartTime).count());
+
+        for (auto i = 0u; i < this->_tasks.size(); ++i)
+        {
+            if (!results[i])
+            {
+                api::logging::Log("Failed to load: " + this->_tasks[i].Name);
+                this->_failedTasks.push_back(this->_tasks[i].Name);
+            }
+        }
+
+        if (!this->_failedTasks.empty())
+        {
+            api::logging::Log("Failed to load " + std::to_string(this->_failedTasks.size()) + " of " +
+                              std::to_string(this->_tasks.size()) + " " + description);
+            return false;
+        }
+
+        auto startStartTime = std::chrono::steady_clock::now();
+
+        for (const auto& task : this->_tasks)
+        {
+            if (task.Start && !task.Start())
+            {
+                api::logging::Log("Failed to start: " + task.Name);
+                this->_failedTasks.push_back(task.Name);
+                return false;
+            }
+        }
+
+        this->_startMicroseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - startStartTime).count());
+
+        api::logging::Log("Loaded " + std::to_string(this->_tasks.size()) + " " + description +
+                          " - load: " + std::to_string(this->_loadMicroseconds / 1000u) + "ms on " +
+                          std::to_string(numberOfThreads) + " threads, start: " +
+                          std::to_string(this->_startMicroseconds / 1000u) + "ms");
+
+        return true;
+    }
+}
@@ -0,0 +1,71 @@
+#ifndef PROJECTFARM_STARTUP_LOADER_H
+#define PROJECTFARM_STARTUP_LOADER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <functional>
+
+namespace projectfarm::shared::concurrency
+{
+    struct StartupTask
+    {
+        std::string Name;
+
+        // run on the thread pool, so must not touch anything bound to the calling thread, such as v8
+        std::function<bool()> Load;
+
+        // run on the calling thread, in name order, once every task has loaded
+        std::function<bool()> Start;
+    };
+
+    // Loads independent tasks, such as worlds, in parallel and then starts them one
+    // at a time on the calling thread. Tasks are ordered by name, so failures are
+    // reported in the same order whatever the thread timings.
+    class StartupLoader final
+    {
+    public:
+        // `numberOfThreads` of 0 uses one thread per hardware thread
+        explicit StartupLoader(uint32_t numberOfThreads = 0u) noexcept
+            : _numberOfThreads {numberOfThreads}
+        {
+        }
+        ~StartupLoader() = default;
+
+        void Add(StartupTask task) noexcept;
+
+        // `description` is used when logging, such as "worlds"
+        [[nodiscard]]
+        bool Run(const std::string& description) noexcept;
+
+        // the names of the tasks that failed, in name order
+        [[nodiscard]]
+        const std::vector<std::string>& GetFailedTasks() const noexcept
+        {
+            return this->_failedTasks;
+        }
+
+        [[nodiscard]]
+        uint64_t GetLoadMicroseconds() const noexcept
+        {
+            return this->_loadMicroseconds;
+        }
+
+        [[nodiscard]]
+        uint64_t GetStartMicroseconds() const noexcept
+        {
+            return this->_startMicroseconds;
+        }
+
+    private:
+        uint32_t _numberOfThreads {0u};
+
+        std::vector<StartupTask> _tasks;
+        std::vector<std::string> _failedTasks;
+
+        uint64_t _loadMicroseconds {0u};
+        uint64_t _startMicroseconds {0u};
+    };
+}
+
+#endif
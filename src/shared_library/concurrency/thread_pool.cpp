@@ -0,0 +1,67 @@
+#include <algorithm>
+
+#include "thread_pool.h"
+
+namespace projectfarm::shared::concurrency
+{
+    ThreadPool::ThreadPool(uint32_t numberOfThreads)
+    {
+        if (numberOfThreads == 0u)
+        {
+            numberOfThreads = ThreadPool::GetDefaultNumberOfThreads();
+        }
+
+        this->_threads.reserve(numberOfThreads);
+
+        for (auto i = 0u; i < numberOfThreads; ++i)
+        {
+            this->_threads.emplace_back([this]() { this->WorkerLoop(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::scoped_lock lock(this->_mutex);
+            this->_isStopping = true;
+        }
+
+        this->_condition.notify_all();
+
+        for (auto& thread : this->_threads)
+        {
+            thread.join();
+        }
+    }
+
+    uint32_t ThreadPool::GetDefaultNumberOfThreads() noexcept
+    {
+        // `hardware_concurrency` can return 0 if it is not known
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    void ThreadPool::WorkerLoop() noexcept
+    {
+        while (true)
+        {
+            std::function<void()> task;
+
+            {
+                std::unique_lock lock(this->_mutex);
+
+                this->_condition.wait(lock, [this]() { return this->_isStopping || !this->_tasks.empty(); });
+
+                if (this->_tasks.empty())
+                {
+                    return;
+                }
+
+                task = std::move(this->_tasks.front());
+                this->_tasks.pop_front();
+            }
+
+            // any exception is stored in the task's future
+            task();
+        }
+    }
+}
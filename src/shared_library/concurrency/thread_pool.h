@@ -0,0 +1,69 @@
+#ifndef PROJECTFARM_THREAD_POOL_H
+#define PROJECTFARM_THREAD_POOL_H
+
+#include <cstdint>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+
+namespace projectfarm::shared::concurrency
+{
+    // A fixed number of worker threads taking tasks from a shared queue. Queued
+    // tasks are finished before the pool is destroyed.
+    class ThreadPool final
+    {
+    public:
+        // `numberOfThreads` of 0 uses one thread per hardware thread
+        explicit ThreadPool(uint32_t numberOfThreads = 0u);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool(ThreadPool&&) = delete;
+
+        template <typename F>
+        [[nodiscard]]
+        std::future<std::invoke_result_t<F>> Enqueue(F&& function)
+        {
+            using ResultType = std::invoke_result_t<F>;
+
+            auto task = std::make_shared<std::packaged_task<ResultType()>>(std::forward<F>(function));
+            auto future = task->get_future();
+
+            {
+                std::scoped_lock lock(this->_mutex);
+                this->_tasks.emplace_back([task]() { (*task)(); });
+            }
+
+            this->_condition.notify_one();
+
+            return future;
+        }
+
+        [[nodiscard]]
+        uint32_t GetNumberOfThreads() const noexcept
+        {
+            return static_cast<uint32_t>(this->_threads.size());
+        }
+
+        [[nodiscard]]
+        static uint32_t GetDefaultNumberOfThreads() noexcept;
+
+    private:
+        std::vector<std::thread> _threads;
+
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        std::deque<std::function<void()>> _tasks;
+        bool _isStopping {false};
+
+        void WorkerLoop() noexcept;
+    };
+}
+
+#endif
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "css_class.h"
 
 namespace projectfarm::shared::css
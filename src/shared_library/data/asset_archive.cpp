@@ -0,0 +1,357 @@
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+#include <array>
+
+#include "asset_archive.h"
+#include "utils/compression.h"
+#include "api/logging/logging.h"
+
+namespace projectfarm::shared
+{
+    namespace
+    {
+        constexpr std::array<char, 4> Magic {'P', 'F', 'A', 'R'};
+
+        constexpr uint64_t HeaderSize {32u};
+        constexpr uint64_t EntrySize {48u};
+        constexpr uint64_t DataAlignment {16u};
+
+        template <typename T>
+        T ReadLE(const std::byte* data) noexcept
+        {
+            T value {0u};
+            for (auto i = 0u; i < sizeof(T); ++i)
+            {
+                value |= static_cast<T>(static_cast<T>(data[i]) << (i * 8u));
+            }
+
+            return value;
+        }
+
+        template <typename T>
+        void WriteLE(std::vector<std::byte>& data, uint64_t offset, T value) noexcept
+        {
+            for (auto i = 0u; i < sizeof(T); ++i)
+            {
+                data[offset + i] = static_cast<std::byte>((value >> (i * 8u)) & 0xFFu);
+            }
+        }
+
+        bool IsInBounds(uint64_t offset, uint64_t size, uint64_t fileSize) noexcept
+        {
+            return offset <= fileSize && size <= fileSize - offset;
+        }
+
+        uint64_t Align(uint64_t value, uint64_t alignment) noexcept
+        {
+            return (value + alignment - 1u) / alignment * alignment;
+        }
+    }
+
+    bool AssetArchive::Open(const std::filesystem::path& filePath) noexcept
+    {
+        this->Close();
+
+        if (!this->_file.Open(filePath))
+        {
+            api::logging::Log("Failed to open asset archive: " + filePath.u8string());
+            return false;
+        }
+
+        auto data = this->_file.GetData();
+        auto fileSize = this->_file.GetSize();
+
+        if (fileSize < HeaderSize || std::memcmp(data, Magic.data(), Magic.size()) != 0)
+        {
+            api::logging::Log("Not an asset archive: " + filePath.u8string());
+            this->Close();
+            return false;
+        }
+
+        if (auto version = ReadLE<uint32_t>(data + 4); version != AssetArchive::Version)
+        {
+            api::logging::Log("Unsupported asset archive version: " + std::to_string(version) +
+                              " in file: " + filePath.u8string());
+            this->Close();
+            return false;
+        }
+
+        auto numberOfEntries = ReadLE<uint32_t>(data + 8);
+        auto tableOffset = ReadLE<uint64_t>(data + 16);
+        auto namesOffset = ReadLE<uint64_t>(data + 24);
+
+        if (!IsInBounds(tableOffset, numberOfEntries * EntrySize, fileSize) || namesOffset > fileSize)
+        {
+            api::logging::Log("Asset archive is truncated or corrupt: " + filePath.u8string());
+            this->Close();
+            return false;
+        }
+
+        this->_entries.resize(numberOfEntries);
+
+        for (auto i = 0u; i < numberOfEntries; ++i)
+        {
+            auto entryData = data + tableOffset + i * EntrySize;
+            auto& entry = this->_entries[i];
+
+            entry.Hash = ReadLE<uint64_t>(entryData + 0);
+            auto nameOffset = ReadLE<uint32_t>(entryData + 8);
+            auto nameLength = ReadLE<uint32_t>(entryData + 12);
+            entry.DataOffset = ReadLE<uint64_t>(entryData + 16);
+            entry.StoredSize = ReadLE<uint64_t>(entryData + 24);
+            entry.Size = ReadLE<uint64_t>(entryData + 32);
+            entry.Compression = static_cast<AssetCompression>(ReadLE<uint32_t>(entryData + 40));
+
+            if (!IsInBounds(namesOffset + nameOffset, nameLength, fileSize) ||
+                !IsInBounds(entry.DataOffset, entry.StoredSize, fileSize) ||
+                (entry.Compression != AssetCompression::None && entry.Compression != AssetCompression::Lz) ||
+                (entry.Compression == AssetCompression::None && entry.StoredSize != entry.Size) ||
+                (entry.Compression == AssetCompression::Lz && entry.Size > utils::GetMaxDecompressedLzSize(entry.StoredSize)))
+            {
+                api::logging::Log("Asset archive entry " + std::to_string(i) + " is corrupt: " + filePath.u8string());
+                this->Close();
+                return false;
+            }
+
+            entry.Name = std::string_view(reinterpret_cast<const char*>(data + namesOffset + nameOffset), nameLength);
+        }
+
+        if (!std::is_sorted(this->_entries.begin(), this->_entries.end(), [](const auto& a, const auto& b)
+            {
+                return a.Hash < b.Hash;
+            }))
+        {
+            api::logging::Log("Asset archive table is not sorted: " + filePath.u8string());
+            this->Close();
+            return false;
+        }
+
+        return true;
+    }
+
+    void AssetArchive::Close() noexcept
+    {
+        {
+            std::scoped_lock lock(this->_decompressedMutex);
+            this->_decompressed.clear();
+        }
+
+        this->_entries.clear();
+        this->_file.Close();
+    }
+
+    bool AssetArchive::Contains(std::string_view name) const noexcept
+    {
+        return this->Find(name) != nullptr;
+    }
+
+    std::optional<utils::ByteSpan> AssetArchive::Read(std::string_view name) const noexcept
+    {
+        auto entry = this->Find(name);
+        if (!entry)
+        {
+            return {};
+        }
+
+        auto storedData = this->_file.GetData() + entry->DataOffset;
+
+        if (entry->Compression == AssetCompression::None)
+        {
+            return utils::ByteSpan(storedData, entry->Size);
+        }
+
+        auto index = static_cast<uint64_t>(entry - this->_entries.data());
+
+        std::scoped_lock lock(this->_decompressedMutex);
+
+        if (auto iter = this->_decompressed.find(index); iter != this->_decompressed.end())
+        {
+            return utils::ByteSpan(iter->second.get(), entry->Size);
+        }
+
+        auto decompressed = std::make_unique<std::byte[]>(entry->Size);
+
+        if (!utils::DecompressLz(storedData, entry->StoredSize, decompressed.get(), entry->Size))
+        {
+            api::logging::Log("Failed to decompress asset archive entry: " + std::string(name));
+            return {};
+        }
+
+        auto result = utils::ByteSpan(decompressed.get(), entry->Size);
+
+        this->_decompressed[index] = std::move(decompressed);
+
+        return result;
+    }
+
+    uint64_t AssetArchive::HashName(std::string_view name) noexcept
+    {
+        // FNV-1a
+        uint64_t hash {14695981039346656037ull};
+
+        for (auto c : name)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+
+        return hash;
+    }
+
+    const AssetArchive::Entry* AssetArchive::Find(std::string_view name) const noexcept
+    {
+        auto hash = AssetArchive::HashName(name);
+
+        auto iter = std::lower_bound(this->_entries.begin(), this->_entries.end(), hash, [](const auto& entry, auto h)
+        {
+            return entry.Hash < h;
+        });
+
+        for (; iter != this->_entries.end() && iter->Hash == hash; ++iter)
+        {
+            if (iter->Name == name)
+            {
+                return &*iter;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void AssetArchiveWriter::Add(const std::string& name, std::vector<std::byte> data, bool allowCompression) noexcept
+    {
+        Entry entry;
+        entry.Name = name;
+        entry.Size = data.size();
+
+        if (allowCompression && !data.empty())
+        {
+            auto compressed = utils::CompressLz(data.data(), data.size());
+
+            if (compressed.size() * 10u <= data.size() * 9u)
+            {
+                entry.Data = std::move(compressed);
+                entry.Compression = AssetCompression::Lz;
+            }
+        }
+
+        if (entry.Compression == AssetCompression::None)
+        {
+            entry.Data = std::move(data);
+        }
+
+        this->_entries.emplace_back(std::move(entry));
+    }
+
+    bool AssetArchiveWriter::AddFile(const std::string& name, const std::filesystem::path& filePath,
+                                     bool allowCompression) noexcept
+    {
+        std::ifstream fs(filePath, std::ios::binary | std::ios::ate);
+        if (!fs.is_open())
+        {
+            api::logging::Log("Failed to open file: " + filePath.u8string());
+            return false;
+        }
+
+        auto size = static_cast<uint64_t>(fs.tellg());
+        fs.seekg(0);
+
+        std::vector<std::byte> data(size);
+        fs.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(size));
+
+        if (!fs)
+        {
+            api::logging::Log("Failed to read file: " + filePath.u8string());
+            return false;
+        }
+
+        this->Add(name, std::move(data), allowCompression);
+
+        return true;
+    }
+
+    bool AssetArchiveWriter::Write(const std::filesystem::path& filePath) const noexcept
+    {
+        std::vector<const Entry*> entries;
+        entries.reserve(this->_entries.size());
+
+        for (const auto& entry : this->_entries)
+        {
+            entries.push_back(&entry);
+        }
+
+        std::sort(entries.begin(), entries.end(), [](const auto* a, const auto* b)
+        {
+            auto hashA = AssetArchive::HashName(a->Name);
+            auto hashB = AssetArchive::HashName(b->Name);
+
+            return hashA != hashB ? hashA < hashB : a->Name < b->Name;
+        });
+
+        auto tableOffset = HeaderSize;
+        auto namesOffset = tableOffset + entries.size() * EntrySize;
+
+        uint64_t namesSize {0u};
+        for (const auto* entry : entries)
+        {
+            namesSize += entry->Name.size();
+        }
+
+        auto dataOffset = Align(namesOffset + namesSize, DataAlignment);
+
+        auto fileSize = dataOffset;
+        for (const auto* entry : entries)
+        {
+            fileSize = Align(fileSize, DataAlignment) + entry->Data.size();
+        }
+
+        std::vector<std::byte> output(fileSize);
+
+        std::memcpy(output.data(), Magic.data(), Magic.size());
+        WriteLE<uint32_t>(output, 4, AssetArchive::Version);
+        WriteLE<uint32_t>(output, 8, static_cast<uint32_t>(entries.size()));
+        WriteLE<uint32_t>(output, 12, 0u);
+        WriteLE<uint64_t>(output, 16, tableOffset);
+        WriteLE<uint64_t>(output, 24, namesOffset);
+
+        uint64_t nameOffset {0u};
+
+        for (auto i = 0u; i < entries.size(); ++i)
+        {
+            const auto* entry = entries[i];
+            auto entryOffset = tableOffset + i * EntrySize;
+
+            dataOffset = Align(dataOffset, DataAlignment);
+
+            WriteLE<uint64_t>(output, entryOffset + 0, AssetArchive::HashName(entry->Name));
+            WriteLE<uint32_t>(output, entryOffset + 8, static_cast<uint32_t>(nameOffset));
+            WriteLE<uint32_t>(output, entryOffset + 12, static_cast<uint32_t>(entry->Name.size()));
+            WriteLE<uint64_t>(output, entryOffset + 16, dataOffset);
+            WriteLE<uint64_t>(output, entryOffset + 24, entry->Data.size());
+            WriteLE<uint64_t>(output, entryOffset + 32, entry->Size);
+            WriteLE<uint32_t>(output, entryOffset + 40, static_cast<uint32_t>(entry->Compression));
+
+            std::memcpy(output.data() + namesOffset + nameOffset, entry->Name.data(), entry->Name.size());
+            nameOffset += entry->Name.size();
+
+            if (!entry->Data.empty())
+            {
+                std::memcpy(output.data() + dataOffset, entry->Data.data(), entry->Data.size());
+            }
+
+            dataOffset += entry->Data.size();
+        }
+
+        std::ofstream fs(filePath, std::ios::binary | std::ios::trunc);
+        if (!fs.is_open())
+        {
+            api::logging::Log("Failed to open asset archive for writing: " + filePath.u8string());
+            return false;
+        }
+
+        fs.write(reinterpret_cast<const char*>(output.data()), static_cast<std::streamsize>(output.size()));
+
+        return fs.good();
+    }
+}
@@ -0,0 +1,175 @@
+#ifndef PROJECTFARM_ASSET_ARCHIVE_H
+#define PROJECTFARM_ASSET_ARCHIVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <filesystem>
+
+#include "utils/byte_span.h"
+#include "utils/mapped_file.h"
+
+// An archive of data files. All values are little endian and all offsets are from
+// the start of the file.
+//
+//  header      32 bytes    magic "PFAR", version, number of entries, flags, table offset, names offset
+//  table       48 bytes per entry, sorted by name hash: name hash, name offset, name length,
+//              data offset, stored size, size, compression
+//  names       the entry names, which are paths relative to the data folder using `/`
+//  data        the entry data, each aligned to 16 bytes
+//
+// Uncompressed entries are read in place from the mapped archive.
+
+namespace projectfarm::shared
+{
+    enum class AssetCompression : uint32_t
+    {
+        None = 0,
+        Lz = 1,
+    };
+
+    class AssetArchive final
+    {
+    public:
+        static constexpr uint32_t Version {1u};
+        static constexpr auto Extension = ".pfa";
+
+        AssetArchive() = default;
+        ~AssetArchive() = default;
+
+        AssetArchive(const AssetArchive&) = delete;
+        AssetArchive(AssetArchive&&) = delete;
+
+        [[nodiscard]]
+        bool Open(const std::filesystem::path& filePath) noexcept;
+
+        void Close() noexcept;
+
+        [[nodiscard]]
+        bool IsOpen() const noexcept
+        {
+            return this->_file.IsOpen();
+        }
+
+        [[nodiscard]]
+        bool Contains(std::string_view name) const noexcept;
+
+        // the data is valid until the archive is closed
+        [[nodiscard]]
+        std::optional<utils::ByteSpan> Read(std::string_view name) const noexcept;
+
+        [[nodiscard]]
+        uint32_t GetNumberOfEntries() const noexcept
+        {
+            return static_cast<uint32_t>(this->_entries.size());
+        }
+
+        [[nodiscard]]
+        static uint64_t HashName(std::string_view name) noexcept;
+
+    private:
+        struct Entry
+        {
+            uint64_t Hash {0u};
+            std::string_view Name;
+            uint64_t DataOffset {0u};
+            uint64_t StoredSize {0u};
+            uint64_t Size {0u};
+            AssetCompression Compression {AssetCompression::None};
+        };
+
+        utils::MappedFile _file;
+
+        std::vector<Entry> _entries;
+
+        // decompressed entries, kept for as long as the archive is open
+        mutable std::mutex _decompressedMutex;
+        mutable std::unordered_map<uint64_t, std::unique_ptr<std::byte[]>> _decompressed;
+
+        [[nodiscard]]
+        const Entry* Find(std::string_view name) const noexcept;
+    };
+
+    // the contents of a data file, either in an asset archive or mapped from the data folder
+    class AssetFile final
+    {
+    public:
+        explicit AssetFile(utils::ByteSpan data) noexcept
+            : _data {data},
+              _isArchived {true}
+        {
+        }
+
+        explicit AssetFile(utils::MappedFile&& file) noexcept
+            : _file {std::move(file)},
+              _data {_file.GetData(), _file.GetSize()}
+        {
+        }
+
+        ~AssetFile() = default;
+
+        AssetFile(const AssetFile&) = delete;
+        AssetFile(AssetFile&&) = default;
+
+        AssetFile& operator=(const AssetFile&) = delete;
+        AssetFile& operator=(AssetFile&&) = default;
+
+        [[nodiscard]]
+        utils::ByteSpan GetData() const noexcept
+        {
+            return this->_data;
+        }
+
+        [[nodiscard]]
+        bool IsArchived() const noexcept
+        {
+            return this->_isArchived;
+        }
+
+    private:
+        utils::MappedFile _file;
+        utils::ByteSpan _data;
+        bool _isArchived {false};
+    };
+
+    class AssetArchiveWriter final
+    {
+    public:
+        AssetArchiveWriter() = default;
+        ~AssetArchiveWriter() = default;
+
+        // entries are compressed when `allowCompression` is set and it saves at least 10%
+        void Add(const std::string& name, std::vector<std::byte> data, bool allowCompression) noexcept;
+
+        [[nodiscard]]
+        bool AddFile(const std::string& name, const std::filesystem::path& filePath, bool allowCompression) noexcept;
+
+        [[nodiscard]]
+        bool Write(const std::filesystem::path& filePath) const noexcept;
+
+        [[nodiscard]]
+        uint32_t GetNumberOfEntries() const noexcept
+        {
+            return static_cast<uint32_t>(this->_entries.size());
+        }
+
+    private:
+        struct Entry
+        {
+            std::string Name;
+            std::vector<std::byte> Data;
+            uint64_t Size {0u};
+            AssetCompression Compression {AssetCompression::None};
+        };
+
+        std::vector<Entry> _entries;
+    };
+}
+
+#endif
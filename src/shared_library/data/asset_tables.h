@@ -0,0 +1,31 @@
+#ifndef PROJECTFARM_ASSET_TABLES_H
+#define PROJECTFARM_ASSET_TABLES_H
+
+#include <cstdint>
+#include <limits>
+
+namespace projectfarm::shared
+{
+    // the location tables the data provider loads from the json index files
+    enum class AssetTables : uint8_t
+    {
+        TileSets,
+        Worlds,
+        Characters,
+        CharacterActionAnimations,
+        UIs,
+        UICustomControls,
+        GraphicsMaterials,
+        GraphicsShaders,
+        DefaultCSS,
+        Count,
+    };
+
+    // an asset interned by the data provider. Ids stay the same for as long as the
+    // data provider is set up, including when a table is reloaded
+    using AssetId = uint32_t;
+
+    constexpr AssetId InvalidAssetId {std::numeric_limits<AssetId>::max()};
+}
+
+#endif
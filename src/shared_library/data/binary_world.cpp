@@ -0,0 +1,888 @@
+#include <cstring>
+#include <fstream>
+#include <array>
+#include <set>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+
+#include "binary_world.h"
+#include "cooked_asset.h"
+#include "utils/stream.h"
+#include "utils/memory.h"
+#include "api/logging/logging.h"
+
+namespace projectfarm::shared
+{
+    namespace
+    {
+        constexpr std::array<char, 4> Magic {'P', 'F', 'W', 'D'};
+
+        constexpr uint32_t HeaderSize {64u};
+        constexpr uint32_t IslandEntrySize {64u};
+        constexpr uint32_t LayerEntrySize {16u};
+
+        // layers are aligned so they can be used in place, and so
+        // each starts on its own cache line
+        constexpr uint64_t LayerAlignment {64u};
+
+        constexpr uint32_t HasChecksumFlag {1u};
+        constexpr uint32_t IsOverheadLayerFlag {1u};
+        constexpr uint32_t IsBackgroundIslandFlag {1u};
+
+        bool IsLittleEndian() noexcept
+        {
+            static const auto isLittleEndian = utils::GetEndian() == utils::Endian::Little;
+            return isLittleEndian;
+        }
+
+        template <typename T>
+        T ReadLE(const std::byte* data) noexcept
+        {
+            static_assert(std::is_unsigned_v<T>);
+
+            T value {0};
+            for (auto i = 0u; i < sizeof(T); ++i)
+            {
+                value |= static_cast<T>(static_cast<T>(data[i]) << (8u * i));
+            }
+
+            return value;
+        }
+
+        float ReadFloatLE(const std::byte* data) noexcept
+        {
+            auto bits = ReadLE<uint32_t>(data);
+
+            float value {0.0f};
+            std::memcpy(&value, &bits, sizeof(value));
+
+            return value;
+        }
+
+        template <typename T>
+        void WriteLE(std::vector<std::byte>& bytes, uint64_t offset, T value) noexcept
+        {
+            static_assert(std::is_unsigned_v<T>);
+
+            for (auto i = 0u; i < sizeof(T); ++i)
+            {
+                bytes[offset + i] = static_cast<std::byte>((value >> (8u * i)) & 0xFFu);
+            }
+        }
+
+        template <typename T>
+        void AppendLE(std::vector<std::byte>& bytes, T value) noexcept
+        {
+            auto offset = bytes.size();
+            bytes.resize(offset + sizeof(T));
+
+            WriteLE(bytes, offset, value);
+        }
+
+        void AppendFloatLE(std::vector<std::byte>& bytes, float value) noexcept
+        {
+            uint32_t bits {0u};
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            AppendLE(bytes, bits);
+        }
+
+        void AppendString(std::vector<std::byte>& bytes, const std::string& value) noexcept
+        {
+            AppendLE(bytes, static_cast<uint32_t>(value.size()));
+
+            auto offset = bytes.size();
+            bytes.resize(offset + value.size());
+            std::memcpy(bytes.data() + offset, value.data(), value.size());
+        }
+
+        void Align(std::vector<std::byte>& bytes, uint64_t alignment) noexcept
+        {
+            auto remainder = bytes.size() % alignment;
+            if (remainder != 0u)
+            {
+                bytes.resize(bytes.size() + alignment - remainder);
+            }
+        }
+
+        // guards all reads from the file, so a truncated or corrupt file cannot read out of bounds
+        bool IsInBounds(uint64_t offset, uint64_t size, uint64_t fileSize) noexcept
+        {
+            return offset <= fileSize && size <= fileSize - offset;
+        }
+    }
+
+    const uint16_t* BinaryWorldFile::LayerView::GetPlotIndexes() const noexcept
+    {
+        if (!IsLittleEndian())
+        {
+            return nullptr;
+        }
+
+        return reinterpret_cast<const uint16_t*>(this->_data);
+    }
+
+    void BinaryWorldFile::LayerView::CopyTo(uint16_t* destination, uint64_t first, uint64_t count) const noexcept
+    {
+        if (IsLittleEndian())
+        {
+            std::memcpy(destination, this->_data + first * sizeof(uint16_t), count * sizeof(uint16_t));
+            return;
+        }
+
+        for (auto i = 0u; i < count; ++i)
+        {
+            destination[i] = ReadLE<uint16_t>(this->_data + (first + i) * sizeof(uint16_t));
+        }
+    }
+
+    bool BinaryWorldFile::IsBinaryWorldFile(const std::filesystem::path& filePath) noexcept
+    {
+        std::ifstream fs(filePath, std::ios::binary);
+        if (!fs.is_open())
+        {
+            return false;
+        }
+
+        std::array<char, 8> header {};
+        fs.read(header.data(), header.size());
+
+        if (!fs)
+        {
+            return false;
+        }
+
+        return BinaryWorldFile::IsBinaryWorldData({reinterpret_cast<const std::byte*>(header.data()), header.size()});
+    }
+
+    bool BinaryWorldFile::IsBinaryWorldData(utils::ByteSpan data) noexcept
+    {
+        if (data.size() < 8u || std::memcmp(data.data(), Magic.data(), Magic.size()) != 0)
+        {
+            return false;
+        }
+
+        return ReadLE<uint32_t>(data.data() + 4) == BinaryWorldFile::Version;
+    }
+
+    bool BinaryWorldFile::Open(const std::filesystem::path& filePath, bool verifyChecksum) noexcept
+    {
+        this->_islands.clear();
+        this->_backgroundIsland.reset();
+
+        if (!this->_file.Open(filePath))
+        {
+            api::logging::Log("Failed to open binary world: " + filePath.u8string());
+            return false;
+        }
+
+        return this->Open(utils::ByteSpan(this->_file.GetData(), this->_file.GetSize()), verifyChecksum,
+                          filePath.u8string());
+    }
+
+    bool BinaryWorldFile::Open(utils::ByteSpan data, bool verifyChecksum) noexcept
+    {
+        this->_file.Close();
+
+        return this->Open(data, verifyChecksum, "memory");
+    }
+
+    bool BinaryWorldFile::Open(utils::ByteSpan worldData, bool verifyChecksum, const std::string& source) noexcept
+    {
+        this->_islands.clear();
+        this->_backgroundIsland.reset();
+        this->_worldData = worldData;
+
+        auto data = worldData.data();
+        auto fileSize = worldData.size();
+
+        if (fileSize < HeaderSize || std::memcmp(data, Magic.data(), Magic.size()) != 0)
+        {
+            api::logging::Log("Not a binary world: " + source);
+            return false;
+        }
+
+        if (auto version = ReadLE<uint32_t>(data + 4); version != BinaryWorldFile::Version)
+        {
+            api::logging::Log("Unsupported binary world version: " + std::to_string(version) +
+                              " in file: " + source);
+            return false;
+        }
+
+        auto headerSize = ReadLE<uint32_t>(data + 8);
+        auto flags = ReadLE<uint32_t>(data + 12);
+        auto numberOfIslands = ReadLE<uint32_t>(data + 16);
+        auto nameLength = ReadLE<uint32_t>(data + 20);
+        auto nameOffset = ReadLE<uint64_t>(data + 24);
+        auto islandTableOffset = ReadLE<uint64_t>(data + 32);
+        auto expectedFileSize = ReadLE<uint64_t>(data + 40);
+        auto checksum = ReadLE<uint64_t>(data + 48);
+
+        if (headerSize < HeaderSize || headerSize > fileSize || expectedFileSize != fileSize)
+        {
+            api::logging::Log("Binary world is truncated or corrupt: " + source);
+            return false;
+        }
+
+        this->_hasChecksum = (flags & HasChecksumFlag) != 0u;
+
+        if (this->_hasChecksum && verifyChecksum &&
+            BinaryWorldFile::CalculateChecksum(data + headerSize, fileSize - headerSize) != checksum)
+        {
+            api::logging::Log("Binary world checksum does not match: " + source);
+            return false;
+        }
+
+        if (!IsInBounds(nameOffset, nameLength, fileSize) ||
+            !IsInBounds(islandTableOffset, static_cast<uint64_t>(numberOfIslands) * IslandEntrySize, fileSize))
+        {
+            api::logging::Log("Binary world is truncated or corrupt: " + source);
+            return false;
+        }
+
+        this->_name = std::string(reinterpret_cast<const char*>(data + nameOffset), nameLength);
+
+        this->_islands.reserve(numberOfIslands);
+
+        for (auto i = 0u; i < numberOfIslands; ++i)
+        {
+            auto entryOffset = islandTableOffset + static_cast<uint64_t>(i) * IslandEntrySize;
+
+            IslandView island;
+            if (!this->ReadIsland(entryOffset, island))
+            {
+                api::logging::Log("Failed to read island: " + std::to_string(i) + " from: " + source);
+                return false;
+            }
+
+            if ((ReadLE<uint32_t>(data + entryOffset + 56) & IsBackgroundIslandFlag) == 0u)
+            {
+                this->_islands.emplace_back(std::move(island));
+            }
+            else if (!this->_backgroundIsland)
+            {
+                this->_backgroundIsland = std::move(island);
+            }
+            else
+            {
+                api::logging::Log("Binary world has more than one background island: " + source);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool BinaryWorldFile::ReadIsland(uint64_t offset, IslandView& island) const noexcept
+    {
+        auto data = this->_worldData.data();
+        auto fileSize = this->_worldData.size();
+
+        auto entry = data + offset;
+
+        island.PositionX = ReadFloatLE(entry + 0);
+        island.PositionY = ReadFloatLE(entry + 4);
+        island.TileWidthInMeters = ReadFloatLE(entry + 8);
+        island.TileHeightInMeters = ReadFloatLE(entry + 12);
+        island.WidthInTiles = ReadLE<uint32_t>(entry + 16);
+        island.HeightInTiles = ReadLE<uint32_t>(entry + 20);
+
+        auto numberOfLayers = ReadLE<uint32_t>(entry + 24);
+        island.NumberOfActionTiles = ReadLE<uint32_t>(entry + 28);
+
+        auto layerTableOffset = ReadLE<uint64_t>(entry + 32);
+        island.ActionTilesOffset = ReadLE<uint64_t>(entry + 40);
+        island.ActionTilesSize = ReadLE<uint64_t>(entry + 48);
+
+        if (!IsInBounds(layerTableOffset, static_cast<uint64_t>(numberOfLayers) * LayerEntrySize, fileSize) ||
+            !IsInBounds(island.ActionTilesOffset, island.ActionTilesSize, fileSize))
+        {
+            return false;
+        }
+
+        auto numberOfTiles = static_cast<uint64_t>(island.WidthInTiles) * island.HeightInTiles;
+
+        island.Layers.clear();
+        island.Layers.reserve(numberOfLayers);
+
+        for (auto l = 0u; l < numberOfLayers; ++l)
+        {
+            auto layerEntry = data + layerTableOffset + static_cast<uint64_t>(l) * LayerEntrySize;
+
+            auto flags = ReadLE<uint32_t>(layerEntry + 0);
+            auto dataOffset = ReadLE<uint64_t>(layerEntry + 8);
+
+            if (dataOffset % alignof(uint16_t) != 0u ||
+                !IsInBounds(dataOffset, numberOfTiles * sizeof(uint16_t), fileSize))
+            {
+                return false;
+            }
+
+            island.Layers.emplace_back((flags & IsOverheadLayerFlag) != 0u, data + dataOffset, numberOfTiles);
+        }
+
+        return true;
+    }
+
+    std::optional<std::vector<BinaryWorldActionTile>> BinaryWorldFile::ReadActionTiles(const IslandView& island) const noexcept
+    {
+        auto data = this->_worldData.data() + island.ActionTilesOffset;
+        auto size = island.ActionTilesSize;
+
+        uint64_t index {0u};
+
+        auto readUInt32 = [data, size, &index](uint32_t& value)
+        {
+            if (!IsInBounds(index, sizeof(uint32_t), size))
+            {
+                return false;
+            }
+
+            value = ReadLE<uint32_t>(data + index);
+            index += sizeof(uint32_t);
+
+            return true;
+        };
+
+        auto readString = [data, size, &index, &readUInt32](std::string& value)
+        {
+            uint32_t length {0u};
+            if (!readUInt32(length) || !IsInBounds(index, length, size))
+            {
+                return false;
+            }
+
+            value.assign(reinterpret_cast<const char*>(data + index), length);
+            index += length;
+
+            return true;
+        };
+
+        std::vector<BinaryWorldActionTile> actionTiles;
+        actionTiles.reserve(island.NumberOfActionTiles);
+
+        for (auto i = 0u; i < island.NumberOfActionTiles; ++i)
+        {
+            BinaryWorldActionTile actionTile;
+            uint32_t numberOfProperties {0u};
+
+            if (!readUInt32(actionTile.X) || !readUInt32(actionTile.Y) || !readUInt32(numberOfProperties))
+            {
+                api::logging::Log("Action tiles are truncated.");
+                return {};
+            }
+
+            for (auto p = 0u; p < numberOfProperties; ++p)
+            {
+                std::string name;
+                std::string value;
+
+                if (!readString(name) || !readString(value))
+                {
+                    api::logging::Log("Action tile properties are truncated.");
+                    return {};
+                }
+
+                actionTile.Properties.emplace_back(std::move(name), std::move(value));
+            }
+
+            actionTiles.emplace_back(std::move(actionTile));
+        }
+
+        return actionTiles;
+    }
+
+    std::optional<BinaryWorldData> BinaryWorldFile::ToData() const noexcept
+    {
+        BinaryWorldData world;
+        world.Name = this->_name;
+
+        for (const auto& islandView : this->_islands)
+        {
+            auto island = this->CopyIsland(islandView);
+            if (!island)
+            {
+                return {};
+            }
+
+            world.Islands.emplace_back(std::move(*island));
+        }
+
+        if (this->_backgroundIsland)
+        {
+            world.Background = this->CopyIsland(*this->_backgroundIsland);
+            if (!world.Background)
+            {
+                return {};
+            }
+        }
+
+        return world;
+    }
+
+    std::optional<BinaryWorldIsland> BinaryWorldFile::CopyIsland(const IslandView& islandView) const noexcept
+    {
+        BinaryWorldIsland island;
+        island.PositionX = islandView.PositionX;
+        island.PositionY = islandView.PositionY;
+        island.TileWidthInMeters = islandView.TileWidthInMeters;
+        island.TileHeightInMeters = islandView.TileHeightInMeters;
+        island.WidthInTiles = islandView.WidthInTiles;
+        island.HeightInTiles = islandView.HeightInTiles;
+
+        for (const auto& layerView : islandView.Layers)
+        {
+            BinaryWorldLayer layer;
+            layer.IsOverhead = layerView.IsOverhead();
+            layer.PlotIndexes.resize(layerView.GetNumberOfTiles());
+
+            layerView.CopyTo(layer.PlotIndexes.data(), 0u, layerView.GetNumberOfTiles());
+
+            island.Layers.emplace_back(std::move(layer));
+        }
+
+        auto actionTiles = this->ReadActionTiles(islandView);
+        if (!actionTiles)
+        {
+            return {};
+        }
+
+        island.ActionTiles = std::move(*actionTiles);
+
+        return island;
+    }
+
+    uint64_t BinaryWorldFile::CalculateChecksum(const std::byte* data, uint64_t size) noexcept
+    {
+        // FNV-1a, taken a 64 bit word at a time so large worlds can be checked quickly
+        constexpr uint64_t offsetBasis {14695981039346656037ull};
+        constexpr uint64_t prime {1099511628211ull};
+
+        auto hash = offsetBasis;
+
+        uint64_t i {0u};
+        for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+        {
+            hash ^= ReadLE<uint64_t>(data + i);
+            hash *= prime;
+        }
+
+        for (; i < size; ++i)
+        {
+            hash ^= static_cast<uint64_t>(data[i]);
+            hash *= prime;
+        }
+
+        return hash;
+    }
+
+    bool WriteBinaryWorld(const BinaryWorldData& world, const std::filesystem::path& filePath,
+                          bool includeChecksum) noexcept
+    {
+        std::vector<std::byte> bytes(HeaderSize);
+
+        auto nameOffset = static_cast<uint64_t>(bytes.size());
+        bytes.resize(bytes.size() + world.Name.size());
+        std::memcpy(bytes.data() + nameOffset, world.Name.data(), world.Name.size());
+
+        Align(bytes, 8u);
+
+        // the background is written after the islands, flagged so readers keep it apart
+        std::vector<std::pair<const BinaryWorldIsland*, uint32_t>> islands;
+        islands.reserve(world.Islands.size() + 1u);
+
+        for (const auto& island : world.Islands)
+        {
+            islands.emplace_back(&island, 0u);
+        }
+
+        if (world.Background)
+        {
+            islands.emplace_back(&*world.Background, IsBackgroundIslandFlag);
+        }
+
+        auto islandTableOffset = static_cast<uint64_t>(bytes.size());
+        bytes.resize(bytes.size() + islands.size() * IslandEntrySize);
+
+        for (auto i = 0u; i < islands.size(); ++i)
+        {
+            const auto& [islandPointer, islandFlags] = islands[i];
+            const auto& island = *islandPointer;
+            auto numberOfTiles = static_cast<uint64_t>(island.WidthInTiles) * island.HeightInTiles;
+
+            auto layerTableOffset = static_cast<uint64_t>(bytes.size());
+            bytes.resize(bytes.size() + island.Layers.size() * LayerEntrySize);
+
+            for (auto l = 0u; l < island.Layers.size(); ++l)
+            {
+                const auto& layer = island.Layers[l];
+
+                if (layer.PlotIndexes.size() != numberOfTiles)
+                {
+                    api::logging::Log("Layer " + std::to_string(l) + " of island " + std::to_string(i) +
+                                      " has " + std::to_string(layer.PlotIndexes.size()) +
+                                      " plots, but expected " + std::to_string(numberOfTiles));
+                    return false;
+                }
+
+                Align(bytes, LayerAlignment);
+
+                auto dataOffset = static_cast<uint64_t>(bytes.size());
+                bytes.resize(bytes.size() + numberOfTiles * sizeof(uint16_t));
+
+                if (IsLittleEndian())
+                {
+                    std::memcpy(bytes.data() + dataOffset, layer.PlotIndexes.data(), numberOfTiles * sizeof(uint16_t));
+                }
+                else
+                {
+                    for (auto t = 0u; t < numberOfTiles; ++t)
+                    {
+                        WriteLE(bytes, dataOffset + t * sizeof(uint16_t), layer.PlotIndexes[t]);
+                    }
+                }
+
+                auto entryOffset = layerTableOffset + static_cast<uint64_t>(l) * LayerEntrySize;
+                WriteLE(bytes, entryOffset + 0, layer.IsOverhead ? IsOverheadLayerFlag : 0u);
+                WriteLE(bytes, entryOffset + 4, 0u);
+                WriteLE(bytes, entryOffset + 8, dataOffset);
+            }
+
+            auto actionTilesOffset = static_cast<uint64_t>(bytes.size());
+
+            for (const auto& actionTile : island.ActionTiles)
+            {
+                AppendLE(bytes, actionTile.X);
+                AppendLE(bytes, actionTile.Y);
+                AppendLE(bytes, static_cast<uint32_t>(actionTile.Properties.size()));
+
+                for (const auto& [name, value] : actionTile.Properties)
+                {
+                    AppendString(bytes, name);
+                    AppendString(bytes, value);
+                }
+            }
+
+            auto actionTilesSize = static_cast<uint64_t>(bytes.size()) - actionTilesOffset;
+
+            Align(bytes, 8u);
+
+            std::vector<std::byte> entry;
+            entry.reserve(IslandEntrySize);
+
+            AppendFloatLE(entry, island.PositionX);
+            AppendFloatLE(entry, island.PositionY);
+            AppendFloatLE(entry, island.TileWidthInMeters);
+            AppendFloatLE(entry, island.TileHeightInMeters);
+            AppendLE(entry, island.WidthInTiles);
+            AppendLE(entry, island.HeightInTiles);
+            AppendLE(entry, static_cast<uint32_t>(island.Layers.size()));
+            AppendLE(entry, static_cast<uint32_t>(island.ActionTiles.size()));
+            AppendLE(entry, layerTableOffset);
+            AppendLE(entry, actionTilesOffset);
+            AppendLE(entry, actionTilesSize);
+            AppendLE(entry, islandFlags);
+            AppendLE(entry, uint32_t {0u});
+
+            std::memcpy(bytes.data() + islandTableOffset + static_cast<uint64_t>(i) * IslandEntrySize,
+                        entry.data(), IslandEntrySize);
+        }
+
+        auto fileSize = static_cast<uint64_t>(bytes.size());
+        auto checksum = includeChecksum ? BinaryWorldFile::CalculateChecksum(bytes.data() + HeaderSize,
+                                                                             fileSize - HeaderSize)
+                                        : 0u;
+
+        std::memcpy(bytes.data(), Magic.data(), Magic.size());
+        WriteLE(bytes, 4, BinaryWorldFile::Version);
+        WriteLE(bytes, 8, HeaderSize);
+        WriteLE(bytes, 12, includeChecksum ? HasChecksumFlag : 0u);
+        WriteLE(bytes, 16, static_cast<uint32_t>(islands.size()));
+        WriteLE(bytes, 20, static_cast<uint32_t>(world.Name.size()));
+        WriteLE(bytes, 24, nameOffset);
+        WriteLE(bytes, 32, islandTableOffset);
+        WriteLE(bytes, 40, fileSize);
+        WriteLE(bytes, 48, checksum);
+        WriteLE(bytes, 56, uint64_t {0u});
+
+        std::ofstream fs(filePath, std::ios::binary | std::ios::trunc);
+        if (!fs.is_open())
+        {
+            api::logging::Log("Failed to open file for writing: " + filePath.u8string());
+            return false;
+        }
+
+        fs.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+
+        if (!fs)
+        {
+            api::logging::Log("Failed to write binary world: " + filePath.u8string());
+            return false;
+        }
+
+        return true;
+    }
+
+    std::optional<BinaryWorldData> ReadBinaryWorldV1(const std::filesystem::path& filePath) noexcept
+    {
+        std::ifstream fs(filePath, std::ios::binary);
+        if (!fs.is_open())
+        {
+            api::logging::Log("Failed to open world file: " + filePath.u8string());
+            return {};
+        }
+
+        BinaryWorldData world;
+        world.Name = utils::ReadStringFromBinaryFile(fs);
+
+        BinaryWorldIsland island;
+        island.WidthInTiles = utils::ReadUInt32FromBinaryFile(fs);
+        island.HeightInTiles = utils::ReadUInt32FromBinaryFile(fs);
+
+        auto numberOfTiles = static_cast<uint64_t>(island.WidthInTiles) * island.HeightInTiles;
+
+        auto numberOfLayers = utils::ReadUInt32FromBinaryFile(fs);
+
+        for (auto l = 0u; l < numberOfLayers; ++l)
+        {
+            BinaryWorldLayer layer;
+            layer.IsOverhead = utils::ReadBoolFromBinaryFile(fs);
+
+            // version 1 stores each plot index as an int32
+            std::vector<int32_t> plotIndexes(numberOfTiles);
+            fs.read(reinterpret_cast<char*>(plotIndexes.data()),
+                    static_cast<std::streamsize>(numberOfTiles * sizeof(int32_t)));
+
+            if (!fs)
+            {
+                api::logging::Log("World file is truncated: " + filePath.u8string());
+                return {};
+            }
+
+            layer.PlotIndexes.resize(numberOfTiles);
+            for (auto t = 0u; t < numberOfTiles; ++t)
+            {
+                layer.PlotIndexes[t] = plotIndexes[t] == -1 ? BinaryWorldFile::EmptyPlotIndex
+                                                            : static_cast<uint16_t>(plotIndexes[t]);
+            }
+
+            island.Layers.emplace_back(std::move(layer));
+        }
+
+        // action tiles were added later, so may not exist
+        auto numberOfActionTiles = utils::ReadUInt32FromBinaryFile(fs);
+
+        for (auto i = 0u; fs && i < numberOfActionTiles; ++i)
+        {
+            BinaryWorldActionTile actionTile;
+            actionTile.X = utils::ReadUInt32FromBinaryFile(fs);
+            actionTile.Y = utils::ReadUInt32FromBinaryFile(fs);
+
+            auto numberOfProperties = utils::ReadUInt32FromBinaryFile(fs);
+
+            for (auto p = 0u; p < numberOfProperties; ++p)
+            {
+                auto name = utils::ReadStringFromBinaryFile(fs);
+                auto value = utils::ReadStringFromBinaryFile(fs);
+
+                actionTile.Properties.emplace_back(std::move(name), std::move(value));
+            }
+
+            island.ActionTiles.emplace_back(std::move(actionTile));
+        }
+
+        world.Islands.emplace_back(std::move(island));
+
+        return world;
+    }
+
+    std::optional<BinaryWorldData> ReadJsonWorld(const std::filesystem::path& filePath,
+                                                 const std::filesystem::path& plotsFilePath) noexcept
+    {
+        // nlohmann::json can throw exceptions
+        try
+        {
+            auto plotsJson = LoadJsonAsset(plotsFilePath);
+            if (!plotsJson)
+            {
+                api::logging::Log("Failed to open plots file: " + plotsFilePath.u8string());
+                return {};
+            }
+
+            std::unordered_map<std::string, uint16_t> plotIndexes;
+            for (const auto& plotJson : (*plotsJson)["plots"])
+            {
+                auto index = static_cast<uint16_t>(plotIndexes.size());
+                plotIndexes[plotJson["name"].get<std::string>()] = index;
+            }
+
+            std::set<std::string> unknownPlotNames;
+
+            auto getPlotIndex = [&plotIndexes, &unknownPlotNames](const std::string& name)
+            {
+                if (name.empty())
+                {
+                    return BinaryWorldFile::EmptyPlotIndex;
+                }
+
+                auto iter = plotIndexes.find(name);
+                if (iter == plotIndexes.end())
+                {
+                    unknownPlotNames.insert(name);
+                    return BinaryWorldFile::EmptyPlotIndex;
+                }
+
+                return iter->second;
+            };
+
+            auto json = LoadJsonAsset(filePath);
+            if (!json)
+            {
+                api::logging::Log("Failed to open world file: " + filePath.u8string());
+                return {};
+            }
+
+            auto& jsonFile = *json;
+
+            auto readIsland = [&getPlotIndex](const nlohmann::json& islandJson)
+            {
+                BinaryWorldIsland island;
+
+                auto jsonIt = islandJson.find("x");
+                island.PositionX = jsonIt == islandJson.end() ? 0.0f : jsonIt->get<float>();
+
+                jsonIt = islandJson.find("y");
+                island.PositionY = jsonIt == islandJson.end() ? 0.0f : jsonIt->get<float>();
+
+                island.WidthInTiles = islandJson["widthInTiles"].get<uint32_t>();
+                island.HeightInTiles = islandJson["heightInTiles"].get<uint32_t>();
+                island.TileWidthInMeters = islandJson["tileWidth"].get<float>();
+                island.TileHeightInMeters = islandJson["tileHeight"].get<float>();
+
+                auto width = island.WidthInTiles;
+                auto height = island.HeightInTiles;
+
+                for (const auto& layerJson : islandJson["layers"])
+                {
+                    auto defaultPlotIter = layerJson.find("defaultPlot");
+                    auto defaultPlot = defaultPlotIter == layerJson.end() ? "" : defaultPlotIter->get<std::string>();
+
+                    BinaryWorldLayer layer;
+                    layer.PlotIndexes.assign(static_cast<uint64_t>(width) * height, getPlotIndex(defaultPlot));
+
+                    if (auto regionsJson = layerJson.find("regions"); regionsJson != layerJson.end())
+                    {
+                        for (const auto& regionJson : *regionsJson)
+                        {
+                            auto plotIndex = getPlotIndex(regionJson["name"].get<std::string>());
+                            auto x = regionJson["x"].get<uint32_t>();
+                            auto y = regionJson["y"].get<uint32_t>();
+                            auto w = regionJson["w"].get<uint32_t>();
+                            auto h = regionJson["h"].get<uint32_t>();
+
+                            for (auto yPos = y; yPos < std::min(y + h, height); ++yPos)
+                            {
+                                for (auto xPos = x; xPos < std::min(x + w, width); ++xPos)
+                                {
+                                    layer.PlotIndexes[static_cast<uint64_t>(yPos) * width + xPos] = plotIndex;
+                                }
+                            }
+                        }
+                    }
+
+                    if (auto plotsInLayerJson = layerJson.find("plots"); plotsInLayerJson != layerJson.end())
+                    {
+                        for (const auto& plotJson : *plotsInLayerJson)
+                        {
+                            auto x = plotJson["x"].get<uint32_t>();
+                            auto y = plotJson["y"].get<uint32_t>();
+
+                            if (x >= width || y >= height)
+                            {
+                                continue;
+                            }
+
+                            layer.PlotIndexes[static_cast<uint64_t>(y) * width + x] =
+                                getPlotIndex(plotJson["name"].get<std::string>());
+                        }
+                    }
+
+                    island.Layers.emplace_back(std::move(layer));
+                }
+
+                return island;
+            };
+
+            BinaryWorldData world;
+            world.Name = jsonFile["name"].get<std::string>();
+
+            for (const auto& islandJson : jsonFile["islands"])
+            {
+                world.Islands.emplace_back(readIsland(islandJson));
+            }
+
+            // only island backgrounds are drawn
+            if (auto backgroundJson = jsonFile.find("background");
+                backgroundJson != jsonFile.end() && (*backgroundJson)["type"].get<std::string>() == "island")
+            {
+                world.Background = readIsland((*backgroundJson)["island"]);
+            }
+
+            if (!unknownPlotNames.empty())
+            {
+                for (const auto& name : unknownPlotNames)
+                {
+                    api::logging::Log("Unknown plot: " + name + " in world file: " + filePath.u8string());
+                }
+
+                return {};
+            }
+
+            return world;
+        }
+        catch (const std::exception& ex)
+        {
+            api::logging::Log("Failed to read world file: " + filePath.u8string() +
+                              " with exception: " + ex.what());
+            return {};
+        }
+    }
+
+    bool ConvertToBinaryWorld(const std::filesystem::path& inputFilePath,
+                              const std::filesystem::path& plotsFilePath,
+                              const std::filesystem::path& outputFilePath) noexcept
+    {
+        std::optional<BinaryWorldData> world;
+
+        if (BinaryWorldFile::IsBinaryWorldFile(inputFilePath))
+        {
+            BinaryWorldFile file;
+            if (file.Open(inputFilePath))
+            {
+                world = file.ToData();
+            }
+        }
+        else if (inputFilePath.extension() == ".bin")
+        {
+            world = ReadBinaryWorldV1(inputFilePath);
+        }
+        else
+        {
+            world = ReadJsonWorld(inputFilePath, plotsFilePath);
+        }
+
+        if (!world)
+        {
+            api::logging::Log("Failed to read world: " + inputFilePath.u8string());
+            return false;
+        }
+
+        if (!WriteBinaryWorld(*world, outputFilePath))
+        {
+            api::logging::Log("Failed to write world: " + outputFilePath.u8string());
+            return false;
+        }
+
+        return true;
+    }
+}
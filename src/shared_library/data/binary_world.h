@@ -0,0 +1,227 @@
+#ifndef PROJECTFARM_BINARY_WORLD_H
+#define PROJECTFARM_BINARY_WORLD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <utility>
+#include <optional>
+#include <filesystem>
+
+#include "utils/mapped_file.h"
+#include "utils/byte_span.h"
+
+// Version 3 of the binary world format. All values are little endian and all
+// offsets are from the start of the file.
+//
+//  header          64 bytes    magic "PFWD", version, header size, flags, number of islands,
+//                              name length, name offset, island table offset, file size, checksum
+//  name            name length bytes
+//  island table    64 bytes per island: position, tile size, size in tiles, number of layers,
+//                  number of action tiles, layer table offset, action tiles offset and size, flags
+//  layer tables    16 bytes per layer: flags, data offset
+//  layers          width * height plot indexes (uint16), row by row, each aligned to 64 bytes
+//  action tiles    per tile: x, y, number of properties, then the length prefixed name and value of each
+//
+// The checksum, when present, covers everything after the header. At most one island
+// is flagged as the background, which is the world's background rather than part of it.
+
+namespace projectfarm::shared
+{
+    struct BinaryWorldActionTile
+    {
+        uint32_t X {0u};
+        uint32_t Y {0u};
+        std::vector<std::pair<std::string, std::string>> Properties;
+    };
+
+    struct BinaryWorldLayer
+    {
+        bool IsOverhead {false};
+
+        // row by row, `WidthInTiles * HeightInTiles` plot indexes
+        std::vector<uint16_t> PlotIndexes;
+    };
+
+    struct BinaryWorldIsland
+    {
+        float PositionX {0.0f};
+        float PositionY {0.0f};
+
+        float TileWidthInMeters {1.0f};
+        float TileHeightInMeters {1.0f};
+
+        uint32_t WidthInTiles {0u};
+        uint32_t HeightInTiles {0u};
+
+        std::vector<BinaryWorldLayer> Layers;
+        std::vector<BinaryWorldActionTile> ActionTiles;
+    };
+
+    struct BinaryWorldData
+    {
+        std::string Name;
+        std::vector<BinaryWorldIsland> Islands;
+
+        // drawn behind the islands, repeated across the screen
+        std::optional<BinaryWorldIsland> Background;
+    };
+
+    // Reads a version 3 binary world in place from a memory mapped file.
+    // The views returned are only valid while this object is alive.
+    class BinaryWorldFile final
+    {
+    public:
+        static constexpr uint32_t Version {3u};
+        static constexpr uint16_t EmptyPlotIndex {0xFFFFu};
+
+        class LayerView final
+        {
+        public:
+            LayerView(bool isOverhead, const std::byte* data, uint64_t numberOfTiles) noexcept
+                : _isOverhead {isOverhead},
+                  _data {data},
+                  _numberOfTiles {numberOfTiles}
+            {
+            }
+
+            [[nodiscard]]
+            bool IsOverhead() const noexcept
+            {
+                return this->_isOverhead;
+            }
+
+            [[nodiscard]]
+            uint64_t GetNumberOfTiles() const noexcept
+            {
+                return this->_numberOfTiles;
+            }
+
+            // the plot indexes as stored in the file, or `nullptr` on big endian platforms
+            [[nodiscard]]
+            const uint16_t* GetPlotIndexes() const noexcept;
+
+            // copies `count` plot indexes, starting at `first`, into `destination`
+            void CopyTo(uint16_t* destination, uint64_t first, uint64_t count) const noexcept;
+
+        private:
+            bool _isOverhead {false};
+            const std::byte* _data {nullptr};
+            uint64_t _numberOfTiles {0u};
+        };
+
+        struct IslandView
+        {
+            float PositionX {0.0f};
+            float PositionY {0.0f};
+
+            float TileWidthInMeters {1.0f};
+            float TileHeightInMeters {1.0f};
+
+            uint32_t WidthInTiles {0u};
+            uint32_t HeightInTiles {0u};
+
+            std::vector<LayerView> Layers;
+
+            uint32_t NumberOfActionTiles {0u};
+            uint64_t ActionTilesOffset {0u};
+            uint64_t ActionTilesSize {0u};
+        };
+
+        BinaryWorldFile() = default;
+        ~BinaryWorldFile() = default;
+
+        BinaryWorldFile(const BinaryWorldFile&) = delete;
+        BinaryWorldFile(BinaryWorldFile&&) = default;
+
+        [[nodiscard]]
+        bool Open(const std::filesystem::path& filePath, bool verifyChecksum = true) noexcept;
+
+        // reads a world already in memory, such as an entry in an asset archive, which
+        // must outlive this object
+        [[nodiscard]]
+        bool Open(utils::ByteSpan data, bool verifyChecksum = true) noexcept;
+
+        // checks the magic number and version without mapping the whole file
+        [[nodiscard]]
+        static bool IsBinaryWorldFile(const std::filesystem::path& filePath) noexcept;
+
+        [[nodiscard]]
+        static bool IsBinaryWorldData(utils::ByteSpan data) noexcept;
+
+        [[nodiscard]]
+        const std::string& GetName() const noexcept
+        {
+            return this->_name;
+        }
+
+        [[nodiscard]]
+        bool HasChecksum() const noexcept
+        {
+            return this->_hasChecksum;
+        }
+
+        [[nodiscard]]
+        const std::vector<IslandView>& GetIslands() const noexcept
+        {
+            return this->_islands;
+        }
+
+        [[nodiscard]]
+        const std::optional<IslandView>& GetBackgroundIsland() const noexcept
+        {
+            return this->_backgroundIsland;
+        }
+
+        [[nodiscard]]
+        std::optional<std::vector<BinaryWorldActionTile>> ReadActionTiles(const IslandView& island) const noexcept;
+
+        // copies the whole world out of the file
+        [[nodiscard]]
+        std::optional<BinaryWorldData> ToData() const noexcept;
+
+        [[nodiscard]]
+        static uint64_t CalculateChecksum(const std::byte* data, uint64_t size) noexcept;
+
+    private:
+        utils::MappedFile _file;
+        utils::ByteSpan _worldData;
+
+        std::string _name;
+        bool _hasChecksum {false};
+
+        std::vector<IslandView> _islands;
+        std::optional<IslandView> _backgroundIsland;
+
+        [[nodiscard]]
+        bool Open(utils::ByteSpan worldData, bool verifyChecksum, const std::string& source) noexcept;
+
+        [[nodiscard]]
+        bool ReadIsland(uint64_t offset, IslandView& island) const noexcept;
+
+        [[nodiscard]]
+        std::optional<BinaryWorldIsland> CopyIsland(const IslandView& islandView) const noexcept;
+    };
+
+    [[nodiscard]]
+    bool WriteBinaryWorld(const BinaryWorldData& world, const std::filesystem::path& filePath,
+                          bool includeChecksum = true) noexcept;
+
+    // the original binary format, which has a single island and native endian values
+    [[nodiscard]]
+    std::optional<BinaryWorldData> ReadBinaryWorldV1(const std::filesystem::path& filePath) noexcept;
+
+    // plot names are resolved with the order of the plots in `plotsFilePath`
+    [[nodiscard]]
+    std::optional<BinaryWorldData> ReadJsonWorld(const std::filesystem::path& filePath,
+                                                 const std::filesystem::path& plotsFilePath) noexcept;
+
+    // converts a json (`.json`) or version 1 binary (`.bin`) world to a version 3 binary world
+    [[nodiscard]]
+    bool ConvertToBinaryWorld(const std::filesystem::path& inputFilePath,
+                              const std::filesystem::path& plotsFilePath,
+                              const std::filesystem::path& outputFilePath) noexcept;
+}
+
+#endif
@@ -0,0 +1,188 @@
+#include <fstream>
+#include <cstring>
+#include <system_error>
+
+#include "cooked_asset.h"
+#include "utils/mapped_file.h"
+#include "api/logging/logging.h"
+
+using namespace std::literals;
+
+namespace projectfarm::shared
+{
+    namespace
+    {
+        constexpr char CookedAssetMagic[] {'P', 'F', 'C', 'A'};
+        constexpr uint64_t CookedAssetHeaderSize {8u};
+    }
+
+    std::filesystem::path GetCookedAssetPath(const std::filesystem::path& filePath) noexcept
+    {
+        auto cookedFilePath = filePath;
+        cookedFilePath += CookedAssetExtension;
+
+        return cookedFilePath;
+    }
+
+    bool IsCookedAssetCurrent(const std::filesystem::path& filePath) noexcept
+    {
+        auto cookedFilePath = GetCookedAssetPath(filePath);
+
+        std::error_code ec;
+        auto cookedTime = std::filesystem::last_write_time(cookedFilePath, ec);
+        if (ec)
+        {
+            return false;
+        }
+
+        // the cooked asset may have been shipped without its source
+        auto sourceTime = std::filesystem::last_write_time(filePath, ec);
+        if (ec)
+        {
+            return true;
+        }
+
+        return cookedTime >= sourceTime;
+    }
+
+    std::optional<nlohmann::json> LoadJsonAsset(const std::filesystem::path& filePath) noexcept
+    {
+        if (IsCookedAssetCurrent(filePath))
+        {
+            if (auto json = ReadCookedJsonAsset(GetCookedAssetPath(filePath)); json)
+            {
+                return json;
+            }
+
+            api::logging::Log("Failed to read cooked asset for: " + filePath.u8string() + ". Using the json file.");
+        }
+
+        // nlohmann::json can throw exceptions
+        try
+        {
+            std::ifstream file(filePath);
+            if (!file.is_open())
+            {
+                api::logging::Log("Failed to open json file: " + filePath.u8string());
+                return {};
+            }
+
+            nlohmann::json json;
+            file >> json;
+
+            return json;
+        }
+        catch (const std::exception& ex)
+        {
+            api::logging::Log("Failed to parse json file: " + filePath.u8string() +
+                              " with error: " + ex.what());
+            return {};
+        }
+    }
+
+    std::optional<nlohmann::json> ReadCookedJsonAsset(const std::filesystem::path& cookedFilePath) noexcept
+    {
+        utils::MappedFile file;
+        if (!file.Open(cookedFilePath))
+        {
+            return {};
+        }
+
+        auto json = ParseCookedJsonAsset({file.GetData(), file.GetSize()});
+        if (!json)
+        {
+            api::logging::Log("Failed to read cooked asset: " + cookedFilePath.u8string());
+            return {};
+        }
+
+        return json;
+    }
+
+    std::optional<nlohmann::json> ParseCookedJsonAsset(utils::ByteSpan data) noexcept
+    {
+        if (data.size() < CookedAssetHeaderSize)
+        {
+            return {};
+        }
+
+        auto bytes = reinterpret_cast<const uint8_t*>(data.data());
+
+        // a cooked world is a binary world, not a cooked json blob
+        if (std::memcmp(bytes, CookedAssetMagic, sizeof(CookedAssetMagic)) != 0)
+        {
+            return {};
+        }
+
+        auto version = static_cast<uint32_t>(bytes[4]) |
+                       static_cast<uint32_t>(bytes[5]) << 8u |
+                       static_cast<uint32_t>(bytes[6]) << 16u |
+                       static_cast<uint32_t>(bytes[7]) << 24u;
+
+        if (version != CookedAssetVersion)
+        {
+            api::logging::Log("Unsupported cooked asset version: " + std::to_string(version));
+            return {};
+        }
+
+        // nlohmann::json can throw exceptions
+        try
+        {
+            return nlohmann::json::from_msgpack(bytes + CookedAssetHeaderSize, bytes + data.size());
+        }
+        catch (const std::exception& ex)
+        {
+            api::logging::Log("Failed to parse cooked asset with error: "s + ex.what());
+            return {};
+        }
+    }
+
+    std::optional<nlohmann::json> ParseJsonAsset(utils::ByteSpan data) noexcept
+    {
+        // nlohmann::json can throw exceptions
+        try
+        {
+            auto bytes = reinterpret_cast<const uint8_t*>(data.data());
+
+            return nlohmann::json::parse(bytes, bytes + data.size());
+        }
+        catch (const std::exception& ex)
+        {
+            api::logging::Log("Failed to parse json with error: "s + ex.what());
+            return {};
+        }
+    }
+
+    bool WriteCookedJsonAsset(const nlohmann::json& json, const std::filesystem::path& cookedFilePath) noexcept
+    {
+        // nlohmann::json can throw exceptions
+        try
+        {
+            auto body = nlohmann::json::to_msgpack(json);
+
+            std::ofstream fp(cookedFilePath, std::ios::binary | std::ios::trunc);
+            if (!fp.is_open())
+            {
+                api::logging::Log("Failed to open cooked asset: " + cookedFilePath.u8string());
+                return false;
+            }
+
+            uint8_t header[CookedAssetHeaderSize] {};
+            std::memcpy(header, CookedAssetMagic, sizeof(CookedAssetMagic));
+            header[4] = static_cast<uint8_t>(CookedAssetVersion);
+            header[5] = static_cast<uint8_t>(CookedAssetVersion >> 8u);
+            header[6] = static_cast<uint8_t>(CookedAssetVersion >> 16u);
+            header[7] = static_cast<uint8_t>(CookedAssetVersion >> 24u);
+
+            fp.write(reinterpret_cast<const char*>(header), sizeof(header));
+            fp.write(reinterpret_cast<const char*>(body.data()), static_cast<std::streamsize>(body.size()));
+
+            return fp.good();
+        }
+        catch (const std::exception& ex)
+        {
+            api::logging::Log("Failed to write cooked asset: " + cookedFilePath.u8string() +
+                              " with error: " + ex.what());
+            return false;
+        }
+    }
+}
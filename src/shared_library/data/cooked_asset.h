@@ -0,0 +1,53 @@
+#ifndef PROJECTFARM_COOKED_ASSET_H
+#define PROJECTFARM_COOKED_ASSET_H
+
+#include <cstdint>
+#include <optional>
+#include <filesystem>
+
+#include <nlohmann/json.hpp>
+
+#include "utils/byte_span.h"
+
+// A cooked asset is the output of the asset cooker for a single json asset. It is
+// stored next to its source as `<source>.cooked` and is either a version 3 binary
+// world (for worlds, with plot names resolved to indexes) or a cooked json blob:
+//
+//  header      8 bytes     magic "PFCA", version
+//  body        the validated json as MessagePack
+//
+// A cooked asset is only used while it is at least as new as its source, so editing
+// a json file during development does not require re-cooking.
+
+namespace projectfarm::shared
+{
+    static constexpr auto CookedAssetExtension = ".cooked";
+    static constexpr uint32_t CookedAssetVersion {1u};
+
+    [[nodiscard]]
+    std::filesystem::path GetCookedAssetPath(const std::filesystem::path& filePath) noexcept;
+
+    // true if the cooked asset for `filePath` exists and is not older than `filePath`
+    [[nodiscard]]
+    bool IsCookedAssetCurrent(const std::filesystem::path& filePath) noexcept;
+
+    // loads the json asset at `filePath`, preferring its cooked asset if it is current
+    [[nodiscard]]
+    std::optional<nlohmann::json> LoadJsonAsset(const std::filesystem::path& filePath) noexcept;
+
+    [[nodiscard]]
+    std::optional<nlohmann::json> ReadCookedJsonAsset(const std::filesystem::path& cookedFilePath) noexcept;
+
+    // `data` is the contents of a cooked asset, such as an entry in an asset archive
+    [[nodiscard]]
+    std::optional<nlohmann::json> ParseCookedJsonAsset(utils::ByteSpan data) noexcept;
+
+    // `data` is the contents of a json file
+    [[nodiscard]]
+    std::optional<nlohmann::json> ParseJsonAsset(utils::ByteSpan data) noexcept;
+
+    [[nodiscard]]
+    bool WriteCookedJsonAsset(const nlohmann::json& json, const std::filesystem::path& cookedFilePath) noexcept;
+}
+
+#endif
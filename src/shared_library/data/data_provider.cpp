@@ -1,24 +1,30 @@
 #include <nlohmann/json.hpp>
-#include <fstream>
 #include <string>
 #include <cstdlib>
+#include <system_error>
 
 #include "data_provider.h"
+#include "cooked_asset.h"
 #include "api/logging/logging.h"
 
 namespace projectfarm::shared
 {
     bool DataProvider::SetupClient()
     {
-        if (!this->LoadLocations(DataProviderLocations::ClientTileSets,
-                                 "tilesets.json", "tileSets",
-                                 this->_tileSetLocations))
+        if (!this->MountDefaultArchive())
+        {
+            api::logging::Log("Failed to mount asset archive");
+            return false;
+        }
+
+        if (!this->LoadTileSetLocations())
         {
             api::logging::Log("Failed to load tile set locations");
             return false;
         }
 
-        if (!this->LoadLocations(DataProviderLocations::SharedWorlds,
+        if (!this->LoadLocations(AssetTables::Worlds,
+                                 DataProviderLocations::SharedWorlds,
                                  "worlds.json", "worlds",
                                  this->_worldLocations))
         {
@@ -26,7 +32,8 @@ namespace projectfarm::shared
             return false;
         }
 
-        if (!this->LoadLocations(DataProviderLocations::SharedCharacters,
+        if (!this->LoadLocations(AssetTables::CharacterActionAnimations,
+                                 DataProviderLocations::SharedCharacters,
                                  "action_animations.json", "animations",
                                  this->_characterActionAnimationLocations))
         {
@@ -34,7 +41,8 @@ namespace projectfarm::shared
             return false;
         }
 
-        if (!this->LoadLocations(DataProviderLocations::ClientUI,
+        if (!this->LoadLocations(AssetTables::UIs,
+                                 DataProviderLocations::ClientUI,
                                  "uis.json", "uis",
                                  this->_uiLocations))
         {
@@ -42,7 +50,8 @@ namespace projectfarm::shared
             return false;
         }
 
-        if (!this->LoadLocations(DataProviderLocations::ClientUI,
+        if (!this->LoadLocations(AssetTables::UICustomControls,
+                                 DataProviderLocations::ClientUI,
                                  "CustomControls.json", "customControls",
                                  this->_uiCustomControlsLocations))
         {
@@ -50,7 +59,8 @@ namespace projectfarm::shared
             return false;
         }
 
-        if (!this->LoadLocations(DataProviderLocations::ClientGraphicsMaterials,
+        if (!this->LoadLocations(AssetTables::GraphicsMaterials,
+                                 DataProviderLocations::ClientGraphicsMaterials,
                                  "Materials.json", "materials",
                                  this->_graphicsMaterialsLocations))
         {
@@ -58,7 +68,8 @@ namespace projectfarm::shared
             return false;
         }
 
-        if (!this->LoadLocations(DataProviderLocations::ClientGraphicsShaders,
+        if (!this->LoadLocations(AssetTables::GraphicsShaders,
+                                 DataProviderLocations::ClientGraphicsShaders,
                                  "Shaders.json", "shaders",
                                  this->_graphicsShadersLocations))
         {
@@ -66,7 +77,8 @@ namespace projectfarm::shared
             return false;
         }
 
-        if (!this->LoadLocations(DataProviderLocations::ClientUICSSDefault,
+        if (!this->LoadLocations(AssetTables::DefaultCSS,
+                                 DataProviderLocations::ClientUICSSDefault,
                                  "DefaultCSS.json", "defaultCSS",
                                  this->_defaultCSSLocations))
         {
@@ -74,12 +86,21 @@ namespace projectfarm::shared
             return false;
         }
 
+        this->SaveLocationManifest();
+
         return true;
     }
 
     bool DataProvider::SetupServer()
     {
-        if (!this->LoadLocations(DataProviderLocations::SharedWorlds,
+        if (!this->MountDefaultArchive())
+        {
+            api::logging::Log("Failed to mount asset archive");
+            return false;
+        }
+
+        if (!this->LoadLocations(AssetTables::Worlds,
+                                 DataProviderLocations::SharedWorlds,
                                  "worlds.json", "worlds",
                                  this->_worldLocations))
         {
@@ -87,7 +108,8 @@ namespace projectfarm::shared
             return false;
         }
 
-        if (!this->LoadLocations(DataProviderLocations::ServerCharacters,
+        if (!this->LoadLocations(AssetTables::Characters,
+                                 DataProviderLocations::ServerCharacters,
                                  "characters.json", "characters",
                                  this->_characterLocations))
         {
@@ -95,7 +117,8 @@ namespace projectfarm::shared
             return false;
         }
 
-        if (!this->LoadLocations(DataProviderLocations::SharedCharacters,
+        if (!this->LoadLocations(AssetTables::CharacterActionAnimations,
+                                 DataProviderLocations::SharedCharacters,
                                  "action_animations.json", "animations",
                                  this->_characterActionAnimationLocations))
         {
@@ -103,6 +126,8 @@ namespace projectfarm::shared
             return false;
         }
 
+        this->SaveLocationManifest();
+
         return true;
     }
 
@@ -111,9 +136,174 @@ namespace projectfarm::shared
         this->_tileSetLocations.clear();
         this->_worldLocations.clear();
         this->_characterActionAnimationLocations.clear();
+
+        this->_assetPaths.clear();
+        for (auto& ids : this->_assetIds)
+        {
+            ids.clear();
+        }
+
+        this->_locationManifest.Clear();
+        this->_numberOfTablesLoadedFromManifest = 0u;
+
+        this->UnmountArchive();
+    }
+
+    bool DataProvider::MountArchive(const std::filesystem::path& archiveFilePath) noexcept
+    {
+        auto archive = std::make_unique<AssetArchive>();
+        if (!archive->Open(archiveFilePath))
+        {
+            api::logging::Log("Failed to open asset archive: " + archiveFilePath.u8string());
+            return false;
+        }
+
+        api::logging::Log("Mounted asset archive: " + archiveFilePath.u8string() + " with " +
+                          std::to_string(archive->GetNumberOfEntries()) + " entries");
+
+        this->_archive = std::move(archive);
+
+        return true;
+    }
+
+    void DataProvider::UnmountArchive() noexcept
+    {
+        this->_archive.reset();
+    }
+
+    bool DataProvider::MountDefaultArchive() noexcept
+    {
+        if (this->_archive || !this->_mountArchiveOnSetup)
+        {
+            return true;
+        }
+
+        auto archiveFilePath = this->GetArchiveFilePath();
+
+        std::error_code ec;
+        if (!std::filesystem::exists(archiveFilePath, ec))
+        {
+            return true;
+        }
+
+        return this->MountArchive(archiveFilePath);
     }
 
-    bool DataProvider::LoadLocations(DataProviderLocations location,
+    std::string DataProvider::GetArchiveEntryName(const std::filesystem::path& filePath) const
+    {
+        auto relativePath = filePath.lexically_normal().lexically_relative(this->_dataFolderPath.lexically_normal());
+
+        if (relativePath.empty() || *relativePath.begin() == "..")
+        {
+            return "";
+        }
+
+        return relativePath.generic_u8string();
+    }
+
+    bool DataProvider::FileExists(const std::filesystem::path& filePath) const noexcept
+    {
+        if (this->_archive)
+        {
+            if (auto name = this->GetArchiveEntryName(filePath); !name.empty() && this->_archive->Contains(name))
+            {
+                return true;
+            }
+        }
+
+        std::error_code ec;
+        return std::filesystem::exists(filePath, ec);
+    }
+
+    std::optional<AssetFile> DataProvider::OpenFile(const std::filesystem::path& filePath) const noexcept
+    {
+        if (this->_archive)
+        {
+            if (auto name = this->GetArchiveEntryName(filePath); !name.empty())
+            {
+                if (auto data = this->_archive->Read(name); data)
+                {
+                    return AssetFile(*data);
+                }
+            }
+        }
+
+        utils::MappedFile file;
+        if (!file.Open(filePath))
+        {
+            return {};
+        }
+
+        return AssetFile(std::move(file));
+    }
+
+    std::optional<AssetFile> DataProvider::OpenCookedAsset(const std::filesystem::path& filePath) const noexcept
+    {
+        auto cookedFilePath = GetCookedAssetPath(filePath);
+
+        // cooked assets are only archived when they are current
+        if (this->_archive)
+        {
+            if (auto name = this->GetArchiveEntryName(cookedFilePath); !name.empty())
+            {
+                if (auto data = this->_archive->Read(name); data)
+                {
+                    return AssetFile(*data);
+                }
+            }
+        }
+
+        if (!IsCookedAssetCurrent(filePath))
+        {
+            return {};
+        }
+
+        utils::MappedFile file;
+        if (!file.Open(cookedFilePath))
+        {
+            return {};
+        }
+
+        return AssetFile(std::move(file));
+    }
+
+    std::optional<nlohmann::json> DataProvider::LoadJsonAsset(const std::filesystem::path& filePath) const noexcept
+    {
+        if (auto cookedFile = this->OpenCookedAsset(filePath); cookedFile)
+        {
+            if (auto json = ParseCookedJsonAsset(cookedFile->GetData()); json)
+            {
+                return json;
+            }
+        }
+
+        auto file = this->OpenFile(filePath);
+        if (!file)
+        {
+            api::logging::Log("Failed to open json file: " + filePath.u8string());
+            return {};
+        }
+
+        auto json = ParseJsonAsset(file->GetData());
+        if (!json)
+        {
+            api::logging::Log("Failed to parse json file: " + filePath.u8string());
+            return {};
+        }
+
+        return json;
+    }
+
+    bool DataProvider::LoadTileSetLocations()
+    {
+        return this->LoadLocations(AssetTables::TileSets,
+                                   DataProviderLocations::ClientTileSets,
+                                   "tilesets.json", "tileSets",
+                                   this->_tileSetLocations);
+    }
+
+    bool DataProvider::LoadLocations(AssetTables table,
+                                     DataProviderLocations location,
                                      const std::filesystem::path& fileName, const std::string& key,
                                      std::unordered_map<std::string, std::filesystem::path>& map)
     {
@@ -121,17 +311,77 @@ namespace projectfarm::shared
 
         auto filePath = this->ResolveFileName(location, fileName);
 
-        std::ifstream file(filePath);
-        if (!file.is_open())
+        if (!this->_useLocationManifest)
+        {
+            if (!this->LoadLocationsFromIndexFile(filePath, key, map))
+            {
+                return false;
+            }
+
+            this->InternAssets(table, map);
+            return true;
+        }
+
+        if (!this->_locationManifest.IsLoaded())
+        {
+            this->_locationManifest.Load(this->GetLocationManifestFilePath(), this->_dataFolderPath);
+        }
+
+        // any of these changing means the index file may have changed
+        std::vector<std::filesystem::path> dependencies { filePath, GetCookedAssetPath(filePath) };
+        if (this->_archive)
+        {
+            dependencies.push_back(this->GetArchiveFilePath());
+        }
+
+        if (const auto* manifestTable = this->_locationManifest.FindTable(key, dependencies); manifestTable)
+        {
+            for (const auto& entry : manifestTable->Entries)
+            {
+                map[entry.Name] = entry.FilePath;
+            }
+
+            ++this->_numberOfTablesLoadedFromManifest;
+
+            this->InternAssets(table, map);
+            return true;
+        }
+
+        if (!this->LoadLocationsFromIndexFile(filePath, key, map))
         {
-            api::logging::Log("Failed to load " + filePath.u8string());
             return false;
         }
 
-        nlohmann::json jsonFile;
-        file >> jsonFile;
+        LocationManifestTable manifestTable;
+        manifestTable.Key = key;
 
-        auto items = jsonFile[key];
+        for (const auto& dependency : dependencies)
+        {
+            manifestTable.Dependencies.push_back({ dependency, FileStamp::Get(dependency) });
+        }
+
+        for (const auto& [name, path] : map)
+        {
+            manifestTable.Entries.push_back({ name, path });
+        }
+
+        this->_locationManifest.SetTable(std::move(manifestTable));
+
+        this->InternAssets(table, map);
+        return true;
+    }
+
+    bool DataProvider::LoadLocationsFromIndexFile(const std::filesystem::path& filePath, const std::string& key,
+                                                  std::unordered_map<std::string, std::filesystem::path>& map)
+    {
+        auto jsonFile = this->LoadJsonAsset(filePath);
+        if (!jsonFile)
+        {
+            api::logging::Log("Failed to load " + filePath.u8string());
+            return false;
+        }
+
+        auto items = (*jsonFile)[key];
 
         for (const auto& item : items)
         {
@@ -144,6 +394,71 @@ namespace projectfarm::shared
         return true;
     }
 
+    void DataProvider::InternAssets(AssetTables table,
+                                    const std::unordered_map<std::string, std::filesystem::path>& map)
+    {
+        auto& ids = this->_assetIds[static_cast<size_t>(table)];
+
+        std::unordered_map<std::string, AssetId> newIds;
+        newIds.reserve(map.size());
+
+        // an asset keeps its id when its table is reloaded
+        for (const auto& [name, path] : map)
+        {
+            if (auto id = ids.find(name); id != ids.end())
+            {
+                this->_assetPaths[id->second] = path;
+                newIds[name] = id->second;
+            }
+            else
+            {
+                newIds[name] = static_cast<AssetId>(this->_assetPaths.size());
+                this->_assetPaths.push_back(path);
+            }
+        }
+
+        ids = std::move(newIds);
+    }
+
+    AssetId DataProvider::GetAssetId(AssetTables table, const std::string& name) const noexcept
+    {
+        const auto& ids = this->_assetIds[static_cast<size_t>(table)];
+
+        auto id = ids.find(name);
+        if (id == ids.end())
+        {
+            return InvalidAssetId;
+        }
+
+        return id->second;
+    }
+
+    const std::filesystem::path& DataProvider::GetAssetPath(AssetId id) const noexcept
+    {
+        static const std::filesystem::path emptyPath;
+
+        if (id >= this->_assetPaths.size())
+        {
+            return emptyPath;
+        }
+
+        return this->_assetPaths[id];
+    }
+
+    void DataProvider::SaveLocationManifest() noexcept
+    {
+        if (!this->_useLocationManifest || !this->_locationManifest.IsDirty())
+        {
+            return;
+        }
+
+        // the data folder may be read only, in which case the index files are read each time
+        if (!this->_locationManifest.Save(this->GetLocationManifestFilePath()))
+        {
+            api::logging::Log("Failed to save the location manifest: " + this->GetLocationManifestFilePath().u8string());
+        }
+    }
+
     std::filesystem::path DataProvider::ResolveFileName(DataProviderLocations location, const std::filesystem::path& fileName)
     {
         std::filesystem::path resolvedPath = fileName;
@@ -1,11 +1,20 @@
 #ifndef PROJECTFARM_DATA_PROVIDER_H
 #define PROJECTFARM_DATA_PROVIDER_H
 
+#include <array>
 #include <string>
+#include <vector>
+#include <memory>
+#include <optional>
 #include <filesystem>
 #include <unordered_map>
 
+#include <nlohmann/json.hpp>
+
 #include "data_provider_locations.h"
+#include "asset_tables.h"
+#include "asset_archive.h"
+#include "location_manifest.h"
 
 namespace projectfarm::shared
 {
@@ -50,22 +59,41 @@ namespace projectfarm::shared
 
         void Shutdown();
 
+        // loaded by `SetupClient`, but tools that set up as the server may need them too
+        [[nodiscard]]
+        bool LoadTileSetLocations();
+
+        // the id of an asset in one of the location tables, or `InvalidAssetId`. Code that
+        // looks the same asset up often can keep the id and use `GetAssetPath`
+        [[nodiscard]]
+        AssetId GetAssetId(AssetTables table, const std::string& name) const noexcept;
+
+        // an empty path for `InvalidAssetId`
+        [[nodiscard]]
+        const std::filesystem::path& GetAssetPath(AssetId id) const noexcept;
+
+        [[nodiscard]]
+        const std::filesystem::path& GetTileSetPathFromName(const std::string& name) const noexcept
+        {
+            return this->GetAssetPath(this->GetAssetId(AssetTables::TileSets, name));
+        }
+
         [[nodiscard]]
-        const std::filesystem::path& GetTileSetPathFromName(const std::string& name)
+        const std::unordered_map<std::string, std::filesystem::path>& GetTileSetLocations() const noexcept
         {
-            return this->_tileSetLocations[name];
+            return this->_tileSetLocations;
         }
 
         [[nodiscard]]
-        const std::filesystem::path& GetCharacterPathFromName(const std::string& name) noexcept
+        const std::filesystem::path& GetCharacterPathFromName(const std::string& name) const noexcept
         {
-          return this->_characterLocations[name];
+            return this->GetAssetPath(this->GetAssetId(AssetTables::Characters, name));
         }
 
         [[nodiscard]]
-        const std::filesystem::path& GetCharacterActionAnimationLocationsFromName(const std::string& name) noexcept
+        const std::filesystem::path& GetCharacterActionAnimationLocationsFromName(const std::string& name) const noexcept
         {
-            return this->_characterActionAnimationLocations[name];
+            return this->GetAssetPath(this->GetAssetId(AssetTables::CharacterActionAnimations, name));
         }
 
         [[nodiscard]]
@@ -75,15 +103,15 @@ namespace projectfarm::shared
         }
 
         [[nodiscard]]
-        const std::filesystem::path& GetUILocationFromName(const std::string& name) noexcept
+        const std::filesystem::path& GetUILocationFromName(const std::string& name) const noexcept
         {
-            return this->_uiLocations[name];
+            return this->GetAssetPath(this->GetAssetId(AssetTables::UIs, name));
         }
 
         [[nodiscard]]
-        const std::filesystem::path& GetUICustomControlLocationFromName(const std::string& name) noexcept
+        const std::filesystem::path& GetUICustomControlLocationFromName(const std::string& name) const noexcept
         {
-            return this->_uiCustomControlsLocations[name];
+            return this->GetAssetPath(this->GetAssetId(AssetTables::UICustomControls, name));
         }
 
         [[nodiscard]]
@@ -93,9 +121,9 @@ namespace projectfarm::shared
         }
 
         [[nodiscard]]
-        const std::filesystem::path& GetGraphicsMaterialLocationFromName(const std::string& name) noexcept
+        const std::filesystem::path& GetGraphicsMaterialLocationFromName(const std::string& name) const noexcept
         {
-            return this->_graphicsMaterialsLocations[name];
+            return this->GetAssetPath(this->GetAssetId(AssetTables::GraphicsMaterials, name));
         }
 
         [[nodiscard]]
@@ -105,9 +133,9 @@ namespace projectfarm::shared
         }
 
         [[nodiscard]]
-        const std::filesystem::path& GetGraphicsShaderLocationByName(const std::string& name) noexcept
+        const std::filesystem::path& GetGraphicsShaderLocationByName(const std::string& name) const noexcept
         {
-            return this->_graphicsShadersLocations[name];
+            return this->GetAssetPath(this->GetAssetId(AssetTables::GraphicsShaders, name));
         }
 
         [[nodiscard]]
@@ -121,7 +149,8 @@ namespace projectfarm::shared
             auto base = basePath;
 
             // this is a hack because CLion will not copy `data` into `bin`
-            if (!std::filesystem::exists(basePath / this->_dataFolderName / "shared" / "worlds" / "worlds.json"))
+            if (!std::filesystem::exists(basePath / this->_dataFolderName / "shared" / "worlds" / "worlds.json") &&
+                !std::filesystem::exists(basePath / (this->_dataFolderName.u8string() + AssetArchive::Extension)))
             {
                 base /= "..";
             }
@@ -129,6 +158,83 @@ namespace projectfarm::shared
             this->_dataFolderPath = base / this->_dataFolderName;
         }
 
+        [[nodiscard]]
+        const std::filesystem::path& GetDataFolderPath() const noexcept
+        {
+            return this->_dataFolderPath;
+        }
+
+        // the archive sits next to the data folder, as `data.pfa`
+        [[nodiscard]]
+        std::filesystem::path GetArchiveFilePath() const
+        {
+            auto archiveFilePath = this->_dataFolderPath;
+            archiveFilePath += AssetArchive::Extension;
+
+            return archiveFilePath;
+        }
+
+        // Files in the archive are read from it in place of the data folder. The archive at
+        // `GetArchiveFilePath` is mounted by `SetupClient` and `SetupServer` if it exists.
+        [[nodiscard]]
+        bool MountArchive(const std::filesystem::path& archiveFilePath) noexcept;
+
+        void UnmountArchive() noexcept;
+
+        // the manifest sits next to the data folder, as `data.manifest`
+        [[nodiscard]]
+        std::filesystem::path GetLocationManifestFilePath() const
+        {
+            auto manifestFilePath = this->_dataFolderPath;
+            manifestFilePath += LocationManifest::Extension;
+
+            return manifestFilePath;
+        }
+
+        void SetUseLocationManifest(bool useLocationManifest) noexcept
+        {
+            this->_useLocationManifest = useLocationManifest;
+        }
+
+        // the number of location tables taken from the manifest, rather than
+        // their index files, since the data provider was set up
+        [[nodiscard]]
+        uint32_t GetNumberOfTablesLoadedFromManifest() const noexcept
+        {
+            return this->_numberOfTablesLoadedFromManifest;
+        }
+
+        // tools that work on the data folder itself turn this off
+        void SetMountArchiveOnSetup(bool mountArchiveOnSetup) noexcept
+        {
+            this->_mountArchiveOnSetup = mountArchiveOnSetup;
+        }
+
+        [[nodiscard]]
+        bool IsArchiveMounted() const noexcept
+        {
+            return this->_archive != nullptr;
+        }
+
+        // the name of `filePath` in the archive, or empty if it is not in the data folder
+        [[nodiscard]]
+        std::string GetArchiveEntryName(const std::filesystem::path& filePath) const;
+
+        // `filePath` is a path from `ResolveFileName`, `NormalizePath` or one of the location maps
+        [[nodiscard]]
+        bool FileExists(const std::filesystem::path& filePath) const noexcept;
+
+        [[nodiscard]]
+        std::optional<AssetFile> OpenFile(const std::filesystem::path& filePath) const noexcept;
+
+        // the cooked asset for `filePath`, if it is archived or is current
+        [[nodiscard]]
+        std::optional<AssetFile> OpenCookedAsset(const std::filesystem::path& filePath) const noexcept;
+
+        // loads a json asset, preferring its cooked asset
+        [[nodiscard]]
+        std::optional<nlohmann::json> LoadJsonAsset(const std::filesystem::path& filePath) const noexcept;
+
         [[nodiscard]]
         std::filesystem::path GetDevDirectoryPath() const
         {
@@ -192,14 +298,36 @@ namespace projectfarm::shared
 
         std::filesystem::path _dataFolderPath;
 
+        std::unique_ptr<AssetArchive> _archive;
+        bool _mountArchiveOnSetup {true};
+
+        [[nodiscard]]
+        bool MountDefaultArchive() noexcept;
+
         void NormalizePathForLocation(std::string& path, DataProviderLocations location);
 
         [[nodiscard]]
-        bool LoadLocations(DataProviderLocations location,
-                           const std::filesystem::path& key,
-                           const std::string& fileName,
+        bool LoadLocations(AssetTables table,
+                           DataProviderLocations location,
+                           const std::filesystem::path& fileName,
+                           const std::string& key,
                            std::unordered_map<std::string, std::filesystem::path>& map);
 
+        [[nodiscard]]
+        bool LoadLocationsFromIndexFile(const std::filesystem::path& filePath, const std::string& key,
+                                        std::unordered_map<std::string, std::filesystem::path>& map);
+
+        void InternAssets(AssetTables table, const std::unordered_map<std::string, std::filesystem::path>& map);
+
+        void SaveLocationManifest() noexcept;
+
+        LocationManifest _locationManifest;
+        bool _useLocationManifest {true};
+        uint32_t _numberOfTablesLoadedFromManifest {0u};
+
+        std::vector<std::filesystem::path> _assetPaths;
+        std::array<std::unordered_map<std::string, AssetId>, static_cast<size_t>(AssetTables::Count)> _assetIds;
+
         std::unordered_map<std::string, std::filesystem::path> _tileSetLocations;
         std::unordered_map<std::string, std::filesystem::path> _worldLocations;
         std::unordered_map<std::string, std::filesystem::path> _characterLocations;
@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <system_error>
+#include <nlohmann/json.hpp>
+
+#include "location_manifest.h"
+#include "cooked_asset.h"
+#include "api/logging/logging.h"
+
+namespace projectfarm::shared
+{
+    FileStamp FileStamp::Get(const std::filesystem::path& filePath) noexcept
+    {
+        FileStamp stamp;
+
+        std::error_code ec;
+
+        auto writeTime = std::filesystem::last_write_time(filePath, ec);
+        if (ec)
+        {
+            return stamp;
+        }
+
+        auto size = std::filesystem::file_size(filePath, ec);
+        if (ec)
+        {
+            return stamp;
+        }
+
+        stamp.Exists = true;
+        stamp.WriteTime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+        stamp.Size = static_cast<uint64_t>(size);
+
+        return stamp;
+    }
+
+    void LocationManifest::Load(const std::filesystem::path& filePath,
+                                const std::filesystem::path& dataFolderPath) noexcept
+    {
+        this->Clear();
+
+        this->_dataFolderPath = dataFolderPath.lexically_normal();
+        this->_isLoaded = true;
+
+        if (!FileStamp::Get(filePath).Exists)
+        {
+            return;
+        }
+
+        auto json = ReadCookedJsonAsset(filePath);
+        if (!json)
+        {
+            api::logging::Log("Failed to read the location manifest: " + filePath.u8string());
+            return;
+        }
+
+        // nlohmann::json can throw exceptions
+        try
+        {
+            if ((*json)["version"].get<uint32_t>() != LocationManifest::Version ||
+                (*json)["dataFolder"].get<std::string>() != this->_dataFolderPath.u8string())
+            {
+                return;
+            }
+
+            for (const auto& tableJson : (*json)["tables"])
+            {
+                LocationManifestTable table;
+                table.Key = tableJson["key"].get<std::string>();
+
+                for (const auto& dependencyJson : tableJson["dependencies"])
+                {
+                    LocationManifestDependency dependency;
+                    dependency.FilePath = std::filesystem::u8path(dependencyJson["filePath"].get<std::string>());
+                    dependency.Stamp.Exists = dependencyJson["exists"].get<bool>();
+                    dependency.Stamp.WriteTime = dependencyJson["writeTime"].get<int64_t>();
+                    dependency.Stamp.Size = dependencyJson["size"].get<uint64_t>();
+
+                    table.Dependencies.push_back(std::move(dependency));
+                }
+
+                for (const auto& entryJson : tableJson["entries"])
+                {
+                    LocationManifestEntry entry;
+                    entry.Name = entryJson[0].get<std::string>();
+                    entry.FilePath = std::filesystem::u8path(entryJson[1].get<std::string>());
+
+                    table.Entries.push_back(std::move(entry));
+                }
+
+                this->_tables.push_back(std::move(table));
+            }
+        }
+        catch (const std::exception& ex)
+        {
+            api::logging::Log("Failed to parse the location manifest: " + filePath.u8string() +
+                              " with error: " + ex.what());
+            this->_tables.clear();
+        }
+    }
+
+    bool LocationManifest::Save(const std::filesystem::path& filePath) noexcept
+    {
+        nlohmann::json json;
+
+        // nlohmann::json can throw exceptions
+        try
+        {
+            json["version"] = LocationManifest::Version;
+            json["dataFolder"] = this->_dataFolderPath.u8string();
+            json["tables"] = nlohmann::json::array();
+
+            for (const auto& table : this->_tables)
+            {
+                nlohmann::json tableJson;
+                tableJson["key"] = table.Key;
+                tableJson["dependencies"] = nlohmann::json::array();
+                tableJson["entries"] = nlohmann::json::array();
+
+                for (const auto& dependency : table.Dependencies)
+                {
+                    tableJson["dependencies"].push_back(
+                    {
+                        { "filePath", dependency.FilePath.u8string() },
+                        { "exists", dependency.Stamp.Exists },
+                        { "writeTime", dependency.Stamp.WriteTime },
+                        { "size", dependency.Stamp.Size },
+                    });
+                }
+
+                for (const auto& entry : table.Entries)
+                {
+                    tableJson["entries"].push_back({ entry.Name, entry.FilePath.u8string() });
+                }
+
+                json["tables"].push_back(std::move(tableJson));
+            }
+        }
+        catch (const std::exception& ex)
+        {
+            api::logging::Log("Failed to create the location manifest with error: " + std::string(ex.what()));
+            return false;
+        }
+
+        // another process may be reading the manifest, so replace it in one step
+        auto tempFilePath = filePath;
+        tempFilePath += ".tmp";
+
+        if (!WriteCookedJsonAsset(json, tempFilePath))
+        {
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tempFilePath, filePath, ec);
+        if (ec)
+        {
+            api::logging::Log("Failed to write the location manifest: " + filePath.u8string() +
+                              " with error: " + ec.message());
+            std::filesystem::remove(tempFilePath, ec);
+            return false;
+        }
+
+        this->_isDirty = false;
+
+        return true;
+    }
+
+    void LocationManifest::Clear() noexcept
+    {
+        this->_tables.clear();
+        this->_isLoaded = false;
+        this->_isDirty = false;
+    }
+
+    const LocationManifestTable* LocationManifest::FindTable(const std::string& key,
+        const std::vector<std::filesystem::path>& dependencies) const noexcept
+    {
+        auto table = std::find_if(this->_tables.begin(), this->_tables.end(), [&key](const auto& t)
+        {
+            return t.Key == key;
+        });
+
+        if (table == this->_tables.end() || table->Dependencies.size() != dependencies.size())
+        {
+            return nullptr;
+        }
+
+        for (auto i = 0u; i < dependencies.size(); ++i)
+        {
+            const auto& dependency = table->Dependencies[i];
+
+            if (dependency.FilePath != dependencies[i] || dependency.Stamp != FileStamp::Get(dependencies[i]))
+            {
+                return nullptr;
+            }
+        }
+
+        return &*table;
+    }
+
+    void LocationManifest::SetTable(LocationManifestTable table) noexcept
+    {
+        auto existing = std::find_if(this->_tables.begin(), this->_tables.end(), [&table](const auto& t)
+        {
+            return t.Key == table.Key;
+        });
+
+        if (existing == this->_tables.end())
+        {
+            this->_tables.push_back(std::move(table));
+        }
+        else
+        {
+            *existing = std::move(table);
+        }
+
+        this->_isDirty = true;
+    }
+}
@@ -0,0 +1,111 @@
+#ifndef PROJECTFARM_LOCATION_MANIFEST_H
+#define PROJECTFARM_LOCATION_MANIFEST_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+// A cache of the location tables that the data provider builds from the json index
+// files, stored as a cooked json blob next to the data folder as `data.manifest`.
+// Each table records the size and write time of the files it was built from (the
+// index file, its cooked asset and the mounted archive), and is only used while
+// they are unchanged. The whole manifest is dropped if the data folder moves, as
+// the tables hold resolved paths.
+
+namespace projectfarm::shared
+{
+    struct FileStamp
+    {
+        bool Exists {false};
+        int64_t WriteTime {0};
+        uint64_t Size {0u};
+
+        [[nodiscard]]
+        static FileStamp Get(const std::filesystem::path& filePath) noexcept;
+
+        [[nodiscard]]
+        bool operator==(const FileStamp& other) const noexcept
+        {
+            return this->Exists == other.Exists && this->WriteTime == other.WriteTime && this->Size == other.Size;
+        }
+
+        [[nodiscard]]
+        bool operator!=(const FileStamp& other) const noexcept
+        {
+            return !(*this == other);
+        }
+    };
+
+    struct LocationManifestDependency
+    {
+        std::filesystem::path FilePath;
+        FileStamp Stamp;
+    };
+
+    struct LocationManifestEntry
+    {
+        std::string Name;
+        std::filesystem::path FilePath;
+    };
+
+    struct LocationManifestTable
+    {
+        std::string Key;
+        std::vector<LocationManifestDependency> Dependencies;
+        std::vector<LocationManifestEntry> Entries;
+    };
+
+    class LocationManifest final
+    {
+    public:
+        static constexpr uint32_t Version {1u};
+        static constexpr auto Extension = ".manifest";
+
+        LocationManifest() = default;
+        ~LocationManifest() = default;
+
+        // an out of date or unreadable manifest is not an error, it is just empty
+        void Load(const std::filesystem::path& filePath, const std::filesystem::path& dataFolderPath) noexcept;
+
+        [[nodiscard]]
+        bool Save(const std::filesystem::path& filePath) noexcept;
+
+        void Clear() noexcept;
+
+        // the table, if it was built from exactly these files and none of them have changed
+        [[nodiscard]]
+        const LocationManifestTable* FindTable(const std::string& key,
+                                               const std::vector<std::filesystem::path>& dependencies) const noexcept;
+
+        void SetTable(LocationManifestTable table) noexcept;
+
+        [[nodiscard]]
+        bool IsLoaded() const noexcept
+        {
+            return this->_isLoaded;
+        }
+
+        [[nodiscard]]
+        bool IsDirty() const noexcept
+        {
+            return this->_isDirty;
+        }
+
+        [[nodiscard]]
+        const std::vector<LocationManifestTable>& GetTables() const noexcept
+        {
+            return this->_tables;
+        }
+
+    private:
+        std::filesystem::path _dataFolderPath;
+
+        std::vector<LocationManifestTable> _tables;
+
+        bool _isLoaded {false};
+        bool _isDirty {false};
+    };
+}
+
+#endif
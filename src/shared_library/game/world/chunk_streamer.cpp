@@ -0,0 +1,322 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+#include "chunk_streamer.h"
+#include "api/logging/logging.h"
+
+namespace projectfarm::shared::game::world
+{
+    ChunkStreamer::ChunkStreamer(std::shared_ptr<concurrency::ThreadPool> threadPool,
+                                 uint32_t widthInTiles, uint32_t heightInTiles,
+                                 uint32_t chunkSizeInTiles) noexcept
+        : _threadPool {std::move(threadPool)},
+          _widthInTiles {widthInTiles},
+          _heightInTiles {heightInTiles},
+          _chunkSizeInTiles {std::max(chunkSizeInTiles, 1u)}
+    {
+        this->_numberOfChunksX = (this->_widthInTiles + this->_chunkSizeInTiles - 1u) / this->_chunkSizeInTiles;
+        this->_numberOfChunksY = (this->_heightInTiles + this->_chunkSizeInTiles - 1u) / this->_chunkSizeInTiles;
+
+        this->_chunks.resize(static_cast<size_t>(this->_numberOfChunksX) * this->_numberOfChunksY);
+    }
+
+    ChunkStreamer::~ChunkStreamer()
+    {
+        this->Shutdown();
+    }
+
+    void ChunkStreamer::Update(int32_t centerTileX, int32_t centerTileY) noexcept
+    {
+        auto startTime = std::chrono::steady_clock::now();
+
+        auto size = static_cast<int64_t>(this->_chunkSizeInTiles);
+
+        // round towards negative infinity, so tiles just outside of the area are not in chunk 0
+        auto centerChunkX = centerTileX < 0 ? (centerTileX - size + 1) / size : centerTileX / size;
+        auto centerChunkY = centerTileY < 0 ? (centerTileY - size + 1) / size : centerTileY / size;
+
+        this->CollectPrepared(false);
+
+        auto evictRadius = this->_loadRadius + ChunkStreamer::EvictionMargin;
+
+        std::vector<uint32_t> toPrepare;
+        std::vector<uint32_t> toActivate;
+
+        for (auto i = 0u; i < this->_chunks.size(); ++i)
+        {
+            auto& chunkState = this->_chunks[i];
+            auto distance = this->GetDistance(i, centerChunkX, centerChunkY);
+
+            if (distance > evictRadius)
+            {
+                if (chunkState.State == ChunkStates::Active)
+                {
+                    this->Evict(i);
+                }
+                else if (chunkState.State == ChunkStates::Prepared)
+                {
+                    chunkState.State = ChunkStates::Unloaded;
+                    chunkState.Chunk.reset();
+                }
+
+                continue;
+            }
+
+            if (chunkState.State == ChunkStates::Unloaded && distance <= this->_loadRadius)
+            {
+                toPrepare.push_back(i);
+            }
+            else if (chunkState.State == ChunkStates::Prepared)
+            {
+                toActivate.push_back(i);
+            }
+        }
+
+        auto byDistance = [this, centerChunkX, centerChunkY](uint32_t a, uint32_t b)
+        {
+            return this->GetDistance(a, centerChunkX, centerChunkY) < this->GetDistance(b, centerChunkX, centerChunkY);
+        };
+
+        // the pool takes tasks in order, so the nearest chunks are prepared first
+        std::stable_sort(toPrepare.begin(), toPrepare.end(), byDistance);
+
+        for (auto index : toPrepare)
+        {
+            this->Prepare(index);
+        }
+
+        std::stable_sort(toActivate.begin(), toActivate.end(), byDistance);
+
+        this->_lastNumberOfActivations = 0u;
+
+        for (auto index : toActivate)
+        {
+            if (this->_lastNumberOfActivations > 0u)
+            {
+                auto elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - startTime).count());
+
+                if (this->_lastNumberOfActivations >= this->_maxActivationsPerUpdate ||
+                    elapsed >= this->_maxMicrosecondsPerUpdate)
+                {
+                    break;
+                }
+            }
+
+            this->Activate(index);
+
+            ++this->_lastNumberOfActivations;
+        }
+    }
+
+    void ChunkStreamer::LoadAll() noexcept
+    {
+        for (auto i = 0u; i < this->_chunks.size(); ++i)
+        {
+            if (this->_chunks[i].State == ChunkStates::Unloaded)
+            {
+                this->Prepare(i);
+            }
+        }
+
+        this->CollectPrepared(true);
+
+        this->_lastNumberOfActivations = 0u;
+
+        for (auto i = 0u; i < this->_chunks.size(); ++i)
+        {
+            if (this->_chunks[i].State == ChunkStates::Prepared)
+            {
+                this->Activate(i);
+
+                ++this->_lastNumberOfActivations;
+            }
+        }
+    }
+
+    void ChunkStreamer::Invalidate(uint32_t tileX, uint32_t tileY) noexcept
+    {
+        if (tileX >= this->_widthInTiles || tileY >= this->_heightInTiles)
+        {
+            return;
+        }
+
+        auto index = (tileY / this->_chunkSizeInTiles) * this->_numberOfChunksX + tileX / this->_chunkSizeInTiles;
+        auto& chunkState = this->_chunks[index];
+
+        if (chunkState.State == ChunkStates::Preparing)
+        {
+            chunkState.IsStale = true;
+        }
+        else if (chunkState.State == ChunkStates::Prepared)
+        {
+            this->Prepare(index);
+        }
+    }
+
+    void ChunkStreamer::Shutdown() noexcept
+    {
+        for (auto& chunkState : this->_chunks)
+        {
+            if (chunkState.State == ChunkStates::Preparing)
+            {
+                chunkState.Result.wait();
+            }
+
+            chunkState.State = ChunkStates::Unloaded;
+            chunkState.Chunk.reset();
+        }
+    }
+
+    bool ChunkStreamer::IsTileActive(uint32_t tileX, uint32_t tileY) const noexcept
+    {
+        return this->IsChunkActive(tileX / this->_chunkSizeInTiles, tileY / this->_chunkSizeInTiles);
+    }
+
+    bool ChunkStreamer::IsChunkActive(uint32_t chunkX, uint32_t chunkY) const noexcept
+    {
+        if (chunkX >= this->_numberOfChunksX || chunkY >= this->_numberOfChunksY)
+        {
+            return false;
+        }
+
+        return this->_chunks[chunkY * this->_numberOfChunksX + chunkX].State == ChunkStates::Active;
+    }
+
+    uint32_t ChunkStreamer::GetNumberOfActiveChunks() const noexcept
+    {
+        return static_cast<uint32_t>(std::count_if(this->_chunks.begin(), this->_chunks.end(),
+            [](const auto& chunkState) { return chunkState.State == ChunkStates::Active; }));
+    }
+
+    uint32_t ChunkStreamer::GetNumberOfPendingChunks() const noexcept
+    {
+        return static_cast<uint32_t>(std::count_if(this->_chunks.begin(), this->_chunks.end(),
+            [](const auto& chunkState)
+            {
+                return chunkState.State == ChunkStates::Preparing || chunkState.State == ChunkStates::Prepared;
+            }));
+    }
+
+    void ChunkStreamer::Prepare(uint32_t chunkIndex) noexcept
+    {
+        auto& chunkState = this->_chunks[chunkIndex];
+
+        auto chunk = std::make_shared<WorldChunk>();
+        chunk->ChunkX = chunkIndex % this->_numberOfChunksX;
+        chunk->ChunkY = chunkIndex / this->_numberOfChunksX;
+        chunk->TileX = chunk->ChunkX * this->_chunkSizeInTiles;
+        chunk->TileY = chunk->ChunkY * this->_chunkSizeInTiles;
+        chunk->WidthInTiles = std::min(this->_chunkSizeInTiles, this->_widthInTiles - chunk->TileX);
+        chunk->HeightInTiles = std::min(this->_chunkSizeInTiles, this->_heightInTiles - chunk->TileY);
+
+        chunkState.State = ChunkStates::Preparing;
+        chunkState.IsStale = false;
+        chunkState.Chunk = chunk;
+
+        // `Shutdown` waits for every task, so `this` outlives them
+        chunkState.Result = this->_threadPool->Enqueue([this, chunk]()
+        {
+            return this->_prepareChunk ? this->_prepareChunk(*chunk) : true;
+        });
+    }
+
+    void ChunkStreamer::CollectPrepared(bool wait) noexcept
+    {
+        auto isPreparing = true;
+
+        while (isPreparing)
+        {
+            isPreparing = false;
+
+            for (auto i = 0u; i < this->_chunks.size(); ++i)
+            {
+                auto& chunkState = this->_chunks[i];
+
+                if (chunkState.State != ChunkStates::Preparing)
+                {
+                    continue;
+                }
+
+                if (!wait && chunkState.Result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                {
+                    continue;
+                }
+
+                auto result = false;
+
+                try
+                {
+                    result = chunkState.Result.get();
+                }
+                catch (const std::exception& ex)
+                {
+                    shared::api::logging::Log("Exception preparing world chunk: " + std::string(ex.what()));
+                }
+
+                if (chunkState.IsStale)
+                {
+                    this->Prepare(i);
+                    isPreparing = wait;
+                    continue;
+                }
+
+                if (!result)
+                {
+                    shared::api::logging::Log("Failed to prepare world chunk: " +
+                                              std::to_string(chunkState.Chunk->ChunkX) + ", " +
+                                              std::to_string(chunkState.Chunk->ChunkY));
+
+                    // failed chunks are not prepared again, so the log is not flooded every update
+                    chunkState.State = ChunkStates::Failed;
+                    chunkState.Chunk.reset();
+                    continue;
+                }
+
+                chunkState.State = ChunkStates::Prepared;
+            }
+        }
+    }
+
+    void ChunkStreamer::Activate(uint32_t chunkIndex) noexcept
+    {
+        auto& chunkState = this->_chunks[chunkIndex];
+
+        if (this->_activateChunk)
+        {
+            this->_activateChunk(*chunkState.Chunk);
+        }
+
+        // the tiles now live wherever they were activated to
+        chunkState.Chunk->Layers.clear();
+        chunkState.Chunk->Layers.shrink_to_fit();
+
+        chunkState.State = ChunkStates::Active;
+    }
+
+    void ChunkStreamer::Evict(uint32_t chunkIndex) noexcept
+    {
+        auto& chunkState = this->_chunks[chunkIndex];
+
+        if (this->_evictChunk)
+        {
+            this->_evictChunk(*chunkState.Chunk);
+        }
+
+        chunkState.State = ChunkStates::Unloaded;
+        chunkState.Chunk.reset();
+    }
+
+    uint32_t ChunkStreamer::GetDistance(uint32_t chunkIndex, int64_t centerChunkX, int64_t centerChunkY) const noexcept
+    {
+        auto chunkX = static_cast<int64_t>(chunkIndex % this->_numberOfChunksX);
+        auto chunkY = static_cast<int64_t>(chunkIndex / this->_numberOfChunksX);
+
+        auto distance = std::max(std::abs(chunkX - centerChunkX), std::abs(chunkY - centerChunkY));
+
+        return static_cast<uint32_t>(std::min<int64_t>(distance, std::numeric_limits<uint32_t>::max()));
+    }
+}
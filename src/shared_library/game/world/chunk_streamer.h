@@ -0,0 +1,177 @@
+#ifndef PROJECTFARM_CHUNK_STREAMER_H
+#define PROJECTFARM_CHUNK_STREAMER_H
+
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <future>
+#include <functional>
+
+#include "concurrency/thread_pool.h"
+
+namespace projectfarm::shared::game::world
+{
+    struct WorldChunk
+    {
+        uint32_t ChunkX {0u};
+        uint32_t ChunkY {0u};
+
+        uint32_t TileX {0u};
+        uint32_t TileY {0u};
+        uint32_t WidthInTiles {0u};
+        uint32_t HeightInTiles {0u};
+
+        // one entry per layer, each `WidthInTiles` * `HeightInTiles` tiles in row order
+        std::vector<std::vector<uint16_t>> Layers;
+    };
+
+    // Splits an area of tiles into square chunks. Chunks around a center point are
+    // prepared on a thread pool and then activated on the calling thread, nearest
+    // first and within a per update budget. Chunks that move far from the center
+    // are evicted.
+    class ChunkStreamer final
+    {
+    public:
+        static constexpr uint32_t DefaultChunkSizeInTiles {32u};
+
+        // run on the thread pool, so must only read data that is safe to read from other threads
+        using PrepareChunkFunction = std::function<bool(WorldChunk&)>;
+
+        // run on the thread calling `Update`
+        using ChunkFunction = std::function<void(const WorldChunk&)>;
+
+        ChunkStreamer(std::shared_ptr<concurrency::ThreadPool> threadPool,
+                      uint32_t widthInTiles, uint32_t heightInTiles,
+                      uint32_t chunkSizeInTiles = DefaultChunkSizeInTiles) noexcept;
+        ~ChunkStreamer();
+
+        ChunkStreamer(const ChunkStreamer&) = delete;
+        ChunkStreamer(ChunkStreamer&&) = delete;
+
+        void SetPrepareChunk(PrepareChunkFunction prepareChunk) noexcept
+        {
+            this->_prepareChunk = std::move(prepareChunk);
+        }
+
+        void SetActivateChunk(ChunkFunction activateChunk) noexcept
+        {
+            this->_activateChunk = std::move(activateChunk);
+        }
+
+        void SetEvictChunk(ChunkFunction evictChunk) noexcept
+        {
+            this->_evictChunk = std::move(evictChunk);
+        }
+
+        // chunks are evicted once they are `EvictionMargin` chunks outside of the load radius,
+        // so moving back and forth over a chunk border does not reload chunks
+        void SetLoadRadius(uint32_t radiusInChunks) noexcept
+        {
+            this->_loadRadius = radiusInChunks;
+        }
+
+        // at least one chunk is activated per update, if one is ready
+        void SetUpdateBudget(uint32_t maxActivations, uint64_t maxMicroseconds) noexcept
+        {
+            this->_maxActivationsPerUpdate = maxActivations;
+            this->_maxMicrosecondsPerUpdate = maxMicroseconds;
+        }
+
+        // the center can be outside of the area, such as when the camera is away from an island
+        void Update(int32_t centerTileX, int32_t centerTileY) noexcept;
+
+        // prepares every chunk and waits for them to be activated
+        void LoadAll() noexcept;
+
+        // the tile has changed, so a chunk being prepared from old data is prepared again
+        void Invalidate(uint32_t tileX, uint32_t tileY) noexcept;
+
+        // waits for chunks being prepared, so the data they read can be released
+        void Shutdown() noexcept;
+
+        [[nodiscard]]
+        bool IsTileActive(uint32_t tileX, uint32_t tileY) const noexcept;
+
+        [[nodiscard]]
+        bool IsChunkActive(uint32_t chunkX, uint32_t chunkY) const noexcept;
+
+        [[nodiscard]]
+        uint32_t GetNumberOfChunksX() const noexcept
+        {
+            return this->_numberOfChunksX;
+        }
+
+        [[nodiscard]]
+        uint32_t GetNumberOfChunksY() const noexcept
+        {
+            return this->_numberOfChunksY;
+        }
+
+        [[nodiscard]]
+        uint32_t GetNumberOfActiveChunks() const noexcept;
+
+        [[nodiscard]]
+        uint32_t GetNumberOfPendingChunks() const noexcept;
+
+        [[nodiscard]]
+        uint32_t GetLastNumberOfActivations() const noexcept
+        {
+            return this->_lastNumberOfActivations;
+        }
+
+    private:
+        static constexpr uint32_t EvictionMargin {1u};
+
+        enum class ChunkStates
+        {
+            Unloaded,
+            Preparing,
+            Prepared,
+            Active,
+            Failed,
+        };
+
+        struct ChunkState
+        {
+            ChunkStates State {ChunkStates::Unloaded};
+            std::shared_ptr<WorldChunk> Chunk;
+            std::future<bool> Result;
+            bool IsStale {false};
+        };
+
+        std::shared_ptr<concurrency::ThreadPool> _threadPool;
+
+        uint32_t _widthInTiles {0u};
+        uint32_t _heightInTiles {0u};
+        uint32_t _chunkSizeInTiles {0u};
+
+        uint32_t _numberOfChunksX {0u};
+        uint32_t _numberOfChunksY {0u};
+
+        std::vector<ChunkState> _chunks;
+
+        PrepareChunkFunction _prepareChunk;
+        ChunkFunction _activateChunk;
+        ChunkFunction _evictChunk;
+
+        uint32_t _loadRadius {1u};
+
+        uint32_t _maxActivationsPerUpdate {4u};
+        uint64_t _maxMicrosecondsPerUpdate {2000u};
+
+        uint32_t _lastNumberOfActivations {0u};
+
+        void Prepare(uint32_t chunkIndex) noexcept;
+
+        // moves finished chunks to `Prepared`, or `Failed`
+        void CollectPrepared(bool wait) noexcept;
+
+        void Activate(uint32_t chunkIndex) noexcept;
+        void Evict(uint32_t chunkIndex) noexcept;
+
+        [[nodiscard]]
+        uint32_t GetDistance(uint32_t chunkIndex, int64_t centerChunkX, int64_t centerChunkY) const noexcept;
+    };
+}
+
+#endif
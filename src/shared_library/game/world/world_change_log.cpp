@@ -0,0 +1,309 @@
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "world_change_log.h"
+#include "utils/stream.h"
+#include "api/logging/logging.h"
+
+namespace projectfarm::shared::game::world
+{
+    namespace
+    {
+        template <typename T, typename F>
+        void WriteRuns(const std::vector<WorldChangeLogEntry>& changes, std::vector<std::byte>& bytes, F getValue) noexcept
+        {
+            for (auto i = 0u; i < changes.size();)
+            {
+                T value = getValue(changes[i]);
+
+                auto run {1u};
+                while (i + run < changes.size() && getValue(changes[i + run]) == value)
+                {
+                    ++run;
+                }
+
+                utils::WriteVarUInt64(bytes, value);
+                utils::WriteVarUInt64(bytes, run);
+
+                i += run;
+            }
+        }
+
+        template <typename T, typename F>
+        bool ReadRuns(const std::vector<std::byte>& bytes, uint32_t& index,
+                      std::vector<WorldChangeLogEntry>& changes, F setValue) noexcept
+        {
+            for (auto i = 0u; i < changes.size();)
+            {
+                uint64_t value {0u};
+                uint64_t run {0u};
+
+                if (!utils::ReadVarUInt64(bytes, index, value) || !utils::ReadVarUInt64(bytes, index, run) ||
+                    value > std::numeric_limits<T>::max() || run == 0u || run > changes.size() - i)
+                {
+                    return false;
+                }
+
+                for (auto r = 0u; r < run; ++r)
+                {
+                    setValue(changes[i++], static_cast<T>(value));
+                }
+            }
+
+            return true;
+        }
+
+        template <typename T, typename F>
+        void WriteDeltas(const std::vector<WorldChangeLogEntry>& changes, std::vector<std::byte>& bytes, F getValue) noexcept
+        {
+            T previous {0u};
+
+            for (const auto& change : changes)
+            {
+                T value = getValue(change);
+
+                // wrapping in 64 bits gives a small negative delta when the value goes down
+                utils::WriteVarInt64(bytes, static_cast<int64_t>(static_cast<uint64_t>(value) -
+                                                                 static_cast<uint64_t>(previous)));
+                previous = value;
+            }
+        }
+
+        template <typename T, typename F>
+        bool ReadDeltas(const std::vector<std::byte>& bytes, uint32_t& index,
+                        std::vector<WorldChangeLogEntry>& changes, F setValue) noexcept
+        {
+            T previous {0u};
+
+            for (auto& change : changes)
+            {
+                int64_t delta {0};
+                if (!utils::ReadVarInt64(bytes, index, delta))
+                {
+                    return false;
+                }
+
+                // the deltas wrap in the same way as when they were written
+                previous += static_cast<T>(delta);
+                setValue(change, previous);
+            }
+
+            return true;
+        }
+    }
+
+    bool WorldChangeLog::Add(const WorldChangeLogEntry& entry) noexcept
+    {
+        if (entry.TileX >= WorldChangeLog::MaxTileCoordinate || entry.TileY >= WorldChangeLog::MaxTileCoordinate)
+        {
+            api::logging::Log("Change log tile is out of range: " + std::to_string(entry.TileX) + ", " +
+                              std::to_string(entry.TileY));
+            return false;
+        }
+
+        this->_tail.push_back(entry);
+        ++this->_numberOfChangesAdded;
+
+        if (this->_tail.size() >= this->_compactionThreshold)
+        {
+            this->Compact();
+        }
+
+        return true;
+    }
+
+    void WorldChangeLog::Compact() noexcept
+    {
+        std::vector<std::pair<uint64_t, uint64_t>> changedTiles;
+        changedTiles.reserve(this->_tail.size());
+
+        for (const auto& entry : this->_tail)
+        {
+            auto key = WorldChangeLog::GetKey(entry.LayerIndex, entry.TileX, entry.TileY);
+            auto [iter, isNewTile] = this->_snapshot.try_emplace(key);
+            auto& tile = iter->second;
+
+            if (!isNewTile)
+            {
+                if (entry.Time < tile.Time)
+                {
+                    continue;
+                }
+
+                ++this->_numberOfStaleSnapshotTimes;
+            }
+
+            tile.Time = entry.Time;
+            tile.PlotIndex = entry.PlotIndex;
+
+            changedTiles.emplace_back(entry.Time, key);
+        }
+
+        this->_tail.clear();
+
+        std::sort(changedTiles.begin(), changedTiles.end());
+
+        auto middle = static_cast<std::ptrdiff_t>(this->_snapshotByTime.size());
+        this->_snapshotByTime.insert(this->_snapshotByTime.end(), changedTiles.begin(), changedTiles.end());
+
+        // changes are usually added in time order, so this is rarely needed
+        if (!changedTiles.empty() && middle > 0 &&
+            changedTiles.front() < this->_snapshotByTime[static_cast<size_t>(middle) - 1u])
+        {
+            std::inplace_merge(this->_snapshotByTime.begin(), this->_snapshotByTime.begin() + middle,
+                               this->_snapshotByTime.end());
+        }
+
+        // keep the index bounded by the number of tiles
+        if (this->_numberOfStaleSnapshotTimes > this->_snapshot.size())
+        {
+            this->_snapshotByTime.erase(std::remove_if(this->_snapshotByTime.begin(), this->_snapshotByTime.end(),
+                [this](const auto& timeAndKey)
+                {
+                    return this->_snapshot.find(timeAndKey.second)->second.Time != timeAndKey.first;
+                }), this->_snapshotByTime.end());
+
+            this->_numberOfStaleSnapshotTimes = 0u;
+        }
+    }
+
+    void WorldChangeLog::Clear() noexcept
+    {
+        this->_snapshot.clear();
+        this->_snapshotByTime.clear();
+        this->_numberOfStaleSnapshotTimes = 0u;
+        this->_tail.clear();
+        this->_numberOfChangesAdded = 0u;
+    }
+
+    std::vector<WorldChangeLogEntry> WorldChangeLog::GetChanges(uint64_t sinceTime) const noexcept
+    {
+        std::unordered_map<uint64_t, TileChange> tiles;
+
+        // only the snapshot's tiles changed after `sinceTime` are visited
+        auto first = std::upper_bound(this->_snapshotByTime.begin(), this->_snapshotByTime.end(),
+                                      std::make_pair(sinceTime, std::numeric_limits<uint64_t>::max()));
+
+        for (auto iter = first; iter != this->_snapshotByTime.end(); ++iter)
+        {
+            const auto& tile = this->_snapshot.find(iter->second)->second;
+
+            // stale, as the tile changed again later
+            if (tile.Time != iter->first)
+            {
+                continue;
+            }
+
+            tiles[iter->second] = tile;
+        }
+
+        for (const auto& entry : this->_tail)
+        {
+            if (entry.Time <= sinceTime)
+            {
+                continue;
+            }
+
+            auto& tile = tiles[WorldChangeLog::GetKey(entry.LayerIndex, entry.TileX, entry.TileY)];
+
+            if (entry.Time >= tile.Time)
+            {
+                tile.Time = entry.Time;
+                tile.PlotIndex = entry.PlotIndex;
+            }
+        }
+
+        std::vector<std::pair<uint64_t, TileChange>> sortedTiles(tiles.begin(), tiles.end());
+        std::sort(sortedTiles.begin(), sortedTiles.end(), [](const auto& a, const auto& b)
+        {
+            return a.first < b.first;
+        });
+
+        std::vector<WorldChangeLogEntry> changes;
+        changes.reserve(sortedTiles.size());
+
+        for (const auto& [key, tile] : sortedTiles)
+        {
+            WorldChangeLogEntry entry;
+            entry.LayerIndex = static_cast<uint8_t>(key >> 48u);
+            entry.TileY = static_cast<uint32_t>((key >> 24u) & (WorldChangeLog::MaxTileCoordinate - 1u));
+            entry.TileX = static_cast<uint32_t>(key & (WorldChangeLog::MaxTileCoordinate - 1u));
+            entry.Time = tile.Time;
+            entry.PlotIndex = tile.PlotIndex;
+
+            changes.push_back(entry);
+        }
+
+        return changes;
+    }
+
+    void EncodeWorldChanges(const std::vector<WorldChangeLogEntry>& changes, std::vector<std::byte>& bytes) noexcept
+    {
+        utils::WriteVarUInt64(bytes, changes.size());
+
+        WriteRuns<uint8_t>(changes, bytes, [](const auto& c) { return c.LayerIndex; });
+        WriteDeltas<uint32_t>(changes, bytes, [](const auto& c) { return c.TileY; });
+        WriteDeltas<uint32_t>(changes, bytes, [](const auto& c) { return c.TileX; });
+        WriteDeltas<uint64_t>(changes, bytes, [](const auto& c) { return c.Time; });
+        WriteRuns<uint16_t>(changes, bytes, [](const auto& c) { return c.PlotIndex; });
+    }
+
+    bool DecodeWorldChanges(const std::vector<std::byte>& bytes, uint32_t& index,
+                            std::vector<WorldChangeLogEntry>& changes) noexcept
+    {
+        changes.clear();
+
+        uint64_t numberOfChanges {0u};
+        if (!utils::ReadVarUInt64(bytes, index, numberOfChanges))
+        {
+            return false;
+        }
+
+        // each change takes at least a byte for its row, column and time
+        if (index > bytes.size() || numberOfChanges > (bytes.size() - index) / 3u)
+        {
+            return false;
+        }
+
+        changes.resize(static_cast<size_t>(numberOfChanges));
+
+        auto result = ReadRuns<uint8_t>(bytes, index, changes, [](auto& c, auto v) { c.LayerIndex = v; }) &&
+                      ReadDeltas<uint32_t>(bytes, index, changes, [](auto& c, auto v) { c.TileY = v; }) &&
+                      ReadDeltas<uint32_t>(bytes, index, changes, [](auto& c, auto v) { c.TileX = v; }) &&
+                      ReadDeltas<uint64_t>(bytes, index, changes, [](auto& c, auto v) { c.Time = v; }) &&
+                      ReadRuns<uint16_t>(bytes, index, changes, [](auto& c, auto v) { c.PlotIndex = v; });
+
+        if (!result)
+        {
+            changes.clear();
+        }
+
+        return result;
+    }
+
+    std::vector<std::vector<std::byte>> EncodeWorldChangeChunks(const std::vector<WorldChangeLogEntry>& changes,
+                                                                uint32_t maxChangesPerChunk) noexcept
+    {
+        std::vector<std::vector<std::byte>> chunks;
+
+        maxChangesPerChunk = std::max(maxChangesPerChunk, 1u);
+
+        auto start {0u};
+
+        // there is always a chunk, so the receiver knows there are no changes
+        do
+        {
+            auto end = std::min(start + maxChangesPerChunk, static_cast<uint32_t>(changes.size()));
+
+            std::vector<WorldChangeLogEntry> chunkChanges(changes.begin() + start, changes.begin() + end);
+
+            EncodeWorldChanges(chunkChanges, chunks.emplace_back());
+
+            start = end;
+        }
+        while (start < changes.size());
+
+        return chunks;
+    }
+}
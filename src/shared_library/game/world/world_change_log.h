@@ -0,0 +1,117 @@
+#ifndef PROJECTFARM_WORLD_CHANGE_LOG_H
+#define PROJECTFARM_WORLD_CHANGE_LOG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+#include <utility>
+
+namespace projectfarm::shared::game::world
+{
+    struct WorldChangeLogEntry
+    {
+        uint8_t LayerIndex {0};
+
+        uint32_t TileX {0};
+        uint32_t TileY {0};
+
+        uint64_t Time {0};
+
+        uint16_t PlotIndex {0};
+    };
+
+    // The changes made to the tiles of an island. New changes are added to a tail,
+    // which is compacted into a snapshot of the latest change to each tile once it
+    // is long enough, so the log is bounded by the number of tiles, not the number
+    // of changes.
+    class WorldChangeLog final
+    {
+    public:
+        static constexpr uint32_t DefaultCompactionThreshold {4096u};
+
+        // tile coordinates must be below this
+        static constexpr uint32_t MaxTileCoordinate {1u << 24u};
+
+        explicit WorldChangeLog(uint32_t compactionThreshold = DefaultCompactionThreshold) noexcept
+            : _compactionThreshold {compactionThreshold}
+        {
+        }
+
+        ~WorldChangeLog() = default;
+
+        [[nodiscard]]
+        bool Add(const WorldChangeLogEntry& entry) noexcept;
+
+        void Compact() noexcept;
+
+        void Clear() noexcept;
+
+        // the latest change to each tile changed after `sinceTime`, ordered by layer, row then column
+        [[nodiscard]]
+        std::vector<WorldChangeLogEntry> GetChanges(uint64_t sinceTime = 0u) const noexcept;
+
+        [[nodiscard]]
+        uint32_t GetNumberOfSnapshotEntries() const noexcept
+        {
+            return static_cast<uint32_t>(this->_snapshot.size());
+        }
+
+        [[nodiscard]]
+        uint32_t GetNumberOfTailEntries() const noexcept
+        {
+            return static_cast<uint32_t>(this->_tail.size());
+        }
+
+        [[nodiscard]]
+        uint64_t GetNumberOfChangesAdded() const noexcept
+        {
+            return this->_numberOfChangesAdded;
+        }
+
+    private:
+        struct TileChange
+        {
+            uint64_t Time {0u};
+            uint16_t PlotIndex {0u};
+        };
+
+        uint32_t _compactionThreshold {DefaultCompactionThreshold};
+
+        // keyed by layer, row then column, so sorting by key sorts the tiles
+        std::unordered_map<uint64_t, TileChange> _snapshot;
+
+        // the time and key of each change compacted into the snapshot, sorted, so recent
+        // changes only visit the tiles changed since. An entry is stale once its tile changes again.
+        std::vector<std::pair<uint64_t, uint64_t>> _snapshotByTime;
+        uint64_t _numberOfStaleSnapshotTimes {0u};
+
+        std::vector<WorldChangeLogEntry> _tail;
+
+        uint64_t _numberOfChangesAdded {0u};
+
+        [[nodiscard]]
+        static uint64_t GetKey(uint8_t layerIndex, uint32_t tileX, uint32_t tileY) noexcept
+        {
+            return (static_cast<uint64_t>(layerIndex) << 48u) |
+                   (static_cast<uint64_t>(tileY) << 24u) |
+                   static_cast<uint64_t>(tileX);
+        }
+    };
+
+    // Writes the changes as columns: the count, then run length encoded layers, row and
+    // column deltas from the previous change, time deltas and run length encoded plots.
+    // The changes are smallest when they are ordered as `GetChanges` orders them.
+    void EncodeWorldChanges(const std::vector<WorldChangeLogEntry>& changes, std::vector<std::byte>& bytes) noexcept;
+
+    [[nodiscard]]
+    bool DecodeWorldChanges(const std::vector<std::byte>& bytes, uint32_t& index,
+                            std::vector<WorldChangeLogEntry>& changes) noexcept;
+
+    // each chunk can be decoded by itself
+    [[nodiscard]]
+    std::vector<std::vector<std::byte>> EncodeWorldChangeChunks(const std::vector<WorldChangeLogEntry>& changes,
+                                                                uint32_t maxChangesPerChunk) noexcept;
+}
+
+#endif
@@ -0,0 +1,597 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+
+#include "world_checkpoint.h"
+#include "utils/stream.h"
+#include "api/logging/logging.h"
+#include "profiling/allocation_tracker.h"
+
+namespace projectfarm::shared::game::world
+{
+    namespace
+    {
+        constexpr char BaseMagic[] {'P', 'F', 'C', 'K'};
+        constexpr char JournalMagic[] {'P', 'F', 'C', 'J'};
+
+        // each entity has at least its type length, position, destination and state counts
+        constexpr uint32_t MinEntitySize {4u + 16u + 8u};
+
+        [[nodiscard]]
+        uint64_t GetChecksum(const std::vector<std::byte>& bytes, uint32_t start, uint32_t size) noexcept
+        {
+            // FNV-1a
+            uint64_t hash {14695981039346656037ull};
+
+            for (auto i = start; i < start + size; ++i)
+            {
+                hash ^= static_cast<uint8_t>(bytes[i]);
+                hash *= 1099511628211ull;
+            }
+
+            return hash;
+        }
+
+        [[nodiscard]]
+        bool HasBytes(const std::vector<std::byte>& bytes, uint32_t index, uint64_t count) noexcept
+        {
+            return index <= bytes.size() && count <= bytes.size() - index;
+        }
+
+        void WriteMagic(std::vector<std::byte>& bytes, const char (&magic)[4]) noexcept
+        {
+            for (auto c : magic)
+            {
+                bytes.push_back(static_cast<std::byte>(c));
+            }
+        }
+
+        [[nodiscard]]
+        bool ReadMagic(const std::vector<std::byte>& bytes, uint32_t& index, const char (&magic)[4]) noexcept
+        {
+            if (!HasBytes(bytes, index, sizeof(magic)) ||
+                std::memcmp(bytes.data() + index, magic, sizeof(magic)) != 0)
+            {
+                return false;
+            }
+
+            index += sizeof(magic);
+            return true;
+        }
+
+        void WriteFloat(std::vector<std::byte>& bytes, float value) noexcept
+        {
+            uint32_t bits {0u};
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            utils::WriteUInt32(bytes, bits);
+        }
+
+        [[nodiscard]]
+        bool ReadUInt8(const std::vector<std::byte>& bytes, uint32_t& index, uint8_t& value) noexcept
+        {
+            if (!HasBytes(bytes, index, sizeof(value)))
+            {
+                return false;
+            }
+
+            value = utils::ReadUInt8(bytes, index);
+            return true;
+        }
+
+        [[nodiscard]]
+        bool ReadUInt32(const std::vector<std::byte>& bytes, uint32_t& index, uint32_t& value) noexcept
+        {
+            if (!HasBytes(bytes, index, sizeof(value)))
+            {
+                return false;
+            }
+
+            value = utils::ReadUInt32(bytes, index);
+            return true;
+        }
+
+        [[nodiscard]]
+        bool ReadUInt64(const std::vector<std::byte>& bytes, uint32_t& index, uint64_t& value) noexcept
+        {
+            if (!HasBytes(bytes, index, sizeof(value)))
+            {
+                return false;
+            }
+
+            value = utils::ReadUInt64(bytes, index);
+            return true;
+        }
+
+        [[nodiscard]]
+        bool ReadFloat(const std::vector<std::byte>& bytes, uint32_t& index, float& value) noexcept
+        {
+            uint32_t bits {0u};
+            if (!ReadUInt32(bytes, index, bits))
+            {
+                return false;
+            }
+
+            std::memcpy(&value, &bits, sizeof(value));
+            return true;
+        }
+
+        void WriteString(std::vector<std::byte>& bytes, const std::string& value) noexcept
+        {
+            utils::WriteString(bytes, value, static_cast<uint32_t>(value.size()));
+        }
+
+        [[nodiscard]]
+        bool ReadString(const std::vector<std::byte>& bytes, uint32_t& index, std::string& value) noexcept
+        {
+            uint32_t length {0u};
+            if (!ReadUInt32(bytes, index, length) || !HasBytes(bytes, index, length))
+            {
+                return false;
+            }
+
+            value.assign(reinterpret_cast<const char*>(bytes.data() + index), length);
+            index += length;
+
+            return true;
+        }
+
+        void WriteStates(std::vector<std::byte>& bytes, const std::vector<CheckpointStateItem>& states) noexcept
+        {
+            utils::WriteUInt32(bytes, static_cast<uint32_t>(states.size()));
+
+            for (const auto& state : states)
+            {
+                utils::WriteUInt8(bytes, state.Key);
+                utils::WriteUInt8(bytes, state.Value);
+            }
+        }
+
+        [[nodiscard]]
+        bool ReadStates(const std::vector<std::byte>& bytes, uint32_t& index,
+                        std::vector<CheckpointStateItem>& states) noexcept
+        {
+            uint32_t numberOfStates {0u};
+            if (!ReadUInt32(bytes, index, numberOfStates) || !HasBytes(bytes, index, numberOfStates * 2ull))
+            {
+                return false;
+            }
+
+            states.resize(numberOfStates);
+
+            return std::all_of(states.begin(), states.end(), [&bytes, &index](auto& state)
+            {
+                return ReadUInt8(bytes, index, state.Key) && ReadUInt8(bytes, index, state.Value);
+            });
+        }
+
+        // a checkpoint and its header, where `version` is only written for a base
+        void WriteRecord(std::vector<std::byte>& bytes, const char (&magic)[4], bool writeVersion,
+                         const WorldCheckpoint& checkpoint) noexcept
+        {
+            std::vector<std::byte> payload;
+            EncodeWorldCheckpoint(checkpoint, payload);
+
+            WriteMagic(bytes, magic);
+
+            if (writeVersion)
+            {
+                utils::WriteUInt32(bytes, WorldCheckpointStore::Version);
+            }
+
+            utils::WriteUInt32(bytes, static_cast<uint32_t>(payload.size()));
+            utils::WriteUInt64(bytes, GetChecksum(payload, 0u, static_cast<uint32_t>(payload.size())));
+
+            bytes.insert(bytes.end(), payload.begin(), payload.end());
+        }
+
+        [[nodiscard]]
+        bool ReadRecord(const std::vector<std::byte>& bytes, uint32_t& index, const char (&magic)[4],
+                        bool readVersion, WorldCheckpoint& checkpoint) noexcept
+        {
+            if (!ReadMagic(bytes, index, magic))
+            {
+                return false;
+            }
+
+            if (readVersion)
+            {
+                uint32_t version {0u};
+                if (!ReadUInt32(bytes, index, version) || version != WorldCheckpointStore::Version)
+                {
+                    return false;
+                }
+            }
+
+            uint32_t size {0u};
+            uint64_t checksum {0u};
+
+            if (!ReadUInt32(bytes, index, size) || !ReadUInt64(bytes, index, checksum) ||
+                !HasBytes(bytes, index, size) || GetChecksum(bytes, index, size) != checksum)
+            {
+                return false;
+            }
+
+            auto end = index + size;
+
+            if (!DecodeWorldCheckpoint(bytes, index, checkpoint) || index != end)
+            {
+                return false;
+            }
+
+            return true;
+        }
+
+        [[nodiscard]]
+        std::vector<std::byte> ReadFile(const std::filesystem::path& filePath) noexcept
+        {
+            std::ifstream fs(filePath, std::ios::binary);
+            if (!fs.is_open())
+            {
+                return {};
+            }
+
+            std::vector<char> data((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+
+            std::vector<std::byte> bytes(data.size());
+            std::memcpy(bytes.data(), data.data(), data.size());
+
+            return bytes;
+        }
+
+        [[nodiscard]]
+        bool WriteFile(const std::filesystem::path& filePath, const std::vector<std::byte>& bytes,
+                       std::ios::openmode mode) noexcept
+        {
+            std::ofstream fs(filePath, std::ios::binary | mode);
+            if (!fs.is_open())
+            {
+                return false;
+            }
+
+            fs.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            fs.flush();
+
+            return fs.good();
+        }
+
+        void AddChanges(std::vector<WorldChangeLog>& changeLogs,
+                        const std::vector<std::vector<WorldChangeLogEntry>>& islandChanges) noexcept
+        {
+            if (changeLogs.size() < islandChanges.size())
+            {
+                changeLogs.resize(islandChanges.size());
+            }
+
+            for (auto i = 0u; i < islandChanges.size(); ++i)
+            {
+                for (const auto& change : islandChanges[i])
+                {
+                    // only out of range tiles are not added, and they are logged
+                    static_cast<void>(changeLogs[i].Add(change));
+                }
+            }
+        }
+    }
+
+    void EncodeWorldCheckpoint(const WorldCheckpoint& checkpoint, std::vector<std::byte>& bytes) noexcept
+    {
+        WriteString(bytes, checkpoint.WorldName);
+
+        utils::WriteUInt64(bytes, checkpoint.Sequence);
+        utils::WriteUInt64(bytes, checkpoint.GameTime);
+
+        utils::WriteUInt32(bytes, static_cast<uint32_t>(checkpoint.IslandChanges.size()));
+        for (const auto& changes : checkpoint.IslandChanges)
+        {
+            EncodeWorldChanges(changes, bytes);
+        }
+
+        utils::WriteUInt32(bytes, static_cast<uint32_t>(checkpoint.Entities.size()));
+        for (const auto& entity : checkpoint.Entities)
+        {
+            WriteString(bytes, entity.CharacterType);
+
+            WriteFloat(bytes, entity.PositionX);
+            WriteFloat(bytes, entity.PositionY);
+            WriteFloat(bytes, entity.MoveToDestinationX);
+            WriteFloat(bytes, entity.MoveToDestinationY);
+
+            WriteStates(bytes, entity.States);
+            WriteStates(bytes, entity.BehaviourStates);
+        }
+
+        WriteString(bytes, checkpoint.ScriptState);
+    }
+
+    bool DecodeWorldCheckpoint(const std::vector<std::byte>& bytes, uint32_t& index,
+                               WorldCheckpoint& checkpoint) noexcept
+    {
+        checkpoint = {};
+
+        uint32_t numberOfIslands {0u};
+
+        if (!ReadString(bytes, index, checkpoint.WorldName) ||
+            !ReadUInt64(bytes, index, checkpoint.Sequence) ||
+            !ReadUInt64(bytes, index, checkpoint.GameTime) ||
+            !ReadUInt32(bytes, index, numberOfIslands) ||
+            !HasBytes(bytes, index, numberOfIslands))
+        {
+            return false;
+        }
+
+        checkpoint.IslandChanges.resize(numberOfIslands);
+        for (auto& changes : checkpoint.IslandChanges)
+        {
+            if (!DecodeWorldChanges(bytes, index, changes))
+            {
+                return false;
+            }
+        }
+
+        uint32_t numberOfEntities {0u};
+        if (!ReadUInt32(bytes, index, numberOfEntities) ||
+            !HasBytes(bytes, index, static_cast<uint64_t>(numberOfEntities) * MinEntitySize))
+        {
+            return false;
+        }
+
+        checkpoint.Entities.resize(numberOfEntities);
+        for (auto& entity : checkpoint.Entities)
+        {
+            if (!ReadString(bytes, index, entity.CharacterType) ||
+                !ReadFloat(bytes, index, entity.PositionX) ||
+                !ReadFloat(bytes, index, entity.PositionY) ||
+                !ReadFloat(bytes, index, entity.MoveToDestinationX) ||
+                !ReadFloat(bytes, index, entity.MoveToDestinationY) ||
+                !ReadStates(bytes, index, entity.States) ||
+                !ReadStates(bytes, index, entity.BehaviourStates))
+            {
+                return false;
+            }
+        }
+
+        return ReadString(bytes, index, checkpoint.ScriptState);
+    }
+
+    bool WorldCheckpointStore::WriteBase(const WorldCheckpoint& checkpoint) noexcept
+    {
+        std::vector<std::byte> bytes;
+        WriteRecord(bytes, BaseMagic, true, checkpoint);
+
+        // a crash part way through leaves the previous base in place
+        auto tempFilePath = this->_baseFilePath;
+        tempFilePath += ".tmp";
+
+        if (!WriteFile(tempFilePath, bytes, std::ios::trunc))
+        {
+            api::logging::Log("Failed to write checkpoint: " + tempFilePath.u8string());
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tempFilePath, this->_baseFilePath, ec);
+        if (ec)
+        {
+            api::logging::Log("Failed to replace checkpoint: " + this->_baseFilePath.u8string() +
+                              " with error: " + ec.message());
+            return false;
+        }
+
+        // the journal records are now in the base. If this fails, they are skipped on
+        // restore, as they are older than the base
+        if (!WriteFile(this->_journalFilePath, {}, std::ios::trunc))
+        {
+            api::logging::Log("Failed to empty checkpoint journal: " + this->_journalFilePath.u8string());
+        }
+
+        return true;
+    }
+
+    bool WorldCheckpointStore::AppendToJournal(const WorldCheckpoint& checkpoint) noexcept
+    {
+        std::vector<std::byte> bytes;
+        WriteRecord(bytes, JournalMagic, false, checkpoint);
+
+        if (!WriteFile(this->_journalFilePath, bytes, std::ios::app))
+        {
+            api::logging::Log("Failed to append to checkpoint journal: " + this->_journalFilePath.u8string());
+            return false;
+        }
+
+        return true;
+    }
+
+    std::optional<WorldCheckpoint> WorldCheckpointStore::Restore() const noexcept
+    {
+        auto baseBytes = ReadFile(this->_baseFilePath);
+        if (baseBytes.empty())
+        {
+            return {};
+        }
+
+        WorldCheckpoint checkpoint;
+
+        uint32_t index {0u};
+        if (!ReadRecord(baseBytes, index, BaseMagic, true, checkpoint))
+        {
+            api::logging::Log("Invalid checkpoint: " + this->_baseFilePath.u8string());
+            return {};
+        }
+
+        std::vector<WorldChangeLog> changeLogs;
+        AddChanges(changeLogs, checkpoint.IslandChanges);
+
+        auto journalBytes = ReadFile(this->_journalFilePath);
+        index = 0u;
+
+        while (index < journalBytes.size())
+        {
+            WorldCheckpoint record;
+
+            if (!ReadRecord(journalBytes, index, JournalMagic, false, record))
+            {
+                api::logging::Log("Ignoring the end of checkpoint journal: " + this->_journalFilePath.u8string());
+                break;
+            }
+
+            if (record.Sequence <= checkpoint.Sequence)
+            {
+                continue;
+            }
+
+            AddChanges(changeLogs, record.IslandChanges);
+
+            checkpoint.Sequence = record.Sequence;
+            checkpoint.GameTime = record.GameTime;
+            checkpoint.Entities = std::move(record.Entities);
+            checkpoint.ScriptState = std::move(record.ScriptState);
+        }
+
+        checkpoint.IslandChanges.resize(changeLogs.size());
+        for (auto i = 0u; i < changeLogs.size(); ++i)
+        {
+            checkpoint.IslandChanges[i] = changeLogs[i].GetChanges();
+        }
+
+        return checkpoint;
+    }
+
+    void WorldCheckpointWriter::Seed(const WorldCheckpoint& checkpoint) noexcept
+    {
+        this->_islandChangeLogs.clear();
+        AddChanges(this->_islandChangeLogs, checkpoint.IslandChanges);
+
+        this->_sequence = checkpoint.Sequence;
+    }
+
+    bool WorldCheckpointWriter::Start() noexcept
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(this->_directory, ec);
+        if (ec)
+        {
+            api::logging::Log("Failed to create checkpoint folder: " + this->_directory.u8string() +
+                              " with error: " + ec.message());
+            return false;
+        }
+
+        this->_runThread = true;
+        this->_thread = std::thread(&WorldCheckpointWriter::ThreadWorker, this);
+
+        return true;
+    }
+
+    void WorldCheckpointWriter::Stop() noexcept
+    {
+        if (this->_thread.joinable())
+        {
+            {
+                std::unique_lock lock(this->_mutex);
+                this->_runThread = false;
+            }
+
+            this->_mutexCV.notify_one();
+            this->_thread.join();
+        }
+    }
+
+    void WorldCheckpointWriter::Submit(WorldCheckpoint checkpoint) noexcept
+    {
+        {
+            std::unique_lock lock(this->_mutex);
+
+            if (!this->_pendingCheckpoint)
+            {
+                this->_pendingCheckpoint = std::move(checkpoint);
+            }
+            else
+            {
+                auto& pending = *this->_pendingCheckpoint;
+
+                if (pending.IslandChanges.size() < checkpoint.IslandChanges.size())
+                {
+                    pending.IslandChanges.resize(checkpoint.IslandChanges.size());
+                }
+
+                for (auto i = 0u; i < checkpoint.IslandChanges.size(); ++i)
+                {
+                    auto& changes = checkpoint.IslandChanges[i];
+                    pending.IslandChanges[i].insert(pending.IslandChanges[i].end(), changes.begin(), changes.end());
+                }
+
+                pending.GameTime = checkpoint.GameTime;
+                pending.Entities = std::move(checkpoint.Entities);
+                pending.ScriptState = std::move(checkpoint.ScriptState);
+            }
+        }
+
+        this->_mutexCV.notify_one();
+    }
+
+    void WorldCheckpointWriter::ThreadWorker() noexcept
+    {
+        ALLOCATION_SCOPE(Persistence);
+
+        auto runThread {true};
+
+        while (runThread)
+        {
+            std::optional<WorldCheckpoint> checkpoint;
+
+            {
+                std::unique_lock lock(this->_mutex);
+                this->_mutexCV.wait(lock, [this]() { return this->_pendingCheckpoint || !this->_runThread; });
+
+                checkpoint.swap(this->_pendingCheckpoint);
+                runThread = this->_runThread;
+            }
+
+            // anything submitted before stopping is still written
+            if (checkpoint)
+            {
+                this->Write(*checkpoint);
+            }
+        }
+    }
+
+    void WorldCheckpointWriter::Write(WorldCheckpoint& checkpoint) noexcept
+    {
+        // the change logs keep the latest change to each tile for the next base
+        AddChanges(this->_islandChangeLogs, checkpoint.IslandChanges);
+
+        checkpoint.WorldName = this->_worldName;
+        checkpoint.Sequence = ++this->_sequence;
+
+        if (!this->_hasWrittenBase || this->_numberOfJournalRecords >= this->_recordsPerBase)
+        {
+            checkpoint.IslandChanges.resize(this->_islandChangeLogs.size());
+            for (auto i = 0u; i < this->_islandChangeLogs.size(); ++i)
+            {
+                checkpoint.IslandChanges[i] = this->_islandChangeLogs[i].GetChanges();
+            }
+
+            this->_hasWrittenBase = this->_store.WriteBase(checkpoint);
+            this->_numberOfJournalRecords = 0u;
+
+            if (!this->_hasWrittenBase)
+            {
+                return;
+            }
+        }
+        else if (this->_store.AppendToJournal(checkpoint))
+        {
+            ++this->_numberOfJournalRecords;
+        }
+        else
+        {
+            // the journal may now end in a torn record, which would hide any record after it
+            this->_hasWrittenBase = false;
+            return;
+        }
+
+        ++this->_numberOfCheckpointsWritten;
+    }
+}
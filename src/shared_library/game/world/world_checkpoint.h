@@ -0,0 +1,191 @@
+#ifndef PROJECTFARM_WORLD_CHECKPOINT_H
+#define PROJECTFARM_WORLD_CHECKPOINT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <optional>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+
+#include "world_change_log.h"
+
+// The runtime state of a world, so the server can restart where it left off. Each world
+// has a base file, `<world>.checkpoint`, and a journal, `<world>.journal`, in the
+// checkpoint folder:
+//
+//  base        header "PFCK", version, size, checksum, then a checkpoint with the
+//              latest change to each tile
+//  journal     records of header "PFCJ", size, checksum, then a checkpoint with only the
+//              changes since the previous record
+//
+// The base is replaced in one step and the journal is only appended to, so a crash
+// leaves at worst a torn record at the end of the journal, which is ignored.
+
+namespace projectfarm::shared::game::world
+{
+    struct CheckpointStateItem
+    {
+        uint8_t Key {0u};
+        uint8_t Value {0u};
+    };
+
+    struct EntityCheckpoint
+    {
+        std::string CharacterType;
+
+        float PositionX {0.0f};
+        float PositionY {0.0f};
+
+        float MoveToDestinationX {0.0f};
+        float MoveToDestinationY {0.0f};
+
+        // the top of each stack first
+        std::vector<CheckpointStateItem> States;
+        std::vector<CheckpointStateItem> BehaviourStates;
+    };
+
+    struct WorldCheckpoint
+    {
+        std::string WorldName;
+
+        uint64_t Sequence {0u};
+        uint64_t GameTime {0u};
+
+        std::vector<std::vector<WorldChangeLogEntry>> IslandChanges;
+
+        std::vector<EntityCheckpoint> Entities;
+
+        // set by the world script, which it can read back on a warm start
+        std::string ScriptState;
+    };
+
+    void EncodeWorldCheckpoint(const WorldCheckpoint& checkpoint, std::vector<std::byte>& bytes) noexcept;
+
+    [[nodiscard]]
+    bool DecodeWorldCheckpoint(const std::vector<std::byte>& bytes, uint32_t& index,
+                               WorldCheckpoint& checkpoint) noexcept;
+
+    class WorldCheckpointStore final
+    {
+    public:
+        static constexpr uint32_t Version {1u};
+        static constexpr auto BaseExtension = ".checkpoint";
+        static constexpr auto JournalExtension = ".journal";
+
+        WorldCheckpointStore(const std::filesystem::path& directory, const std::string& worldName)
+            : _baseFilePath {directory / (worldName + BaseExtension)},
+              _journalFilePath {directory / (worldName + JournalExtension)}
+        {
+        }
+
+        ~WorldCheckpointStore() = default;
+
+        // replaces the base and empties the journal
+        [[nodiscard]]
+        bool WriteBase(const WorldCheckpoint& checkpoint) noexcept;
+
+        [[nodiscard]]
+        bool AppendToJournal(const WorldCheckpoint& checkpoint) noexcept;
+
+        // the base with every journal record after it applied, if there is a base
+        [[nodiscard]]
+        std::optional<WorldCheckpoint> Restore() const noexcept;
+
+        [[nodiscard]]
+        const std::filesystem::path& GetBaseFilePath() const noexcept
+        {
+            return this->_baseFilePath;
+        }
+
+        [[nodiscard]]
+        const std::filesystem::path& GetJournalFilePath() const noexcept
+        {
+            return this->_journalFilePath;
+        }
+
+    private:
+        std::filesystem::path _baseFilePath;
+        std::filesystem::path _journalFilePath;
+    };
+
+    // Writes checkpoints on its own thread. The first checkpoint written is a base, then
+    // each is appended to the journal until there are `recordsPerBase` records, when the
+    // journal is folded into a new base.
+    class WorldCheckpointWriter final
+    {
+    public:
+        static constexpr uint32_t DefaultRecordsPerBase {32u};
+
+        WorldCheckpointWriter(const std::filesystem::path& directory, const std::string& worldName,
+                              uint32_t recordsPerBase = DefaultRecordsPerBase)
+            : _directory {directory},
+              _worldName {worldName},
+              _store {directory, worldName},
+              _recordsPerBase {recordsPerBase}
+        {
+        }
+
+        ~WorldCheckpointWriter()
+        {
+            this->Stop();
+        }
+
+        WorldCheckpointWriter(const WorldCheckpointWriter&) = delete;
+        WorldCheckpointWriter(WorldCheckpointWriter&&) = delete;
+
+        // the state the checkpoints continue from, such as a restored checkpoint. Must be
+        // called before `Start`
+        void Seed(const WorldCheckpoint& checkpoint) noexcept;
+
+        [[nodiscard]]
+        bool Start() noexcept;
+
+        // writes anything already submitted before stopping
+        void Stop() noexcept;
+
+        // `checkpoint` holds only the tile changes since the last submit. This only moves the
+        // checkpoint, so it is cheap enough to call during a tick. If the last checkpoint has
+        // not been written yet, the two are merged.
+        void Submit(WorldCheckpoint checkpoint) noexcept;
+
+        [[nodiscard]]
+        uint64_t GetNumberOfCheckpointsWritten() const noexcept
+        {
+            return this->_numberOfCheckpointsWritten;
+        }
+
+    private:
+        std::filesystem::path _directory;
+        std::string _worldName;
+
+        WorldCheckpointStore _store;
+        uint32_t _recordsPerBase {DefaultRecordsPerBase};
+
+        std::atomic_bool _runThread {false};
+        std::thread _thread;
+
+        std::mutex _mutex;
+        std::condition_variable _mutexCV;
+
+        std::optional<WorldCheckpoint> _pendingCheckpoint;
+
+        // only used by the writer thread once it has started
+        std::vector<WorldChangeLog> _islandChangeLogs;
+        uint64_t _sequence {0u};
+        uint32_t _numberOfJournalRecords {0u};
+        bool _hasWrittenBase {false};
+
+        std::atomic<uint64_t> _numberOfCheckpointsWritten {0u};
+
+        void ThreadWorker() noexcept;
+
+        void Write(WorldCheckpoint& checkpoint) noexcept;
+    };
+}
+
+#endif
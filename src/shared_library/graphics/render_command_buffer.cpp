@@ -0,0 +1,132 @@
+#include <algorithm>
+#include <array>
+
+#include "render_command_buffer.h"
+
+namespace projectfarm::shared::graphics
+{
+    namespace
+    {
+        constexpr uint64_t MaxRenderLayer {0xFFFFFFu};
+        constexpr uint64_t MaxOrder {0xFu};
+
+        constexpr auto BitsPerPass {8u};
+        constexpr auto BucketsPerPass {1u << BitsPerPass};
+    }
+
+    uint64_t RenderCommandBuffer::CreateSortKey(const RenderCommand& command) noexcept
+    {
+        auto renderLayer = std::min<uint64_t>(command.RenderLayer, MaxRenderLayer);
+        auto order = std::min<uint64_t>(command.Order, MaxOrder);
+        auto color = (command.Color ^ (command.Color >> 12u) ^ (command.Color >> 24u)) & 0xFFFu;
+
+        return renderLayer << 40u |
+               order << 36u |
+               static_cast<uint64_t>(command.MaterialId & 0xFFu) << 28u |
+               static_cast<uint64_t>(command.TextureId & 0xFFFFu) << 12u |
+               color;
+    }
+
+    void RenderCommandBuffer::Clear() noexcept
+    {
+        this->_commands.clear();
+    }
+
+    void RenderCommandBuffer::Add(RenderCommand command) noexcept
+    {
+        command.SortKey = RenderCommandBuffer::CreateSortKey(command);
+
+        this->_commands.push_back(command);
+    }
+
+    void RenderCommandBuffer::Sort() noexcept
+    {
+        auto numberOfCommands = this->_commands.size();
+        if (numberOfCommands < 2u)
+        {
+            return;
+        }
+
+        this->_sortBuffer.resize(numberOfCommands);
+
+        std::array<size_t, BucketsPerPass> offsets {};
+
+        for (auto shift = 0u; shift < 64u; shift += BitsPerPass)
+        {
+            offsets.fill(0u);
+
+            for (const auto& command : this->_commands)
+            {
+                ++offsets[(command.SortKey >> shift) & (BucketsPerPass - 1u)];
+            }
+
+            // most of the key is the same for every draw, so most passes wouldn't move anything
+            if (offsets[(this->_commands.front().SortKey >> shift) & (BucketsPerPass - 1u)] == numberOfCommands)
+            {
+                continue;
+            }
+
+            size_t offset {0u};
+            for (auto& bucket : offsets)
+            {
+                auto count = bucket;
+                bucket = offset;
+                offset += count;
+            }
+
+            for (const auto& command : this->_commands)
+            {
+                this->_sortBuffer[offsets[(command.SortKey >> shift) & (BucketsPerPass - 1u)]++] = command;
+            }
+
+            std::swap(this->_commands, this->_sortBuffer);
+        }
+    }
+
+    RenderSubmitStatistics RenderCommandBuffer::Submit(RenderBackend& backend) const noexcept
+    {
+        RenderSubmitStatistics statistics;
+
+        // nothing is known about the state before the first command
+        const RenderCommand* last {nullptr};
+        auto isColorSet {false};
+
+        for (const auto& command : this->_commands)
+        {
+            if (!last || command.RenderLayer != last->RenderLayer)
+            {
+                ++statistics.RenderLayers;
+            }
+
+            // the color is a uniform of the material's program, so it is set again for a new material
+            if (!last || command.MaterialId != last->MaterialId)
+            {
+                backend.BindMaterial(command);
+                ++statistics.MaterialBinds;
+
+                isColorSet = false;
+            }
+
+            if (!last || command.TextureId != last->TextureId)
+            {
+                backend.BindTexture(command);
+                ++statistics.TextureBinds;
+            }
+
+            if (!isColorSet || command.Color != last->Color)
+            {
+                backend.SetColor(command);
+                ++statistics.ColorChanges;
+
+                isColorSet = true;
+            }
+
+            backend.Draw(command);
+            ++statistics.Draws;
+
+            last = &command;
+        }
+
+        return statistics;
+    }
+}
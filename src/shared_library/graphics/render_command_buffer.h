@@ -0,0 +1,91 @@
+#ifndef PROJECTFARM_RENDER_COMMAND_BUFFER_H
+#define PROJECTFARM_RENDER_COMMAND_BUFFER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace projectfarm::shared::graphics
+{
+    // A draw and the state it needs bound. `DrawIndex` is the caller's own, for
+    // finding what to draw once the commands are sorted.
+    struct RenderCommand
+    {
+        uint64_t SortKey {0u};
+
+        uint32_t RenderLayer {0u};
+        uint32_t MaterialId {0u};
+        uint32_t TextureId {0u};
+        uint32_t Color {0u};
+        uint32_t DrawIndex {0u};
+
+        // draws in the same render layer with a lower order are drawn first
+        uint8_t Order {0u};
+    };
+
+    // Makes the calls for a command buffer. Each is only called when the state changes.
+    class RenderBackend
+    {
+    public:
+        RenderBackend() = default;
+        virtual ~RenderBackend() = default;
+
+        virtual void BindMaterial(const RenderCommand& command) noexcept = 0;
+        virtual void BindTexture(const RenderCommand& command) noexcept = 0;
+
+        // to the material that is bound
+        virtual void SetColor(const RenderCommand& command) noexcept = 0;
+
+        virtual void Draw(const RenderCommand& command) noexcept = 0;
+    };
+
+    struct RenderSubmitStatistics
+    {
+        uint32_t Draws {0u};
+        uint32_t MaterialBinds {0u};
+        uint32_t TextureBinds {0u};
+        uint32_t ColorChanges {0u};
+        uint32_t RenderLayers {0u};
+    };
+
+    // Draws are added in any order, then sorted by render layer, order, material, texture and
+    // color, so draws needing the same state are next to each other when they are submitted.
+    class RenderCommandBuffer final
+    {
+    public:
+        // from the most significant bits: render layer (24), order (4), material (8),
+        // texture (16) and a hash of the color (12). Only the render layer and order
+        // have to be exact, as the others just group draws and are compared in full
+        // when submitted. Render layers past the 24 bits are drawn last.
+        [[nodiscard]]
+        static uint64_t CreateSortKey(const RenderCommand& command) noexcept;
+
+        // keeps the memory to be reused
+        void Clear() noexcept;
+
+        void Add(RenderCommand command) noexcept;
+
+        // a radix sort, which is stable, so draws with the same key stay in the order they were added
+        void Sort() noexcept;
+
+        RenderSubmitStatistics Submit(RenderBackend& backend) const noexcept;
+
+        [[nodiscard]]
+        const std::vector<RenderCommand>& GetCommands() const noexcept
+        {
+            return this->_commands;
+        }
+
+        [[nodiscard]]
+        size_t GetNumberOfCommands() const noexcept
+        {
+            return this->_commands.size();
+        }
+
+    private:
+        std::vector<RenderCommand> _commands;
+        std::vector<RenderCommand> _sortBuffer;
+    };
+}
+
+#endif
@@ -0,0 +1,398 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "texture_atlas.h"
+#include "api/logging/logging.h"
+
+namespace projectfarm::shared::graphics
+{
+    namespace
+    {
+        constexpr uint32_t BytesPerPixel {4u};
+
+        constexpr std::array<uint8_t, 8> PngSignature {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A};
+
+        // the signature, the IHDR chunk length and type, then the width and height
+        constexpr uint64_t PngHeaderSize {24u};
+
+        struct Shelf
+        {
+            uint32_t Y {0u};
+            uint32_t Height {0u};
+            uint32_t UsedWidth {0u};
+        };
+
+        struct PageShelves
+        {
+            std::vector<Shelf> Shelves;
+            uint32_t UsedWidth {0u};
+            uint32_t UsedHeight {0u};
+        };
+
+        uint32_t GetNextPowerOfTwo(uint32_t value) noexcept
+        {
+            auto result {1u};
+            while (result < value)
+            {
+                result <<= 1u;
+            }
+
+            return result;
+        }
+
+        uint32_t ReadBigEndian32(const std::byte* data) noexcept
+        {
+            return (static_cast<uint32_t>(data[0]) << 24u) |
+                   (static_cast<uint32_t>(data[1]) << 16u) |
+                   (static_cast<uint32_t>(data[2]) << 8u) |
+                   static_cast<uint32_t>(data[3]);
+        }
+    }
+
+    bool TextureAtlasLayout::Build(std::vector<AtlasImage> images, uint32_t maxPageSize, uint32_t padding) noexcept
+    {
+        this->Clear();
+        this->_padding = padding;
+
+        // tallest first, so each shelf is filled with images of a similar height
+        std::sort(images.begin(), images.end(), [](const auto& a, const auto& b)
+        {
+            if (a.Height != b.Height)
+            {
+                return a.Height > b.Height;
+            }
+
+            if (a.Width != b.Width)
+            {
+                return a.Width > b.Width;
+            }
+
+            return a.Name < b.Name;
+        });
+
+        std::vector<PageShelves> pages;
+
+        for (const auto& image : images)
+        {
+            if (image.Width == 0u || image.Height == 0u)
+            {
+                api::logging::Log("Atlas image has no size: " + image.Name);
+                this->Clear();
+                return false;
+            }
+
+            auto paddedWidth = image.Width + padding * 2u;
+            auto paddedHeight = image.Height + padding * 2u;
+
+            if (paddedWidth > maxPageSize || paddedHeight > maxPageSize)
+            {
+                api::logging::Log("Atlas image is too large for a page: " + image.Name);
+                this->Clear();
+                return false;
+            }
+
+            Shelf* shelf {nullptr};
+            uint32_t pageIndex {0u};
+
+            for (auto p = 0u; p < pages.size() && !shelf; ++p)
+            {
+                for (auto& s : pages[p].Shelves)
+                {
+                    if (paddedHeight <= s.Height && s.UsedWidth + paddedWidth <= maxPageSize)
+                    {
+                        shelf = &s;
+                        pageIndex = p;
+                        break;
+                    }
+                }
+            }
+
+            for (auto p = 0u; p < pages.size() && !shelf; ++p)
+            {
+                if (pages[p].UsedHeight + paddedHeight <= maxPageSize)
+                {
+                    shelf = &pages[p].Shelves.emplace_back(Shelf {pages[p].UsedHeight, paddedHeight, 0u});
+                    pages[p].UsedHeight += paddedHeight;
+                    pageIndex = p;
+                }
+            }
+
+            if (!shelf)
+            {
+                pageIndex = static_cast<uint32_t>(pages.size());
+
+                auto& page = pages.emplace_back();
+                shelf = &page.Shelves.emplace_back(Shelf {0u, paddedHeight, 0u});
+                page.UsedHeight = paddedHeight;
+            }
+
+            AtlasEntry entry;
+            entry.Name = image.Name;
+            entry.Page = pageIndex;
+            entry.X = shelf->UsedWidth + padding;
+            entry.Y = shelf->Y + padding;
+            entry.Width = image.Width;
+            entry.Height = image.Height;
+
+            shelf->UsedWidth += paddedWidth;
+            pages[pageIndex].UsedWidth = std::max(pages[pageIndex].UsedWidth, shelf->UsedWidth);
+
+            this->_entries.push_back(std::move(entry));
+        }
+
+        for (const auto& page : pages)
+        {
+            this->_pages.push_back({ GetNextPowerOfTwo(page.UsedWidth), GetNextPowerOfTwo(page.UsedHeight) });
+        }
+
+        this->IndexEntries();
+
+        if (this->_entryIndexes.size() != this->_entries.size())
+        {
+            api::logging::Log("Atlas images must have unique names.");
+            this->Clear();
+            return false;
+        }
+
+        return true;
+    }
+
+    void TextureAtlasLayout::Clear() noexcept
+    {
+        this->_pages.clear();
+        this->_entries.clear();
+        this->_entryIndexes.clear();
+    }
+
+    const AtlasEntry* TextureAtlasLayout::Find(std::string_view name) const noexcept
+    {
+        auto index = this->_entryIndexes.find(std::string(name));
+        if (index == this->_entryIndexes.end())
+        {
+            return nullptr;
+        }
+
+        return &this->_entries[index->second];
+    }
+
+    bool TextureAtlasLayout::Matches(const std::vector<AtlasImage>& images) const noexcept
+    {
+        if (images.size() != this->_entries.size())
+        {
+            return false;
+        }
+
+        return std::all_of(images.begin(), images.end(), [this](const auto& image)
+        {
+            const auto* entry = this->Find(image.Name);
+            return entry && entry->Width == image.Width && entry->Height == image.Height;
+        });
+    }
+
+    std::optional<AtlasEntry> TextureAtlasLayout::MapRect(std::string_view name,
+                                                          uint32_t x, uint32_t y,
+                                                          uint32_t width, uint32_t height) const noexcept
+    {
+        const auto* entry = this->Find(name);
+        if (!entry || x + width > entry->Width || y + height > entry->Height)
+        {
+            return {};
+        }
+
+        return AtlasEntry { entry->Name, entry->Page, entry->X + x, entry->Y + y, width, height };
+    }
+
+    std::optional<AtlasUVs> TextureAtlasLayout::GetUVs(std::string_view name,
+                                                       uint32_t x, uint32_t y,
+                                                       uint32_t width, uint32_t height) const noexcept
+    {
+        auto rect = this->MapRect(name, x, y, width, height);
+        if (!rect)
+        {
+            return {};
+        }
+
+        const auto& page = this->_pages[rect->Page];
+
+        auto pageWidth = static_cast<float>(page.Width);
+        auto pageHeight = static_cast<float>(page.Height);
+
+        return AtlasUVs
+        {
+            static_cast<float>(rect->X) / pageWidth,
+            static_cast<float>(rect->Y) / pageHeight,
+            static_cast<float>(rect->X + rect->Width) / pageWidth,
+            static_cast<float>(rect->Y + rect->Height) / pageHeight,
+        };
+    }
+
+    nlohmann::json TextureAtlasLayout::ToJson() const noexcept
+    {
+        auto pages = nlohmann::json::array();
+        for (const auto& page : this->_pages)
+        {
+            pages.push_back({ { "width", page.Width }, { "height", page.Height } });
+        }
+
+        auto entries = nlohmann::json::array();
+        for (const auto& entry : this->_entries)
+        {
+            entries.push_back({
+                { "name", entry.Name },
+                { "page", entry.Page },
+                { "x", entry.X },
+                { "y", entry.Y },
+                { "width", entry.Width },
+                { "height", entry.Height },
+            });
+        }
+
+        return { { "padding", this->_padding }, { "pages", pages }, { "entries", entries } };
+    }
+
+    bool TextureAtlasLayout::FromJson(const nlohmann::json& json) noexcept
+    {
+        this->Clear();
+
+        try
+        {
+            this->_padding = json.at("padding").get<uint32_t>();
+
+            for (const auto& page : json.at("pages"))
+            {
+                this->_pages.push_back({ page.at("width").get<uint32_t>(), page.at("height").get<uint32_t>() });
+            }
+
+            for (const auto& item : json.at("entries"))
+            {
+                AtlasEntry entry;
+                entry.Name = item.at("name").get<std::string>();
+                entry.Page = item.at("page").get<uint32_t>();
+                entry.X = item.at("x").get<uint32_t>();
+                entry.Y = item.at("y").get<uint32_t>();
+                entry.Width = item.at("width").get<uint32_t>();
+                entry.Height = item.at("height").get<uint32_t>();
+
+                // the padding around the entry must also be on the page, as it is
+                // written when the page is composed
+                uint64_t padding = this->_padding;
+
+                if (entry.Page >= this->_pages.size() ||
+                    entry.X < padding || entry.Y < padding ||
+                    static_cast<uint64_t>(entry.X) + entry.Width + padding > this->_pages[entry.Page].Width ||
+                    static_cast<uint64_t>(entry.Y) + entry.Height + padding > this->_pages[entry.Page].Height)
+                {
+                    api::logging::Log("Atlas entry is outside of its page: " + entry.Name);
+                    this->Clear();
+                    return false;
+                }
+
+                this->_entries.push_back(std::move(entry));
+            }
+        }
+        catch (const nlohmann::json::exception& ex)
+        {
+            api::logging::Log("Failed to read atlas layout: " + std::string(ex.what()));
+            this->Clear();
+            return false;
+        }
+
+        this->IndexEntries();
+
+        return true;
+    }
+
+    void TextureAtlasLayout::IndexEntries() noexcept
+    {
+        this->_entryIndexes.clear();
+
+        for (auto i = 0u; i < this->_entries.size(); ++i)
+        {
+            this->_entryIndexes[this->_entries[i].Name] = i;
+        }
+    }
+
+    DecodedImagePtr ComposeAtlasPage(const TextureAtlasLayout& layout, uint32_t pageIndex,
+                                     const std::unordered_map<std::string, DecodedImagePtr>& images) noexcept
+    {
+        if (pageIndex >= layout.GetPages().size())
+        {
+            return {};
+        }
+
+        const auto& page = layout.GetPages()[pageIndex];
+        auto padding = layout.GetPadding();
+
+        auto result = std::make_shared<DecodedImage>();
+        result->Width = page.Width;
+        result->Height = page.Height;
+        result->Pixels.resize(static_cast<size_t>(page.Width) * page.Height * BytesPerPixel);
+
+        auto pageRowSize = static_cast<size_t>(page.Width) * BytesPerPixel;
+
+        for (const auto& entry : layout.GetEntries())
+        {
+            if (entry.Page != pageIndex)
+            {
+                continue;
+            }
+
+            auto image = images.find(entry.Name);
+            if (image == images.end() || !image->second ||
+                image->second->Width != entry.Width || image->second->Height != entry.Height)
+            {
+                api::logging::Log("Missing or resized atlas image: " + entry.Name);
+                return {};
+            }
+
+            const auto& source = *image->second;
+            auto sourceRowSize = static_cast<size_t>(source.Width) * BytesPerPixel;
+
+            // the padding repeats the edge rows and columns
+            for (auto row = 0u; row < entry.Height + padding * 2u; ++row)
+            {
+                auto sourceY = std::clamp(static_cast<int64_t>(row) - padding, int64_t {0}, int64_t {entry.Height - 1u});
+
+                const auto* sourceRow = source.Pixels.data() + static_cast<size_t>(sourceY) * sourceRowSize;
+                auto* destinationRow = result->Pixels.data() +
+                                       static_cast<size_t>(entry.Y - padding + row) * pageRowSize +
+                                       static_cast<size_t>(entry.X) * BytesPerPixel;
+
+                std::memcpy(destinationRow, sourceRow, sourceRowSize);
+
+                for (auto column = 1u; column <= padding; ++column)
+                {
+                    std::memcpy(destinationRow - column * BytesPerPixel, sourceRow, BytesPerPixel);
+                    std::memcpy(destinationRow + sourceRowSize + (column - 1u) * BytesPerPixel,
+                                sourceRow + sourceRowSize - BytesPerPixel, BytesPerPixel);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    std::optional<std::pair<uint32_t, uint32_t>> GetPngImageSize(utils::ByteSpan data) noexcept
+    {
+        if (data.size() < PngHeaderSize)
+        {
+            return {};
+        }
+
+        for (auto i = 0u; i < PngSignature.size(); ++i)
+        {
+            if (static_cast<uint8_t>(data.data()[i]) != PngSignature[i])
+            {
+                return {};
+            }
+        }
+
+        if (std::memcmp(data.data() + 12u, "IHDR", 4u) != 0)
+        {
+            return {};
+        }
+
+        return std::make_pair(ReadBigEndian32(data.data() + 16u), ReadBigEndian32(data.data() + 20u));
+    }
+}
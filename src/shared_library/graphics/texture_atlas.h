@@ -0,0 +1,138 @@
+#ifndef PROJECTFARM_TEXTURE_ATLAS_H
+#define PROJECTFARM_TEXTURE_ATLAS_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+
+#include "texture_decoder.h"
+#include "utils/byte_span.h"
+
+namespace projectfarm::shared::graphics
+{
+    // the layout of the tile set atlas, in the client tile sets folder. It is only written
+    // cooked, so cleaning the cooked assets leaves the client to build the layout itself
+    constexpr auto TileSetAtlasLayoutFileName = "tileset_atlas.json";
+
+    struct AtlasImage
+    {
+        std::string Name;
+        uint32_t Width {0u};
+        uint32_t Height {0u};
+    };
+
+    // where an image is in the atlas, not including its padding
+    struct AtlasEntry
+    {
+        std::string Name;
+        uint32_t Page {0u};
+        uint32_t X {0u};
+        uint32_t Y {0u};
+        uint32_t Width {0u};
+        uint32_t Height {0u};
+    };
+
+    struct AtlasPage
+    {
+        uint32_t Width {0u};
+        uint32_t Height {0u};
+    };
+
+    struct AtlasUVs
+    {
+        float U1 {0.0f};
+        float V1 {0.0f};
+        float U2 {0.0f};
+        float V2 {0.0f};
+    };
+
+    // Packs images into as few pages as possible using shelves of similar heights.
+    // Each image has a border of `padding` pixels, which is filled with its edge pixels
+    // when the page is composed, so sampling near the edge of an image does not pick
+    // up its neighbours. Pages are sized to powers of two.
+    class TextureAtlasLayout final
+    {
+    public:
+        static constexpr uint32_t DefaultMaxPageSize {2048u};
+        static constexpr uint32_t DefaultPadding {1u};
+
+        TextureAtlasLayout() = default;
+        ~TextureAtlasLayout() = default;
+
+        // fails if an image does not fit on a page
+        [[nodiscard]]
+        bool Build(std::vector<AtlasImage> images,
+                   uint32_t maxPageSize = DefaultMaxPageSize,
+                   uint32_t padding = DefaultPadding) noexcept;
+
+        void Clear() noexcept;
+
+        [[nodiscard]]
+        const AtlasEntry* Find(std::string_view name) const noexcept;
+
+        // true if the layout has exactly these images with these sizes, so it can be used for them
+        [[nodiscard]]
+        bool Matches(const std::vector<AtlasImage>& images) const noexcept;
+
+        // moves a rect within the named image to a rect within its page
+        [[nodiscard]]
+        std::optional<AtlasEntry> MapRect(std::string_view name,
+                                          uint32_t x, uint32_t y,
+                                          uint32_t width, uint32_t height) const noexcept;
+
+        // the normalized coordinates of a rect within the named image
+        [[nodiscard]]
+        std::optional<AtlasUVs> GetUVs(std::string_view name,
+                                       uint32_t x, uint32_t y,
+                                       uint32_t width, uint32_t height) const noexcept;
+
+        [[nodiscard]]
+        const std::vector<AtlasPage>& GetPages() const noexcept
+        {
+            return this->_pages;
+        }
+
+        [[nodiscard]]
+        const std::vector<AtlasEntry>& GetEntries() const noexcept
+        {
+            return this->_entries;
+        }
+
+        [[nodiscard]]
+        uint32_t GetPadding() const noexcept
+        {
+            return this->_padding;
+        }
+
+        [[nodiscard]]
+        nlohmann::json ToJson() const noexcept;
+
+        [[nodiscard]]
+        bool FromJson(const nlohmann::json& json) noexcept;
+
+    private:
+        uint32_t _padding {DefaultPadding};
+
+        std::vector<AtlasPage> _pages;
+        std::vector<AtlasEntry> _entries;
+
+        std::unordered_map<std::string, uint32_t> _entryIndexes;
+
+        void IndexEntries() noexcept;
+    };
+
+    // `images` must have an image, with the size in the layout, for every entry on the page
+    [[nodiscard]]
+    DecodedImagePtr ComposeAtlasPage(const TextureAtlasLayout& layout, uint32_t pageIndex,
+                                     const std::unordered_map<std::string, DecodedImagePtr>& images) noexcept;
+
+    // reads the size from the header, so the image does not need to be decoded
+    [[nodiscard]]
+    std::optional<std::pair<uint32_t, uint32_t>> GetPngImageSize(utils::ByteSpan data) noexcept;
+}
+
+#endif
@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <chrono>
+
+#include "texture_decoder.h"
+#include "api/logging/logging.h"
+
+namespace projectfarm::shared::graphics
+{
+    TextureDecoder::TextureDecoder(std::shared_ptr<concurrency::ThreadPool> threadPool,
+                                   DecodeFunction decode, uint64_t maxCacheSizeInBytes) noexcept
+        : _threadPool {std::move(threadPool)},
+          _decode {std::move(decode)},
+          _maxCacheSizeInBytes {maxCacheSizeInBytes}
+    {
+    }
+
+    TextureDecoder::~TextureDecoder()
+    {
+        this->Clear();
+    }
+
+    std::shared_future<DecodedImagePtr> TextureDecoder::Request(const std::string& path, bool queueUpload) noexcept
+    {
+        auto request = std::find_if(this->_requests.begin(), this->_requests.end(),
+            [&path](const auto& r) { return r.Path == path; });
+
+        if (request != this->_requests.end())
+        {
+            request->QueueUpload |= queueUpload;
+            return request->Result;
+        }
+
+        std::shared_future<DecodedImagePtr> result;
+
+        if (auto image = this->GetCached(path); image)
+        {
+            std::promise<DecodedImagePtr> promise;
+            promise.set_value(image);
+
+            result = promise.get_future().share();
+
+            // nothing to wait for or upload
+            if (!queueUpload)
+            {
+                return result;
+            }
+        }
+        else
+        {
+            ++this->_numberOfDecodes;
+
+            // the decoder waits for every request before it is destroyed, so `this` outlives the task
+            result = this->_threadPool->Enqueue([this, path]() { return this->_decode(path); }).share();
+        }
+
+        this->_requests.push_back({path, result, queueUpload});
+
+        return result;
+    }
+
+    DecodedImagePtr TextureDecoder::Decode(const std::string& path) noexcept
+    {
+        if (auto image = this->GetCached(path); image)
+        {
+            return image;
+        }
+
+        auto request = std::find_if(this->_requests.begin(), this->_requests.end(),
+            [&path](const auto& r) { return r.Path == path; });
+
+        if (request != this->_requests.end())
+        {
+            auto image = this->GetResult(request->Result);
+            this->AddToCache(path, image);
+
+            return image;
+        }
+
+        ++this->_numberOfDecodes;
+
+        DecodedImagePtr image;
+
+        try
+        {
+            image = this->_decode(path);
+        }
+        catch (const std::exception& ex)
+        {
+            shared::api::logging::Log("Exception decoding image: " + path + " - " + ex.what());
+        }
+
+        this->AddToCache(path, image);
+
+        return image;
+    }
+
+    std::vector<TextureDecoder::Upload> TextureDecoder::TakeUploads(uint64_t maxBytes) noexcept
+    {
+        std::vector<TextureDecoder::Upload> uploads;
+        uint64_t totalBytes {0u};
+
+        auto request = this->_requests.begin();
+
+        while (request != this->_requests.end())
+        {
+            if (request->Result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                ++request;
+                continue;
+            }
+
+            auto image = this->GetResult(request->Result);
+            this->AddToCache(request->Path, image);
+
+            if (request->QueueUpload)
+            {
+                auto size = image ? image->GetSizeInBytes() : 0u;
+
+                if (!uploads.empty() && totalBytes + size > maxBytes)
+                {
+                    break;
+                }
+
+                totalBytes += size;
+                uploads.push_back({request->Path, image});
+            }
+
+            request = this->_requests.erase(request);
+        }
+
+        return uploads;
+    }
+
+    void TextureDecoder::Clear() noexcept
+    {
+        for (auto& request : this->_requests)
+        {
+            request.Result.wait();
+        }
+
+        this->_requests.clear();
+
+        this->_cache.clear();
+        this->_recentlyUsed.clear();
+        this->_cacheSizeInBytes = 0u;
+    }
+
+    DecodedImagePtr TextureDecoder::GetCached(const std::string& path) noexcept
+    {
+        auto entry = this->_cache.find(path);
+        if (entry == this->_cache.end())
+        {
+            return {};
+        }
+
+        this->_recentlyUsed.splice(this->_recentlyUsed.begin(), this->_recentlyUsed, entry->second.Position);
+
+        return entry->second.Image;
+    }
+
+    void TextureDecoder::AddToCache(const std::string& path, const DecodedImagePtr& image) noexcept
+    {
+        // failed images are not cached, so they can be fixed and requested again
+        if (!image || image->GetSizeInBytes() > this->_maxCacheSizeInBytes || this->_cache.count(path) > 0)
+        {
+            return;
+        }
+
+        while (this->_cacheSizeInBytes + image->GetSizeInBytes() > this->_maxCacheSizeInBytes)
+        {
+            const auto& leastRecentlyUsed = this->_recentlyUsed.back();
+
+            this->_cacheSizeInBytes -= this->_cache[leastRecentlyUsed].Image->GetSizeInBytes();
+            this->_cache.erase(leastRecentlyUsed);
+            this->_recentlyUsed.pop_back();
+        }
+
+        this->_recentlyUsed.push_front(path);
+        this->_cache[path] = {image, this->_recentlyUsed.begin()};
+        this->_cacheSizeInBytes += image->GetSizeInBytes();
+    }
+
+    DecodedImagePtr TextureDecoder::GetResult(std::shared_future<DecodedImagePtr>& result) const noexcept
+    {
+        try
+        {
+            return result.get();
+        }
+        catch (const std::exception& ex)
+        {
+            shared::api::logging::Log("Exception decoding image: " + std::string(ex.what()));
+        }
+
+        return {};
+    }
+}
@@ -0,0 +1,140 @@
+#ifndef PROJECTFARM_TEXTURE_DECODER_H
+#define PROJECTFARM_TEXTURE_DECODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <list>
+#include <memory>
+#include <future>
+#include <functional>
+#include <unordered_map>
+
+#include "concurrency/thread_pool.h"
+
+namespace projectfarm::shared::graphics
+{
+    // tightly packed RGBA pixels, ready to be uploaded
+    struct DecodedImage
+    {
+        uint32_t Width {0u};
+        uint32_t Height {0u};
+        std::vector<std::byte> Pixels;
+
+        [[nodiscard]]
+        uint64_t GetSizeInBytes() const noexcept
+        {
+            return this->Pixels.size();
+        }
+    };
+
+    using DecodedImagePtr = std::shared_ptr<const DecodedImage>;
+
+    // Decodes images on a thread pool and keeps the most recently used decoded images,
+    // up to a size in bytes. Requests for an image that is already being decoded share
+    // the same decode. Apart from the decode function, everything runs on the thread that
+    // owns the decoder, so uploading the decoded images can be spread over frames.
+    class TextureDecoder final
+    {
+    public:
+        // run on the thread pool, returns null if the image failed to decode
+        using DecodeFunction = std::function<DecodedImagePtr(const std::string& path)>;
+
+        struct Upload
+        {
+            std::string Path;
+
+            // null if the image failed to decode
+            DecodedImagePtr Image;
+        };
+
+        TextureDecoder(std::shared_ptr<concurrency::ThreadPool> threadPool,
+                       DecodeFunction decode, uint64_t maxCacheSizeInBytes) noexcept;
+        ~TextureDecoder();
+
+        TextureDecoder(const TextureDecoder&) = delete;
+        TextureDecoder(TextureDecoder&&) = delete;
+
+        // starts decoding `path` if it is not cached or already being decoded. When `queueUpload`
+        // is set, the image is returned from `TakeUploads` once it is decoded
+        std::shared_future<DecodedImagePtr> Request(const std::string& path, bool queueUpload = true) noexcept;
+
+        // returns the decoded image, decoding it on the calling thread if it is not
+        // cached or already being decoded
+        [[nodiscard]]
+        DecodedImagePtr Decode(const std::string& path) noexcept;
+
+        // the decoded images queued for upload, in request order, up to `maxBytes`. At least
+        // one decoded image is returned, if there is one, so a large image is not stuck
+        [[nodiscard]]
+        std::vector<Upload> TakeUploads(uint64_t maxBytes) noexcept;
+
+        // waits for any decodes and removes every cached image
+        void Clear() noexcept;
+
+        [[nodiscard]]
+        bool IsCached(const std::string& path) const noexcept
+        {
+            return this->_cache.count(path) > 0;
+        }
+
+        [[nodiscard]]
+        uint64_t GetCacheSizeInBytes() const noexcept
+        {
+            return this->_cacheSizeInBytes;
+        }
+
+        [[nodiscard]]
+        uint32_t GetNumberOfPendingRequests() const noexcept
+        {
+            return static_cast<uint32_t>(this->_requests.size());
+        }
+
+        // the number of times the decode function has been called
+        [[nodiscard]]
+        uint64_t GetNumberOfDecodes() const noexcept
+        {
+            return this->_numberOfDecodes;
+        }
+
+    private:
+        struct PendingRequest
+        {
+            std::string Path;
+            std::shared_future<DecodedImagePtr> Result;
+            bool QueueUpload {false};
+        };
+
+        struct CacheEntry
+        {
+            DecodedImagePtr Image;
+            std::list<std::string>::iterator Position;
+        };
+
+        std::shared_ptr<concurrency::ThreadPool> _threadPool;
+        DecodeFunction _decode;
+
+        // in request order
+        std::vector<PendingRequest> _requests;
+
+        // the most recently used image is at the front
+        std::list<std::string> _recentlyUsed;
+        std::unordered_map<std::string, CacheEntry> _cache;
+
+        uint64_t _maxCacheSizeInBytes {0u};
+        uint64_t _cacheSizeInBytes {0u};
+
+        uint64_t _numberOfDecodes {0u};
+
+        [[nodiscard]]
+        DecodedImagePtr GetCached(const std::string& path) noexcept;
+
+        void AddToCache(const std::string& path, const DecodedImagePtr& image) noexcept;
+
+        [[nodiscard]]
+        DecodedImagePtr GetResult(std::shared_future<DecodedImagePtr>& result) const noexcept;
+    };
+}
+
+#endif
@@ -0,0 +1,94 @@
+#include "tile_mesh_builder.h"
+
+namespace projectfarm::shared::graphics
+{
+    void TileMeshData::Clear() noexcept
+    {
+        this->Positions.clear();
+        this->TextureCoordinates.clear();
+        this->Indexes.clear();
+    }
+
+    void TileMeshData::AddTile(const TileRect& source, uint32_t textureWidth, uint32_t textureHeight,
+                               const TileRect& destination, uint32_t areaWidth, uint32_t areaHeight) noexcept
+    {
+        // -1  1    1  1
+        // -1 -1    1 -1
+        auto leftX = destination.X / static_cast<float>(areaWidth) * 2.0f - 1.0f;
+        auto rightX = (destination.X + destination.Width) / static_cast<float>(areaWidth) * 2.0f - 1.0f;
+        auto topY = 1.0f - destination.Y / static_cast<float>(areaHeight) * 2.0f;
+        auto bottomY = 1.0f - (destination.Y + destination.Height) / static_cast<float>(areaHeight) * 2.0f;
+
+        auto textureLeftX = source.X / static_cast<float>(textureWidth);
+        auto textureRightX = (source.X + source.Width) / static_cast<float>(textureWidth);
+        auto textureTopY = source.Y / static_cast<float>(textureHeight);
+        auto textureBottomY = (source.Y + source.Height) / static_cast<float>(textureHeight);
+
+        auto firstVertex = static_cast<uint32_t>(this->Positions.size() / 2u);
+
+        // top left, bottom left, top right, bottom right
+        this->Positions.insert(this->Positions.end(),
+                               {
+                                   leftX, topY,
+                                   leftX, bottomY,
+                                   rightX, topY,
+                                   rightX, bottomY,
+                               });
+
+        this->TextureCoordinates.insert(this->TextureCoordinates.end(),
+                                        {
+                                            textureLeftX, textureTopY,
+                                            textureLeftX, textureBottomY,
+                                            textureRightX, textureTopY,
+                                            textureRightX, textureBottomY,
+                                        });
+
+        // both triangles are counter clockwise
+        this->Indexes.insert(this->Indexes.end(),
+                             {
+                                 firstVertex, firstVertex + 1u, firstVertex + 2u,
+                                 firstVertex + 2u, firstVertex + 1u, firstVertex + 3u,
+                             });
+    }
+
+    void TileChunkMeshBuilder::Begin(uint32_t widthInPixels, uint32_t heightInPixels) noexcept
+    {
+        for (auto i = 0u; i < this->_numberOfMeshes; ++i)
+        {
+            this->_meshes[i].Data.Clear();
+        }
+
+        this->_numberOfMeshes = 0u;
+        this->_numberOfTiles = 0u;
+
+        this->_widthInPixels = widthInPixels;
+        this->_heightInPixels = heightInPixels;
+    }
+
+    void TileChunkMeshBuilder::AddTile(uint32_t textureKey, uint32_t textureWidth, uint32_t textureHeight,
+                                       const TileRect& source, const TileRect& destination) noexcept
+    {
+        // a chunk only has a few textures, so a search is quicker than a map
+        auto meshIndex = 0u;
+        while (meshIndex < this->_numberOfMeshes && this->_meshes[meshIndex].TextureKey != textureKey)
+        {
+            ++meshIndex;
+        }
+
+        if (meshIndex == this->_numberOfMeshes)
+        {
+            if (this->_numberOfMeshes == this->_meshes.size())
+            {
+                this->_meshes.emplace_back();
+            }
+
+            this->_meshes[meshIndex].TextureKey = textureKey;
+            ++this->_numberOfMeshes;
+        }
+
+        this->_meshes[meshIndex].Data.AddTile(source, textureWidth, textureHeight,
+                                              destination, this->_widthInPixels, this->_heightInPixels);
+
+        ++this->_numberOfTiles;
+    }
+}
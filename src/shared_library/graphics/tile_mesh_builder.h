@@ -0,0 +1,110 @@
+#ifndef PROJECTFARM_TILE_MESH_BUILDER_H
+#define PROJECTFARM_TILE_MESH_BUILDER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace projectfarm::shared::graphics
+{
+    // in pixels
+    struct TileRect
+    {
+        float X {0.0f};
+        float Y {0.0f};
+        float Width {0.0f};
+        float Height {0.0f};
+    };
+
+    // Tiles from a single texture in the layout the client's tile shaders take, which is
+    // two floats of position in normalized device coordinates and two of texture coordinates
+    // for each vertex. Each tile is four vertices and six indexes.
+    struct TileMeshData
+    {
+        static constexpr uint32_t VerticesPerTile {4u};
+        static constexpr uint32_t IndexesPerTile {6u};
+
+        std::vector<float> Positions;
+        std::vector<float> TextureCoordinates;
+        std::vector<uint32_t> Indexes;
+
+        // keeps the memory to be reused
+        void Clear() noexcept;
+
+        [[nodiscard]]
+        bool IsEmpty() const noexcept
+        {
+            return this->Indexes.empty();
+        }
+
+        [[nodiscard]]
+        uint32_t GetNumberOfTiles() const noexcept
+        {
+            return static_cast<uint32_t>(this->Indexes.size() / IndexesPerTile);
+        }
+
+        // `destination` is in an area of `areaWidth` by `areaHeight` pixels, which
+        // is mapped to the whole of normalized device coordinates
+        void AddTile(const TileRect& source, uint32_t textureWidth, uint32_t textureHeight,
+                     const TileRect& destination, uint32_t areaWidth, uint32_t areaHeight) noexcept;
+    };
+
+    // Builds the meshes of one chunk of a tile map layer, with a mesh for each texture.
+    // Positions are relative to the chunk, so the mesh only has to be rebuilt when
+    // its tiles change, not when the camera moves.
+    class TileChunkMeshBuilder final
+    {
+    public:
+        TileChunkMeshBuilder() = default;
+        ~TileChunkMeshBuilder() = default;
+
+        // clears the previous chunk's meshes, keeping their memory
+        void Begin(uint32_t widthInPixels, uint32_t heightInPixels) noexcept;
+
+        // `textureKey` is chosen by the caller, and tiles with the same key share a mesh.
+        // `destination` is from the chunk's top left.
+        void AddTile(uint32_t textureKey, uint32_t textureWidth, uint32_t textureHeight,
+                     const TileRect& source, const TileRect& destination) noexcept;
+
+        [[nodiscard]]
+        size_t GetNumberOfMeshes() const noexcept
+        {
+            return this->_numberOfMeshes;
+        }
+
+        [[nodiscard]]
+        uint32_t GetTextureKey(size_t meshIndex) const noexcept
+        {
+            return this->_meshes[meshIndex].TextureKey;
+        }
+
+        [[nodiscard]]
+        const TileMeshData& GetMesh(size_t meshIndex) const noexcept
+        {
+            return this->_meshes[meshIndex].Data;
+        }
+
+        [[nodiscard]]
+        uint32_t GetNumberOfTiles() const noexcept
+        {
+            return this->_numberOfTiles;
+        }
+
+    private:
+        struct Mesh
+        {
+            uint32_t TextureKey {0u};
+            TileMeshData Data;
+        };
+
+        // only the first `_numberOfMeshes` are in use, the rest are kept for their memory
+        std::vector<Mesh> _meshes;
+        size_t _numberOfMeshes {0u};
+
+        uint32_t _widthInPixels {0u};
+        uint32_t _heightInPixels {0u};
+        uint32_t _numberOfTiles {0u};
+    };
+}
+
+#endif
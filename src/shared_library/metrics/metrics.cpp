@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <cmath>
+
+#include "metrics.h"
+
+namespace projectfarm::shared::metrics
+{
+    namespace
+    {
+        // the number of bits needed to hold `value`
+        uint32_t GetBitWidth(uint64_t value) noexcept
+        {
+            auto width = 0u;
+
+            for (auto shift : {32u, 16u, 8u, 4u, 2u, 1u})
+            {
+                if (value >> shift)
+                {
+                    value >>= shift;
+                    width += shift;
+                }
+            }
+
+            return value > 0u ? width + 1u : width;
+        }
+    }
+
+    void Histogram::Record(uint64_t value) noexcept
+    {
+        this->_buckets[Histogram::GetBucketIndex(value)].fetch_add(1u, std::memory_order_relaxed);
+
+        this->_count.fetch_add(1u, std::memory_order_relaxed);
+        this->_sum.fetch_add(value, std::memory_order_relaxed);
+
+        auto max = this->_max.load(std::memory_order_relaxed);
+        while (value > max && !this->_max.compare_exchange_weak(max, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    uint64_t Histogram::GetValueAtPercentile(double percentile) const noexcept
+    {
+        auto count = this->GetCount();
+        if (count == 0u)
+        {
+            return 0u;
+        }
+
+        percentile = std::clamp(percentile, 0.0, 100.0);
+
+        auto rank = std::max(static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count))),
+                             uint64_t {1u});
+
+        uint64_t total {0u};
+
+        for (auto i = 0u; i < NumberOfBuckets; ++i)
+        {
+            total += this->_buckets[i].load(std::memory_order_relaxed);
+
+            if (total >= rank)
+            {
+                return std::min(Histogram::GetBucketUpperBound(i), this->GetMax());
+            }
+        }
+
+        // values were recorded while we were counting
+        return this->GetMax();
+    }
+
+    uint32_t Histogram::GetBucketIndex(uint64_t value) noexcept
+    {
+        if (value < SubBucketCount)
+        {
+            return static_cast<uint32_t>(value);
+        }
+
+        auto shift = GetBitWidth(value) - SubBucketBits - 1u;
+        auto subBucket = static_cast<uint32_t>(value >> shift) - SubBucketCount;
+
+        return (shift + 1u) * SubBucketCount + subBucket;
+    }
+
+    uint64_t Histogram::GetBucketUpperBound(uint32_t index) noexcept
+    {
+        if (index < SubBucketCount)
+        {
+            return index;
+        }
+
+        auto shift = index / SubBucketCount - 1u;
+        auto subBucket = static_cast<uint64_t>(SubBucketCount + index % SubBucketCount);
+
+        // the last bucket's bound wraps around to the largest value
+        return ((subBucket + 1u) << shift) - 1u;
+    }
+}
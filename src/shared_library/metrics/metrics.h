@@ -0,0 +1,155 @@
+#ifndef PROJECTFARM_METRICS_H
+#define PROJECTFARM_METRICS_H
+
+#include <cstdint>
+#include <atomic>
+#include <array>
+#include <chrono>
+
+namespace projectfarm::shared::metrics
+{
+    // Each metric is updated with relaxed atomics, so they can be updated from any
+    // thread without a lock. They are aligned so that metrics updated by different
+    // threads don't share a cache line.
+
+    class alignas(64) Counter final
+    {
+    public:
+        Counter() = default;
+        ~Counter() = default;
+
+        Counter(const Counter&) = delete;
+        Counter(Counter&&) = delete;
+
+        void Increment(uint64_t amount = 1u) noexcept
+        {
+            this->_value.fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]]
+        uint64_t GetValue() const noexcept
+        {
+            return this->_value.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<uint64_t> _value {0u};
+    };
+
+    class alignas(64) Gauge final
+    {
+    public:
+        Gauge() = default;
+        ~Gauge() = default;
+
+        Gauge(const Gauge&) = delete;
+        Gauge(Gauge&&) = delete;
+
+        void Set(int64_t value) noexcept
+        {
+            this->_value.store(value, std::memory_order_relaxed);
+        }
+
+        void Increment(int64_t amount = 1) noexcept
+        {
+            this->_value.fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        void Decrement(int64_t amount = 1) noexcept
+        {
+            this->_value.fetch_sub(amount, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]]
+        int64_t GetValue() const noexcept
+        {
+            return this->_value.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<int64_t> _value {0};
+    };
+
+    // Counts values into log-linear buckets, in the style of an HDR histogram. Values
+    // below `SubBucketCount` have their own bucket, and each power of two above that is
+    // split into `SubBucketCount` buckets, so a percentile is within ~6% of the
+    // recorded value across the whole range of `uint64_t`.
+    class alignas(64) Histogram final
+    {
+    public:
+        static constexpr uint32_t SubBucketBits {4u};
+        static constexpr uint32_t SubBucketCount {1u << SubBucketBits};
+        static constexpr uint32_t NumberOfBuckets {(65u - SubBucketBits) * SubBucketCount};
+
+        Histogram() = default;
+        ~Histogram() = default;
+
+        Histogram(const Histogram&) = delete;
+        Histogram(Histogram&&) = delete;
+
+        void Record(uint64_t value) noexcept;
+
+        [[nodiscard]]
+        uint64_t GetCount() const noexcept
+        {
+            return this->_count.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]]
+        uint64_t GetSum() const noexcept
+        {
+            return this->_sum.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]]
+        uint64_t GetMax() const noexcept
+        {
+            return this->_max.load(std::memory_order_relaxed);
+        }
+
+        // `percentile` is from 0 to 100. The value is the top of the bucket it falls
+        // in, so is never less than the recorded value
+        [[nodiscard]]
+        uint64_t GetValueAtPercentile(double percentile) const noexcept;
+
+        [[nodiscard]]
+        static uint32_t GetBucketIndex(uint64_t value) noexcept;
+
+        // the largest value counted in the bucket
+        [[nodiscard]]
+        static uint64_t GetBucketUpperBound(uint32_t index) noexcept;
+
+    private:
+        std::atomic<uint64_t> _count {0u};
+        std::atomic<uint64_t> _sum {0u};
+        std::atomic<uint64_t> _max {0u};
+
+        std::array<std::atomic<uint64_t>, NumberOfBuckets> _buckets {};
+    };
+
+    // records how long it is alive for into a histogram, in microseconds
+    class ScopedTimer final
+    {
+    public:
+        explicit ScopedTimer(Histogram& histogram) noexcept
+            : _histogram {histogram},
+              _startTime {std::chrono::steady_clock::now()}
+        {
+        }
+
+        ~ScopedTimer()
+        {
+            this->_histogram.Record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - this->_startTime).count()));
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer(ScopedTimer&&) = delete;
+
+    private:
+        Histogram& _histogram;
+        std::chrono::steady_clock::time_point _startTime;
+    };
+}
+
+#endif
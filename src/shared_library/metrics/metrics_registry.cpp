@@ -0,0 +1,306 @@
+#include <algorithm>
+#include <cctype>
+#include <array>
+#include <sstream>
+#include <fstream>
+
+#include "metrics_registry.h"
+#include "api/logging/logging.h"
+
+using namespace std::literals;
+
+namespace projectfarm::shared::metrics
+{
+    namespace
+    {
+        constexpr std::array<std::pair<const char*, double>, 4> SummaryQuantiles
+        {{
+            {"0.5", 50.0},
+            {"0.9", 90.0},
+            {"0.99", 99.0},
+            {"0.999", 99.9},
+        }};
+
+        bool IsValidName(const std::string& name) noexcept
+        {
+            if (name.empty() || std::isdigit(static_cast<unsigned char>(name.front())))
+            {
+                return false;
+            }
+
+            return std::all_of(name.begin(), name.end(), [](char c)
+            {
+                return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == ':';
+            });
+        }
+
+        std::string Escape(const std::string& text, bool escapeQuotes) noexcept
+        {
+            std::string escaped;
+            escaped.reserve(text.size());
+
+            for (auto c : text)
+            {
+                if (c == '\\')
+                {
+                    escaped += "\\\\";
+                }
+                else if (c == '\n')
+                {
+                    escaped += "\\n";
+                }
+                else if (c == '"' && escapeQuotes)
+                {
+                    escaped += "\\\"";
+                }
+                else
+                {
+                    escaped += c;
+                }
+            }
+
+            return escaped;
+        }
+
+        std::string FormatLabels(const MetricLabels& labels) noexcept
+        {
+            std::string formatted;
+
+            for (const auto& [name, value] : labels)
+            {
+                if (!formatted.empty())
+                {
+                    formatted += ',';
+                }
+
+                formatted += name + "=\"" + Escape(value, true) + "\"";
+            }
+
+            return formatted;
+        }
+
+        // `name{labels,extraLabel}`, without the braces if there are no labels
+        void WriteSeries(std::ostream& stream, const std::string& name, const std::string& labels,
+                         const std::string& extraLabel = {}) noexcept
+        {
+            stream << name;
+
+            if (labels.empty() && extraLabel.empty())
+            {
+                return;
+            }
+
+            stream << '{' << labels;
+
+            if (!labels.empty() && !extraLabel.empty())
+            {
+                stream << ',';
+            }
+
+            stream << extraLabel << '}';
+        }
+
+        const char* GetTypeName(MetricTypes type) noexcept
+        {
+            switch (type)
+            {
+                case MetricTypes::Counter:
+                {
+                    return "counter";
+                }
+                case MetricTypes::Gauge:
+                {
+                    return "gauge";
+                }
+                case MetricTypes::Histogram:
+                {
+                    return "summary";
+                }
+            }
+
+            return "untyped";
+        }
+    }
+
+    MetricsRegistry& MetricsRegistry::GetGlobal() noexcept
+    {
+        static MetricsRegistry registry;
+        return registry;
+    }
+
+    Counter& MetricsRegistry::GetCounter(const std::string& name, const std::string& help,
+                                         const MetricLabels& labels) noexcept
+    {
+        return *this->GetMetric(MetricTypes::Counter, name, help, labels).CounterValue;
+    }
+
+    Gauge& MetricsRegistry::GetGauge(const std::string& name, const std::string& help,
+                                     const MetricLabels& labels) noexcept
+    {
+        return *this->GetMetric(MetricTypes::Gauge, name, help, labels).GaugeValue;
+    }
+
+    Histogram& MetricsRegistry::GetHistogram(const std::string& name, const std::string& help,
+                                             const MetricLabels& labels) noexcept
+    {
+        return *this->GetMetric(MetricTypes::Histogram, name, help, labels).HistogramValue;
+    }
+
+    MetricsRegistry::Metric& MetricsRegistry::GetMetric(MetricTypes type, const std::string& name,
+                                                        const std::string& help,
+                                                        const MetricLabels& labels) noexcept
+    {
+        auto createMetric = [type]()
+        {
+            Metric metric;
+
+            switch (type)
+            {
+                case MetricTypes::Counter:
+                {
+                    metric.CounterValue = std::make_unique<Counter>();
+                    break;
+                }
+                case MetricTypes::Gauge:
+                {
+                    metric.GaugeValue = std::make_unique<Gauge>();
+                    break;
+                }
+                case MetricTypes::Histogram:
+                {
+                    metric.HistogramValue = std::make_unique<Histogram>();
+                    break;
+                }
+            }
+
+            return metric;
+        };
+
+        auto isValid = IsValidName(name) &&
+                       std::all_of(labels.begin(), labels.end(), [](const auto& label)
+                       {
+                           return IsValidName(label.first);
+                       });
+
+        std::scoped_lock lock(this->_mutex);
+
+        if (!isValid)
+        {
+            api::logging::Log("Invalid metric name or label: " + name, api::logging::LogLevels::Warning);
+            return this->_unregisteredMetrics.emplace_back(createMetric());
+        }
+
+        auto [familyIter, isNewFamily] = this->_families.try_emplace(name);
+        auto& family = familyIter->second;
+
+        if (isNewFamily)
+        {
+            family.Type = type;
+            family.Help = help;
+        }
+        else if (family.Type != type)
+        {
+            api::logging::Log("Metric is already registered with a different type: " + name,
+                              api::logging::LogLevels::Warning);
+            return this->_unregisteredMetrics.emplace_back(createMetric());
+        }
+
+        auto [metricIter, isNewMetric] = family.Metrics.try_emplace(FormatLabels(labels));
+        if (isNewMetric)
+        {
+            metricIter->second = createMetric();
+        }
+
+        return metricIter->second;
+    }
+
+    void MetricsRegistry::WritePrometheusText(std::ostream& stream) const noexcept
+    {
+        std::scoped_lock lock(this->_mutex);
+
+        for (const auto& [name, family] : this->_families)
+        {
+            stream << "# HELP " << name << ' ' << Escape(family.Help, false) << '\n';
+            stream << "# TYPE " << name << ' ' << GetTypeName(family.Type) << '\n';
+
+            for (const auto& [labels, metric] : family.Metrics)
+            {
+                switch (family.Type)
+                {
+                    case MetricTypes::Counter:
+                    {
+                        WriteSeries(stream, name, labels);
+                        stream << ' ' << metric.CounterValue->GetValue() << '\n';
+                        break;
+                    }
+                    case MetricTypes::Gauge:
+                    {
+                        WriteSeries(stream, name, labels);
+                        stream << ' ' << metric.GaugeValue->GetValue() << '\n';
+                        break;
+                    }
+                    case MetricTypes::Histogram:
+                    {
+                        const auto& histogram = *metric.HistogramValue;
+
+                        for (const auto& [quantile, percentile] : SummaryQuantiles)
+                        {
+                            WriteSeries(stream, name, labels, "quantile=\""s + quantile + "\"");
+                            stream << ' ' << histogram.GetValueAtPercentile(percentile) << '\n';
+                        }
+
+                        WriteSeries(stream, name + "_sum", labels);
+                        stream << ' ' << histogram.GetSum() << '\n';
+
+                        WriteSeries(stream, name + "_count", labels);
+                        stream << ' ' << histogram.GetCount() << '\n';
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    std::string MetricsRegistry::GetPrometheusText() const noexcept
+    {
+        std::stringstream ss;
+        this->WritePrometheusText(ss);
+
+        return ss.str();
+    }
+
+    bool MetricsRegistry::WriteToFile(const std::filesystem::path& filePath) const noexcept
+    {
+        auto tempFilePath = filePath;
+        tempFilePath += ".tmp";
+
+        {
+            std::ofstream fp(tempFilePath, std::ios::trunc);
+            if (!fp.is_open())
+            {
+                api::logging::Log("Failed to open metrics file: " + tempFilePath.u8string());
+                return false;
+            }
+
+            this->WritePrometheusText(fp);
+
+            if (!fp.good())
+            {
+                api::logging::Log("Failed to write metrics file: " + tempFilePath.u8string());
+                return false;
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tempFilePath, filePath, ec);
+
+        if (ec)
+        {
+            api::logging::Log("Failed to replace metrics file: " + filePath.u8string() + " with error: " +
+                              ec.message());
+            return false;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,93 @@
+#ifndef PROJECTFARM_METRICS_REGISTRY_H
+#define PROJECTFARM_METRICS_REGISTRY_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <filesystem>
+
+#include "metrics.h"
+
+namespace projectfarm::shared::metrics
+{
+    using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+    enum class MetricTypes
+    {
+        Counter,
+        Gauge,
+        Histogram,
+    };
+
+    // Owns the metrics, by name and labels, and writes them in the Prometheus text
+    // format. Getting a metric takes a lock, so callers keep the reference they are
+    // given, which is valid for as long as the registry is.
+    class MetricsRegistry final
+    {
+    public:
+        MetricsRegistry() = default;
+        ~MetricsRegistry() = default;
+
+        MetricsRegistry(const MetricsRegistry&) = delete;
+        MetricsRegistry(MetricsRegistry&&) = delete;
+
+        // the registry the game's modules record into
+        [[nodiscard]]
+        static MetricsRegistry& GetGlobal() noexcept;
+
+        [[nodiscard]]
+        Counter& GetCounter(const std::string& name, const std::string& help,
+                            const MetricLabels& labels = {}) noexcept;
+
+        [[nodiscard]]
+        Gauge& GetGauge(const std::string& name, const std::string& help,
+                        const MetricLabels& labels = {}) noexcept;
+
+        // written as a summary with the 50th, 90th, 99th and 99.9th percentiles
+        [[nodiscard]]
+        Histogram& GetHistogram(const std::string& name, const std::string& help,
+                                const MetricLabels& labels = {}) noexcept;
+
+        void WritePrometheusText(std::ostream& stream) const noexcept;
+
+        [[nodiscard]]
+        std::string GetPrometheusText() const noexcept;
+
+        // written to a temporary file first, so a reader never sees a partial file
+        [[nodiscard]]
+        bool WriteToFile(const std::filesystem::path& filePath) const noexcept;
+
+    private:
+        struct Metric
+        {
+            std::unique_ptr<metrics::Counter> CounterValue;
+            std::unique_ptr<metrics::Gauge> GaugeValue;
+            std::unique_ptr<metrics::Histogram> HistogramValue;
+        };
+
+        struct MetricFamily
+        {
+            MetricTypes Type {MetricTypes::Counter};
+            std::string Help;
+
+            // by the formatted labels, such as `type="2"`
+            std::map<std::string, Metric> Metrics;
+        };
+
+        mutable std::mutex _mutex;
+
+        std::map<std::string, MetricFamily> _families;
+
+        // given out when a name is reused with a different type, so they aren't written
+        std::vector<Metric> _unregisteredMetrics;
+
+        [[nodiscard]]
+        Metric& GetMetric(MetricTypes type, const std::string& name, const std::string& help,
+                          const MetricLabels& labels) noexcept;
+    };
+}
+
+#endif
@@ -0,0 +1,248 @@
+#include <chrono>
+#include <string>
+
+#include "metrics_server.h"
+#include "platform/platform_id.h"
+#include "api/logging/logging.h"
+
+#if !defined(IS_WINDOWS)
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+namespace projectfarm::shared::metrics
+{
+    namespace
+    {
+        constexpr int PollTimeoutInMilliseconds {100};
+        constexpr uint32_t MaxRequestSize {8192u};
+        constexpr int ReceiveTimeoutInSeconds {1};
+
+        std::string CreateResponse(const std::string& status, const std::string& body) noexcept
+        {
+            return "HTTP/1.1 " + status + "\r\n"
+                   "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                   "Content-Length: " + std::to_string(body.size()) + "\r\n"
+                   "Connection: close\r\n"
+                   "\r\n" + body;
+        }
+    }
+
+    bool MetricsServer::Start() noexcept
+    {
+        if (this->_runThread)
+        {
+            return true;
+        }
+
+        if (this->_isListenerEnabled && !this->OpenListenSocket())
+        {
+            api::logging::Log("Failed to open metrics listener.");
+            return false;
+        }
+
+        this->_runThread = true;
+        this->_thread = std::thread(&MetricsServer::ThreadWorker, this);
+
+        if (this->_isListenerEnabled)
+        {
+            api::logging::Log("Serving metrics at http://127.0.0.1:" + std::to_string(this->_port) + "/metrics");
+        }
+
+        return true;
+    }
+
+    void MetricsServer::Stop() noexcept
+    {
+        if (!this->_thread.joinable())
+        {
+            return;
+        }
+
+        this->_runThread = false;
+        this->_thread.join();
+
+        this->CloseListenSocket();
+
+        this->DumpToFile();
+    }
+
+    void MetricsServer::ThreadWorker() noexcept
+    {
+        auto lastDumpTime = std::chrono::steady_clock::now();
+
+        while (this->_runThread)
+        {
+#if !defined(IS_WINDOWS)
+            if (this->_listenSocket >= 0)
+            {
+                pollfd pollFd {};
+                pollFd.fd = this->_listenSocket;
+                pollFd.events = POLLIN;
+
+                if (::poll(&pollFd, 1, PollTimeoutInMilliseconds) > 0 && (pollFd.revents & POLLIN))
+                {
+                    if (auto socket = ::accept(this->_listenSocket, nullptr, nullptr); socket >= 0)
+                    {
+                        this->HandleConnection(socket);
+                    }
+                }
+            }
+            else
+#endif
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(PollTimeoutInMilliseconds));
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            if (now - lastDumpTime >= std::chrono::milliseconds(this->_dumpIntervalInMilliseconds))
+            {
+                lastDumpTime = now;
+                this->DumpToFile();
+            }
+        }
+    }
+
+    void MetricsServer::DumpToFile() const noexcept
+    {
+        if (this->_dumpFilePath.empty())
+        {
+            return;
+        }
+
+        if (!this->_registry.WriteToFile(this->_dumpFilePath))
+        {
+            api::logging::Log("Failed to dump metrics to: " + this->_dumpFilePath.u8string());
+        }
+    }
+
+#if defined(IS_WINDOWS)
+    bool MetricsServer::OpenListenSocket() noexcept
+    {
+        // only the file dump is supported
+        api::logging::Log("The metrics listener is not supported on this platform.");
+        return false;
+    }
+
+    void MetricsServer::CloseListenSocket() noexcept
+    {
+    }
+
+    void MetricsServer::HandleConnection(int) noexcept
+    {
+    }
+#else
+    bool MetricsServer::OpenListenSocket() noexcept
+    {
+        this->_listenSocket = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (this->_listenSocket < 0)
+        {
+            api::logging::Log("Failed to create metrics socket.");
+            return false;
+        }
+
+        int reuseAddress {1};
+        ::setsockopt(this->_listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+
+        // loopback only, the metrics aren't for the outside world
+        sockaddr_in address {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(this->_port);
+
+        if (::bind(this->_listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+            ::listen(this->_listenSocket, SOMAXCONN) != 0)
+        {
+            api::logging::Log("Failed to listen for metrics on port: " + std::to_string(this->_port));
+            this->CloseListenSocket();
+            return false;
+        }
+
+        socklen_t addressSize = sizeof(address);
+        if (::getsockname(this->_listenSocket, reinterpret_cast<sockaddr*>(&address), &addressSize) == 0)
+        {
+            this->_port = ntohs(address.sin_port);
+        }
+
+        return true;
+    }
+
+    void MetricsServer::CloseListenSocket() noexcept
+    {
+        if (this->_listenSocket >= 0)
+        {
+            ::close(this->_listenSocket);
+            this->_listenSocket = -1;
+        }
+    }
+
+    void MetricsServer::HandleConnection(int socket) noexcept
+    {
+        timeval timeout {};
+        timeout.tv_sec = ReceiveTimeoutInSeconds;
+        ::setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        ::setsockopt(socket, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+#if defined(SO_NOSIGPIPE)
+        int noSigPipe {1};
+        ::setsockopt(socket, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+
+        // we only need the request line, but read the headers so the client sees a clean close
+        std::string request;
+        char buffer[1024];
+
+        while (request.size() < MaxRequestSize && request.find("\r\n\r\n") == std::string::npos)
+        {
+            auto received = ::recv(socket, buffer, sizeof(buffer), 0);
+            if (received <= 0)
+            {
+                break;
+            }
+
+            request.append(buffer, static_cast<size_t>(received));
+        }
+
+        ++this->_numberOfRequests;
+
+        std::string response;
+
+        auto requestLine = request.substr(0, request.find("\r\n"));
+        if (requestLine.rfind("GET /metrics ", 0) == 0)
+        {
+            response = CreateResponse("200 OK", this->_registry.GetPrometheusText());
+        }
+        else if (requestLine.rfind("GET ", 0) == 0)
+        {
+            response = CreateResponse("404 Not Found", "Not found.\n");
+        }
+        else
+        {
+            response = CreateResponse("405 Method Not Allowed", "Only GET is supported.\n");
+        }
+
+#if defined(MSG_NOSIGNAL)
+        constexpr int sendFlags {MSG_NOSIGNAL};
+#else
+        constexpr int sendFlags {0};
+#endif
+
+        size_t sent {0u};
+        while (sent < response.size())
+        {
+            auto result = ::send(socket, response.data() + sent, response.size() - sent, sendFlags);
+            if (result <= 0)
+            {
+                break;
+            }
+
+            sent += static_cast<size_t>(result);
+        }
+
+        ::close(socket);
+    }
+#endif
+}
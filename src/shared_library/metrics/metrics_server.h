@@ -0,0 +1,93 @@
+#ifndef PROJECTFARM_METRICS_SERVER_H
+#define PROJECTFARM_METRICS_SERVER_H
+
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <filesystem>
+
+#include "metrics_registry.h"
+
+namespace projectfarm::shared::metrics
+{
+    // Serves a registry's metrics at `GET /metrics` on a loopback-only HTTP listener,
+    // for a Prometheus scraper on the same host, and/or dumps them to a file every so
+    // often. Both happen on the server's own thread.
+    class MetricsServer final
+    {
+    public:
+        static constexpr uint32_t DefaultDumpIntervalInMilliseconds {10000u};
+
+        explicit MetricsServer(const MetricsRegistry& registry)
+            : _registry {registry}
+        {
+        }
+
+        ~MetricsServer()
+        {
+            this->Stop();
+        }
+
+        MetricsServer(const MetricsServer&) = delete;
+        MetricsServer(MetricsServer&&) = delete;
+
+        // 0 takes any free port, which `GetPort` returns once started
+        void SetListenPort(uint16_t port) noexcept
+        {
+            this->_isListenerEnabled = true;
+            this->_port = port;
+        }
+
+        void SetDumpFile(const std::filesystem::path& filePath,
+                         uint32_t intervalInMilliseconds = DefaultDumpIntervalInMilliseconds) noexcept
+        {
+            this->_dumpFilePath = filePath;
+            this->_dumpIntervalInMilliseconds = intervalInMilliseconds;
+        }
+
+        [[nodiscard]]
+        bool Start() noexcept;
+
+        // dumps the metrics a last time before stopping
+        void Stop() noexcept;
+
+        [[nodiscard]]
+        uint16_t GetPort() const noexcept
+        {
+            return this->_port;
+        }
+
+        [[nodiscard]]
+        uint64_t GetNumberOfRequests() const noexcept
+        {
+            return this->_numberOfRequests;
+        }
+
+    private:
+        const MetricsRegistry& _registry;
+
+        bool _isListenerEnabled {false};
+        uint16_t _port {0u};
+        int _listenSocket {-1};
+
+        std::filesystem::path _dumpFilePath;
+        uint32_t _dumpIntervalInMilliseconds {DefaultDumpIntervalInMilliseconds};
+
+        std::atomic_bool _runThread {false};
+        std::thread _thread;
+
+        std::atomic<uint64_t> _numberOfRequests {0u};
+
+        void ThreadWorker() noexcept;
+
+        [[nodiscard]]
+        bool OpenListenSocket() noexcept;
+        void CloseListenSocket() noexcept;
+
+        void HandleConnection(int socket) noexcept;
+
+        void DumpToFile() const noexcept;
+    };
+}
+
+#endif
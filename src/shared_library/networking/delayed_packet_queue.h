@@ -0,0 +1,83 @@
+#ifndef PROJECTFARM_DELAYED_PACKET_QUEUE_H
+#define PROJECTFARM_DELAYED_PACKET_QUEUE_H
+
+#include <cstdint>
+#include <list>
+#include <utility>
+#include <algorithm>
+
+namespace projectfarm::shared::networking
+{
+    // Packets waiting until they are due. The current time is passed in rather than
+    // read, so a time earlier than the last one only means nothing is due yet.
+    template <typename T>
+    class DelayedPacketQueue final
+    {
+    public:
+        DelayedPacketQueue() = default;
+        ~DelayedPacketQueue() = default;
+
+        DelayedPacketQueue(const DelayedPacketQueue&) = delete;
+        DelayedPacketQueue(DelayedPacketQueue&&) = delete;
+
+        void Add(T packet, uint64_t sendTimeInMilliseconds) noexcept
+        {
+            this->_packets.push_back({ std::move(packet), sendTimeInMilliseconds });
+        }
+
+        [[nodiscard]]
+        bool IsEmpty() const noexcept
+        {
+            return this->_packets.empty();
+        }
+
+        [[nodiscard]]
+        size_t GetSize() const noexcept
+        {
+            return this->_packets.size();
+        }
+
+        // 0 if a packet is already due
+        [[nodiscard]]
+        uint64_t GetMillisecondsUntilNext(uint64_t currentTime) const noexcept
+        {
+            auto nextSendTime = UINT64_MAX;
+            for (const auto& packet : this->_packets)
+            {
+                nextSendTime = std::min(nextSendTime, packet.SendTimeInMilliseconds);
+            }
+
+            return nextSendTime <= currentTime ? 0u : nextSendTime - currentTime;
+        }
+
+        // `onDue` is called with each packet due by `currentTime`, in the order they
+        // were added, and they are removed
+        template <typename F>
+        void TakeDue(uint64_t currentTime, F&& onDue) noexcept
+        {
+            for (auto packetIter = this->_packets.begin(); packetIter != this->_packets.end();)
+            {
+                if (packetIter->SendTimeInMilliseconds <= currentTime)
+                {
+                    onDue(std::move(packetIter->Packet));
+
+                    packetIter = this->_packets.erase(packetIter);
+                    continue;
+                }
+
+                ++packetIter;
+            }
+        }
+
+    private:
+        struct DelayedPacket
+        {
+            T Packet;
+            uint64_t SendTimeInMilliseconds {0u};
+        };
+
+        std::list<DelayedPacket> _packets;
+    };
+}
+
+#endif
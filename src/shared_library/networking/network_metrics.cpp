@@ -0,0 +1,115 @@
+#include <array>
+#include <string>
+
+#include "network_metrics.h"
+#include "metrics/metrics_registry.h"
+
+namespace projectfarm::shared::networking
+{
+    namespace
+    {
+        // the last slot is for types we don't know about, such as from a corrupt packet
+        constexpr uint32_t NumberOfPacketTypes {static_cast<uint32_t>(PacketTypes::ServerClientPong) + 2u};
+
+        struct DirectionMetrics
+        {
+            std::array<metrics::Counter*, NumberOfPacketTypes> Packets {};
+            std::array<metrics::Counter*, NumberOfPacketTypes> Bytes {};
+        };
+
+        DirectionMetrics CreateDirectionMetrics(const std::string& direction) noexcept
+        {
+            auto& registry = metrics::MetricsRegistry::GetGlobal();
+
+            DirectionMetrics directionMetrics;
+
+            for (auto i = 0u; i < NumberOfPacketTypes; ++i)
+            {
+                auto type = i + 1u < NumberOfPacketTypes ? std::to_string(i) : "unknown";
+
+                directionMetrics.Packets[i] = &registry.GetCounter("projectfarm_packets_" + direction + "_total",
+                                                                   "Packets " + direction + ", by packet type.",
+                                                                   {{"type", type}});
+                directionMetrics.Bytes[i] = &registry.GetCounter("projectfarm_packet_bytes_" + direction + "_total",
+                                                                 "Packet bytes " + direction + ", by packet type.",
+                                                                 {{"type", type}});
+            }
+
+            return directionMetrics;
+        }
+
+        uint32_t GetIndex(PacketTypes packetType) noexcept
+        {
+            auto index = static_cast<uint32_t>(packetType);
+
+            return index + 1u < NumberOfPacketTypes ? index : NumberOfPacketTypes - 1u;
+        }
+
+        const DirectionMetrics& GetSentMetrics() noexcept
+        {
+            static const auto sentMetrics = CreateDirectionMetrics("sent");
+            return sentMetrics;
+        }
+
+        const DirectionMetrics& GetReceivedMetrics() noexcept
+        {
+            static const auto receivedMetrics = CreateDirectionMetrics("received");
+            return receivedMetrics;
+        }
+
+        uint64_t GetTotal(const std::array<metrics::Counter*, NumberOfPacketTypes>& counters) noexcept
+        {
+            uint64_t total {0u};
+
+            for (const auto counter : counters)
+            {
+                total += counter->GetValue();
+            }
+
+            return total;
+        }
+    }
+
+    void CountPacketSent(PacketTypes packetType, uint32_t numberOfBytes) noexcept
+    {
+        const auto& sentMetrics = GetSentMetrics();
+
+        auto index = GetIndex(packetType);
+
+        sentMetrics.Packets[index]->Increment();
+        sentMetrics.Bytes[index]->Increment(numberOfBytes);
+    }
+
+    void CountPacketReceived(PacketTypes packetType, uint32_t numberOfBytes) noexcept
+    {
+        const auto& receivedMetrics = GetReceivedMetrics();
+
+        auto index = GetIndex(packetType);
+
+        receivedMetrics.Packets[index]->Increment();
+        receivedMetrics.Bytes[index]->Increment(numberOfBytes);
+    }
+
+    uint64_t GetNumberOfPacketsSent() noexcept
+    {
+        return GetTotal(GetSentMetrics().Packets);
+    }
+
+    uint64_t GetNumberOfPacketsReceived() noexcept
+    {
+        return GetTotal(GetReceivedMetrics().Packets);
+    }
+
+    uint64_t GetNumberOfPacketBytesSent() noexcept
+    {
+        return GetTotal(GetSentMetrics().Bytes);
+    }
+
+    void SetSendQueueDepth(uint64_t depth) noexcept
+    {
+        static auto& gauge = metrics::MetricsRegistry::GetGlobal().GetGauge(
+                "projectfarm_packet_send_queue_depth", "Packets waiting to be sent, including delayed packets.");
+
+        gauge.Set(static_cast<int64_t>(depth));
+    }
+}
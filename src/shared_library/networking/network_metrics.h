@@ -0,0 +1,29 @@
+#ifndef PROJECTFARM_NETWORK_METRICS_H
+#define PROJECTFARM_NETWORK_METRICS_H
+
+#include <cstdint>
+
+#include "packet_types.h"
+
+namespace projectfarm::shared::networking
+{
+    // packets and bytes in and out, by packet type, in the global metrics registry
+
+    void CountPacketSent(PacketTypes packetType, uint32_t numberOfBytes) noexcept;
+
+    void CountPacketReceived(PacketTypes packetType, uint32_t numberOfBytes) noexcept;
+
+    // every packet type added together, since the process started
+    [[nodiscard]]
+    uint64_t GetNumberOfPacketsSent() noexcept;
+
+    [[nodiscard]]
+    uint64_t GetNumberOfPacketsReceived() noexcept;
+
+    [[nodiscard]]
+    uint64_t GetNumberOfPacketBytesSent() noexcept;
+
+    void SetSendQueueDepth(uint64_t depth) noexcept;
+}
+
+#endif
@@ -0,0 +1,296 @@
+#include <limits>
+#include <exception>
+
+#include "packet_capture.h"
+#include "packet_factory.h"
+#include "utils/util.h"
+#include "api/logging/logging.h"
+
+namespace projectfarm::shared::networking
+{
+    namespace
+    {
+        constexpr size_t FlushSizeInBytes {64u * 1024u};
+
+        // `Packet::GetBytes` starts with the packet's size, which is not captured
+        constexpr size_t PacketSizeLength {sizeof(uint32_t)};
+    }
+
+    bool PacketCaptureWriter::Open(const std::filesystem::path& filePath) noexcept
+    {
+        this->Close();
+
+        this->_file.open(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!this->_file.is_open())
+        {
+            api::logging::Log("Failed to open packet capture file: " + filePath.u8string());
+            return false;
+        }
+
+        this->_buffer.clear();
+        this->_buffer.reserve(FlushSizeInBytes * 2u);
+
+        for (auto c : PacketCaptureMagic)
+        {
+            pfu::WriteUInt8(this->_buffer, static_cast<uint8_t>(c));
+        }
+        pfu::WriteUInt8(this->_buffer, PacketCaptureVersion);
+
+        this->_lastTimeInMicroseconds = 0u;
+        this->_numberOfRecords = 0u;
+
+        return true;
+    }
+
+    void PacketCaptureWriter::Close() noexcept
+    {
+        if (!this->_file.is_open())
+        {
+            return;
+        }
+
+        this->_file.write(reinterpret_cast<const char*>(this->_buffer.data()),
+                          static_cast<std::streamsize>(this->_buffer.size()));
+        this->_buffer.clear();
+
+        this->_file.close();
+    }
+
+    void PacketCaptureWriter::WriteClientAdded(uint64_t timeInMicroseconds, uint32_t clientId) noexcept
+    {
+        this->WriteRecordHeader(PacketCaptureRecordTypes::ClientAdded, timeInMicroseconds);
+        pfu::WriteVarUInt64(this->_buffer, clientId);
+
+        this->FlushIfFull();
+    }
+
+    void PacketCaptureWriter::WriteClientRemoved(uint64_t timeInMicroseconds, uint32_t clientId) noexcept
+    {
+        this->WriteRecordHeader(PacketCaptureRecordTypes::ClientRemoved, timeInMicroseconds);
+        pfu::WriteVarUInt64(this->_buffer, clientId);
+
+        this->FlushIfFull();
+    }
+
+    void PacketCaptureWriter::WriteTCPPacket(uint64_t timeInMicroseconds, uint32_t clientId,
+                                             const Packet& packet) noexcept
+    {
+        this->WriteRecordHeader(PacketCaptureRecordTypes::TCPPacket, timeInMicroseconds);
+        pfu::WriteVarUInt64(this->_buffer, clientId);
+        this->WritePacket(packet);
+
+        this->FlushIfFull();
+    }
+
+    void PacketCaptureWriter::WriteUDPPacket(uint64_t timeInMicroseconds, uint32_t host, uint16_t port,
+                                             const Packet& packet) noexcept
+    {
+        this->WriteRecordHeader(PacketCaptureRecordTypes::UDPPacket, timeInMicroseconds);
+        pfu::WriteUInt32(this->_buffer, host);
+        pfu::WriteUInt16(this->_buffer, port);
+        this->WritePacket(packet);
+
+        this->FlushIfFull();
+    }
+
+    void PacketCaptureWriter::WriteRecordHeader(PacketCaptureRecordTypes type, uint64_t timeInMicroseconds) noexcept
+    {
+        // a record that goes back in time is written as happening with the one before it
+        auto delta = timeInMicroseconds > this->_lastTimeInMicroseconds ?
+                     timeInMicroseconds - this->_lastTimeInMicroseconds : 0u;
+        this->_lastTimeInMicroseconds += delta;
+
+        pfu::WriteUInt8(this->_buffer, static_cast<uint8_t>(type));
+        pfu::WriteVarUInt64(this->_buffer, delta);
+
+        ++this->_numberOfRecords;
+    }
+
+    void PacketCaptureWriter::WritePacket(const Packet& packet) noexcept
+    {
+        auto bytes = packet.GetBytes();
+
+        // the packet type and body
+        pfu::WriteVarUInt64(this->_buffer, bytes.size() - PacketSizeLength);
+        this->_buffer.insert(this->_buffer.end(), bytes.begin() + PacketSizeLength, bytes.end());
+    }
+
+    void PacketCaptureWriter::FlushIfFull() noexcept
+    {
+        if (this->_buffer.size() < FlushSizeInBytes)
+        {
+            return;
+        }
+
+        this->_file.write(reinterpret_cast<const char*>(this->_buffer.data()),
+                          static_cast<std::streamsize>(this->_buffer.size()));
+        this->_buffer.clear();
+    }
+
+    bool PacketCaptureReader::Open(const std::filesystem::path& filePath) noexcept
+    {
+        this->_data.clear();
+        this->_index = 0u;
+        this->_timeInMicroseconds = 0u;
+        this->_hasError = false;
+
+        std::error_code ec;
+        auto fileSize = std::filesystem::file_size(filePath, ec);
+        if (ec)
+        {
+            api::logging::Log("Failed to find packet capture file: " + filePath.u8string());
+            this->_hasError = true;
+            return false;
+        }
+
+        // the stream helpers index with 32 bits
+        if (fileSize > std::numeric_limits<uint32_t>::max())
+        {
+            api::logging::Log("Packet capture file is too large: " + filePath.u8string());
+            this->_hasError = true;
+            return false;
+        }
+
+        std::ifstream file(filePath, std::ios::in | std::ios::binary);
+        if (!file.is_open())
+        {
+            api::logging::Log("Failed to open packet capture file: " + filePath.u8string());
+            this->_hasError = true;
+            return false;
+        }
+
+        this->_data.resize(static_cast<size_t>(fileSize));
+        file.read(reinterpret_cast<char*>(this->_data.data()), static_cast<std::streamsize>(fileSize));
+        if (!file)
+        {
+            api::logging::Log("Failed to read packet capture file: " + filePath.u8string());
+            this->_hasError = true;
+            return false;
+        }
+
+        if (this->_data.size() < sizeof(PacketCaptureMagic) + sizeof(PacketCaptureVersion))
+        {
+            api::logging::Log("Not a packet capture file: " + filePath.u8string());
+            this->_hasError = true;
+            return false;
+        }
+
+        for (auto c : PacketCaptureMagic)
+        {
+            if (pfu::ReadUInt8(this->_data, this->_index) != static_cast<uint8_t>(c))
+            {
+                api::logging::Log("Not a packet capture file: " + filePath.u8string());
+                this->_hasError = true;
+                return false;
+            }
+        }
+
+        if (auto version = pfu::ReadUInt8(this->_data, this->_index); version != PacketCaptureVersion)
+        {
+            api::logging::Log("Unsupported packet capture version " + std::to_string(version) +
+                              " in: " + filePath.u8string());
+            this->_hasError = true;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool PacketCaptureReader::ReadNext(PacketCaptureRecord& record) noexcept
+    {
+        if (this->_hasError || this->_index >= this->_data.size())
+        {
+            return false;
+        }
+
+        auto type = pfu::ReadUInt8(this->_data, this->_index);
+        if (type > static_cast<uint8_t>(PacketCaptureRecordTypes::UDPPacket))
+        {
+            api::logging::Log("Unknown packet capture record type: " + std::to_string(type));
+            this->_hasError = true;
+            return false;
+        }
+
+        uint64_t delta {0u};
+        if (!pfu::ReadVarUInt64(this->_data, this->_index, delta))
+        {
+            api::logging::Log("Packet capture is truncated.");
+            this->_hasError = true;
+            return false;
+        }
+
+        this->_timeInMicroseconds += delta;
+
+        record = {};
+        record.Type = static_cast<PacketCaptureRecordTypes>(type);
+        record.TimeInMicroseconds = this->_timeInMicroseconds;
+
+        if (record.Type == PacketCaptureRecordTypes::UDPPacket)
+        {
+            if (this->_data.size() - this->_index < sizeof(uint32_t) + sizeof(uint16_t))
+            {
+                api::logging::Log("Packet capture is truncated.");
+                this->_hasError = true;
+                return false;
+            }
+
+            record.Host = pfu::ReadUInt32(this->_data, this->_index);
+            record.Port = pfu::ReadUInt16(this->_data, this->_index);
+        }
+        else
+        {
+            uint64_t clientId {0u};
+            if (!pfu::ReadVarUInt64(this->_data, this->_index, clientId))
+            {
+                api::logging::Log("Packet capture is truncated.");
+                this->_hasError = true;
+                return false;
+            }
+
+            record.ClientId = static_cast<uint32_t>(clientId);
+        }
+
+        if (record.Type == PacketCaptureRecordTypes::TCPPacket ||
+            record.Type == PacketCaptureRecordTypes::UDPPacket)
+        {
+            return this->ReadPacket(record);
+        }
+
+        return true;
+    }
+
+    bool PacketCaptureReader::ReadPacket(PacketCaptureRecord& record) noexcept
+    {
+        uint64_t length {0u};
+        if (!pfu::ReadVarUInt64(this->_data, this->_index, length) ||
+            length == 0u ||
+            length > this->_data.size() - this->_index)
+        {
+            api::logging::Log("Packet capture is truncated.");
+            this->_hasError = true;
+            return false;
+        }
+
+        auto packetType = static_cast<PacketTypes>(pfu::ReadUInt8(this->_data, this->_index));
+
+        auto bodyStart = this->_data.begin() + this->_index;
+        auto bodyEnd = bodyStart + static_cast<std::ptrdiff_t>(length - 1u);
+        std::vector<std::byte> body(bodyStart, bodyEnd);
+
+        this->_index += static_cast<uint32_t>(length - 1u);
+
+        try
+        {
+            record.ReceivedPacket = PacketFactory::CreatePacket(packetType);
+            record.ReceivedPacket->FromBytes(body);
+        }
+        catch (const std::exception& ex)
+        {
+            api::logging::Log("Failed to read captured packet: " + std::string(ex.what()));
+            this->_hasError = true;
+            return false;
+        }
+
+        return true;
+    }
+}
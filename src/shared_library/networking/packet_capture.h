@@ -0,0 +1,133 @@
+#ifndef PROJECTFARM_PACKET_CAPTURE_H
+#define PROJECTFARM_PACKET_CAPTURE_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+
+#include "packet.h"
+
+namespace projectfarm::shared::networking
+{
+    // A capture file is `PacketCaptureMagic`, a version byte, and then one record after
+    // another. Each record is its type, the microseconds since the previous record as a
+    // var int, who it is from, and for packets, the packet type and body. Clients are
+    // given an id when they connect, so TCP packets can be matched to the client, and
+    // UDP packets keep the address they came from.
+
+    constexpr char PacketCaptureMagic[] {'P', 'F', 'C', 'A', 'P'};
+    constexpr uint8_t PacketCaptureVersion {1u};
+
+    enum class PacketCaptureRecordTypes : uint8_t
+    {
+        ClientAdded = 0,
+        ClientRemoved = 1,
+        TCPPacket = 2,
+        UDPPacket = 3,
+    };
+
+    struct PacketCaptureRecord
+    {
+        PacketCaptureRecordTypes Type {PacketCaptureRecordTypes::ClientAdded};
+
+        // since the capture started
+        uint64_t TimeInMicroseconds {0u};
+
+        // for everything but UDP packets
+        uint32_t ClientId {0u};
+
+        // for UDP packets, as SDL_net stores them
+        uint32_t Host {0u};
+        uint16_t Port {0u};
+
+        std::shared_ptr<Packet> ReceivedPacket;
+    };
+
+    // Not thread safe, the caller must serialize the writes
+    class PacketCaptureWriter final
+    {
+    public:
+        PacketCaptureWriter() = default;
+        ~PacketCaptureWriter()
+        {
+            this->Close();
+        }
+
+        PacketCaptureWriter(const PacketCaptureWriter&) = delete;
+        PacketCaptureWriter(PacketCaptureWriter&&) = delete;
+
+        [[nodiscard]]
+        bool Open(const std::filesystem::path& filePath) noexcept;
+
+        // writes anything still buffered
+        void Close() noexcept;
+
+        [[nodiscard]]
+        bool IsOpen() const noexcept
+        {
+            return this->_file.is_open();
+        }
+
+        // the times must not go backwards
+        void WriteClientAdded(uint64_t timeInMicroseconds, uint32_t clientId) noexcept;
+        void WriteClientRemoved(uint64_t timeInMicroseconds, uint32_t clientId) noexcept;
+        void WriteTCPPacket(uint64_t timeInMicroseconds, uint32_t clientId, const Packet& packet) noexcept;
+        void WriteUDPPacket(uint64_t timeInMicroseconds, uint32_t host, uint16_t port, const Packet& packet) noexcept;
+
+        [[nodiscard]]
+        uint64_t GetNumberOfRecords() const noexcept
+        {
+            return this->_numberOfRecords;
+        }
+
+    private:
+        std::ofstream _file;
+        std::vector<std::byte> _buffer;
+
+        uint64_t _lastTimeInMicroseconds {0u};
+        uint64_t _numberOfRecords {0u};
+
+        void WriteRecordHeader(PacketCaptureRecordTypes type, uint64_t timeInMicroseconds) noexcept;
+        void WritePacket(const Packet& packet) noexcept;
+        void FlushIfFull() noexcept;
+    };
+
+    // The whole capture is read into memory, so replaying doesn't wait on the disk
+    class PacketCaptureReader final
+    {
+    public:
+        PacketCaptureReader() = default;
+        ~PacketCaptureReader() = default;
+
+        PacketCaptureReader(const PacketCaptureReader&) = delete;
+        PacketCaptureReader(PacketCaptureReader&&) = delete;
+
+        [[nodiscard]]
+        bool Open(const std::filesystem::path& filePath) noexcept;
+
+        // false at the end of the capture, or if it is corrupt, which `HasError` says
+        [[nodiscard]]
+        bool ReadNext(PacketCaptureRecord& record) noexcept;
+
+        [[nodiscard]]
+        bool HasError() const noexcept
+        {
+            return this->_hasError;
+        }
+
+    private:
+        std::vector<std::byte> _data;
+        uint32_t _index {0u};
+
+        uint64_t _timeInMicroseconds {0u};
+
+        bool _hasError {false};
+
+        [[nodiscard]]
+        bool ReadPacket(PacketCaptureRecord& record) noexcept;
+    };
+}
+
+#endif
@@ -17,6 +17,9 @@
 #include "packets/server_client_send_hashed_password.h"
 #include "packets/client_server_chatbox_message.h"
 #include "packets/server_client_chatbox_message.h"
+#include "packets/server_client_world_changes_chunk.h"
+#include "packets/client_server_ping.h"
+#include "packets/server_client_pong.h"
 
 namespace projectfarm::shared::networking
 {
@@ -100,6 +103,21 @@ namespace projectfarm::shared::networking
             {
                 packet = std::make_shared<packets::ServerClientChatboxMessagePacket>();
                 break;
+            }
+            case PacketTypes::ServerClientWorldChangesChunk:
+            {
+                packet = std::make_shared<packets::ServerClientWorldChangesChunkPacket>();
+                break;
+            }
+            case PacketTypes::ClientServerPing:
+            {
+                packet = std::make_shared<packets::ClientServerPingPacket>();
+                break;
+            }
+            case PacketTypes::ServerClientPong:
+            {
+                packet = std::make_shared<packets::ServerClientPongPacket>();
+                break;
             }
 		}
 
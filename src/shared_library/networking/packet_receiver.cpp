@@ -3,6 +3,7 @@
 
 #include "packet_receiver.h"
 #include "networking/packet_factory.h"
+#include "networking/network_metrics.h"
 #include "api/logging/logging.h"
 
 namespace projectfarm::shared::networking
@@ -29,6 +30,8 @@ namespace projectfarm::shared::networking
         const auto packetType { static_cast<projectfarm::shared::networking::PacketTypes>(packetTypeNumber) };
         auto packet { projectfarm::shared::networking::PacketFactory::CreatePacket(packetType) };
 
+        CountPacketReceived(packetType, static_cast<uint32_t>(udpPacket->len));
+
         startOffset += sizeof(std::byte); // skip the byte we just read
 
         // start from the byte after the packet type
@@ -89,6 +92,8 @@ namespace projectfarm::shared::networking
                 packet->FromBytes(buff);
             }
 
+            CountPacketReceived(packetType, packetSize);
+
 #ifdef LOGGING_PACKET_DEBUG_INFO
             //auto debugData = packet->GetDebugData();
             //api::logging::Log(debugData);
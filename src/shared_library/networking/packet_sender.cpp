@@ -1,4 +1,5 @@
 #include "packet_sender.h"
+#include "network_metrics.h"
 #include "api/logging/logging.h"
 
 namespace projectfarm::shared::networking
@@ -7,6 +8,12 @@ namespace projectfarm::shared::networking
 	{
 		api::logging::Log("Initializing packet sender...");
 
+		if (this->_discardPackets)
+        {
+		    api::logging::Log("Discarding packets instead of sending them.");
+		    return true;
+        }
+
 		if (this->_udpSocket == nullptr)
         {
             api::logging::Log("Creating UDP socket...");
@@ -47,7 +54,7 @@ namespace projectfarm::shared::networking
             this->_packetSenderWorker->StopThread();
         }
 
-		if (this->_internalUDPSocket)
+		if (this->_internalUDPSocket && this->_udpSocket != nullptr)
         {
             SDLNet_UDP_Close(this->_udpSocket);
             this->_udpSocket = nullptr;
@@ -62,12 +69,32 @@ namespace projectfarm::shared::networking
 	void PacketSender::AddPacketToSend(TCPsocket socket, const std::shared_ptr<Packet>& packet,
 	        uint64_t milliseconds) noexcept
 	{
+	    if (this->_discardPackets)
+        {
+	        this->DiscardPacket(packet);
+	        return;
+        }
+
         this->_packetSenderWorker->AddPacketToSend(socket, packet, milliseconds);
 	}
 
     void PacketSender::AddPacketToSend(const IPaddress& ipAddress, const std::shared_ptr<Packet>& packet,
             uint64_t milliseconds) noexcept
     {
+        if (this->_discardPackets)
+        {
+            this->DiscardPacket(packet);
+            return;
+        }
+
         this->_packetSenderWorker->AddPacketToSend(ipAddress, packet, milliseconds);
     }
+
+    void PacketSender::DiscardPacket(const std::shared_ptr<Packet>& packet) const noexcept
+    {
+        auto numberOfBytes = this->_serializeDiscardedPackets ? static_cast<uint32_t>(packet->GetBytes().size())
+                                                              : packet->PacketSize();
+
+        CountPacketSent(packet->GetPacketType(), numberOfBytes);
+    }
 }
\ No newline at end of file
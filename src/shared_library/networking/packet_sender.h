@@ -36,9 +36,26 @@ namespace projectfarm::shared::networking
             this->_internalUDPSocket = false;
         }
         
+        // packets are counted as sent and then dropped, without a socket or a thread,
+        // so the server can run without clients. This must be set before `Initialize`.
+        void SetDiscardPackets(bool discardPackets) noexcept
+        {
+            this->_discardPackets = discardPackets;
+        }
+
+        // discarded packets are serialized before they are counted, so the bytes are
+        // what would have been sent, and the cost of serializing is still paid
+        void SetSerializeDiscardedPackets(bool serializeDiscardedPackets) noexcept
+        {
+            this->_serializeDiscardedPackets = serializeDiscardedPackets;
+        }
+
         void SetIsInLowerActivityState(bool state) noexcept
         {
-            this->_packetSenderWorker->SetIsInLowerActivityState(state);
+            if (this->_packetSenderWorker)
+            {
+                this->_packetSenderWorker->SetIsInLowerActivityState(state);
+            }
         }
 
 	private:
@@ -49,6 +66,10 @@ namespace projectfarm::shared::networking
         UDPpacket* _udpPacket {nullptr};
 
         bool _isServer = true;
+        bool _discardPackets = false;
+        bool _serializeDiscardedPackets = false;
+
+        void DiscardPacket(const std::shared_ptr<Packet>& packet) const noexcept;
 	};
 }
 
@@ -1,7 +1,12 @@
+#include <algorithm>
 #include <cstring>
 
 #include "packet_sender_worker.h"
+#include "network_metrics.h"
 #include "api/logging/logging.h"
+#include "profiling/profiler.h"
+#include "profiling/allocation_tracker.h"
+#include "time/monotonic_clock.h"
 
 using namespace std::literals;
 
@@ -39,8 +44,7 @@ namespace projectfarm::shared::networking
     {
         api::logging::Log("In packet sender thread.");
 
-        this->_currentTime = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::system_clock::now().time_since_epoch()).count());
+        ALLOCATION_SCOPE(Networking);
 
         while (this->_runThread)
         {
@@ -52,15 +56,29 @@ namespace projectfarm::shared::networking
 
             {
                 std::unique_lock lock(this->_packetMutex);
-                this->_packetMutexCV.wait(lock,
-                                          [this]() { return !this->_packetsToSend.empty() ||
-                                                                  !this->_runThread; });
+
+                auto isReady = [this]() { return !this->_packetsToSend.empty() || !this->_runThread; };
+
+                if (this->_countdownPacketsToSend.IsEmpty())
+                {
+                    this->_packetMutexCV.wait(lock, isReady);
+                }
+                else
+                {
+                    // delayed packets are sent when they are due, even if nothing else is added
+                    auto timeUntilNext = this->_countdownPacketsToSend.GetMillisecondsUntilNext(
+                            PacketSenderWorker::GetCurrentMilliseconds());
+
+                    this->_packetMutexCV.wait_for(lock, std::chrono::milliseconds(timeUntilNext), isReady);
+                }
 
                 if (!this->_runThread)
                 {
                     break;
                 }
 
+                this->QueueDueDelayedPackets(PacketSenderWorker::GetCurrentMilliseconds());
+
                 while (!this->_packetsToSend.empty())
                 {
                     auto packet = this->_packetsToSend.front();
@@ -69,49 +87,45 @@ namespace projectfarm::shared::networking
                     this->SendPacket(packet);
                 }
 
-                for (auto packetIter = this->_countdownPacketsToSend.begin();
-                     packetIter != this->_countdownPacketsToSend.end();)
-                {
-                    auto &packet = *packetIter;
-
-                    int64_t milliseconds = packet._milliseconds - this->_lastFrameTime;
-                    if (milliseconds <= 0)
-                    {
-                        this->_packetsToSend.push(packet);
-
-                        packetIter = this->_countdownPacketsToSend.erase(packetIter);
-                        continue;
-                    }
-
-                    ++packetIter;
-
-                    packet._milliseconds -= this->_lastFrameTime;
-                }
+                SetSendQueueDepth(this->_countdownPacketsToSend.GetSize());
             }
-
-            auto currentTime = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
-                    std::chrono::system_clock::now().time_since_epoch()).count());
-            this->_lastFrameTime = currentTime - this->_currentTime;
-            this->_currentTime = currentTime;
         }
 
         api::logging::Log("Exiting packet sender thread.");
     }
 
+    uint64_t PacketSenderWorker::GetCurrentMilliseconds() noexcept
+    {
+        return time::MonotonicClock::ReadCoarseMicroseconds() / 1000u;
+    }
+
+    void PacketSenderWorker::QueueDueDelayedPackets(uint64_t currentTime) noexcept
+    {
+        this->_countdownPacketsToSend.TakeDue(currentTime, [this](PacketSendInfo&& packet)
+        {
+            this->_packetsToSend.push(std::move(packet));
+        });
+    }
+
     void PacketSenderWorker::AddPacketToSend(TCPsocket socket, const std::shared_ptr<Packet>& packet,
                                              uint64_t milliseconds) noexcept
     {
+        ALLOCATION_SCOPE(Networking);
+
         {
             std::unique_lock lock(this->_packetMutex);
 
             if (milliseconds > 0)
             {
-                this->_countdownPacketsToSend.push_back({ socket, packet, milliseconds });
+                this->_countdownPacketsToSend.Add({ socket, packet },
+                                                  PacketSenderWorker::GetCurrentMilliseconds() + milliseconds);
             }
             else
             {
-                this->_packetsToSend.push({ socket, packet, 0 });
+                this->_packetsToSend.push({ socket, packet });
             }
+
+            SetSendQueueDepth(this->_packetsToSend.size() + this->_countdownPacketsToSend.GetSize());
         }
 
         this->_packetMutexCV.notify_one();
@@ -120,17 +134,22 @@ namespace projectfarm::shared::networking
     void PacketSenderWorker::AddPacketToSend(const IPaddress& ipAddress, const std::shared_ptr<Packet>& packet,
                                              uint64_t milliseconds) noexcept
     {
+        ALLOCATION_SCOPE(Networking);
+
         {
             std::unique_lock lock(this->_packetMutex);
 
             if (milliseconds > 0)
             {
-                this->_countdownPacketsToSend.push_back({ ipAddress, packet, milliseconds });
+                this->_countdownPacketsToSend.Add({ ipAddress, packet },
+                                                  PacketSenderWorker::GetCurrentMilliseconds() + milliseconds);
             }
             else
             {
-                this->_packetsToSend.push({ ipAddress, packet, 0 });
+                this->_packetsToSend.push({ ipAddress, packet });
             }
+
+            SetSendQueueDepth(this->_packetsToSend.size() + this->_countdownPacketsToSend.GetSize());
         }
 
         this->_packetMutexCV.notify_one();
@@ -143,6 +162,8 @@ namespace projectfarm::shared::networking
 
     void PacketSenderWorker::SendPacket(PacketSendInfo& info) noexcept
     {
+        PROFILE_ZONE("PacketSenderWorker::SendPacket");
+
         std::visit(overloaded {
            [this, &info](const IPaddress& ipAddress)
            {
@@ -159,7 +180,10 @@ namespace projectfarm::shared::networking
                    // TODO: Find out how to get destination IP address from the socket, then log it below
                    api::logging::Log("Failed to send message (UDP).");
                    api::logging::Log(SDLNet_GetError());
+                   return;
                }
+
+               CountPacketSent(info._packet->GetPacketType(), static_cast<uint32_t>(this->_udpPacket->len));
            },
            [&info](const TCPsocket& socket)
            {
@@ -178,7 +202,10 @@ namespace projectfarm::shared::networking
                    // TODO: Find out how to get destination IP address from the socket, then log it below
                    api::logging::Log("Failed to send message (TCP).");
                    api::logging::Log(SDLNet_GetError());
+                   return;
                }
+
+               CountPacketSent(info._packet->GetPacketType(), size);
            }
         },
         info._destination);
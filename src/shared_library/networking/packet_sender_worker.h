@@ -6,12 +6,13 @@
 #include <mutex>
 #include <condition_variable>
 #include <queue>
-#include <list>
 #include <variant>
+#include <chrono>
 
 #include <SDL_net.h>
 
 #include "networking/packet.h"
+#include "networking/delayed_packet_queue.h"
 #include "utils/util.h"
 
 namespace projectfarm::shared::networking
@@ -50,14 +51,10 @@ namespace projectfarm::shared::networking
         std::mutex _packetMutex;
         std::condition_variable _packetMutexCV;
 
-        uint64_t _currentTime {0};
-        uint64_t _lastFrameTime {0};
-
         struct PacketSendInfo
         {
             std::variant<TCPsocket, IPaddress> _destination;
             std::shared_ptr<Packet> _packet;
-            uint64_t _milliseconds;
 
             bool operator == (const PacketSendInfo& other) const
             {
@@ -71,13 +68,20 @@ namespace projectfarm::shared::networking
         };
 
         std::queue<PacketSendInfo> _packetsToSend;
-        std::list<PacketSendInfo> _countdownPacketsToSend;
+
+        // due by `MonotonicClock`'s coarse time, so setting the system time doesn't affect them
+        DelayedPacketQueue<PacketSendInfo> _countdownPacketsToSend;
 
         UDPsocket _udpSocket {nullptr};
         UDPpacket* _udpPacket {nullptr};
 
         void ThreadWorker() noexcept;
 
+        [[nodiscard]]
+        static uint64_t GetCurrentMilliseconds() noexcept;
+
+        void QueueDueDelayedPackets(uint64_t currentTime) noexcept;
+
         void SendPacket(PacketSendInfo& info) noexcept;
     };
 }
@@ -20,6 +20,9 @@ namespace projectfarm::shared::networking
         ServerClientSendHashedPassword = 12,
         ClientServerChatboxMessage = 13,
         ServerClientChatboxMessage = 14,
+        ServerClientWorldChangesChunk = 15,
+        ClientServerPing = 16,
+        ServerClientPong = 17,
 	};
 }
 
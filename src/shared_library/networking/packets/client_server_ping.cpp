@@ -0,0 +1,22 @@
+#include "utils/util.h"
+#include "client_server_ping.h"
+
+namespace projectfarm::shared::networking::packets
+{
+    void ClientServerPingPacket::SerializeBytes(std::vector<std::byte>& bytes) const noexcept
+    {
+        pfu::WriteUInt64(bytes, this->_clientTime);
+    }
+
+    void ClientServerPingPacket::FromBytes(const std::vector<std::byte>& bytes)
+    {
+        uint32_t index {0};
+
+        this->_clientTime = pfu::ReadUInt64(bytes, index);
+    }
+
+    void ClientServerPingPacket::OutputDebugData(std::stringstream& ss) const noexcept
+    {
+        this->SerializeDebugData(ss, "Client Time", this->_clientTime);
+    }
+}
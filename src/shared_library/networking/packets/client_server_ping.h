@@ -0,0 +1,56 @@
+#ifndef PROJECTFARM_CLIENT_SERVER_PING_H
+#define PROJECTFARM_CLIENT_SERVER_PING_H
+
+#include <cstdint>
+
+#include "../packet.h"
+#include "../packet_types.h"
+
+namespace projectfarm::shared::networking::packets
+{
+    class ClientServerPingPacket final : public Packet
+    {
+    public:
+        ClientServerPingPacket() = default;
+        ~ClientServerPingPacket() override = default;
+
+        [[nodiscard]] PacketTypes GetPacketType() const override
+        {
+            return PacketTypes::ClientServerPing;
+        }
+
+        [[nodiscard]] uint32_t SizeInBytes() const override
+        {
+            return this->GetSize(this->_clientTime);
+        }
+
+        void FromBytes(const std::vector<std::byte>& bytes) override;
+
+        void OutputDebugData(std::stringstream& ss) const noexcept override;
+
+        // the client's time when it sent the ping, which the pong echoes back
+        [[nodiscard]]
+        uint64_t GetClientTime() const noexcept
+        {
+            return this->_clientTime;
+        }
+
+        void SetClientTime(uint64_t clientTime) noexcept
+        {
+            this->_clientTime = clientTime;
+        }
+
+        [[nodiscard]] bool IsVital() const override
+        {
+            return true;
+        }
+
+    protected:
+        void SerializeBytes(std::vector<std::byte>& bytes) const noexcept override;
+
+    private:
+        uint64_t _clientTime {0};
+    };
+}
+
+#endif
@@ -0,0 +1,22 @@
+#include "utils/util.h"
+#include "server_client_pong.h"
+
+namespace projectfarm::shared::networking::packets
+{
+    void ServerClientPongPacket::SerializeBytes(std::vector<std::byte>& bytes) const noexcept
+    {
+        pfu::WriteUInt64(bytes, this->_clientTime);
+    }
+
+    void ServerClientPongPacket::FromBytes(const std::vector<std::byte>& bytes)
+    {
+        uint32_t index {0};
+
+        this->_clientTime = pfu::ReadUInt64(bytes, index);
+    }
+
+    void ServerClientPongPacket::OutputDebugData(std::stringstream& ss) const noexcept
+    {
+        this->SerializeDebugData(ss, "Client Time", this->_clientTime);
+    }
+}
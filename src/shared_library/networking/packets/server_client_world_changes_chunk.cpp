@@ -0,0 +1,57 @@
+#include <algorithm>
+#include <vector>
+
+#include "utils/util.h"
+#include "server_client_world_changes_chunk.h"
+
+namespace projectfarm::shared::networking::packets
+{
+    void ServerClientWorldChangesChunkPacket::SerializeBytes(std::vector<std::byte>& bytes) const noexcept
+    {
+        auto dataSize = static_cast<uint32_t>(this->_data.size());
+
+        pfu::WriteString(bytes, this->_worldName, static_cast<uint32_t>(this->_worldName.size()));
+        pfu::WriteUInt8(bytes, this->_islandIndex);
+        pfu::WriteUInt32(bytes, this->_chunkIndex);
+        pfu::WriteUInt32(bytes, this->_numberOfChunks);
+        pfu::WriteUInt32(bytes, dataSize);
+
+        if (dataSize > 0)
+        {
+            std::copy(this->_data.begin(), this->_data.end(), std::back_inserter(bytes));
+        }
+    }
+
+    void ServerClientWorldChangesChunkPacket::FromBytes(const std::vector<std::byte>& bytes)
+    {
+        uint32_t index {0};
+
+        this->_worldName = pfu::ReadString(bytes, index);
+        this->_islandIndex = pfu::ReadUInt8(bytes, index);
+        this->_chunkIndex = pfu::ReadUInt32(bytes, index);
+        this->_numberOfChunks = pfu::ReadUInt32(bytes, index);
+
+        auto dataSize = pfu::ReadUInt32(bytes, index);
+
+        this->_data.clear();
+
+        if (dataSize > 0)
+        {
+            this->_data.reserve(dataSize);
+
+            std::copy(bytes.begin() + index, bytes.begin() + index + dataSize,
+                      std::back_inserter(this->_data));
+
+            index += dataSize;
+        }
+    }
+
+    void ServerClientWorldChangesChunkPacket::OutputDebugData(std::stringstream& ss) const noexcept
+    {
+        this->SerializeDebugData(ss, "World Name", this->_worldName);
+        this->SerializeDebugData(ss, "Island Index", static_cast<int>(this->_islandIndex));
+        this->SerializeDebugData(ss, "Chunk Index", this->_chunkIndex);
+        this->SerializeDebugData(ss, "Number of Chunks", this->_numberOfChunks);
+        this->SerializeDebugData(ss, "Data Size", this->_data.size());
+    }
+}
@@ -0,0 +1,113 @@
+#ifndef PROJECTFARM_SERVER_CLIENT_WORLD_CHANGES_CHUNK_H
+#define PROJECTFARM_SERVER_CLIENT_WORLD_CHANGES_CHUNK_H
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "../packet.h"
+#include "../packet_types.h"
+
+namespace projectfarm::shared::networking::packets
+{
+    // a chunk of the encoded tile changes of an island, sent when a player loads a world
+    class ServerClientWorldChangesChunkPacket final : public Packet
+    {
+    public:
+        ServerClientWorldChangesChunkPacket() = default;
+        ~ServerClientWorldChangesChunkPacket() override = default;
+
+        [[nodiscard]]
+        PacketTypes GetPacketType() const override
+        {
+            return PacketTypes::ServerClientWorldChangesChunk;
+        }
+
+        [[nodiscard]]
+        uint32_t SizeInBytes() const override
+        {
+            return this->GetSize(this->_worldName) +
+                   this->GetSize(this->_islandIndex) +
+                   this->GetSize(this->_chunkIndex) +
+                   this->GetSize(this->_numberOfChunks) +
+                   this->GetSize(this->_data);
+        }
+
+        void FromBytes(const std::vector<std::byte>& bytes) override;
+
+        void OutputDebugData(std::stringstream& ss) const noexcept override;
+
+        [[nodiscard]]
+        bool IsVital() const override
+        {
+            return true;
+        }
+
+        [[nodiscard]]
+        const std::string& GetWorldName() const noexcept
+        {
+            return this->_worldName;
+        }
+
+        void SetWorldName(const std::string& worldName) noexcept
+        {
+            this->_worldName = worldName;
+        }
+
+        [[nodiscard]]
+        uint8_t GetIslandIndex() const noexcept
+        {
+            return this->_islandIndex;
+        }
+
+        void SetIslandIndex(uint8_t islandIndex) noexcept
+        {
+            this->_islandIndex = islandIndex;
+        }
+
+        [[nodiscard]]
+        uint32_t GetChunkIndex() const noexcept
+        {
+            return this->_chunkIndex;
+        }
+
+        void SetChunkIndex(uint32_t chunkIndex) noexcept
+        {
+            this->_chunkIndex = chunkIndex;
+        }
+
+        [[nodiscard]]
+        uint32_t GetNumberOfChunks() const noexcept
+        {
+            return this->_numberOfChunks;
+        }
+
+        void SetNumberOfChunks(uint32_t numberOfChunks) noexcept
+        {
+            this->_numberOfChunks = numberOfChunks;
+        }
+
+        [[nodiscard]]
+        const std::vector<std::byte>& GetData() const noexcept
+        {
+            return this->_data;
+        }
+
+        void SetData(std::vector<std::byte> data) noexcept
+        {
+            this->_data = std::move(data);
+        }
+
+    protected:
+        void SerializeBytes(std::vector<std::byte>& bytes) const noexcept override;
+
+    private:
+        std::string _worldName;
+        uint8_t _islandIndex {0};
+        uint32_t _chunkIndex {0};
+        uint32_t _numberOfChunks {0};
+        std::vector<std::byte> _data;
+    };
+}
+
+#endif
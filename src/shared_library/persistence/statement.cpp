@@ -6,6 +6,8 @@
 #include "database.h"
 #include "utils/util.h"
 #include "api/logging/logging.h"
+#include "metrics/metrics_registry.h"
+#include "profiling/allocation_tracker.h"
 
 using namespace std::literals;
 
@@ -170,6 +172,13 @@ namespace projectfarm::shared::persistence
 
     bool Statement::Run() noexcept
     {
+        ALLOCATION_SCOPE(Persistence);
+
+        static auto& runDuration = metrics::MetricsRegistry::GetGlobal().GetHistogram(
+                "projectfarm_sqlite_statement_duration_microseconds", "How long SQLite statements take to run.");
+
+        metrics::ScopedTimer timer(runDuration);
+
         auto res = std::all_of(this->_statements.begin(), this->_statements.end(),
                                [this](auto& statement) -> bool
                                {
@@ -0,0 +1,201 @@
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "allocation_tracker.h"
+#include "metrics/metrics_registry.h"
+
+namespace projectfarm::shared::profiling
+{
+    namespace
+    {
+        // each on its own cache line, as the tags are counted from different threads
+        struct alignas(64) TagCounts
+        {
+            std::atomic<uint64_t> Allocations {0u};
+            std::atomic<uint64_t> Bytes {0u};
+        };
+
+        std::array<TagCounts, NumberOfAllocationTags> tagCounts;
+
+        thread_local AllocationTags currentTag {AllocationTags::Untagged};
+        thread_local uint64_t threadAllocations {0u};
+    }
+
+    void AllocationTracker::SetEnabled(bool isEnabled) noexcept
+    {
+        AllocationTracker::_isEnabled = isEnabled;
+    }
+
+    void AllocationTracker::RecordAllocation(size_t size) noexcept
+    {
+        auto& counts = tagCounts[static_cast<size_t>(currentTag)];
+
+        counts.Allocations.fetch_add(1u, std::memory_order_relaxed);
+        counts.Bytes.fetch_add(size, std::memory_order_relaxed);
+
+        ++threadAllocations;
+    }
+
+    AllocationTags AllocationTracker::GetCurrentTag() noexcept
+    {
+        return currentTag;
+    }
+
+    void AllocationTracker::SetCurrentTag(AllocationTags tag) noexcept
+    {
+        currentTag = tag;
+    }
+
+    AllocationSnapshot AllocationTracker::GetSnapshot() noexcept
+    {
+        AllocationSnapshot snapshot;
+
+        for (auto i = 0u; i < NumberOfAllocationTags; ++i)
+        {
+            snapshot[i].Allocations = tagCounts[i].Allocations.load(std::memory_order_relaxed);
+            snapshot[i].Bytes = tagCounts[i].Bytes.load(std::memory_order_relaxed);
+        }
+
+        return snapshot;
+    }
+
+    uint64_t AllocationTracker::GetNumberOfAllocations() noexcept
+    {
+        uint64_t allocations {0u};
+
+        for (const auto& counts : tagCounts)
+        {
+            allocations += counts.Allocations.load(std::memory_order_relaxed);
+        }
+
+        return allocations;
+    }
+
+    uint64_t AllocationTracker::GetThreadNumberOfAllocations() noexcept
+    {
+        return threadAllocations;
+    }
+
+    const char* AllocationTracker::GetTagName(AllocationTags tag) noexcept
+    {
+        switch (tag)
+        {
+            case AllocationTags::Networking:
+                return "networking";
+            case AllocationTags::WorldTick:
+                return "world_tick";
+            case AllocationTags::Scripting:
+                return "scripting";
+            case AllocationTags::Persistence:
+                return "persistence";
+            case AllocationTags::UI:
+                return "ui";
+            default:
+                return "untagged";
+        }
+    }
+
+    AllocationMetrics::AllocationMetrics() noexcept
+    {
+        auto& registry = metrics::MetricsRegistry::GetGlobal();
+
+        for (auto i = 0u; i < NumberOfAllocationTags; ++i)
+        {
+            std::string subsystem = AllocationTracker::GetTagName(static_cast<AllocationTags>(i));
+
+            this->_allocations[i] = &registry.GetCounter("projectfarm_allocations_total",
+                                                         "Calls to operator new, by subsystem.",
+                                                         {{"subsystem", subsystem}});
+            this->_bytes[i] = &registry.GetCounter("projectfarm_allocated_bytes_total",
+                                                   "Bytes asked of operator new, by subsystem.",
+                                                   {{"subsystem", subsystem}});
+        }
+
+        this->_tickAllocations = &registry.GetHistogram("projectfarm_tick_allocations",
+                                                        "Calls to operator new in a tick.");
+
+        this->_lastSnapshot = AllocationTracker::GetSnapshot();
+    }
+
+    void AllocationMetrics::Record() noexcept
+    {
+        auto snapshot = AllocationTracker::GetSnapshot();
+
+        uint64_t tickAllocations {0u};
+
+        for (auto i = 0u; i < NumberOfAllocationTags; ++i)
+        {
+            auto allocations = snapshot[i].Allocations - this->_lastSnapshot[i].Allocations;
+
+            this->_allocations[i]->Increment(allocations);
+            this->_bytes[i]->Increment(snapshot[i].Bytes - this->_lastSnapshot[i].Bytes);
+
+            tickAllocations += allocations;
+        }
+
+        this->_tickAllocations->Record(tickAllocations);
+
+        this->_lastSnapshot = snapshot;
+    }
+}
+
+using projectfarm::shared::profiling::AllocationTracker;
+
+// Replaces the global allocation functions, so every allocation in the process is seen.
+// They are here rather than in their own file so that they are always linked along with
+// the tracker.
+void* operator new(std::size_t size)
+{
+    if (AllocationTracker::IsEnabled())
+    {
+        AllocationTracker::RecordAllocation(size);
+    }
+
+    if (auto memory = std::malloc(size > 0u ? size : 1u); memory)
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    if (AllocationTracker::IsEnabled())
+    {
+        AllocationTracker::RecordAllocation(size);
+    }
+
+    return std::malloc(size > 0u ? size : 1u);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return ::operator new(size, tag);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
@@ -0,0 +1,132 @@
+#ifndef PROJECTFARM_ALLOCATION_TRACKER_H
+#define PROJECTFARM_ALLOCATION_TRACKER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <atomic>
+
+#include "metrics/metrics.h"
+
+namespace projectfarm::shared::profiling
+{
+    // the subsystem an allocation is counted against, which is whichever scope is innermost
+    enum class AllocationTags : uint8_t
+    {
+        Untagged = 0,
+        Networking,
+        WorldTick,
+        Scripting,
+        Persistence,
+        UI,
+        Count,
+    };
+
+    constexpr size_t NumberOfAllocationTags {static_cast<size_t>(AllocationTags::Count)};
+
+    struct AllocationCounts
+    {
+        uint64_t Allocations {0u};
+        uint64_t Bytes {0u};
+    };
+
+    using AllocationSnapshot = std::array<AllocationCounts, NumberOfAllocationTags>;
+
+    // Counts the calls to the global `operator new`, and their bytes, by the calling
+    // thread's current tag. The allocation functions are replaced in any executable that
+    // links this, but only count while the tracker is enabled. Over-aligned allocations
+    // aren't counted.
+    class AllocationTracker final
+    {
+    public:
+        AllocationTracker() = delete;
+        ~AllocationTracker() = delete;
+
+        static void SetEnabled(bool isEnabled) noexcept;
+
+        [[nodiscard]]
+        static bool IsEnabled() noexcept
+        {
+            return AllocationTracker::_isEnabled.load(std::memory_order_relaxed);
+        }
+
+        // called from `operator new`, so must not allocate
+        static void RecordAllocation(size_t size) noexcept;
+
+        [[nodiscard]]
+        static AllocationTags GetCurrentTag() noexcept;
+
+        static void SetCurrentTag(AllocationTags tag) noexcept;
+
+        // the counts since the process started
+        [[nodiscard]]
+        static AllocationSnapshot GetSnapshot() noexcept;
+
+        // every tag's allocations added together
+        [[nodiscard]]
+        static uint64_t GetNumberOfAllocations() noexcept;
+
+        // only the calling thread's allocations, whatever their tag
+        [[nodiscard]]
+        static uint64_t GetThreadNumberOfAllocations() noexcept;
+
+        [[nodiscard]]
+        static const char* GetTagName(AllocationTags tag) noexcept;
+
+    private:
+        static inline std::atomic_bool _isEnabled {false};
+    };
+
+    // counts the allocations in the rest of the enclosing scope against `tag`
+    class AllocationScope final
+    {
+    public:
+        explicit AllocationScope(AllocationTags tag) noexcept
+            : _previousTag {AllocationTracker::GetCurrentTag()}
+        {
+            AllocationTracker::SetCurrentTag(tag);
+        }
+
+        ~AllocationScope()
+        {
+            AllocationTracker::SetCurrentTag(this->_previousTag);
+        }
+
+        AllocationScope(const AllocationScope&) = delete;
+        AllocationScope(AllocationScope&&) = delete;
+
+    private:
+        AllocationTags _previousTag {AllocationTags::Untagged};
+    };
+
+    // Adds each tag's allocations since the last `Record` to the global metrics
+    // registry, and the total to a histogram of allocations per tick
+    class AllocationMetrics final
+    {
+    public:
+        AllocationMetrics() noexcept;
+        ~AllocationMetrics() = default;
+
+        AllocationMetrics(const AllocationMetrics&) = delete;
+        AllocationMetrics(AllocationMetrics&&) = delete;
+
+        void Record() noexcept;
+
+    private:
+        std::array<metrics::Counter*, NumberOfAllocationTags> _allocations {};
+        std::array<metrics::Counter*, NumberOfAllocationTags> _bytes {};
+        metrics::Histogram* _tickAllocations {nullptr};
+
+        AllocationSnapshot _lastSnapshot {};
+    };
+
+#define ALLOCATION_CONCATENATE_INTERNAL(a, b) a##b
+#define ALLOCATION_CONCATENATE(a, b) ALLOCATION_CONCATENATE_INTERNAL(a, b)
+
+// `tag` is one of `AllocationTags`, such as `Networking`
+#define ALLOCATION_SCOPE(tag) \
+projectfarm::shared::profiling::AllocationScope ALLOCATION_CONCATENATE(allocationScope, __LINE__) \
+{projectfarm::shared::profiling::AllocationTags::tag}
+}
+
+#endif
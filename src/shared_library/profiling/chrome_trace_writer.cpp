@@ -0,0 +1,81 @@
+#include <cstdio>
+
+#include "chrome_trace_writer.h"
+
+namespace projectfarm::shared::profiling
+{
+    ChromeTraceWriter::ChromeTraceWriter(std::ostream& output) noexcept
+        : _output {output}
+    {
+        this->_output.setf(std::ios::fixed);
+        this->_output.precision(3);
+
+        this->_output << "{\"traceEvents\":[";
+    }
+
+    void ChromeTraceWriter::WriteThreadName(uint64_t threadId, std::string_view name) noexcept
+    {
+        this->WriteSeparator();
+
+        this->_output << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadId
+                      << ",\"args\":{\"name\":";
+        ChromeTraceWriter::WriteJsonString(this->_output, name);
+        this->_output << "}}";
+    }
+
+    void ChromeTraceWriter::WriteEvent(std::string_view name, std::string_view category, double startMicroseconds,
+                                       double durationMicroseconds, uint64_t threadId) noexcept
+    {
+        this->WriteSeparator();
+
+        this->_output << "\n{\"name\":";
+        ChromeTraceWriter::WriteJsonString(this->_output, name);
+        this->_output << ",\"cat\":";
+        ChromeTraceWriter::WriteJsonString(this->_output, category);
+        this->_output << ",\"ph\":\"X\""
+                      << ",\"ts\":" << startMicroseconds
+                      << ",\"dur\":" << durationMicroseconds
+                      << ",\"pid\":1"
+                      << ",\"tid\":" << threadId << "}";
+    }
+
+    void ChromeTraceWriter::Finish() noexcept
+    {
+        this->_output << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    void ChromeTraceWriter::WriteJsonString(std::ostream& output, std::string_view s) noexcept
+    {
+        output << '"';
+
+        for (auto c : s)
+        {
+            if (c == '"' || c == '\\')
+            {
+                output << '\\' << c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20u)
+            {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+                output << escaped;
+            }
+            else
+            {
+                output << c;
+            }
+        }
+
+        output << '"';
+    }
+
+    void ChromeTraceWriter::WriteSeparator() noexcept
+    {
+        if (!this->_isFirstEvent)
+        {
+            this->_output << ",";
+        }
+
+        this->_isFirstEvent = false;
+    }
+}
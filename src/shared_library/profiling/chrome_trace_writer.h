@@ -0,0 +1,41 @@
+#ifndef PROJECTFARM_CHROME_TRACE_WRITER_H
+#define PROJECTFARM_CHROME_TRACE_WRITER_H
+
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+
+namespace projectfarm::shared::profiling
+{
+    // Writes events in the traceEvents json format read by chrome://tracing and
+    // Perfetto. Every event is in the one process, and times are in microseconds.
+    class ChromeTraceWriter final
+    {
+    public:
+        explicit ChromeTraceWriter(std::ostream& output) noexcept;
+        ~ChromeTraceWriter() = default;
+
+        ChromeTraceWriter(const ChromeTraceWriter&) = delete;
+        ChromeTraceWriter(ChromeTraceWriter&&) = delete;
+
+        // shown in the trace instead of the thread's id
+        void WriteThreadName(uint64_t threadId, std::string_view name) noexcept;
+
+        void WriteEvent(std::string_view name, std::string_view category, double startMicroseconds,
+                        double durationMicroseconds, uint64_t threadId) noexcept;
+
+        // must be called once every event has been written
+        void Finish() noexcept;
+
+        // quoted, with every control character escaped
+        static void WriteJsonString(std::ostream& output, std::string_view s) noexcept;
+
+    private:
+        std::ostream& _output;
+        bool _isFirstEvent {true};
+
+        void WriteSeparator() noexcept;
+    };
+}
+
+#endif
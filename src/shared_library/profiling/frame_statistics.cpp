@@ -0,0 +1,182 @@
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+#include "frame_statistics.h"
+#include "api/logging/logging.h"
+
+namespace projectfarm::shared::profiling
+{
+    namespace
+    {
+        const FrameSample EmptyFrame {};
+
+        uint64_t GetTiming(const FrameSample& sample, FrameTimings timing) noexcept
+        {
+            switch (timing)
+            {
+                case FrameTimings::Update:
+                    return sample.UpdateTimeInMicroseconds;
+                case FrameTimings::Render:
+                    return sample.RenderTimeInMicroseconds;
+                default:
+                    return sample.FrameTimeInMicroseconds;
+            }
+        }
+
+        // the nearest rank, so it is always a value that was added
+        uint64_t GetSortedPercentile(const std::vector<uint64_t>& sortedTimes, double percentile) noexcept
+        {
+            auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(sortedTimes.size())));
+
+            return sortedTimes[std::clamp<size_t>(rank, 1u, sortedTimes.size()) - 1u];
+        }
+    }
+
+    FrameStatistics::FrameStatistics(size_t numberOfFrames, uint64_t slowFrameTimeInMicroseconds)
+        : _frames(std::max<size_t>(numberOfFrames, 1u)),
+          _slowFrameTimeInMicroseconds {slowFrameTimeInMicroseconds}
+    {
+        this->_sortedTimes.reserve(this->_frames.size());
+    }
+
+    bool FrameStatistics::AddFrame(const FrameSample& sample) noexcept
+    {
+        this->_frames[this->_nextFrameIndex] = sample;
+        this->_nextFrameIndex = (this->_nextFrameIndex + 1u) % this->_frames.size();
+        this->_numberOfFrames = std::min(this->_numberOfFrames + 1u, this->_frames.size());
+
+        ++this->_numberOfFramesAdded;
+
+        this->_frameTimes.Record(sample.FrameTimeInMicroseconds);
+        this->_updateTimes.Record(sample.UpdateTimeInMicroseconds);
+        this->_renderTimes.Record(sample.RenderTimeInMicroseconds);
+
+        if (sample.FrameTimeInMicroseconds <= this->_slowFrameTimeInMicroseconds)
+        {
+            return false;
+        }
+
+        ++this->_numberOfSlowFrames;
+
+        return true;
+    }
+
+    const FrameSample& FrameStatistics::GetLastFrame() const noexcept
+    {
+        if (this->_numberOfFrames == 0u)
+        {
+            return EmptyFrame;
+        }
+
+        return this->GetFrame(this->_numberOfFrames - 1u);
+    }
+
+    FramePercentiles FrameStatistics::GetPercentiles(FrameTimings timing) const noexcept
+    {
+        if (this->_numberOfFrames == 0u)
+        {
+            return {};
+        }
+
+        this->_sortedTimes.clear();
+
+        for (auto i = 0u; i < this->_numberOfFrames; ++i)
+        {
+            this->_sortedTimes.push_back(GetTiming(this->GetFrame(i), timing));
+        }
+
+        std::sort(this->_sortedTimes.begin(), this->_sortedTimes.end());
+
+        FramePercentiles percentiles;
+        percentiles.P50 = GetSortedPercentile(this->_sortedTimes, 50.0);
+        percentiles.P95 = GetSortedPercentile(this->_sortedTimes, 95.0);
+        percentiles.P99 = GetSortedPercentile(this->_sortedTimes, 99.0);
+
+        return percentiles;
+    }
+
+    const metrics::Histogram& FrameStatistics::GetHistogram(FrameTimings timing) const noexcept
+    {
+        switch (timing)
+        {
+            case FrameTimings::Update:
+                return this->_updateTimes;
+            case FrameTimings::Render:
+                return this->_renderTimes;
+            default:
+                return this->_frameTimes;
+        }
+    }
+
+    double FrameStatistics::GetPacketsPerSecond() const noexcept
+    {
+        uint64_t numberOfPackets {0u};
+        uint64_t timeInMicroseconds {0u};
+
+        for (auto i = 0u; i < this->_numberOfFrames; ++i)
+        {
+            const auto& frame = this->GetFrame(i);
+
+            numberOfPackets += frame.PacketsSent + frame.PacketsReceived;
+            timeInMicroseconds += frame.FrameTimeInMicroseconds;
+        }
+
+        if (timeInMicroseconds == 0u)
+        {
+            return 0.0;
+        }
+
+        return static_cast<double>(numberOfPackets) * 1'000'000.0 / static_cast<double>(timeInMicroseconds);
+    }
+
+    void FrameStatistics::WriteCsv(std::ostream& stream) const noexcept
+    {
+        stream << "frame,frame_us,update_us,render_us,allocations,draw_calls,packets_sent,packets_received,"
+                  "round_trip_us,entities,texture_bytes\n";
+
+        auto firstFrameNumber = this->_numberOfFramesAdded - this->_numberOfFrames;
+
+        for (auto i = 0u; i < this->_numberOfFrames; ++i)
+        {
+            const auto& frame = this->GetFrame(i);
+
+            stream << firstFrameNumber + i << ','
+                   << frame.FrameTimeInMicroseconds << ','
+                   << frame.UpdateTimeInMicroseconds << ','
+                   << frame.RenderTimeInMicroseconds << ','
+                   << frame.Allocations << ','
+                   << frame.DrawCalls << ','
+                   << frame.PacketsSent << ','
+                   << frame.PacketsReceived << ','
+                   << frame.RoundTripTimeInMicroseconds << ','
+                   << frame.NumberOfEntities << ','
+                   << frame.TextureMemoryInBytes << '\n';
+        }
+    }
+
+    bool FrameStatistics::WriteCsvFile(const std::filesystem::path& filePath) const noexcept
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(filePath.parent_path(), ec);
+
+        std::ofstream fp(filePath, std::ios::out | std::ios::trunc);
+        if (!fp.is_open())
+        {
+            api::logging::Log("Failed to open frame statistics file: " + filePath.u8string());
+            return false;
+        }
+
+        this->WriteCsv(fp);
+
+        return static_cast<bool>(fp);
+    }
+
+    const FrameSample& FrameStatistics::GetFrame(size_t index) const noexcept
+    {
+        auto oldestFrameIndex = (this->_nextFrameIndex + this->_frames.size() - this->_numberOfFrames) %
+                                this->_frames.size();
+
+        return this->_frames[(oldestFrameIndex + index) % this->_frames.size()];
+    }
+}
@@ -0,0 +1,129 @@
+#ifndef PROJECTFARM_FRAME_STATISTICS_H
+#define PROJECTFARM_FRAME_STATISTICS_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <ostream>
+#include <filesystem>
+
+#include "metrics/metrics.h"
+
+namespace projectfarm::shared::profiling
+{
+    // what happened in one frame. The counts are for the frame alone, the rest are
+    // what they were at the end of it
+    struct FrameSample
+    {
+        uint64_t FrameTimeInMicroseconds {0u};
+        uint64_t UpdateTimeInMicroseconds {0u};
+        uint64_t RenderTimeInMicroseconds {0u};
+
+        uint64_t Allocations {0u};
+        uint64_t DrawCalls {0u};
+        uint64_t PacketsSent {0u};
+        uint64_t PacketsReceived {0u};
+
+        // zero until the first round trip has been measured
+        uint64_t RoundTripTimeInMicroseconds {0u};
+        uint64_t NumberOfEntities {0u};
+        uint64_t TextureMemoryInBytes {0u};
+    };
+
+    enum class FrameTimings : uint8_t
+    {
+        Frame,
+        Update,
+        Render,
+    };
+
+    struct FramePercentiles
+    {
+        uint64_t P50 {0u};
+        uint64_t P95 {0u};
+        uint64_t P99 {0u};
+    };
+
+    // Keeps the latest frames for the debug HUD and for a CSV trace of the lead up to
+    // a slowdown, and histograms of every frame's timings since it was created. It
+    // doesn't read any clocks or globals, so it can be driven from a test.
+    class FrameStatistics final
+    {
+    public:
+        static constexpr size_t DefaultNumberOfFrames {600u};
+        static constexpr uint64_t DefaultSlowFrameTimeInMicroseconds {50'000u};
+
+        explicit FrameStatistics(size_t numberOfFrames = DefaultNumberOfFrames,
+                                 uint64_t slowFrameTimeInMicroseconds = DefaultSlowFrameTimeInMicroseconds);
+        ~FrameStatistics() = default;
+
+        FrameStatistics(const FrameStatistics&) = delete;
+        FrameStatistics(FrameStatistics&&) = delete;
+
+        // returns whether the frame took longer than the slow frame time
+        bool AddFrame(const FrameSample& sample) noexcept;
+
+        // the frames that are kept, at most the number given on creation
+        [[nodiscard]]
+        size_t GetNumberOfFrames() const noexcept
+        {
+            return this->_numberOfFrames;
+        }
+
+        [[nodiscard]]
+        uint64_t GetNumberOfFramesAdded() const noexcept
+        {
+            return this->_numberOfFramesAdded;
+        }
+
+        [[nodiscard]]
+        uint64_t GetNumberOfSlowFrames() const noexcept
+        {
+            return this->_numberOfSlowFrames;
+        }
+
+        // an empty sample if no frames have been added
+        [[nodiscard]]
+        const FrameSample& GetLastFrame() const noexcept;
+
+        // of the frames that are kept
+        [[nodiscard]]
+        FramePercentiles GetPercentiles(FrameTimings timing) const noexcept;
+
+        // of every frame added
+        [[nodiscard]]
+        const metrics::Histogram& GetHistogram(FrameTimings timing) const noexcept;
+
+        // packets sent and received over the time of the frames that are kept
+        [[nodiscard]]
+        double GetPacketsPerSecond() const noexcept;
+
+        // a header, then the frames that are kept from oldest to newest
+        void WriteCsv(std::ostream& stream) const noexcept;
+
+        [[nodiscard]]
+        bool WriteCsvFile(const std::filesystem::path& filePath) const noexcept;
+
+    private:
+        std::vector<FrameSample> _frames;
+        size_t _nextFrameIndex {0u};
+        size_t _numberOfFrames {0u};
+
+        uint64_t _numberOfFramesAdded {0u};
+        uint64_t _numberOfSlowFrames {0u};
+        uint64_t _slowFrameTimeInMicroseconds {0u};
+
+        metrics::Histogram _frameTimes;
+        metrics::Histogram _updateTimes;
+        metrics::Histogram _renderTimes;
+
+        // reused by `GetPercentiles` so it doesn't allocate each frame
+        mutable std::vector<uint64_t> _sortedTimes;
+
+        // 0 is the oldest frame that is kept
+        [[nodiscard]]
+        const FrameSample& GetFrame(size_t index) const noexcept;
+    };
+}
+
+#endif
@@ -0,0 +1,236 @@
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <string_view>
+#include <iterator>
+
+#include "profiler.h"
+#include "chrome_trace_writer.h"
+#include "api/logging/logging.h"
+
+namespace projectfarm::shared::profiling
+{
+    namespace
+    {
+        // written by its own thread, and only read when exporting, so the lock is
+        // almost never contended
+        struct ThreadEvents
+        {
+            std::mutex Mutex;
+
+            uint32_t ThreadIndex {0u};
+            std::string Name;
+
+            std::vector<ProfileEvent> Events;
+            uint64_t NumberOfEvents {0u};
+        };
+
+        std::mutex threadsMutex;
+        std::vector<std::shared_ptr<ThreadEvents>> threads;
+
+        ThreadEvents& GetThreadEvents() noexcept
+        {
+            thread_local std::shared_ptr<ThreadEvents> threadEvents = []()
+            {
+                auto newThreadEvents = std::make_shared<ThreadEvents>();
+
+                std::scoped_lock lock(threadsMutex);
+
+                newThreadEvents->ThreadIndex = static_cast<uint32_t>(threads.size()) + 1u;
+                threads.push_back(newThreadEvents);
+
+                return newThreadEvents;
+            }();
+
+            return *threadEvents;
+        }
+
+        // the thread's events, oldest first
+        [[nodiscard]]
+        std::vector<ProfileEvent> CopyEvents(ThreadEvents& threadEvents) noexcept
+        {
+            std::scoped_lock lock(threadEvents.Mutex);
+
+            auto& events = threadEvents.Events;
+
+            if (threadEvents.NumberOfEvents <= events.size())
+            {
+                return events;
+            }
+
+            auto start = events.begin() + static_cast<std::ptrdiff_t>(threadEvents.NumberOfEvents % events.size());
+
+            std::vector<ProfileEvent> copy(start, events.end());
+            copy.insert(copy.end(), events.begin(), start);
+
+            return copy;
+        }
+    }
+
+    void Profiler::SetEnabled(bool isEnabled) noexcept
+    {
+        Profiler::_isEnabled = isEnabled;
+    }
+
+    void Profiler::SetThreadName(const std::string& name) noexcept
+    {
+        auto& threadEvents = GetThreadEvents();
+
+        std::scoped_lock lock(threadEvents.Mutex);
+        threadEvents.Name = name;
+    }
+
+    void Profiler::Record(const char* name, uint64_t startNanoseconds, uint64_t endNanoseconds) noexcept
+    {
+        auto& threadEvents = GetThreadEvents();
+
+        std::scoped_lock lock(threadEvents.Mutex);
+
+        auto& events = threadEvents.Events;
+
+        // only threads that record pay for a buffer
+        if (events.empty())
+        {
+            events.reserve(Profiler::MaxEventsPerThread);
+        }
+
+        ProfileEvent event {name, startNanoseconds, endNanoseconds - startNanoseconds};
+
+        if (events.size() < Profiler::MaxEventsPerThread)
+        {
+            events.push_back(event);
+        }
+        else
+        {
+            events[threadEvents.NumberOfEvents % Profiler::MaxEventsPerThread] = event;
+        }
+
+        ++threadEvents.NumberOfEvents;
+    }
+
+    uint64_t Profiler::GetNumberOfEvents() noexcept
+    {
+        std::scoped_lock lock(threadsMutex);
+
+        uint64_t numberOfEvents {0u};
+
+        for (const auto& threadEvents : threads)
+        {
+            std::scoped_lock threadLock(threadEvents->Mutex);
+            numberOfEvents += threadEvents->Events.size();
+        }
+
+        return numberOfEvents;
+    }
+
+    std::vector<ProfileZoneTotal> Profiler::GetZoneTotals() noexcept
+    {
+        std::vector<ProfileZoneTotal> totals;
+
+        std::scoped_lock lock(threadsMutex);
+
+        for (const auto& threadEvents : threads)
+        {
+            std::scoped_lock threadLock(threadEvents->Mutex);
+
+            for (const auto& event : threadEvents->Events)
+            {
+                // the same literal can have a different address in each translation unit
+                auto total = std::find_if(totals.begin(), totals.end(), [&event](const auto& t)
+                {
+                    return t.Name == event.Name || std::string_view(t.Name) == event.Name;
+                });
+
+                if (total == totals.end())
+                {
+                    totals.push_back({event.Name, 0u, 0u, 0u});
+                    total = std::prev(totals.end());
+                }
+
+                ++total->NumberOfEvents;
+                total->TotalNanoseconds += event.DurationNanoseconds;
+                total->MaxNanoseconds = std::max(total->MaxNanoseconds, event.DurationNanoseconds);
+            }
+        }
+
+        std::sort(totals.begin(), totals.end(), [](const auto& a, const auto& b)
+        {
+            return a.TotalNanoseconds > b.TotalNanoseconds;
+        });
+
+        return totals;
+    }
+
+    bool Profiler::ExportChromeTrace(const std::filesystem::path& filePath) noexcept
+    {
+        std::vector<std::pair<std::shared_ptr<ThreadEvents>, std::vector<ProfileEvent>>> threadsToExport;
+
+        {
+            std::scoped_lock lock(threadsMutex);
+
+            for (const auto& threadEvents : threads)
+            {
+                threadsToExport.emplace_back(threadEvents, CopyEvents(*threadEvents));
+            }
+        }
+
+        auto startNanoseconds = UINT64_MAX;
+        for (const auto& [_, events] : threadsToExport)
+        {
+            for (const auto& event : events)
+            {
+                startNanoseconds = std::min(startNanoseconds, event.StartNanoseconds);
+            }
+        }
+
+        std::ofstream fp(filePath);
+        if (!fp.is_open())
+        {
+            api::logging::Log("Failed to open Chrome trace file: " + filePath.u8string());
+            return false;
+        }
+
+        ChromeTraceWriter writer(fp);
+
+        for (const auto& [threadEvents, events] : threadsToExport)
+        {
+            std::string threadName;
+            {
+                std::scoped_lock lock(threadEvents->Mutex);
+                threadName = threadEvents->Name;
+            }
+
+            if (!threadName.empty())
+            {
+                writer.WriteThreadName(threadEvents->ThreadIndex, threadName);
+            }
+
+            for (const auto& event : events)
+            {
+                writer.WriteEvent(event.Name, "tick",
+                                  static_cast<double>(event.StartNanoseconds - startNanoseconds) / 1000.0,
+                                  static_cast<double>(event.DurationNanoseconds) / 1000.0,
+                                  threadEvents->ThreadIndex);
+            }
+        }
+
+        writer.Finish();
+
+        return fp.good();
+    }
+
+    void Profiler::Clear() noexcept
+    {
+        std::scoped_lock lock(threadsMutex);
+
+        for (const auto& threadEvents : threads)
+        {
+            std::scoped_lock threadLock(threadEvents->Mutex);
+
+            threadEvents->Events.clear();
+            threadEvents->NumberOfEvents = 0u;
+        }
+    }
+}
@@ -0,0 +1,114 @@
+#ifndef PROJECTFARM_PROFILER_H
+#define PROJECTFARM_PROFILER_H
+
+#include <cstdint>
+#include <string>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <vector>
+
+namespace projectfarm::shared::profiling
+{
+    struct ProfileEvent
+    {
+        // a string literal, so only the pointer is kept
+        const char* Name {nullptr};
+
+        uint64_t StartNanoseconds {0u};
+        uint64_t DurationNanoseconds {0u};
+    };
+
+    struct ProfileZoneTotal
+    {
+        const char* Name {nullptr};
+
+        uint64_t NumberOfEvents {0u};
+        uint64_t TotalNanoseconds {0u};
+        uint64_t MaxNanoseconds {0u};
+    };
+
+    // Records how long zones of code take on each thread, to be viewed in
+    // chrome://tracing or Perfetto. Each thread records into its own buffer, which
+    // keeps its latest `MaxEventsPerThread` events. Zones are only recorded while the
+    // profiler is enabled, and are compiled out unless `ENABLE_PROFILER` is defined.
+    class Profiler final
+    {
+    public:
+        static constexpr uint32_t MaxEventsPerThread {1u << 16u};
+
+        static void SetEnabled(bool isEnabled) noexcept;
+
+        [[nodiscard]]
+        static bool IsEnabled() noexcept
+        {
+            return Profiler::_isEnabled.load(std::memory_order_relaxed);
+        }
+
+        // shown in the trace instead of the thread's number
+        static void SetThreadName(const std::string& name) noexcept;
+
+        [[nodiscard]]
+        static uint64_t GetNanoseconds() noexcept
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        static void Record(const char* name, uint64_t startNanoseconds, uint64_t endNanoseconds) noexcept;
+
+        [[nodiscard]]
+        static uint64_t GetNumberOfEvents() noexcept;
+
+        // the events that are kept, added together by zone name across every thread,
+        // with the longest total first. Nested zones are each counted in full
+        [[nodiscard]]
+        static std::vector<ProfileZoneTotal> GetZoneTotals() noexcept;
+
+        [[nodiscard]]
+        static bool ExportChromeTrace(const std::filesystem::path& filePath) noexcept;
+
+        static void Clear() noexcept;
+
+    private:
+        static inline std::atomic_bool _isEnabled {false};
+    };
+
+    class ProfileZone final
+    {
+    public:
+        explicit ProfileZone(const char* name) noexcept
+            : _name {name},
+              _startNanoseconds {Profiler::IsEnabled() ? Profiler::GetNanoseconds() : 0u}
+        {
+        }
+
+        ~ProfileZone()
+        {
+            if (this->_startNanoseconds > 0u)
+            {
+                Profiler::Record(this->_name, this->_startNanoseconds, Profiler::GetNanoseconds());
+            }
+        }
+
+        ProfileZone(const ProfileZone&) = delete;
+        ProfileZone(ProfileZone&&) = delete;
+
+    private:
+        const char* _name {nullptr};
+        uint64_t _startNanoseconds {0u};
+    };
+
+#define PROFILE_CONCATENATE_INTERNAL(a, b) a##b
+#define PROFILE_CONCATENATE(a, b) PROFILE_CONCATENATE_INTERNAL(a, b)
+
+#ifdef ENABLE_PROFILER
+// times the rest of the enclosing scope. `name` must be a string literal
+#define PROFILE_ZONE(name) \
+projectfarm::shared::profiling::ProfileZone PROFILE_CONCATENATE(profileZone, __LINE__) {name}
+#else
+#define PROFILE_ZONE(name)
+#endif
+}
+
+#endif
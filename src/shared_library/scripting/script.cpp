@@ -1,6 +1,11 @@
+#include <chrono>
+
 #include "script.h"
 #include "script_system.h"
 #include "api/logging/logging.h"
+#include "profiling/profiler.h"
+#include "profiling/allocation_tracker.h"
+#include "metrics/metrics_registry.h"
 
 using namespace std::literals;
 
@@ -37,7 +42,7 @@ namespace projectfarm::shared::scripting
 
         auto function = this->_functions[type].Get(this->_isolate);
 
-        if (!this->CallFunction(function, parameters))
+        if (!this->CallFunction(type, function, parameters))
         {
             api::logging::Log("Failed to call function: "s + std::to_string(static_cast<uint8_t>(type)));
             return false;
@@ -57,7 +62,7 @@ namespace projectfarm::shared::scripting
         if (auto function = ScriptSystem::ExtractFunctionFromContextGlobalScope(context, name);
             function)
         {
-            if (!this->CallFunction(*function, parameters))
+            if (!this->CallFunction(FunctionTypes::UnknownFunction, *function, parameters))
             {
                 api::logging::Log("Failed to call function: "s + name);
                 return false;
@@ -71,9 +76,18 @@ namespace projectfarm::shared::scripting
         }
     }
 
-    bool Script::CallFunction(v8::Local<v8::Function> function,
+    bool Script::CallFunction(FunctionTypes type,
+                              v8::Local<v8::Function> function,
                               const std::vector<FunctionParameter>& parameters) noexcept
     {
+        PROFILE_ZONE("Script::CallFunction");
+        ALLOCATION_SCOPE(Scripting);
+
+        static auto& callDuration = metrics::MetricsRegistry::GetGlobal().GetHistogram(
+                "projectfarm_script_call_duration_microseconds", "How long calls into scripts take.");
+
+        metrics::ScopedTimer timer(callDuration);
+
         v8::Isolate::Scope isolateScope(this->_isolate);
 
         auto handleScope = v8::HandleScope(this->_isolate);
@@ -86,8 +100,17 @@ namespace projectfarm::shared::scripting
 
         auto args = this->GetFunctionArguments(parameters);
 
+        auto isProfiling = this->_profiler && this->_profiler->IsEnabled();
+        auto start = isProfiling ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point {};
+
         v8::Local<v8::Value> functionResult;
         auto callFunctionResult = function->Call(context, globalVariableScope, static_cast<int>(args.size()), args.data());
+
+        if (isProfiling)
+        {
+            this->_profiler->RecordCall(this->_name, type, start, std::chrono::steady_clock::now());
+        }
+
         if (!callFunctionResult.ToLocal(&functionResult))
         {
             auto s = function->GetName()->ToString(context).FromMaybe(v8::String::NewFromUtf8(this->_isolate, "").ToLocalChecked());
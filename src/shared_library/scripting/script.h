@@ -3,11 +3,14 @@
 
 #include <vector>
 #include <unordered_map>
+#include <string>
+#include <memory>
 
 #include <v8.h>
 
 #include "function_types.h"
 #include "function_parameter.h"
+#include "script_profiler.h"
 
 namespace projectfarm::shared::scripting
 {
@@ -22,6 +25,26 @@ namespace projectfarm::shared::scripting
             this->_isolate = isolate;
         }
 
+        [[nodiscard]] v8::Isolate* GetIsolate() const noexcept
+        {
+            return this->_isolate;
+        }
+
+        void SetName(const std::string& name) noexcept
+        {
+            this->_name = name;
+        }
+
+        [[nodiscard]] const std::string& GetName() const noexcept
+        {
+            return this->_name;
+        }
+
+        void SetProfiler(const std::shared_ptr<ScriptProfiler>& profiler) noexcept
+        {
+            this->_profiler = profiler;
+        }
+
         void SetContext(const v8::Local<v8::Context>& context) noexcept
         {
             this->_context.Reset(this->_isolate, context);
@@ -79,11 +102,16 @@ namespace projectfarm::shared::scripting
         v8::Persistent<v8::Context> _context;
 
     private:
+        std::string _name;
+
+        std::shared_ptr<ScriptProfiler> _profiler;
+
         [[nodiscard]]
         std::vector<v8::Local<v8::Value>> GetFunctionArguments(const std::vector<FunctionParameter>& parameters) const noexcept;
 
         [[nodiscard]]
-        bool CallFunction(v8::Local<v8::Function> function,
+        bool CallFunction(FunctionTypes type,
+                          v8::Local<v8::Function> function,
                           const std::vector<FunctionParameter>& parameters) noexcept;
     };
 }
@@ -0,0 +1,273 @@
+#include <fstream>
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+#include "script_profiler.h"
+#include "script_system.h"
+#include "api/logging/logging.h"
+#include "profiling/chrome_trace_writer.h"
+
+namespace projectfarm::shared::scripting
+{
+    void ScriptProfiler::StartSampling(v8::Isolate* isolate) noexcept
+    {
+        std::scoped_lock lock(this->_mutex);
+
+        if (this->_cpuProfilers.find(isolate) != this->_cpuProfilers.end())
+        {
+            return;
+        }
+
+        v8::Isolate::Scope isolateScope(isolate);
+        v8::HandleScope handleScope(isolate);
+
+        auto cpuProfiler = v8::CpuProfiler::New(isolate);
+
+        cpuProfiler->StartProfiling(v8::String::NewFromUtf8(isolate, ScriptProfiler::ProfileTitle).ToLocalChecked(),
+                                    true);
+
+        this->_cpuProfilers[isolate] = cpuProfiler;
+    }
+
+    void ScriptProfiler::StopSampling(v8::Isolate* isolate) noexcept
+    {
+        std::scoped_lock lock(this->_mutex);
+
+        auto iter = this->_cpuProfilers.find(isolate);
+        if (iter == this->_cpuProfilers.end())
+        {
+            return;
+        }
+
+        this->StopAndCollect(isolate, iter->second);
+
+        iter->second->Dispose();
+
+        this->_cpuProfilers.erase(iter);
+    }
+
+    bool ScriptProfiler::IsSampling(v8::Isolate* isolate) const noexcept
+    {
+        std::scoped_lock lock(this->_mutex);
+
+        return this->_cpuProfilers.find(isolate) != this->_cpuProfilers.end();
+    }
+
+    void ScriptProfiler::CollectSamples(v8::Isolate* isolate) noexcept
+    {
+        std::scoped_lock lock(this->_mutex);
+
+        auto iter = this->_cpuProfilers.find(isolate);
+        if (iter == this->_cpuProfilers.end())
+        {
+            return;
+        }
+
+        this->StopAndCollect(isolate, iter->second);
+
+        v8::Isolate::Scope isolateScope(isolate);
+        v8::HandleScope handleScope(isolate);
+
+        iter->second->StartProfiling(v8::String::NewFromUtf8(isolate, ScriptProfiler::ProfileTitle).ToLocalChecked(),
+                                     true);
+    }
+
+    void ScriptProfiler::RecordCall(const std::string& scriptName, FunctionTypes functionType,
+                                    std::chrono::steady_clock::time_point start,
+                                    std::chrono::steady_clock::time_point end) noexcept
+    {
+        auto duration = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+        auto startMicroseconds = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(start - this->_startTime).count());
+
+        auto threadId = static_cast<uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+        std::scoped_lock lock(this->_mutex);
+
+        auto& counters = this->_callCounters[{scriptName, functionType}];
+        ++counters.NumberOfCalls;
+        counters.TotalMicroseconds += duration;
+        counters.MaxMicroseconds = std::max(counters.MaxMicroseconds, duration);
+
+        if (this->_traceEvents.size() >= ScriptProfiler::MaxTraceEvents)
+        {
+            this->_traceEvents.pop_front();
+        }
+
+        this->_traceEvents.push_back({scriptName + ":" + ScriptSystem::GetFunctionName(functionType),
+                                      startMicroseconds, duration, threadId});
+    }
+
+    std::map<std::pair<std::string, FunctionTypes>, ScriptCallCounters> ScriptProfiler::GetCallCounters() const noexcept
+    {
+        std::scoped_lock lock(this->_mutex);
+
+        return this->_callCounters;
+    }
+
+    std::map<std::string, uint64_t> ScriptProfiler::GetCollapsedStacks() const noexcept
+    {
+        std::scoped_lock lock(this->_mutex);
+
+        return this->_collapsedStacks;
+    }
+
+    bool ScriptProfiler::ExportCollapsedStacks(const std::filesystem::path& filePath) const noexcept
+    {
+        std::ofstream fp(filePath);
+        if (!fp.is_open())
+        {
+            api::logging::Log("Failed to open collapsed stacks file: " + filePath.u8string());
+            return false;
+        }
+
+        std::scoped_lock lock(this->_mutex);
+
+        for (const auto& [stack, hits] : this->_collapsedStacks)
+        {
+            fp << stack << " " << hits << "\n";
+        }
+
+        return fp.good();
+    }
+
+    bool ScriptProfiler::ExportChromeTrace(const std::filesystem::path& filePath) const noexcept
+    {
+        std::ofstream fp(filePath);
+        if (!fp.is_open())
+        {
+            api::logging::Log("Failed to open Chrome trace file: " + filePath.u8string());
+            return false;
+        }
+
+        std::scoped_lock lock(this->_mutex);
+
+        profiling::ChromeTraceWriter writer(fp);
+
+        for (const auto& event : this->_traceEvents)
+        {
+            writer.WriteEvent(event.Name, "script", static_cast<double>(event.StartMicroseconds),
+                              static_cast<double>(event.DurationMicroseconds), event.ThreadId);
+        }
+
+        writer.Finish();
+
+        return fp.good();
+    }
+
+    bool ScriptProfiler::ExportCallCounters(const std::filesystem::path& filePath) const noexcept
+    {
+        std::ofstream fp(filePath);
+        if (!fp.is_open())
+        {
+            api::logging::Log("Failed to open call counters file: " + filePath.u8string());
+            return false;
+        }
+
+        std::scoped_lock lock(this->_mutex);
+
+        fp << "script,function,calls,total_us,max_us\n";
+
+        for (const auto& [key, counters] : this->_callCounters)
+        {
+            fp << ScriptProfiler::EscapeCsvField(key.first) << ","
+               << ScriptProfiler::EscapeCsvField(ScriptSystem::GetFunctionName(key.second)) << ","
+               << counters.NumberOfCalls << ","
+               << counters.TotalMicroseconds << ","
+               << counters.MaxMicroseconds << "\n";
+        }
+
+        return fp.good();
+    }
+
+    void ScriptProfiler::Clear() noexcept
+    {
+        std::scoped_lock lock(this->_mutex);
+
+        this->_callCounters.clear();
+        this->_traceEvents.clear();
+        this->_collapsedStacks.clear();
+    }
+
+    void ScriptProfiler::StopAndCollect(v8::Isolate* isolate, v8::CpuProfiler* cpuProfiler) noexcept
+    {
+        v8::Isolate::Scope isolateScope(isolate);
+        v8::HandleScope handleScope(isolate);
+
+        auto profile = cpuProfiler->StopProfiling(
+                v8::String::NewFromUtf8(isolate, ScriptProfiler::ProfileTitle).ToLocalChecked());
+
+        if (!profile)
+        {
+            return;
+        }
+
+        this->AddCollapsedStacks(profile->GetTopDownRoot(), "");
+
+        profile->Delete();
+    }
+
+    void ScriptProfiler::AddCollapsedStacks(const v8::CpuProfileNode* node, const std::string& parentStack) noexcept
+    {
+        auto name = ScriptProfiler::GetNodeName(node);
+
+        // the root node is not a real frame
+        auto stack = parentStack.empty() && name == "(root)" ? ""
+                   : parentStack.empty() ? name
+                   : parentStack + ";" + name;
+
+        if (auto hits = node->GetHitCount(); hits > 0 && !stack.empty())
+        {
+            this->_collapsedStacks[stack] += hits;
+        }
+
+        for (auto i = 0; i < node->GetChildrenCount(); ++i)
+        {
+            this->AddCollapsedStacks(node->GetChild(i), stack);
+        }
+    }
+
+    std::string ScriptProfiler::GetNodeName(const v8::CpuProfileNode* node) noexcept
+    {
+        std::string name = node->GetFunctionNameStr();
+        if (name.empty())
+        {
+            name = "(anonymous)";
+        }
+
+        if (std::string resourceName = node->GetScriptResourceNameStr(); !resourceName.empty())
+        {
+            name += " (" + resourceName + ":" + std::to_string(node->GetLineNumber()) + ")";
+        }
+
+        // `;` separates frames in the collapsed format
+        std::replace(name.begin(), name.end(), ';', ':');
+
+        return name;
+    }
+
+    std::string ScriptProfiler::EscapeCsvField(std::string_view s) noexcept
+    {
+        std::string escaped;
+        escaped.reserve(s.size() + 2);
+
+        escaped += '"';
+
+        for (auto c : s)
+        {
+            if (c == '"')
+            {
+                escaped += '"';
+            }
+
+            escaped += c;
+        }
+
+        escaped += '"';
+
+        return escaped;
+    }
+}
@@ -0,0 +1,125 @@
+#ifndef PROJECTFARM_SCRIPT_PROFILER_H
+#define PROJECTFARM_SCRIPT_PROFILER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <unordered_map>
+#include <v8.h>
+#include <v8-profiler.h>
+
+#include "function_types.h"
+
+namespace projectfarm::shared::scripting
+{
+    struct ScriptCallCounters
+    {
+        uint64_t NumberOfCalls {0u};
+        uint64_t TotalMicroseconds {0u};
+        uint64_t MaxMicroseconds {0u};
+    };
+
+    // Opt-in profiler for scripts. When enabled, every script function call is
+    // timed, and the v8 CPU profiler samples the isolates that profiling was
+    // started on. The results can be exported as collapsed stacks (for flame graphs)
+    // and as Chrome trace files (for chrome://tracing or Perfetto).
+    class ScriptProfiler final
+    {
+    public:
+        ScriptProfiler() = default;
+        ~ScriptProfiler() = default;
+
+        [[nodiscard]]
+        bool IsEnabled() const noexcept
+        {
+            return this->_isEnabled;
+        }
+
+        void SetEnabled(bool isEnabled) noexcept
+        {
+            this->_isEnabled = isEnabled;
+        }
+
+        // starts sampling `isolate`. This must be called on the thread that owns `isolate`.
+        void StartSampling(v8::Isolate* isolate) noexcept;
+
+        // stops sampling `isolate` and keeps the samples taken. This must be called
+        // before `isolate` is disposed.
+        void StopSampling(v8::Isolate* isolate) noexcept;
+
+        [[nodiscard]]
+        bool IsSampling(v8::Isolate* isolate) const noexcept;
+
+        void RecordCall(const std::string& scriptName, FunctionTypes functionType,
+                        std::chrono::steady_clock::time_point start,
+                        std::chrono::steady_clock::time_point end) noexcept;
+
+        [[nodiscard]]
+        std::map<std::pair<std::string, FunctionTypes>, ScriptCallCounters> GetCallCounters() const noexcept;
+
+        // collects the samples taken so far for `isolate` and keeps sampling.
+        // This must be called on the thread that owns `isolate`.
+        void CollectSamples(v8::Isolate* isolate) noexcept;
+
+        [[nodiscard]]
+        std::map<std::string, uint64_t> GetCollapsedStacks() const noexcept;
+
+        [[nodiscard]]
+        bool ExportCollapsedStacks(const std::filesystem::path& filePath) const noexcept;
+
+        [[nodiscard]]
+        bool ExportChromeTrace(const std::filesystem::path& filePath) const noexcept;
+
+        [[nodiscard]]
+        bool ExportCallCounters(const std::filesystem::path& filePath) const noexcept;
+
+        void Clear() noexcept;
+
+    private:
+        struct TraceEvent
+        {
+            std::string Name;
+            uint64_t StartMicroseconds {0u};
+            uint64_t DurationMicroseconds {0u};
+            uint64_t ThreadId {0u};
+        };
+
+        // keep the trace bounded, as a long profiling session would otherwise grow forever
+        static constexpr size_t MaxTraceEvents {100000u};
+
+        static constexpr auto ProfileTitle = "projectfarm";
+
+        std::atomic<bool> _isEnabled {false};
+
+        std::chrono::steady_clock::time_point _startTime {std::chrono::steady_clock::now()};
+
+        mutable std::mutex _mutex;
+
+        std::map<std::pair<std::string, FunctionTypes>, ScriptCallCounters> _callCounters;
+        std::deque<TraceEvent> _traceEvents;
+
+        // collapsed stack -> number of samples
+        std::map<std::string, uint64_t> _collapsedStacks;
+
+        std::unordered_map<v8::Isolate*, v8::CpuProfiler*> _cpuProfilers;
+
+        void StopAndCollect(v8::Isolate* isolate, v8::CpuProfiler* cpuProfiler) noexcept;
+
+        // `_mutex` must be held
+        void AddCollapsedStacks(const v8::CpuProfileNode* node, const std::string& parentStack) noexcept;
+
+        [[nodiscard]]
+        static std::string GetNodeName(const v8::CpuProfileNode* node) noexcept;
+
+        [[nodiscard]]
+        static std::string EscapeCsvField(std::string_view s) noexcept;
+    };
+}
+
+#endif
@@ -1,6 +1,9 @@
 #include <fstream>
 #include <sstream>
 #include <cmath>
+#include <memory>
+#include <algorithm>
+#include <unordered_set>
 
 #include <libplatform/libplatform.h>
 #include <v8.h>
@@ -15,16 +18,93 @@ using namespace std::literals;
 
 namespace projectfarm::shared::scripting
 {
+    struct ScriptIsolates
+    {
+        std::mutex Mutex;
+        std::unordered_set<v8::Isolate*> Isolates;
+
+        std::shared_ptr<ScriptProfiler> Profiler;
+
+        // false if it was already disposed of, which happens on shutdown
+        bool Dispose(v8::Isolate* isolate) noexcept
+        {
+            std::scoped_lock lock(this->Mutex);
+
+            if (this->Isolates.erase(isolate) == 0u)
+            {
+                return false;
+            }
+
+            this->Profiler->StopSampling(isolate);
+
+            isolate->Dispose();
+
+            return true;
+        }
+    };
+
+    namespace
+    {
+        struct ThreadIsolate
+        {
+            std::weak_ptr<ScriptIsolates> Owner;
+            v8::Isolate* Isolate {nullptr};
+        };
+
+        // The isolates of the thread, one for each script system. A thread id can be reused
+        // once its thread exits, so the isolates are owned by the thread, not kept by its id.
+        struct ThreadIsolates
+        {
+            std::vector<ThreadIsolate> Isolates;
+
+            ~ThreadIsolates()
+            {
+                for (const auto& threadIsolate : this->Isolates)
+                {
+                    if (auto owner = threadIsolate.Owner.lock(); owner)
+                    {
+                        owner->Dispose(threadIsolate.Isolate);
+                    }
+                }
+            }
+
+            // also drops the isolates of script systems that have since shut down
+            std::vector<ThreadIsolate>::iterator Find(const std::shared_ptr<ScriptIsolates>& owner) noexcept
+            {
+                this->Isolates.erase(std::remove_if(this->Isolates.begin(), this->Isolates.end(),
+                                                    [](const auto& threadIsolate)
+                                                    {
+                                                        return threadIsolate.Owner.expired();
+                                                    }),
+                                     this->Isolates.end());
+
+                return std::find_if(this->Isolates.begin(), this->Isolates.end(),
+                                    [&owner](const auto& threadIsolate)
+                                    {
+                                        return threadIsolate.Owner.lock() == owner;
+                                    });
+            }
+        };
+
+        thread_local ThreadIsolates CurrentThreadIsolates;
+    }
+
     bool ScriptSystem::Initialize(const std::filesystem::path& executableDirectory) noexcept
     {
         api::logging::Log("Initializing v8 with version: "s + v8::V8::GetVersion());
 
-        v8::V8::InitializeICUDefaultLocation(executableDirectory.u8string().c_str());
-        // our v8 was compiled not to use external data
-        //v8::V8::InitializeExternalStartupData(executableDirectory.u8string().c_str());
-        this->_platform = v8::platform::NewDefaultPlatform();
-        v8::V8::InitializePlatform(this->_platform.get());
-        v8::V8::Initialize();
+        // v8 cannot be initialized again once it has been disposed, so it is
+        // initialized once per process and left for the process to clean up
+        static std::once_flag v8InitializedFlag;
+        std::call_once(v8InitializedFlag, [&executableDirectory]()
+        {
+            v8::V8::InitializeICUDefaultLocation(executableDirectory.u8string().c_str());
+            // our v8 was compiled not to use external data
+            //v8::V8::InitializeExternalStartupData(executableDirectory.u8string().c_str());
+            ScriptSystem::Platform = v8::platform::NewDefaultPlatform();
+            v8::V8::InitializePlatform(ScriptSystem::Platform.get());
+            v8::V8::Initialize();
+        });
 
         this->_createParams.array_buffer_allocator = v8::ArrayBuffer::Allocator::NewDefaultAllocator();
 
@@ -32,7 +112,17 @@ namespace projectfarm::shared::scripting
         v8::V8::SetFlagsFromString("--expose-gc");
 #endif
 
-        this->_isolate = v8::Isolate::New(this->_createParams);
+        this->_isolates = std::make_shared<ScriptIsolates>();
+        this->_isolates->Profiler = this->_profiler;
+
+        this->_isInitialized = true;
+
+        // the initializing thread will almost always create scripts, so give it an isolate now
+        if (!this->GetIsolateForCurrentThread())
+        {
+            api::logging::Log("Failed to create isolate for the initializing thread.");
+            return false;
+        }
 
         api::logging::Log("Initialized v8.");
 
@@ -45,17 +135,26 @@ namespace projectfarm::shared::scripting
 
         GCPersistent::ClearDeleteQueue();
 
-        if (this->_isolate)
+        if (this->_isolates)
         {
-            this->_isolate->Dispose();
-            this->_isolate = nullptr;
+            std::scoped_lock lock(this->_isolates->Mutex);
+
+            for (auto isolate : this->_isolates->Isolates)
+            {
+                this->_profiler->StopSampling(isolate);
 
-            // if the isolate is nullptr, this wasn't initialized
-            v8::V8::Dispose();
-            v8::V8::ShutdownPlatform();
+                isolate->Dispose();
+            }
+
+            this->_isolates->Isolates.clear();
         }
 
-        this->_platform = nullptr;
+        this->_profiler->SetEnabled(false);
+
+        // the threads' isolates of this script system are dropped once they see it has gone
+        this->_isolates = nullptr;
+
+        this->_isInitialized = false;
 
         if (this->_createParams.array_buffer_allocator)
         {
@@ -63,33 +162,197 @@ namespace projectfarm::shared::scripting
             this->_createParams.array_buffer_allocator = nullptr;
         }
 
+        {
+            std::scoped_lock lock(this->_sourceCacheMutex);
+            this->_sourceCache.clear();
+        }
+
+        {
+            std::scoped_lock lock(this->_codeCacheMutex);
+            this->_codeCache.clear();
+        }
+
         api::logging::Log("Shut down v8.");
     }
 
-    std::shared_ptr<Script> ScriptSystem::CreateScript(ScriptTypes type, const std::filesystem::path& filePath) noexcept
+    v8::Isolate* ScriptSystem::GetIsolateForCurrentThread() noexcept
+    {
+        if (!this->_isInitialized)
+        {
+            api::logging::Log("The script system has not been initialized.");
+            return nullptr;
+        }
+
+        if (auto iter = CurrentThreadIsolates.Find(this->_isolates); iter != CurrentThreadIsolates.Isolates.end())
+        {
+            return iter->Isolate;
+        }
+
+        auto isolate = v8::Isolate::New(this->_createParams);
+
+        {
+            std::scoped_lock lock(this->_isolates->Mutex);
+            this->_isolates->Isolates.insert(isolate);
+        }
+
+        CurrentThreadIsolates.Isolates.push_back({this->_isolates, isolate});
+
+        return isolate;
+    }
+
+    void ScriptSystem::ReleaseIsolateForCurrentThread() noexcept
+    {
+        if (!this->_isolates)
+        {
+            return;
+        }
+
+        auto iter = CurrentThreadIsolates.Find(this->_isolates);
+        if (iter == CurrentThreadIsolates.Isolates.end())
+        {
+            return;
+        }
+
+        this->_isolates->Dispose(iter->Isolate);
+
+        CurrentThreadIsolates.Isolates.erase(iter);
+    }
+
+    size_t ScriptSystem::GetNumberOfIsolates() const noexcept
+    {
+        if (!this->_isolates)
+        {
+            return 0u;
+        }
+
+        std::scoped_lock lock(this->_isolates->Mutex);
+
+        return this->_isolates->Isolates.size();
+    }
+
+    void ScriptSystem::StartProfiling() noexcept
+    {
+        auto isolate = this->GetIsolateForCurrentThread();
+        if (!isolate)
+        {
+            api::logging::Log("Failed to get isolate for the current thread.");
+            return;
+        }
+
+        this->_profiler->SetEnabled(true);
+        this->_profiler->StartSampling(isolate);
+
+        api::logging::Log("Started profiling scripts.");
+    }
+
+    void ScriptSystem::StopProfiling() noexcept
+    {
+        this->_profiler->SetEnabled(false);
+
+        if (auto isolate = this->GetIsolateForCurrentThread(); isolate)
+        {
+            this->_profiler->StopSampling(isolate);
+        }
+
+        api::logging::Log("Stopped profiling scripts.");
+    }
+
+    bool ScriptSystem::ExportProfile(const std::filesystem::path& outputDirectory) noexcept
+    {
+        if (auto isolate = this->GetIsolateForCurrentThread(); isolate)
+        {
+            this->_profiler->CollectSamples(isolate);
+        }
+
+        std::error_code ec;
+        std::filesystem::create_directories(outputDirectory, ec);
+        if (ec)
+        {
+            api::logging::Log("Failed to create profile directory: " + outputDirectory.u8string() +
+                              " with error: " + ec.message());
+            return false;
+        }
+
+        if (!this->_profiler->ExportCollapsedStacks(outputDirectory / "scripts.folded"))
+        {
+            api::logging::Log("Failed to export collapsed stacks.");
+            return false;
+        }
+
+        if (!this->_profiler->ExportChromeTrace(outputDirectory / "scripts.trace.json"))
+        {
+            api::logging::Log("Failed to export Chrome trace.");
+            return false;
+        }
+
+        if (!this->_profiler->ExportCallCounters(outputDirectory / "scripts.calls.csv"))
+        {
+            api::logging::Log("Failed to export call counters.");
+            return false;
+        }
+
+        api::logging::Log("Exported script profile to: " + outputDirectory.u8string());
+
+        return true;
+    }
+
+    std::optional<std::string> ScriptSystem::ReadScriptFile(const std::filesystem::path& filePath) noexcept
     {
+        auto key = filePath.u8string();
+        auto stamp = FileStamp::Get(filePath);
+
+        std::scoped_lock lock(this->_sourceCacheMutex);
+
+        if (auto iter = this->_sourceCache.find(key);
+            iter != this->_sourceCache.end() && stamp.Exists && iter->second.Stamp == stamp)
+        {
+            return iter->second.Code;
+        }
+
         std::ifstream fp(filePath);
 
         if (!fp.is_open())
         {
-            api::logging::Log("Failed to open file: " + filePath.u8string());
-            return nullptr;
+            api::logging::Log("Failed to open file: " + key);
+            return {};
         }
 
         std::stringstream ss;
         ss << fp.rdbuf();
 
-        std::string code = ss.str();
+        auto code = ss.str();
+
+        this->_sourceCache[key] = { stamp, code };
+
+        return code;
+    }
+
+    std::shared_ptr<Script> ScriptSystem::CreateScript(ScriptTypes type, const std::filesystem::path& filePath) noexcept
+    {
+        auto code = this->ReadScriptFile(filePath);
+        if (!code)
+        {
+            api::logging::Log("Failed to read script file: " + filePath.u8string());
+            return nullptr;
+        }
 
-        return this->CreateScript(type, code);
+        return this->CreateScript(type, *code, filePath.u8string());
     }
 
-    std::shared_ptr<Script> ScriptSystem::CreateScript(ScriptTypes type, const std::string& code) noexcept
+    std::shared_ptr<Script> ScriptSystem::CreateScript(ScriptTypes type, const std::string& code,
+                                                       const std::string& name) noexcept
     {
-        v8::Isolate::Scope isolateScope(this->_isolate);
+        auto isolate = this->GetIsolateForCurrentThread();
+        if (!isolate)
+        {
+            api::logging::Log("Failed to get isolate for the current thread.");
+            return {};
+        }
+
+        v8::Isolate::Scope isolateScope(isolate);
 
-        v8::HandleScope handleScope(this->_isolate);
-        v8::TryCatch tryCatch(this->_isolate);
+        v8::HandleScope handleScope(isolate);
+        v8::TryCatch tryCatch(isolate);
 
         auto script = this->_scriptFactory->CreateScript(type);
         if (!script)
@@ -98,20 +361,22 @@ namespace projectfarm::shared::scripting
             return {};
         }
 
-        script->SetIsolate(this->_isolate);
+        script->SetIsolate(isolate);
+        script->SetName(name);
+        script->SetProfiler(this->_profiler);
 
-        auto context = type == ScriptTypes::Include ? this->_isolate->GetCurrentContext()
-                                                    : this->CreateNewScriptContext(script);
+        auto context = type == ScriptTypes::Include ? isolate->GetCurrentContext()
+                                                    : this->CreateNewScriptContext(isolate, script);
 
         v8::Context::Scope contextScope(context);
 
-        if (!this->CompileCode(code, context, tryCatch))
+        if (!this->CompileCode(isolate, code, name, context, tryCatch))
         {
             api::logging::Log("Failed to compile the code: " + code);
             return {};
         }
 
-        if (!this->ExtractFunctions(context, script))
+        if (!this->ExtractFunctions(isolate, context, script))
         {
             api::logging::Log("Failed to extract functions.");
             return {};
@@ -122,41 +387,83 @@ namespace projectfarm::shared::scripting
         return script;
     }
 
-    v8::Local<v8::Context> ScriptSystem::CreateNewScriptContext(const std::shared_ptr<Script>& script) noexcept
+    v8::Local<v8::Context> ScriptSystem::CreateNewScriptContext(v8::Isolate* isolate,
+                                                                const std::shared_ptr<Script>& script) noexcept
     {
-        auto globalTemplate = this->CreateGlobalObjectTemplate(script->GetNumberOfInternalFieldsNeeded());
+        auto globalTemplate = this->CreateGlobalObjectTemplate(isolate, script->GetNumberOfInternalFieldsNeeded());
 
         script->SetupGlobalTemplate(globalTemplate);
 
-        auto context = v8::Context::New(this->_isolate, nullptr, globalTemplate);
+        auto context = v8::Context::New(isolate, nullptr, globalTemplate);
 
         auto globalVariableScope = context->Global();
 
-        globalVariableScope->SetInternalField(0, v8::External::New(this->_isolate, this));
+        globalVariableScope->SetInternalField(0, v8::External::New(isolate, this));
 
         return context;
     }
 
-    bool ScriptSystem::CompileCode(const std::string& code,
+    bool ScriptSystem::CompileCode(v8::Isolate* isolate,
+                                   const std::string& code,
+                                   const std::string& name,
                                    v8::Local<v8::Context>& context,
-                                   v8::TryCatch& tryCatch) const noexcept
+                                   v8::TryCatch& tryCatch) noexcept
     {
-        auto sourceCode = v8::String::NewFromUtf8(this->_isolate, code.c_str()).ToLocalChecked();
+        auto sourceCode = v8::String::NewFromUtf8(isolate, code.c_str()).ToLocalChecked();
+
+        // the origin gives the profiler and stack traces the path of the script
+        v8::ScriptOrigin origin(v8::String::NewFromUtf8(isolate, name.c_str()).ToLocalChecked());
+
+        // the code cache is not tied to an isolate, so a cache created by one
+        // isolate can be consumed by all the others
+        std::vector<uint8_t> codeCache;
+        {
+            std::scoped_lock lock(this->_codeCacheMutex);
+
+            if (auto iter = this->_codeCache.find(code); iter != this->_codeCache.end())
+            {
+                codeCache = iter->second;
+            }
+        }
+
+        auto hasCodeCache = !codeCache.empty();
+
+        // `source` takes ownership of the cached data, but not of the buffer
+        v8::ScriptCompiler::Source source(sourceCode, origin,
+            hasCodeCache ? new v8::ScriptCompiler::CachedData(codeCache.data(), static_cast<int>(codeCache.size()))
+                         : nullptr);
+
+        auto compileOptions = hasCodeCache ? v8::ScriptCompiler::kConsumeCodeCache
+                                           : v8::ScriptCompiler::kNoCompileOptions;
 
         v8::Local<v8::Script> compiledScript;
-        if (!v8::Script::Compile(context, sourceCode).ToLocal(&compiledScript))
+        if (!v8::ScriptCompiler::Compile(context, &source, compileOptions).ToLocal(&compiledScript))
         {
-            v8::String::Utf8Value error(this->_isolate, tryCatch.Exception());
+            v8::String::Utf8Value error(isolate, tryCatch.Exception());
 
-            api::logging::Log("Failed to compile script with error: "s + static_cast<const char*>(*error) +
+            api::logging::Log("Failed to compile script: " + name + " with error: " + static_cast<const char*>(*error) +
                              "\nwith code: " + code);
             return false;
         }
 
+        if (!hasCodeCache || source.GetCachedData()->rejected)
+        {
+            std::unique_ptr<v8::ScriptCompiler::CachedData> newCodeCache(
+                v8::ScriptCompiler::CreateCodeCache(compiledScript->GetUnboundScript()));
+
+            if (newCodeCache)
+            {
+                std::scoped_lock lock(this->_codeCacheMutex);
+
+                this->_codeCache[code] = std::vector<uint8_t>(newCodeCache->data,
+                                                              newCodeCache->data + newCodeCache->length);
+            }
+        }
+
         v8::Local<v8::Value> result;
         if (!compiledScript->Run(context).ToLocal(&result))
         {
-            v8::String::Utf8Value error(this->_isolate, tryCatch.Exception());
+            v8::String::Utf8Value error(isolate, tryCatch.Exception());
 
             api::logging::Log("Failed to run script with error: "s + static_cast<const char*>(*error) +
                              "\nwith code: " + code);
@@ -169,10 +476,11 @@ namespace projectfarm::shared::scripting
         return true;
     }
 
-    bool ScriptSystem::ExtractFunctions(v8::Local<v8::Context>& context,
+    bool ScriptSystem::ExtractFunctions(v8::Isolate* isolate,
+                                        v8::Local<v8::Context>& context,
                                         const std::shared_ptr<Script>& script) noexcept
     {
-        v8::HandleScope handleScope(this->_isolate);
+        v8::HandleScope handleScope(isolate);
 
         auto functions = script->GetFunctions();
 
@@ -194,7 +502,7 @@ namespace projectfarm::shared::scripting
                 }
             }
 
-            script->SetFunction(type, *scriptFunction, this->_isolate);
+            script->SetFunction(type, *scriptFunction, isolate);
         }
 
         return true;
@@ -296,58 +604,59 @@ namespace projectfarm::shared::scripting
         return handleScope.Escape(scriptFunction.As<v8::Function>());
     }
 
-    v8::Local<v8::ObjectTemplate> ScriptSystem::CreateGlobalObjectTemplate(uint8_t numberOfInternalFields) noexcept
+    v8::Local<v8::ObjectTemplate> ScriptSystem::CreateGlobalObjectTemplate(v8::Isolate* isolate,
+                                                                           uint8_t numberOfInternalFields) noexcept
     {
-        auto globalVariableScopeTemplate = v8::ObjectTemplate::New(this->_isolate);
+        auto globalVariableScopeTemplate = v8::ObjectTemplate::New(isolate);
 
         // we will store `this` in internal field 0
         // field 1 will likely be used for the object associated with this script
         globalVariableScopeTemplate->SetInternalFieldCount(1 + numberOfInternalFields);
 
-        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "log").ToLocalChecked(),
-                                         v8::FunctionTemplate::New(this->_isolate, &ScriptSystem::Log));
+        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(isolate, "log").ToLocalChecked(),
+                                         v8::FunctionTemplate::New(isolate, &ScriptSystem::Log));
 
-        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "include_into_global").ToLocalChecked(),
-                                         v8::FunctionTemplate::New(this->_isolate, &ScriptSystem::IncludeIntoGlobal));
+        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(isolate, "include_into_global").ToLocalChecked(),
+                                         v8::FunctionTemplate::New(isolate, &ScriptSystem::IncludeIntoGlobal));
 
-        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "random_int").ToLocalChecked(),
-                                         v8::FunctionTemplate::New(this->_isolate, &ScriptSystem::RandomInt));
+        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(isolate, "random_int").ToLocalChecked(),
+                                         v8::FunctionTemplate::New(isolate, &ScriptSystem::RandomInt));
 
-        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "random_float").ToLocalChecked(),
-                                         v8::FunctionTemplate::New(this->_isolate, &ScriptSystem::RandomFloat));
+        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(isolate, "random_float").ToLocalChecked(),
+                                         v8::FunctionTemplate::New(isolate, &ScriptSystem::RandomFloat));
 
-        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "math_sqrt").ToLocalChecked(),
-                                         v8::FunctionTemplate::New(this->_isolate, &ScriptSystem::MathSqrt));
+        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(isolate, "math_sqrt").ToLocalChecked(),
+                                         v8::FunctionTemplate::New(isolate, &ScriptSystem::MathSqrt));
 
-        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "string_length").ToLocalChecked(),
-                                         v8::FunctionTemplate::New(this->_isolate, &ScriptSystem::StringLength));
+        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(isolate, "string_length").ToLocalChecked(),
+                                         v8::FunctionTemplate::New(isolate, &ScriptSystem::StringLength));
 
-        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "string_substring").ToLocalChecked(),
-                                         v8::FunctionTemplate::New(this->_isolate, &ScriptSystem::StringSubstring));
+        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(isolate, "string_substring").ToLocalChecked(),
+                                         v8::FunctionTemplate::New(isolate, &ScriptSystem::StringSubstring));
 
-        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "string_insert").ToLocalChecked(),
-                                         v8::FunctionTemplate::New(this->_isolate, &ScriptSystem::StringInsert));
+        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(isolate, "string_insert").ToLocalChecked(),
+                                         v8::FunctionTemplate::New(isolate, &ScriptSystem::StringInsert));
 
-        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "string_remove_character_at").ToLocalChecked(),
-                                         v8::FunctionTemplate::New(this->_isolate, &ScriptSystem::StringRemoveCharacterAt));
+        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(isolate, "string_remove_character_at").ToLocalChecked(),
+                                         v8::FunctionTemplate::New(isolate, &ScriptSystem::StringRemoveCharacterAt));
 
-        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "string_char_at").ToLocalChecked(),
-                                         v8::FunctionTemplate::New(this->_isolate, &ScriptSystem::StringCharAt));
+        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(isolate, "string_char_at").ToLocalChecked(),
+                                         v8::FunctionTemplate::New(isolate, &ScriptSystem::StringCharAt));
 
-        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "markdown_part_position_to_text_position").ToLocalChecked(),
-                                         v8::FunctionTemplate::New(this->_isolate, &ScriptSystem::MarkdownPartPositionToTextPosition));
+        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(isolate, "markdown_part_position_to_text_position").ToLocalChecked(),
+                                         v8::FunctionTemplate::New(isolate, &ScriptSystem::MarkdownPartPositionToTextPosition));
 
-        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "time_utc_short_string").ToLocalChecked(),
-                                         v8::FunctionTemplate::New(this->_isolate, &ScriptSystem::TimeUTCShortString));
+        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(isolate, "time_utc_short_string").ToLocalChecked(),
+                                         v8::FunctionTemplate::New(isolate, &ScriptSystem::TimeUTCShortString));
 
-        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "time_utc_long_string").ToLocalChecked(),
-                                         v8::FunctionTemplate::New(this->_isolate, &ScriptSystem::TimeUTCLongString));
+        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(isolate, "time_utc_long_string").ToLocalChecked(),
+                                         v8::FunctionTemplate::New(isolate, &ScriptSystem::TimeUTCLongString));
 
-        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "time_local_time_short_string").ToLocalChecked(),
-                                         v8::FunctionTemplate::New(this->_isolate, &ScriptSystem::TimeLocalTimeShortString));
+        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(isolate, "time_local_time_short_string").ToLocalChecked(),
+                                         v8::FunctionTemplate::New(isolate, &ScriptSystem::TimeLocalTimeShortString));
 
-        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "time_local_time_long_string").ToLocalChecked(),
-                                         v8::FunctionTemplate::New(this->_isolate, &ScriptSystem::TimeLocalTimeLongString));
+        globalVariableScopeTemplate->Set(v8::String::NewFromUtf8(isolate, "time_local_time_long_string").ToLocalChecked(),
+                                         v8::FunctionTemplate::New(isolate, &ScriptSystem::TimeLocalTimeLongString));
 
         return globalVariableScopeTemplate;
     }
@@ -411,6 +720,8 @@ namespace projectfarm::shared::scripting
         auto min = args[0]->Int32Value(context).FromMaybe(0);
         auto max = args[1]->Int32Value(context).FromMaybe(0);
 
+        std::scoped_lock lock(ss->_randomEngineMutex);
+
         auto result = ss->_randomEngine->Next(min, max);
 
         args.GetReturnValue().Set(result);
@@ -435,6 +746,8 @@ namespace projectfarm::shared::scripting
         auto min = args[0]->NumberValue(context).FromMaybe(0.0);
         auto max = args[1]->NumberValue(context).FromMaybe(0.0);
 
+        std::scoped_lock lock(ss->_randomEngineMutex);
+
         auto result = ss->_randomEngine->Next(min, max);
 
         args.GetReturnValue().Set(result);
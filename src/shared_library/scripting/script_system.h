@@ -5,6 +5,9 @@
 #include <filesystem>
 #include <memory>
 #include <optional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 #include <v8.h>
 #include <libplatform/libplatform.h>
 
@@ -12,11 +15,19 @@
 #include "script_types.h"
 #include "function_types.h"
 #include "script_factory.h"
+#include "script_profiler.h"
 #include "math/consume_random_engine.h"
 #include "data/consume_data_provider.h"
+#include "data/location_manifest.h"
 
 namespace projectfarm::shared::scripting
 {
+    struct ScriptIsolates;
+
+    // Each thread that creates scripts is given its own isolate. A script is bound to
+    // the isolate of the thread that created it and must only be run on that thread.
+    // To move a script to another thread, re-create it on that thread. A thread's
+    // isolate is disposed of when the thread exits, if it wasn't released before.
     class ScriptSystem final : public shared::math::ConsumeRandomEngine,
                                public shared::ConsumeDataProvider
     {
@@ -37,8 +48,36 @@ namespace projectfarm::shared::scripting
         [[nodiscard]]
         std::shared_ptr<Script> CreateScript(ScriptTypes type, const std::filesystem::path& filePath) noexcept;
 
+        // `name` identifies the script when profiling
+        [[nodiscard]]
+        std::shared_ptr<Script> CreateScript(ScriptTypes type, const std::string& code,
+                                             const std::string& name = "") noexcept;
+
+        // creates the isolate for the calling thread if it does not yet have one
+        [[nodiscard]]
+        v8::Isolate* GetIsolateForCurrentThread() noexcept;
+
+        // all scripts created on the calling thread must be destroyed before calling this
+        void ReleaseIsolateForCurrentThread() noexcept;
+
+        [[nodiscard]]
+        size_t GetNumberOfIsolates() const noexcept;
+
+        [[nodiscard]]
+        const std::shared_ptr<ScriptProfiler>& GetProfiler() const noexcept
+        {
+            return this->_profiler;
+        }
+
+        // times all script calls and samples the isolate of the calling thread
+        void StartProfiling() noexcept;
+
+        void StopProfiling() noexcept;
+
+        // writes the collapsed stacks, Chrome trace and call counters gathered so far to `outputDirectory`.
+        // Only samples from the isolate of the calling thread are collected.
         [[nodiscard]]
-        std::shared_ptr<Script> CreateScript(ScriptTypes type, const std::string& code) noexcept;
+        bool ExportProfile(const std::filesystem::path& outputDirectory) noexcept;
 
         [[nodiscard]]
         static std::string GetFunctionName(FunctionTypes type) noexcept;
@@ -49,25 +88,56 @@ namespace projectfarm::shared::scripting
                 const std::string& name) noexcept;
 
     private:
-        std::unique_ptr<v8::Platform> _platform;
+        static inline std::unique_ptr<v8::Platform> Platform;
         v8::Isolate::CreateParams _createParams;
-        v8::Isolate* _isolate {nullptr};
+
+        bool _isInitialized {false};
+
+        // shared with the threads that own the isolates, and only while initialized
+        std::shared_ptr<ScriptIsolates> _isolates;
+
+        // these are shared between all isolates. A script file is read again when its
+        // size or write time changes, and the code cache is keyed by the source itself
+        struct CachedSource
+        {
+            FileStamp Stamp;
+            std::string Code;
+        };
+
+        std::mutex _sourceCacheMutex;
+        std::unordered_map<std::string, CachedSource> _sourceCache;
+
+        std::mutex _codeCacheMutex;
+        std::unordered_map<std::string, std::vector<uint8_t>> _codeCache;
+
+        // the random engine is shared between all isolates
+        std::mutex _randomEngineMutex;
 
         std::shared_ptr<ScriptFactory> _scriptFactory;
 
+        std::shared_ptr<ScriptProfiler> _profiler {std::make_shared<ScriptProfiler>()};
+
+        [[nodiscard]]
+        std::optional<std::string> ReadScriptFile(const std::filesystem::path& filePath) noexcept;
+
         [[nodiscard]]
-        v8::Local<v8::ObjectTemplate> CreateGlobalObjectTemplate(uint8_t numberOfInternalFields) noexcept;
+        v8::Local<v8::ObjectTemplate> CreateGlobalObjectTemplate(v8::Isolate* isolate,
+                                                                 uint8_t numberOfInternalFields) noexcept;
 
         [[nodiscard]]
-        v8::Local<v8::Context> CreateNewScriptContext(const std::shared_ptr<Script>& script) noexcept;
+        v8::Local<v8::Context> CreateNewScriptContext(v8::Isolate* isolate,
+                                                      const std::shared_ptr<Script>& script) noexcept;
 
         [[nodiscard]]
-        bool CompileCode(const std::string& code,
+        bool CompileCode(v8::Isolate* isolate,
+                         const std::string& code,
+                         const std::string& name,
                          v8::Local<v8::Context>& context,
-                         v8::TryCatch& tryCatch) const noexcept;
+                         v8::TryCatch& tryCatch) noexcept;
 
         [[nodiscard]]
-        bool ExtractFunctions(v8::Local<v8::Context>& context,
+        bool ExtractFunctions(v8::Isolate* isolate,
+                              v8::Local<v8::Context>& context,
                               const std::shared_ptr<Script>& script) noexcept;
 
         [[nodiscard]]
@@ -81,6 +81,12 @@ namespace projectfarm::shared::state
             this->_stateStack.clear();
         }
 
+        // the top of the stack first, including any cancelled states not yet removed
+        [[nodiscard]] const std::list<StateItemType>& GetStates() const noexcept
+        {
+            return this->_stateStack;
+        }
+
     private:
         std::list<StateItemType> _stateStack;
 
@@ -0,0 +1,88 @@
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "catch2/catch.hpp"
+#include "api/logging/log_buffer.h"
+
+using namespace projectfarm::shared::api::logging;
+
+/*********************************************
+ * LogBuffer
+ ********************************************/
+
+TEST_CASE("LogBuffer::Consume - pushed entries - returns them in order", "[api/logging]")
+{
+    LogBuffer buffer(4u);
+    REQUIRE(buffer.IsEmpty());
+
+    REQUIRE(buffer.TryPush(10u, LogLevels::Info, "first"));
+    REQUIRE(buffer.TryPush(20u, LogLevels::Error, "second"));
+
+    std::vector<std::string> messages;
+    auto numberOfEntries = buffer.Consume([&messages](const LogEntry& entry)
+    {
+        messages.push_back(entry.Message);
+    });
+
+    REQUIRE(numberOfEntries == 2);
+    REQUIRE(messages == std::vector<std::string> { "first", "second" });
+    REQUIRE(buffer.IsEmpty());
+}
+
+TEST_CASE("LogBuffer::TryPush - buffer is full - drops and counts the message", "[api/logging]")
+{
+    // rounded up to a power of two
+    LogBuffer buffer(3u);
+    REQUIRE(buffer.GetCapacity() == 4);
+
+    for (auto i = 0u; i < 4u; ++i)
+    {
+        REQUIRE(buffer.TryPush(i, LogLevels::Info, std::to_string(i)));
+    }
+
+    REQUIRE_FALSE(buffer.TryPush(4u, LogLevels::Info, "4"));
+    REQUIRE_FALSE(buffer.TryPush(5u, LogLevels::Info, "5"));
+    REQUIRE(buffer.TakeNumberOfDropped() == 2);
+    REQUIRE(buffer.TakeNumberOfDropped() == 0);
+
+    REQUIRE(buffer.Consume([](const LogEntry&) {}) == 4);
+
+    // the space is reused once consumed
+    REQUIRE(buffer.TryPush(6u, LogLevels::Info, "6"));
+}
+
+TEST_CASE("LogBuffer - producer and consumer threads - every entry is consumed in order", "[api/logging]")
+{
+    constexpr uint64_t numberOfMessages {100000u};
+
+    LogBuffer buffer(64u);
+
+    std::thread producer([&buffer]()
+    {
+        for (uint64_t i = 0u; i < numberOfMessages;)
+        {
+            if (buffer.TryPush(i, LogLevels::Info, std::to_string(i)))
+            {
+                ++i;
+            }
+        }
+    });
+
+    uint64_t expected {0u};
+    auto isInOrder {true};
+
+    while (expected < numberOfMessages)
+    {
+        buffer.Consume([&](const LogEntry& entry)
+        {
+            isInOrder = isInOrder && entry.Time == expected && entry.Message == std::to_string(expected);
+            ++expected;
+        });
+    }
+
+    producer.join();
+
+    REQUIRE(isInOrder);
+    REQUIRE(expected == numberOfMessages);
+}
@@ -0,0 +1,258 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "catch2/catch.hpp"
+#include "api/logging/logging.h"
+#include "time/clock.h"
+
+using namespace projectfarm::shared;
+using namespace projectfarm::shared::api::logging;
+
+namespace
+{
+    // everything logged while this exists goes to `Text`
+    class LogCapture final
+    {
+    public:
+        LogCapture()
+        {
+            SetLogOutput(this->_stream);
+        }
+
+        ~LogCapture()
+        {
+            SetMinimumLogLevel(LogLevels::Info);
+            SetLogOutput(std::cout);
+        }
+
+        [[nodiscard]] std::string GetText()
+        {
+            // stops writing to the stream before reading it
+            SetLogOutput(std::cout);
+            return this->_stream.str();
+        }
+
+    private:
+        std::ostringstream _stream;
+    };
+
+    uint32_t Count(const std::string& text, const std::string& value)
+    {
+        uint32_t count {0u};
+
+        for (auto position = text.find(value); position != std::string::npos;
+             position = text.find(value, position + value.size()))
+        {
+            ++count;
+        }
+
+        return count;
+    }
+
+    class NullBuffer final : public std::streambuf
+    {
+    protected:
+        std::streamsize xsputn(const char*, std::streamsize count) override
+        {
+            return count;
+        }
+
+        int overflow(int c) override
+        {
+            return c;
+        }
+    };
+}
+
+/*********************************************
+ * Log
+ ********************************************/
+
+TEST_CASE("Log - messages from a thread - are written in order", "[api/logging]")
+{
+    LogCapture capture;
+
+    Log("logging test first");
+    Log("logging test second", LogLevels::Warning);
+    FlushLog();
+
+    auto text = capture.GetText();
+
+    auto first = text.find(": logging test first\n");
+    auto second = text.find(": [Warning] logging test second\n");
+
+    REQUIRE(first != std::string::npos);
+    REQUIRE(second != std::string::npos);
+    REQUIRE(first < second);
+}
+
+TEST_CASE("Log - below the minimum level - is not written or formatted", "[api/logging]")
+{
+    LogCapture capture;
+
+    SetMinimumLogLevel(LogLevels::Warning);
+    REQUIRE_FALSE(IsLogLevelEnabled(LogLevels::Info));
+    REQUIRE(IsLogLevelEnabled(LogLevels::Error));
+
+    auto numberOfCalls {0u};
+    auto makeMessage = [&numberOfCalls]()
+    {
+        ++numberOfCalls;
+        return "logging test lazy " + std::to_string(numberOfCalls);
+    };
+
+    Log("logging test filtered");
+    Log(makeMessage, LogLevels::Debug);
+    Log(makeMessage, LogLevels::Error);
+    FlushLog();
+
+    auto text = capture.GetText();
+
+    REQUIRE(numberOfCalls == 1);
+    REQUIRE(text.find("logging test filtered") == std::string::npos);
+    REQUIRE(text.find("[Error] logging test lazy 1\n") != std::string::npos);
+}
+
+TEST_CASE("Log - repeated message - is rate limited", "[api/logging]")
+{
+    LogCapture capture;
+
+    for (auto i = 0u; i < 100u; ++i)
+    {
+        Log("logging test repeated");
+    }
+
+    Log("logging test different");
+    FlushLog();
+
+    auto text = capture.GetText();
+
+    REQUIRE(Count(text, "logging test repeated") == MaxRepeatedMessages);
+    REQUIRE(text.find("Previous message repeated " + std::to_string(100u - MaxRepeatedMessages) +
+                      " more times.") != std::string::npos);
+    REQUIRE(text.find("logging test different") != std::string::npos);
+}
+
+TEST_CASE("Log - many threads - every message is written", "[api/logging]")
+{
+    constexpr uint32_t numberOfThreads {4u};
+    constexpr uint32_t numberOfMessages {1000u};
+
+    LogCapture capture;
+
+    std::vector<std::thread> threads;
+    for (auto t = 0u; t < numberOfThreads; ++t)
+    {
+        threads.emplace_back([t]()
+        {
+            for (auto i = 0u; i < numberOfMessages; ++i)
+            {
+                Log("logging test thread " + std::to_string(t) + " message " + std::to_string(i));
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    FlushLog();
+
+    auto text = capture.GetText();
+
+    REQUIRE(Count(text, "logging test thread") == numberOfThreads * numberOfMessages);
+    REQUIRE(text.find("logging test thread 3 message 999\n") != std::string::npos);
+}
+
+/*********************************************
+ * Benchmarks
+ ********************************************/
+
+TEST_CASE("Log - 8 threads", "[api/logging][.benchmark]")
+{
+    constexpr uint32_t numberOfThreads {8u};
+    constexpr uint32_t numberOfMessages {200000u};
+
+    NullBuffer nullBuffer;
+    std::ostream nullStream(&nullBuffer);
+
+    // a handful of messages, so they are not rate limited as repeats
+    std::vector<std::string> messages;
+    for (auto i = 0u; i < 16u; ++i)
+    {
+        messages.push_back("Failed to find player with id: " + std::to_string(i));
+    }
+
+    auto run = [&](auto log)
+    {
+        std::atomic_bool start {false};
+        std::vector<std::thread> threads;
+
+        for (auto t = 0u; t < numberOfThreads; ++t)
+        {
+            threads.emplace_back([&]()
+            {
+                while (!start)
+                {
+                    std::this_thread::yield();
+                }
+
+                for (auto i = 0u; i < numberOfMessages; ++i)
+                {
+                    log(messages[i % messages.size()]);
+                }
+            });
+        }
+
+        auto startTime = std::chrono::steady_clock::now();
+        start = true;
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+        return static_cast<double>(numberOfThreads) * numberOfMessages / elapsed;
+    };
+
+    // how every message was logged before
+    auto synchronousCallsPerSecond = run([&nullStream](const std::string& message)
+    {
+        static std::mutex mutex;
+
+        std::scoped_lock<std::mutex> lock(mutex);
+
+        auto currentTime = time::Clock::LocalTimeAsLongString();
+
+        nullStream << currentTime << ": " << message << '\n';
+    });
+
+    SetLogOutput(nullStream);
+
+    auto droppedBefore = GetNumberOfDroppedLogMessages();
+
+    auto asynchronousCallsPerSecond = run([](const std::string& message)
+    {
+        Log(message);
+    });
+
+    FlushLog();
+    auto dropped = GetNumberOfDroppedLogMessages() - droppedBefore;
+
+    SetLogOutput(std::cout);
+
+    // the calls are spread over threads, so they are reported rather than timed by BENCHMARK
+    WARN("synchronous: " << static_cast<uint64_t>(synchronousCallsPerSecond) << " calls/s");
+    WARN("asynchronous: " << static_cast<uint64_t>(asynchronousCallsPerSecond) << " calls/s, "
+         << dropped << " of " << numberOfThreads * numberOfMessages << " dropped");
+}
@@ -0,0 +1,192 @@
+#include <atomic>
+#include <fstream>
+#include <thread>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include "catch2/catch.hpp"
+#include "test_util.h"
+#include "concurrency/startup_loader.h"
+#include "data/binary_world.h"
+
+using namespace std::literals;
+using namespace projectfarm::shared;
+using namespace projectfarm::shared::concurrency;
+
+/*********************************************
+ * StartupLoader
+ ********************************************/
+
+TEST_CASE("StartupLoader - successful tasks - starts them in name order on the calling thread", "[concurrency]")
+{
+    StartupLoader loader(4);
+
+    std::vector<std::string> startOrder;
+    std::atomic<uint32_t> numberOfLoads {0u};
+    auto callingThreadId = std::this_thread::get_id();
+    auto startedOnCallingThread = true;
+
+    for (const auto& name : { "d", "b", "a", "c" })
+    {
+        loader.Add({name,
+                    [&numberOfLoads]()
+                    {
+                        ++numberOfLoads;
+                        return true;
+                    },
+                    [&, name]()
+                    {
+                        startedOnCallingThread &= std::this_thread::get_id() == callingThreadId;
+                        startOrder.emplace_back(name);
+                        return true;
+                    }});
+    }
+
+    REQUIRE(loader.Run("tests"));
+
+    REQUIRE(numberOfLoads == 4u);
+    REQUIRE(startedOnCallingThread);
+    REQUIRE(startOrder == std::vector<std::string> { "a", "b", "c", "d" });
+    REQUIRE(loader.GetFailedTasks().empty());
+}
+
+TEST_CASE("StartupLoader - failed loads - reports every failure in name order and starts nothing", "[concurrency]")
+{
+    // repeat to shake out any dependence on thread timings
+    for (auto i = 0u; i < 20u; ++i)
+    {
+        StartupLoader loader(8);
+
+        auto numberOfStarts = 0u;
+
+        for (auto t = 0u; t < 16u; ++t)
+        {
+            auto name = "task_" + std::to_string(15u - t);
+
+            loader.Add({name,
+                        [t]()
+                        {
+                            std::this_thread::sleep_for(std::chrono::microseconds((t * 37u) % 200u));
+
+                            if (t == 3u)
+                            {
+                                throw std::runtime_error("failed");
+                            }
+
+                            return t % 5u != 0u;
+                        },
+                        [&numberOfStarts]()
+                        {
+                            ++numberOfStarts;
+                            return true;
+                        }});
+        }
+
+        REQUIRE_FALSE(loader.Run("tests"));
+
+        REQUIRE(numberOfStarts == 0u);
+        REQUIRE(loader.GetFailedTasks() == std::vector<std::string> { "task_0", "task_10", "task_12", "task_15", "task_5" });
+    }
+}
+
+TEST_CASE("StartupLoader - failed start - stops starting tasks", "[concurrency]")
+{
+    StartupLoader loader(2);
+
+    std::vector<std::string> startOrder;
+
+    for (const auto& name : { "a", "b", "c" })
+    {
+        loader.Add({name,
+                    []() { return true; },
+                    [&, name]()
+                    {
+                        startOrder.emplace_back(name);
+                        return std::string(name) != "b";
+                    }});
+    }
+
+    REQUIRE_FALSE(loader.Run("tests"));
+
+    REQUIRE(startOrder == std::vector<std::string> { "a", "b" });
+    REQUIRE(loader.GetFailedTasks() == std::vector<std::string> { "b" });
+}
+
+TEST_CASE("StartupLoader - no tasks - succeeds", "[concurrency]")
+{
+    StartupLoader loader;
+
+    REQUIRE(loader.Run("tests"));
+}
+
+/*********************************************
+ * Benchmarks
+ ********************************************/
+
+TEST_CASE("Startup - 30 synthetic worlds", "[concurrency][.benchmark]")
+{
+    constexpr auto NumberOfWorlds = 30u;
+
+    auto plotsFilePath = GetTempFilePath("startup_plots.json");
+
+    {
+        std::ofstream fs(plotsFilePath);
+        fs << R"({ "plots": [ { "name": "grass" }, { "name": "water" }, { "name": "sand" } ] })";
+    }
+
+    std::vector<std::filesystem::path> worldFilePaths;
+
+    for (auto w = 0u; w < NumberOfWorlds; ++w)
+    {
+        auto worldFilePath = GetTempFilePath("startup_world_" + std::to_string(w) + ".json");
+
+        std::ofstream fs(worldFilePath);
+        fs << R"({ "name": "world_)" << w << R"(", "islands": [ { "widthInTiles": 256, "heightInTiles": 256,
+                 "tileWidth": 1, "tileHeight": 1, "layers": [ { "defaultPlot": "grass", "plots": [ )";
+
+        for (auto p = 0u; p < 5000u; ++p)
+        {
+            fs << (p > 0u ? "," : "") << R"({ "name": ")" << (p % 2u ? "water" : "sand") << R"(", "x": )"
+               << (p * 7u) % 256u << R"(, "y": )" << (p * 13u) % 256u << " }";
+        }
+
+        fs << " ] } ] } ] }";
+
+        worldFilePaths.push_back(worldFilePath);
+    }
+
+    auto runLoader = [&](uint32_t numberOfThreads)
+    {
+        StartupLoader loader(numberOfThreads);
+
+        for (const auto& worldFilePath : worldFilePaths)
+        {
+            loader.Add({worldFilePath.filename().u8string(),
+                        [&worldFilePath, &plotsFilePath]()
+                        {
+                            return ReadJsonWorld(worldFilePath, plotsFilePath).has_value();
+                        },
+                        {}});
+        }
+
+        return loader.Run("worlds");
+    };
+
+    BENCHMARK("1 thread")
+    {
+        return runLoader(1);
+    };
+
+    BENCHMARK("all threads")
+    {
+        return runLoader(0);
+    };
+
+    for (const auto& worldFilePath : worldFilePaths)
+    {
+        std::filesystem::remove(worldFilePath);
+    }
+
+    std::filesystem::remove(plotsFilePath);
+}
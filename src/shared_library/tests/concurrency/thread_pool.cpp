@@ -0,0 +1,70 @@
+#include <atomic>
+#include <vector>
+#include <future>
+#include <thread>
+#include <stdexcept>
+
+#include "catch2/catch.hpp"
+#include "concurrency/thread_pool.h"
+
+using namespace std::literals;
+using namespace projectfarm::shared::concurrency;
+
+/*********************************************
+ * ThreadPool
+ ********************************************/
+
+TEST_CASE("ThreadPool - default number of threads - uses at least one thread", "[concurrency]")
+{
+    ThreadPool pool;
+
+    REQUIRE(pool.GetNumberOfThreads() >= 1);
+}
+
+TEST_CASE("ThreadPool - enqueue tasks - returns their results", "[concurrency]")
+{
+    ThreadPool pool(4);
+
+    std::vector<std::future<uint32_t>> futures;
+    for (auto i = 0u; i < 100u; ++i)
+    {
+        futures.emplace_back(pool.Enqueue([i]() { return i * 2u; }));
+    }
+
+    for (auto i = 0u; i < 100u; ++i)
+    {
+        REQUIRE(futures[i].get() == i * 2u);
+    }
+}
+
+TEST_CASE("ThreadPool - task throws - exception is stored in future", "[concurrency]")
+{
+    ThreadPool pool(1);
+
+    auto future = pool.Enqueue([]() -> int { throw std::runtime_error("failed"); });
+
+    REQUIRE_THROWS_AS(future.get(), std::runtime_error);
+
+    // the worker is still running
+    REQUIRE(pool.Enqueue([]() { return 1; }).get() == 1);
+}
+
+TEST_CASE("ThreadPool - destroyed with queued tasks - runs every task", "[concurrency]")
+{
+    std::atomic<uint32_t> count {0u};
+
+    {
+        ThreadPool pool(2);
+
+        for (auto i = 0u; i < 50u; ++i)
+        {
+            (void)pool.Enqueue([&count]()
+            {
+                std::this_thread::sleep_for(100us);
+                ++count;
+            });
+        }
+    }
+
+    REQUIRE(count == 50u);
+}
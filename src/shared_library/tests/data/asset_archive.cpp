@@ -0,0 +1,297 @@
+#include <fstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include "catch2/catch.hpp"
+#include "test_util.h"
+#include "data/asset_archive.h"
+#include "data/data_provider.h"
+
+using namespace projectfarm::shared;
+
+namespace
+{
+    std::vector<std::byte> ToBytes(const std::string& s)
+    {
+        std::vector<std::byte> bytes(s.size());
+        for (auto i = 0u; i < s.size(); ++i)
+        {
+            bytes[i] = static_cast<std::byte>(s[i]);
+        }
+
+        return bytes;
+    }
+
+    std::string ReadText(AssetArchive& archive, const std::string& name)
+    {
+        auto data = archive.Read(name);
+        REQUIRE(data);
+
+        return std::string(data->AsStringView());
+    }
+}
+
+/*********************************************
+ * AssetArchive
+ ********************************************/
+
+TEST_CASE("AssetArchive - written archive - reads every entry", "[asset_archive]")
+{
+    auto archiveFilePath = GetTempFilePath("asset_archive.pfa");
+
+    std::string repetitive;
+    for (auto i = 0u; i < 100u; ++i)
+    {
+        repetitive += R"({ "name": "grass", "tileSet": "ground" },)";
+    }
+
+    AssetArchiveWriter writer;
+    writer.Add("shared/worlds/worlds.json", ToBytes(R"({ "worlds": [] })"), false);
+    writer.Add("shared/worlds/test/plots.json", ToBytes(repetitive), true);
+    writer.Add("client/empty.txt", {}, true);
+
+    REQUIRE(writer.Write(archiveFilePath));
+
+    AssetArchive archive;
+    REQUIRE(archive.Open(archiveFilePath));
+    REQUIRE(archive.GetNumberOfEntries() == 3);
+
+    REQUIRE(archive.Contains("shared/worlds/worlds.json"));
+    REQUIRE_FALSE(archive.Contains("shared/worlds/missing.json"));
+    REQUIRE_FALSE(archive.Read("shared/worlds/missing.json"));
+
+    REQUIRE(ReadText(archive, "shared/worlds/worlds.json") == R"({ "worlds": [] })");
+    REQUIRE(ReadText(archive, "shared/worlds/test/plots.json") == repetitive);
+    REQUIRE(ReadText(archive, "client/empty.txt").empty());
+
+    // decompressed entries are kept, so the same data is returned each time
+    REQUIRE(archive.Read("shared/worlds/test/plots.json")->data() ==
+            archive.Read("shared/worlds/test/plots.json")->data());
+
+    archive.Close();
+    std::filesystem::remove(archiveFilePath);
+}
+
+TEST_CASE("AssetArchive - compressible entry - is stored smaller", "[asset_archive]")
+{
+    auto compressedFilePath = GetTempFilePath("asset_archive_compressed.pfa");
+    auto uncompressedFilePath = GetTempFilePath("asset_archive_uncompressed.pfa");
+
+    auto data = ToBytes(std::string(10000, 'a'));
+
+    AssetArchiveWriter compressedWriter;
+    compressedWriter.Add("a.txt", data, true);
+    REQUIRE(compressedWriter.Write(compressedFilePath));
+
+    AssetArchiveWriter uncompressedWriter;
+    uncompressedWriter.Add("a.txt", data, false);
+    REQUIRE(uncompressedWriter.Write(uncompressedFilePath));
+
+    REQUIRE(std::filesystem::file_size(compressedFilePath) < std::filesystem::file_size(uncompressedFilePath));
+
+    std::filesystem::remove(compressedFilePath);
+    std::filesystem::remove(uncompressedFilePath);
+}
+
+TEST_CASE("AssetArchive - not an archive - fails to open", "[asset_archive]")
+{
+    auto archiveFilePath = GetTempFilePath("asset_archive_invalid.pfa");
+
+    WriteTextFile(archiveFilePath, std::string(64, 'x'));
+
+    AssetArchive archive;
+    REQUIRE_FALSE(archive.Open(archiveFilePath));
+    REQUIRE_FALSE(archive.IsOpen());
+
+    std::filesystem::remove(archiveFilePath);
+}
+
+TEST_CASE("AssetArchive - truncated archive - fails to open", "[asset_archive]")
+{
+    auto archiveFilePath = GetTempFilePath("asset_archive_truncated.pfa");
+
+    AssetArchiveWriter writer;
+    writer.Add("a.txt", ToBytes(std::string(1000, 'a')), false);
+    REQUIRE(writer.Write(archiveFilePath));
+
+    std::filesystem::resize_file(archiveFilePath, std::filesystem::file_size(archiveFilePath) - 10u);
+
+    AssetArchive archive;
+    REQUIRE_FALSE(archive.Open(archiveFilePath));
+
+    std::filesystem::remove(archiveFilePath);
+}
+
+TEST_CASE("AssetArchive - compressed entry with a huge size - fails to open", "[asset_archive]")
+{
+    auto archiveFilePath = GetTempFilePath("asset_archive_huge_size.pfa");
+
+    AssetArchiveWriter writer;
+    writer.Add("a.txt", ToBytes(std::string(1000, 'a')), true);
+    REQUIRE(writer.Write(archiveFilePath));
+
+    {
+        std::fstream fs(archiveFilePath, std::ios::in | std::ios::out | std::ios::binary);
+
+        uint64_t tableOffset {0u};
+        fs.seekg(16);
+        fs.read(reinterpret_cast<char*>(&tableOffset), sizeof(tableOffset));
+
+        // the entry's uncompressed size
+        uint64_t size {UINT64_MAX / 2u};
+        fs.seekp(static_cast<std::streamoff>(tableOffset + 32u));
+        fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    }
+
+    AssetArchive archive;
+    REQUIRE_FALSE(archive.Open(archiveFilePath));
+
+    std::filesystem::remove(archiveFilePath);
+}
+
+/*********************************************
+ * DataProvider
+ ********************************************/
+
+TEST_CASE("DataProvider - mounted archive - archived files replace loose files", "[asset_archive]")
+{
+    auto basePath = GetTempFilePath("asset_archive_data_provider");
+    std::filesystem::remove_all(basePath);
+
+    WriteTextFile(basePath / "data" / "shared" / "worlds" / "worlds.json", R"({ "worlds": [] })");
+    WriteTextFile(basePath / "data" / "shared" / "worlds" / "test" / "plots.json", R"({ "source": "loose" })");
+    WriteTextFile(basePath / "data" / "server" / "loose_only.json", R"({ "source": "loose" })");
+
+    DataProvider dataProvider(basePath);
+
+    AssetArchiveWriter writer;
+    writer.Add("shared/worlds/test/plots.json", ToBytes(R"({ "source": "archive" })"), true);
+    REQUIRE(writer.Write(dataProvider.GetArchiveFilePath()));
+
+    REQUIRE(dataProvider.MountArchive(dataProvider.GetArchiveFilePath()));
+
+    auto plotsFilePath = dataProvider.ResolveFileName(DataProviderLocations::SharedWorlds, "test/plots.json");
+    REQUIRE(dataProvider.GetArchiveEntryName(plotsFilePath) == "shared/worlds/test/plots.json");
+
+    auto json = dataProvider.LoadJsonAsset(plotsFilePath);
+    REQUIRE(json);
+    REQUIRE((*json)["source"].get<std::string>() == "archive");
+
+    auto file = dataProvider.OpenFile(plotsFilePath);
+    REQUIRE(file);
+    REQUIRE(file->IsArchived());
+
+    auto looseFilePath = dataProvider.ResolveFileName(DataProviderLocations::Server, "loose_only.json");
+
+    json = dataProvider.LoadJsonAsset(looseFilePath);
+    REQUIRE(json);
+    REQUIRE((*json)["source"].get<std::string>() == "loose");
+
+    file = dataProvider.OpenFile(looseFilePath);
+    REQUIRE(file);
+    REQUIRE_FALSE(file->IsArchived());
+
+    REQUIRE(dataProvider.GetArchiveEntryName(basePath / "elsewhere.json").empty());
+    REQUIRE_FALSE(dataProvider.FileExists(dataProvider.ResolveFileName(DataProviderLocations::Server, "missing.json")));
+
+    dataProvider.UnmountArchive();
+
+    json = dataProvider.LoadJsonAsset(plotsFilePath);
+    REQUIRE(json);
+    REQUIRE((*json)["source"].get<std::string>() == "loose");
+
+    std::filesystem::remove_all(basePath);
+}
+
+TEST_CASE("DataProvider - archive without data folder - sets up server", "[asset_archive]")
+{
+    auto basePath = GetTempFilePath("asset_archive_only");
+    std::filesystem::remove_all(basePath);
+    std::filesystem::create_directories(basePath);
+
+    AssetArchiveWriter writer;
+    writer.Add("shared/worlds/worlds.json",
+               ToBytes(R"({ "worlds": [ { "name": "test", "filePath": "{SharedWorlds}/test.json" } ] })"), true);
+    writer.Add("server/characters/characters.json", ToBytes(R"({ "characters": [] })"), true);
+    writer.Add("shared/characters/action_animations.json", ToBytes(R"({ "animations": [] })"), true);
+    REQUIRE(writer.Write(basePath / "data.pfa"));
+
+    DataProvider dataProvider(basePath);
+
+    REQUIRE(dataProvider.SetupServer());
+    REQUIRE(dataProvider.IsArchiveMounted());
+
+    const auto& worldLocations = dataProvider.GetWorldLocations();
+    REQUIRE(worldLocations.size() == 1);
+    REQUIRE(dataProvider.GetArchiveEntryName(worldLocations.at("test")) == "shared/worlds/test.json");
+
+    dataProvider.Shutdown();
+    REQUIRE_FALSE(dataProvider.IsArchiveMounted());
+
+    std::filesystem::remove_all(basePath);
+}
+
+/*********************************************
+ * Benchmarks
+ ********************************************/
+
+TEST_CASE("Asset archive startup I/O - 1000 files", "[asset_archive][.benchmark]")
+{
+    auto basePath = GetTempFilePath("asset_archive_benchmark");
+    std::filesystem::remove_all(basePath);
+
+    std::string text;
+    for (auto i = 0u; i < 50u; ++i)
+    {
+        text += R"({ "name": "plot_)" + std::to_string(i) + R"(", "tileSet": "grass", "isCollidable": false },)";
+    }
+
+    AssetArchiveWriter writer;
+    std::vector<std::filesystem::path> filePaths;
+
+    for (auto i = 0u; i < 1000u; ++i)
+    {
+        auto name = "client/assets/" + std::to_string(i % 10u) + "/" + std::to_string(i) + ".json";
+        auto filePath = basePath / "data" / name;
+
+        WriteTextFile(filePath, text);
+        writer.Add(name, ToBytes(text), true);
+
+        filePaths.push_back(filePath);
+    }
+
+    WriteTextFile(basePath / "data" / "shared" / "worlds" / "worlds.json", R"({ "worlds": [] })");
+
+    DataProvider dataProvider(basePath);
+    REQUIRE(writer.Write(dataProvider.GetArchiveFilePath()));
+
+    BENCHMARK("loose files")
+    {
+        uint64_t total {0u};
+        for (const auto& filePath : filePaths)
+        {
+            std::ifstream fs(filePath, std::ios::binary);
+            std::string contents((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+            total += contents.size();
+        }
+
+        return total;
+    };
+
+    BENCHMARK("archive")
+    {
+        DataProvider archiveDataProvider(basePath);
+        REQUIRE(archiveDataProvider.MountArchive(archiveDataProvider.GetArchiveFilePath()));
+
+        uint64_t total {0u};
+        for (const auto& filePath : filePaths)
+        {
+            total += archiveDataProvider.OpenFile(filePath)->GetData().size();
+        }
+
+        return total;
+    };
+
+    std::filesystem::remove_all(basePath);
+}
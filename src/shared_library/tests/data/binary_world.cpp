@@ -0,0 +1,521 @@
+#include <fstream>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+
+#include "catch2/catch.hpp"
+#include "test_util.h"
+#include "data/binary_world.h"
+
+using namespace projectfarm::shared;
+
+namespace
+{
+    BinaryWorldData CreateWorld(uint32_t numberOfIslands, uint32_t widthInTiles, uint32_t heightInTiles)
+    {
+        BinaryWorldData world;
+        world.Name = "test_world";
+
+        for (auto i = 0u; i < numberOfIslands; ++i)
+        {
+            BinaryWorldIsland island;
+            island.PositionX = static_cast<float>(i * widthInTiles);
+            island.PositionY = 10.0f;
+            island.TileWidthInMeters = 1.0f;
+            island.TileHeightInMeters = 0.5f;
+            island.WidthInTiles = widthInTiles;
+            island.HeightInTiles = heightInTiles;
+
+            for (auto l = 0u; l < 2u; ++l)
+            {
+                BinaryWorldLayer layer;
+                layer.IsOverhead = l == 1u;
+                layer.PlotIndexes.resize(static_cast<uint64_t>(widthInTiles) * heightInTiles);
+
+                for (auto t = 0u; t < layer.PlotIndexes.size(); ++t)
+                {
+                    layer.PlotIndexes[t] = l == 1u && t % 3u == 0u ? BinaryWorldFile::EmptyPlotIndex
+                                                                    : static_cast<uint16_t>((t + i) % 17u);
+                }
+
+                island.Layers.emplace_back(std::move(layer));
+            }
+
+            island.ActionTiles.push_back({ 1u, 2u, { { "action", "warp" }, { "world", "other" } } });
+
+            world.Islands.emplace_back(std::move(island));
+        }
+
+        return world;
+    }
+
+    // writes the original single island format, with native endian int32 plot indexes
+    void WriteV1World(const BinaryWorldData& world, const std::filesystem::path& filePath)
+    {
+        std::ofstream fs(filePath, std::ios::binary | std::ios::trunc);
+
+        auto writeString = [&fs](const std::string& s)
+        {
+            auto length = static_cast<char>(s.size());
+            fs.write(&length, 1);
+            fs.write(s.data(), static_cast<std::streamsize>(s.size()));
+        };
+
+        auto writeUInt32 = [&fs](uint32_t value)
+        {
+            fs.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        };
+
+        const auto& island = world.Islands[0];
+
+        writeString(world.Name);
+        writeUInt32(island.WidthInTiles);
+        writeUInt32(island.HeightInTiles);
+        writeUInt32(static_cast<uint32_t>(island.Layers.size()));
+
+        for (const auto& layer : island.Layers)
+        {
+            auto isOverhead = static_cast<char>(layer.IsOverhead ? 1 : 0);
+            fs.write(&isOverhead, 1);
+
+            for (auto plotIndex : layer.PlotIndexes)
+            {
+                auto value = plotIndex == BinaryWorldFile::EmptyPlotIndex ? -1 : static_cast<int32_t>(plotIndex);
+                fs.write(reinterpret_cast<const char*>(&value), sizeof(value));
+            }
+        }
+
+        writeUInt32(static_cast<uint32_t>(island.ActionTiles.size()));
+
+        for (const auto& actionTile : island.ActionTiles)
+        {
+            writeUInt32(actionTile.X);
+            writeUInt32(actionTile.Y);
+            writeUInt32(static_cast<uint32_t>(actionTile.Properties.size()));
+
+            for (const auto& [name, value] : actionTile.Properties)
+            {
+                writeString(name);
+                writeString(value);
+            }
+        }
+    }
+
+    void RequireSameWorld(const BinaryWorldData& a, const BinaryWorldData& b)
+    {
+        REQUIRE(a.Name == b.Name);
+        REQUIRE(a.Islands.size() == b.Islands.size());
+
+        for (auto i = 0u; i < a.Islands.size(); ++i)
+        {
+            const auto& islandA = a.Islands[i];
+            const auto& islandB = b.Islands[i];
+
+            REQUIRE(islandA.WidthInTiles == islandB.WidthInTiles);
+            REQUIRE(islandA.HeightInTiles == islandB.HeightInTiles);
+            REQUIRE(islandA.Layers.size() == islandB.Layers.size());
+
+            for (auto l = 0u; l < islandA.Layers.size(); ++l)
+            {
+                REQUIRE(islandA.Layers[l].IsOverhead == islandB.Layers[l].IsOverhead);
+                REQUIRE(islandA.Layers[l].PlotIndexes == islandB.Layers[l].PlotIndexes);
+            }
+
+            REQUIRE(islandA.ActionTiles.size() == islandB.ActionTiles.size());
+
+            for (auto t = 0u; t < islandA.ActionTiles.size(); ++t)
+            {
+                REQUIRE(islandA.ActionTiles[t].X == islandB.ActionTiles[t].X);
+                REQUIRE(islandA.ActionTiles[t].Y == islandB.ActionTiles[t].Y);
+                REQUIRE(islandA.ActionTiles[t].Properties == islandB.ActionTiles[t].Properties);
+            }
+        }
+    }
+}
+
+/*********************************************
+ * WriteBinaryWorld
+ ********************************************/
+
+TEST_CASE("WriteBinaryWorld - multiple islands - reads back the same world", "[binary_world]")
+{
+    auto world = CreateWorld(3, 17, 9);
+    auto filePath = GetTempFilePath("binary_world_round_trip.bin");
+
+    REQUIRE(WriteBinaryWorld(world, filePath));
+    REQUIRE(BinaryWorldFile::IsBinaryWorldFile(filePath));
+
+    BinaryWorldFile file;
+    REQUIRE(file.Open(filePath));
+    REQUIRE(file.HasChecksum());
+    REQUIRE(file.GetName() == "test_world");
+    REQUIRE(file.GetIslands().size() == 3);
+
+    const auto& island = file.GetIslands()[1];
+    REQUIRE(island.PositionX == 17.0f);
+    REQUIRE(island.PositionY == 10.0f);
+    REQUIRE(island.TileHeightInMeters == 0.5f);
+
+    for (const auto& layer : island.Layers)
+    {
+        if (auto plotIndexes = layer.GetPlotIndexes(); plotIndexes)
+        {
+            // layers are aligned so they can be used in place
+            REQUIRE(reinterpret_cast<uintptr_t>(plotIndexes) % 64u == 0u);
+        }
+    }
+
+    auto data = file.ToData();
+    REQUIRE(data);
+
+    RequireSameWorld(world, *data);
+
+    std::filesystem::remove(filePath);
+}
+
+TEST_CASE("WriteBinaryWorld - background island - reads back apart from the islands", "[binary_world]")
+{
+    auto world = CreateWorld(2, 6, 4);
+    world.Background = CreateWorld(1, 5, 3).Islands[0];
+
+    auto filePath = GetTempFilePath("binary_world_background.bin");
+
+    REQUIRE(WriteBinaryWorld(world, filePath));
+
+    BinaryWorldFile file;
+    REQUIRE(file.Open(filePath));
+    REQUIRE(file.GetIslands().size() == 2);
+    REQUIRE(file.GetBackgroundIsland());
+    REQUIRE(file.GetBackgroundIsland()->WidthInTiles == 5);
+    REQUIRE(file.GetBackgroundIsland()->HeightInTiles == 3);
+
+    auto data = file.ToData();
+    REQUIRE(data);
+    REQUIRE(data->Background);
+
+    RequireSameWorld(world, *data);
+
+    BinaryWorldData background;
+    background.Name = world.Name;
+    background.Islands.push_back(*world.Background);
+
+    BinaryWorldData backgroundRead;
+    backgroundRead.Name = data->Name;
+    backgroundRead.Islands.push_back(*data->Background);
+
+    RequireSameWorld(background, backgroundRead);
+
+    std::filesystem::remove(filePath);
+}
+
+/*********************************************
+ * Open
+ ********************************************/
+
+TEST_CASE("Open - corrupt layer - fails checksum", "[binary_world]")
+{
+    auto world = CreateWorld(1, 8, 8);
+    auto filePath = GetTempFilePath("binary_world_corrupt.bin");
+
+    REQUIRE(WriteBinaryWorld(world, filePath));
+
+    {
+        std::fstream fs(filePath, std::ios::binary | std::ios::in | std::ios::out);
+        fs.seekp(-20, std::ios::end);
+        char value {0x7F};
+        fs.write(&value, 1);
+    }
+
+    BinaryWorldFile file;
+    REQUIRE_FALSE(file.Open(filePath));
+    REQUIRE(file.Open(filePath, false));
+
+    std::filesystem::remove(filePath);
+}
+
+TEST_CASE("Open - truncated file - returns false", "[binary_world]")
+{
+    auto world = CreateWorld(1, 8, 8);
+    auto filePath = GetTempFilePath("binary_world_truncated.bin");
+
+    REQUIRE(WriteBinaryWorld(world, filePath, false));
+
+    std::filesystem::resize_file(filePath, std::filesystem::file_size(filePath) - 32);
+
+    BinaryWorldFile file;
+    REQUIRE_FALSE(file.Open(filePath, false));
+
+    std::filesystem::remove(filePath);
+}
+
+TEST_CASE("Open - version 2 world - returns false", "[binary_world]")
+{
+    auto world = CreateWorld(1, 8, 8);
+    auto filePath = GetTempFilePath("binary_world_version_2.bin");
+
+    REQUIRE(WriteBinaryWorld(world, filePath));
+
+    {
+        std::fstream fs(filePath, std::ios::binary | std::ios::in | std::ios::out);
+        fs.seekp(4);
+        char version {2};
+        fs.write(&version, 1);
+    }
+
+    // version 2 worlds have no background, so are cooked again rather than used
+    REQUIRE_FALSE(BinaryWorldFile::IsBinaryWorldFile(filePath));
+
+    BinaryWorldFile file;
+    REQUIRE_FALSE(file.Open(filePath));
+
+    std::filesystem::remove(filePath);
+}
+
+TEST_CASE("Open - not a binary world - returns false", "[binary_world]")
+{
+    auto filePath = GetTempFilePath("binary_world_invalid.bin");
+
+    {
+        std::ofstream fs(filePath);
+        fs << "{ \"name\": \"not a binary world\" }";
+    }
+
+    REQUIRE_FALSE(BinaryWorldFile::IsBinaryWorldFile(filePath));
+
+    BinaryWorldFile file;
+    REQUIRE_FALSE(file.Open(filePath));
+
+    std::filesystem::remove(filePath);
+}
+
+/*********************************************
+ * ConvertToBinaryWorld
+ ********************************************/
+
+TEST_CASE("ConvertToBinaryWorld - version 1 world - converts all layers and action tiles", "[binary_world]")
+{
+    auto world = CreateWorld(1, 13, 7);
+    auto v1FilePath = GetTempFilePath("binary_world_v1.bin");
+    auto v3FilePath = GetTempFilePath("binary_world_v3.bin");
+
+    WriteV1World(world, v1FilePath);
+
+    REQUIRE_FALSE(BinaryWorldFile::IsBinaryWorldFile(v1FilePath));
+    REQUIRE(ConvertToBinaryWorld(v1FilePath, {}, v3FilePath));
+
+    BinaryWorldFile file;
+    REQUIRE(file.Open(v3FilePath));
+
+    auto data = file.ToData();
+    REQUIRE(data);
+
+    RequireSameWorld(world, *data);
+
+    std::filesystem::remove(v1FilePath);
+    std::filesystem::remove(v3FilePath);
+}
+
+TEST_CASE("ConvertToBinaryWorld - json world - resolves plots by name", "[binary_world]")
+{
+    auto jsonFilePath = GetTempFilePath("binary_world.json");
+    auto plotsFilePath = GetTempFilePath("binary_world_plots.json");
+    auto v3FilePath = GetTempFilePath("binary_world_from_json.bin");
+
+    {
+        std::ofstream fs(plotsFilePath);
+        fs << R"({ "plots": [ { "name": "grass" }, { "name": "water" }, { "name": "sand" } ] })";
+    }
+
+    {
+        std::ofstream fs(jsonFilePath);
+        fs << R"({ "name": "json_world", "islands": [
+                   { "widthInTiles": 4, "heightInTiles": 3, "tileWidth": 1, "tileHeight": 1, "x": 2, "y": 3,
+                     "layers": [ { "defaultPlot": "grass",
+                                   "regions": [ { "name": "water", "x": 1, "y": 1, "w": 10, "h": 1 } ],
+                                   "plots": [ { "name": "sand", "x": 0, "y": 2 } ] },
+                                 { "plots": [ { "name": "sand", "x": 3, "y": 0 } ] } ] } ] })";
+    }
+
+    REQUIRE(ConvertToBinaryWorld(jsonFilePath, plotsFilePath, v3FilePath));
+
+    BinaryWorldFile file;
+    REQUIRE(file.Open(v3FilePath));
+    REQUIRE(file.GetName() == "json_world");
+
+    auto data = file.ToData();
+    REQUIRE(data);
+    REQUIRE(data->Islands.size() == 1);
+
+    const auto& island = data->Islands[0];
+    REQUIRE(island.PositionX == 2.0f);
+    REQUIRE(island.PositionY == 3.0f);
+    REQUIRE(island.Layers.size() == 2);
+
+    constexpr auto e = BinaryWorldFile::EmptyPlotIndex;
+
+    REQUIRE(island.Layers[0].PlotIndexes == std::vector<uint16_t> { 0, 0, 0, 0,
+                                                                     0, 1, 1, 1,
+                                                                     2, 0, 0, 0 });
+
+    REQUIRE(island.Layers[1].PlotIndexes == std::vector<uint16_t> { e, e, e, 2,
+                                                                     e, e, e, e,
+                                                                     e, e, e, e });
+
+    std::filesystem::remove(jsonFilePath);
+    std::filesystem::remove(plotsFilePath);
+    std::filesystem::remove(v3FilePath);
+}
+
+TEST_CASE("ConvertToBinaryWorld - json world with background - keeps the background", "[binary_world]")
+{
+    auto jsonFilePath = GetTempFilePath("binary_world_with_background.json");
+    auto plotsFilePath = GetTempFilePath("binary_world_with_background_plots.json");
+    auto v3FilePath = GetTempFilePath("binary_world_with_background.bin");
+
+    {
+        std::ofstream fs(plotsFilePath);
+        fs << R"({ "plots": [ { "name": "grass" }, { "name": "water" } ] })";
+    }
+
+    {
+        std::ofstream fs(jsonFilePath);
+        fs << R"({ "name": "json_world", "islands": [
+                   { "widthInTiles": 2, "heightInTiles": 2, "tileWidth": 1, "tileHeight": 1,
+                     "layers": [ { "defaultPlot": "grass", "plots": [] } ] } ],
+                   "background": { "type": "island", "island":
+                   { "widthInTiles": 3, "heightInTiles": 1, "tileWidth": 1, "tileHeight": 1,
+                     "layers": [ { "defaultPlot": "water", "plots": [ { "name": "grass", "x": 1, "y": 0 } ] } ] } } })";
+    }
+
+    REQUIRE(ConvertToBinaryWorld(jsonFilePath, plotsFilePath, v3FilePath));
+
+    BinaryWorldFile file;
+    REQUIRE(file.Open(v3FilePath));
+    REQUIRE(file.GetIslands().size() == 1);
+
+    auto data = file.ToData();
+    REQUIRE(data);
+    REQUIRE(data->Islands[0].Layers[0].PlotIndexes == std::vector<uint16_t> { 0, 0, 0, 0 });
+
+    REQUIRE(data->Background);
+    REQUIRE(data->Background->WidthInTiles == 3);
+    REQUIRE(data->Background->Layers.size() == 1);
+    REQUIRE(data->Background->Layers[0].PlotIndexes == std::vector<uint16_t> { 1, 0, 1 });
+
+    std::filesystem::remove(jsonFilePath);
+    std::filesystem::remove(plotsFilePath);
+    std::filesystem::remove(v3FilePath);
+}
+
+TEST_CASE("ConvertToBinaryWorld - json world with unknown plot - fails", "[binary_world]")
+{
+    auto jsonFilePath = GetTempFilePath("binary_world_unknown_plot.json");
+    auto plotsFilePath = GetTempFilePath("binary_world_unknown_plot_plots.json");
+    auto v3FilePath = GetTempFilePath("binary_world_unknown_plot.bin");
+
+    {
+        std::ofstream fs(plotsFilePath);
+        fs << R"({ "plots": [ { "name": "grass" } ] })";
+    }
+
+    {
+        std::ofstream fs(jsonFilePath);
+        fs << R"({ "name": "json_world", "islands": [
+                   { "widthInTiles": 2, "heightInTiles": 2, "tileWidth": 1, "tileHeight": 1,
+                     "layers": [ { "defaultPlot": "grass",
+                                   "plots": [ { "name": "lava", "x": 0, "y": 0 } ] } ] } ] })";
+    }
+
+    REQUIRE_FALSE(ConvertToBinaryWorld(jsonFilePath, plotsFilePath, v3FilePath));
+
+    std::filesystem::remove(jsonFilePath);
+    std::filesystem::remove(plotsFilePath);
+    std::filesystem::remove(v3FilePath);
+}
+
+/*********************************************
+ * Benchmarks
+ ********************************************/
+
+TEST_CASE("Binary world load - 4096x4096 world over 4 islands", "[binary_world][.benchmark]")
+{
+    // 4 islands of 2048x2048 tiles, so 4096x4096 tiles in total
+    auto world = CreateWorld(4, 2048, 2048);
+
+    auto v1FilePaths = std::vector<std::filesystem::path>();
+    for (auto i = 0u; i < world.Islands.size(); ++i)
+    {
+        BinaryWorldData islandWorld;
+        islandWorld.Name = world.Name;
+        islandWorld.Islands.push_back(world.Islands[i]);
+
+        auto filePath = GetTempFilePath("binary_world_benchmark_v1_" + std::to_string(i) + ".bin");
+        WriteV1World(islandWorld, filePath);
+
+        v1FilePaths.push_back(filePath);
+    }
+
+    auto v3FilePath = GetTempFilePath("binary_world_benchmark_v3.bin");
+    REQUIRE(WriteBinaryWorld(world, v3FilePath));
+
+    BENCHMARK("version 1 - read and convert")
+    {
+        uint64_t total {0u};
+
+        for (const auto& filePath : v1FilePaths)
+        {
+            auto data = ReadBinaryWorldV1(filePath);
+            total += data->Islands[0].Layers[0].PlotIndexes[0];
+        }
+
+        return total;
+    };
+
+    BENCHMARK("version 3 - open with checksum and copy layers")
+    {
+        BinaryWorldFile file;
+        (void)file.Open(v3FilePath);
+
+        uint64_t total {0u};
+        std::vector<uint16_t> layer;
+
+        for (const auto& island : file.GetIslands())
+        {
+            for (const auto& layerView : island.Layers)
+            {
+                layer.resize(layerView.GetNumberOfTiles());
+                layerView.CopyTo(layer.data(), 0u, layerView.GetNumberOfTiles());
+
+                total += layer[0];
+            }
+        }
+
+        return total;
+    };
+
+    BENCHMARK("version 3 - open without checksum and use layers in place")
+    {
+        BinaryWorldFile file;
+        (void)file.Open(v3FilePath, false);
+
+        uint64_t total {0u};
+
+        for (const auto& island : file.GetIslands())
+        {
+            for (const auto& layerView : island.Layers)
+            {
+                total += layerView.GetPlotIndexes()[layerView.GetNumberOfTiles() - 1u];
+            }
+        }
+
+        return total;
+    };
+
+    for (const auto& filePath : v1FilePaths)
+    {
+        std::filesystem::remove(filePath);
+    }
+
+    std::filesystem::remove(v3FilePath);
+}
@@ -0,0 +1,207 @@
+#include <chrono>
+#include <filesystem>
+
+#include "catch2/catch.hpp"
+#include "test_util.h"
+#include "data/cooked_asset.h"
+
+using namespace projectfarm::shared;
+using namespace std::literals;
+
+namespace
+{
+    void RemoveAsset(const std::filesystem::path& filePath)
+    {
+        std::filesystem::remove(filePath);
+        std::filesystem::remove(GetCookedAssetPath(filePath));
+    }
+}
+
+/*********************************************
+ * GetCookedAssetPath
+ ********************************************/
+
+TEST_CASE("GetCookedAssetPath - json file - appends cooked extension", "[cooked_asset]")
+{
+    auto result = GetCookedAssetPath("data/shared/worlds/worlds.json");
+
+    REQUIRE(result == std::filesystem::path("data/shared/worlds/worlds.json.cooked"));
+}
+
+/*********************************************
+ * WriteCookedJsonAsset
+ ********************************************/
+
+TEST_CASE("WriteCookedJsonAsset - valid json - reads back the same json", "[cooked_asset]")
+{
+    auto cookedFilePath = GetTempFilePath("cooked_asset_round_trip.json.cooked");
+
+    auto json = nlohmann::json::parse(R"({ "name": "grass", "items": [ 1, 2.5, "three", null, true ] })");
+
+    REQUIRE(WriteCookedJsonAsset(json, cookedFilePath));
+
+    auto result = ReadCookedJsonAsset(cookedFilePath);
+    REQUIRE(result);
+    REQUIRE(*result == json);
+
+    std::filesystem::remove(cookedFilePath);
+}
+
+/*********************************************
+ * ReadCookedJsonAsset
+ ********************************************/
+
+TEST_CASE("ReadCookedJsonAsset - not a cooked asset - returns nothing", "[cooked_asset]")
+{
+    auto cookedFilePath = GetTempFilePath("cooked_asset_invalid.json.cooked");
+
+    WriteTextFile(cookedFilePath, R"({ "name": "grass" })");
+
+    REQUIRE_FALSE(ReadCookedJsonAsset(cookedFilePath));
+
+    std::filesystem::remove(cookedFilePath);
+}
+
+/*********************************************
+ * LoadJsonAsset
+ ********************************************/
+
+TEST_CASE("LoadJsonAsset - no cooked asset - reads json file", "[cooked_asset]")
+{
+    auto filePath = GetTempFilePath("cooked_asset_json_only.json");
+    RemoveAsset(filePath);
+
+    WriteTextFile(filePath, R"({ "name": "json" })");
+
+    auto result = LoadJsonAsset(filePath);
+    REQUIRE(result);
+    REQUIRE((*result)["name"].get<std::string>() == "json");
+
+    RemoveAsset(filePath);
+}
+
+TEST_CASE("LoadJsonAsset - current cooked asset - reads cooked asset", "[cooked_asset]")
+{
+    auto filePath = GetTempFilePath("cooked_asset_current.json");
+    RemoveAsset(filePath);
+
+    WriteTextFile(filePath, R"({ "name": "json" })");
+    REQUIRE(WriteCookedJsonAsset(nlohmann::json::parse(R"({ "name": "cooked" })"), GetCookedAssetPath(filePath)));
+
+    std::filesystem::last_write_time(GetCookedAssetPath(filePath),
+                                     std::filesystem::last_write_time(filePath) + 1s);
+
+    auto result = LoadJsonAsset(filePath);
+    REQUIRE(result);
+    REQUIRE((*result)["name"].get<std::string>() == "cooked");
+
+    RemoveAsset(filePath);
+}
+
+TEST_CASE("LoadJsonAsset - stale cooked asset - reads json file", "[cooked_asset]")
+{
+    auto filePath = GetTempFilePath("cooked_asset_stale.json");
+    RemoveAsset(filePath);
+
+    WriteTextFile(filePath, R"({ "name": "json" })");
+    REQUIRE(WriteCookedJsonAsset(nlohmann::json::parse(R"({ "name": "cooked" })"), GetCookedAssetPath(filePath)));
+
+    std::filesystem::last_write_time(GetCookedAssetPath(filePath),
+                                     std::filesystem::last_write_time(filePath) - 1s);
+
+    auto result = LoadJsonAsset(filePath);
+    REQUIRE(result);
+    REQUIRE((*result)["name"].get<std::string>() == "json");
+
+    RemoveAsset(filePath);
+}
+
+TEST_CASE("LoadJsonAsset - corrupt cooked asset - reads json file", "[cooked_asset]")
+{
+    auto filePath = GetTempFilePath("cooked_asset_corrupt.json");
+    RemoveAsset(filePath);
+
+    WriteTextFile(filePath, R"({ "name": "json" })");
+    WriteTextFile(GetCookedAssetPath(filePath), "PFCA\x01");
+
+    std::filesystem::last_write_time(GetCookedAssetPath(filePath),
+                                     std::filesystem::last_write_time(filePath) + 1s);
+
+    auto result = LoadJsonAsset(filePath);
+    REQUIRE(result);
+    REQUIRE((*result)["name"].get<std::string>() == "json");
+
+    RemoveAsset(filePath);
+}
+
+TEST_CASE("LoadJsonAsset - cooked asset without json file - reads cooked asset", "[cooked_asset]")
+{
+    auto filePath = GetTempFilePath("cooked_asset_shipped.json");
+    RemoveAsset(filePath);
+
+    REQUIRE(WriteCookedJsonAsset(nlohmann::json::parse(R"({ "name": "cooked" })"), GetCookedAssetPath(filePath)));
+
+    auto result = LoadJsonAsset(filePath);
+    REQUIRE(result);
+    REQUIRE((*result)["name"].get<std::string>() == "cooked");
+
+    RemoveAsset(filePath);
+}
+
+TEST_CASE("LoadJsonAsset - invalid json file - returns nothing", "[cooked_asset]")
+{
+    auto filePath = GetTempFilePath("cooked_asset_invalid_json.json");
+    RemoveAsset(filePath);
+
+    WriteTextFile(filePath, R"({ "name": )");
+
+    REQUIRE_FALSE(LoadJsonAsset(filePath));
+
+    RemoveAsset(filePath);
+}
+
+TEST_CASE("LoadJsonAsset - missing file - returns nothing", "[cooked_asset]")
+{
+    auto filePath = GetTempFilePath("cooked_asset_missing.json");
+    RemoveAsset(filePath);
+
+    REQUIRE_FALSE(LoadJsonAsset(filePath));
+}
+
+/*********************************************
+ * Benchmarks
+ ********************************************/
+
+TEST_CASE("Cooked asset load - 10000 plots", "[cooked_asset][.benchmark]")
+{
+    auto filePath = GetTempFilePath("cooked_asset_benchmark.json");
+    RemoveAsset(filePath);
+
+    nlohmann::json json;
+    for (auto i = 0u; i < 10000u; ++i)
+    {
+        json["plots"].push_back({ { "name", "plot_" + std::to_string(i) },
+                                  { "tileSet", "tileset_" + std::to_string(i % 16u) },
+                                  { "index", i },
+                                  { "isCollidable", i % 2u == 0u } });
+    }
+
+    WriteTextFile(filePath, json.dump(4));
+
+    BENCHMARK("json")
+    {
+        return LoadJsonAsset(filePath);
+    };
+
+    REQUIRE(WriteCookedJsonAsset(json, GetCookedAssetPath(filePath)));
+
+    std::filesystem::last_write_time(GetCookedAssetPath(filePath),
+                                     std::filesystem::last_write_time(filePath) + 1s);
+
+    BENCHMARK("cooked")
+    {
+        return LoadJsonAsset(filePath);
+    };
+
+    RemoveAsset(filePath);
+}
@@ -0,0 +1,255 @@
+#include <string>
+#include <filesystem>
+
+#include "catch2/catch.hpp"
+#include "test_util.h"
+#include "data/data_provider.h"
+#include "data/location_manifest.h"
+
+using namespace projectfarm::shared;
+
+namespace
+{
+    std::string CreateIndex(const std::string& key, const std::string& location, uint32_t numberOfEntries)
+    {
+        std::string text = R"({ ")" + key + R"(": [)";
+
+        for (auto i = 0u; i < numberOfEntries; ++i)
+        {
+            if (i > 0u)
+            {
+                text += ",";
+            }
+
+            text += R"({ "name": "asset_)" + std::to_string(i) + R"(", "filePath": "{)" + location +
+                    "}/asset_" + std::to_string(i) + R"(.json" })";
+        }
+
+        return text + "] }";
+    }
+
+    // the index files that `SetupServer` reads
+    void CreateServerDataFolder(const std::filesystem::path& basePath, uint32_t numberOfEntries)
+    {
+        std::filesystem::remove_all(basePath);
+
+        WriteTextFile(basePath / "data" / "shared" / "worlds" / "worlds.json",
+                      CreateIndex("worlds", "SharedWorlds", numberOfEntries));
+        WriteTextFile(basePath / "data" / "server" / "characters" / "characters.json",
+                      CreateIndex("characters", "ServerCharacters", numberOfEntries));
+        WriteTextFile(basePath / "data" / "shared" / "characters" / "action_animations.json",
+                      CreateIndex("animations", "SharedCharacters", numberOfEntries));
+    }
+}
+
+/*********************************************
+ * LocationManifest
+ ********************************************/
+
+TEST_CASE("LocationManifest - saved manifest - loads the same tables", "[location_manifest]")
+{
+    auto basePath = GetTempFilePath("location_manifest");
+    std::filesystem::remove_all(basePath);
+
+    auto indexFilePath = basePath / "data" / "index.json";
+    WriteTextFile(indexFilePath, "{}");
+
+    LocationManifestTable table;
+    table.Key = "worlds";
+    table.Dependencies.push_back({ indexFilePath, FileStamp::Get(indexFilePath) });
+    table.Entries.push_back({ "test", basePath / "data" / "test.json" });
+
+    LocationManifest manifest;
+    manifest.Load(basePath / "data.manifest", basePath / "data");
+    REQUIRE(manifest.IsLoaded());
+    REQUIRE(manifest.GetTables().empty());
+
+    manifest.SetTable(table);
+    REQUIRE(manifest.IsDirty());
+    REQUIRE(manifest.Save(basePath / "data.manifest"));
+    REQUIRE_FALSE(manifest.IsDirty());
+
+    LocationManifest loadedManifest;
+    loadedManifest.Load(basePath / "data.manifest", basePath / "data");
+
+    const auto* loadedTable = loadedManifest.FindTable("worlds", { indexFilePath });
+    REQUIRE(loadedTable);
+    REQUIRE(loadedTable->Entries.size() == 1);
+    REQUIRE(loadedTable->Entries[0].Name == "test");
+    REQUIRE(loadedTable->Entries[0].FilePath == basePath / "data" / "test.json");
+
+    // built from other files
+    REQUIRE_FALSE(loadedManifest.FindTable("worlds", { basePath / "data" / "other.json" }));
+    REQUIRE_FALSE(loadedManifest.FindTable("worlds", { indexFilePath, basePath / "data.pfa" }));
+    REQUIRE_FALSE(loadedManifest.FindTable("characters", { indexFilePath }));
+
+    // the tables hold resolved paths, so are no use for another data folder
+    LocationManifest movedManifest;
+    movedManifest.Load(basePath / "data.manifest", basePath / "moved");
+    REQUIRE(movedManifest.GetTables().empty());
+
+    std::filesystem::remove_all(basePath);
+}
+
+TEST_CASE("LocationManifest - not a manifest - loads no tables", "[location_manifest]")
+{
+    auto basePath = GetTempFilePath("location_manifest_invalid");
+    std::filesystem::remove_all(basePath);
+
+    WriteTextFile(basePath / "data.manifest", "not a manifest");
+
+    LocationManifest manifest;
+    manifest.Load(basePath / "data.manifest", basePath / "data");
+
+    REQUIRE(manifest.IsLoaded());
+    REQUIRE(manifest.GetTables().empty());
+
+    std::filesystem::remove_all(basePath);
+}
+
+/*********************************************
+ * DataProvider
+ ********************************************/
+
+TEST_CASE("DataProvider - unchanged index files - loads the locations from the manifest", "[location_manifest]")
+{
+    auto basePath = GetTempFilePath("location_manifest_setup");
+    CreateServerDataFolder(basePath, 3u);
+
+    DataProvider dataProvider(basePath);
+    REQUIRE(dataProvider.SetupServer());
+    REQUIRE(dataProvider.GetNumberOfTablesLoadedFromManifest() == 0);
+    REQUIRE(std::filesystem::exists(dataProvider.GetLocationManifestFilePath()));
+
+    DataProvider cachedDataProvider(basePath);
+    REQUIRE(cachedDataProvider.SetupServer());
+    REQUIRE(cachedDataProvider.GetNumberOfTablesLoadedFromManifest() == 3);
+
+    REQUIRE(cachedDataProvider.GetWorldLocations() == dataProvider.GetWorldLocations());
+    REQUIRE(cachedDataProvider.GetCharacterPathFromName("asset_1") ==
+            dataProvider.GetCharacterPathFromName("asset_1"));
+    REQUIRE(cachedDataProvider.GetCharacterPathFromName("asset_1") ==
+            cachedDataProvider.ResolveFileName(DataProviderLocations::ServerCharacters, "asset_1.json"));
+
+    std::filesystem::remove_all(basePath);
+}
+
+TEST_CASE("DataProvider - changed index file - reloads only that table", "[location_manifest]")
+{
+    auto basePath = GetTempFilePath("location_manifest_invalidate");
+    CreateServerDataFolder(basePath, 3u);
+
+    {
+        DataProvider dataProvider(basePath);
+        REQUIRE(dataProvider.SetupServer());
+    }
+
+    auto charactersFilePath = basePath / "data" / "server" / "characters" / "characters.json";
+    auto writeTime = std::filesystem::last_write_time(charactersFilePath);
+
+    WriteTextFile(charactersFilePath, CreateIndex("characters", "ServerCharacters", 5u));
+    std::filesystem::last_write_time(charactersFilePath, writeTime + std::chrono::seconds(1));
+
+    DataProvider dataProvider(basePath);
+    REQUIRE(dataProvider.SetupServer());
+    REQUIRE(dataProvider.GetNumberOfTablesLoadedFromManifest() == 2);
+    REQUIRE_FALSE(dataProvider.GetCharacterPathFromName("asset_4").empty());
+
+    // the reloaded table is saved, so the next start up uses it
+    DataProvider cachedDataProvider(basePath);
+    REQUIRE(cachedDataProvider.SetupServer());
+    REQUIRE(cachedDataProvider.GetNumberOfTablesLoadedFromManifest() == 3);
+    REQUIRE(cachedDataProvider.GetCharacterPathFromName("asset_4") == dataProvider.GetCharacterPathFromName("asset_4"));
+
+    // a cooked index file replaces the json file, so also invalidates the table
+    WriteTextFile(basePath / "data" / "server" / "characters" / "characters.json.cooked", "");
+
+    DataProvider cookedDataProvider(basePath);
+    REQUIRE(cookedDataProvider.SetupServer());
+    REQUIRE(cookedDataProvider.GetNumberOfTablesLoadedFromManifest() == 2);
+
+    std::filesystem::remove_all(basePath);
+}
+
+TEST_CASE("DataProvider::GetAssetId - interned assets - ids find the same paths", "[location_manifest]")
+{
+    auto basePath = GetTempFilePath("location_manifest_ids");
+    CreateServerDataFolder(basePath, 3u);
+
+    DataProvider dataProvider(basePath);
+    dataProvider.SetUseLocationManifest(false);
+    REQUIRE(dataProvider.SetupServer());
+    REQUIRE_FALSE(std::filesystem::exists(dataProvider.GetLocationManifestFilePath()));
+
+    auto worldId = dataProvider.GetAssetId(AssetTables::Worlds, "asset_0");
+    auto characterId = dataProvider.GetAssetId(AssetTables::Characters, "asset_0");
+
+    REQUIRE(worldId != InvalidAssetId);
+    REQUIRE(characterId != InvalidAssetId);
+    REQUIRE(worldId != characterId);
+
+    REQUIRE(dataProvider.GetAssetPath(worldId) == dataProvider.GetWorldLocations().at("asset_0"));
+    REQUIRE(dataProvider.GetAssetPath(characterId) == dataProvider.GetCharacterPathFromName("asset_0"));
+
+    REQUIRE(dataProvider.GetAssetId(AssetTables::Worlds, "missing") == InvalidAssetId);
+    REQUIRE(dataProvider.GetAssetId(AssetTables::TileSets, "asset_0") == InvalidAssetId);
+    REQUIRE(dataProvider.GetAssetPath(InvalidAssetId).empty());
+
+    // looking up a missing asset does not add it
+    REQUIRE(dataProvider.GetCharacterPathFromName("missing").empty());
+    REQUIRE(dataProvider.GetAssetId(AssetTables::Characters, "missing") == InvalidAssetId);
+
+    // setting up again keeps the ids
+    REQUIRE(dataProvider.SetupServer());
+    REQUIRE(dataProvider.GetAssetId(AssetTables::Worlds, "asset_0") == worldId);
+    REQUIRE(dataProvider.GetAssetId(AssetTables::Characters, "asset_0") == characterId);
+
+    std::filesystem::remove_all(basePath);
+}
+
+/*********************************************
+ * Benchmarks
+ ********************************************/
+
+TEST_CASE("Location manifest startup - 3 tables of 2000 entries", "[location_manifest][.benchmark]")
+{
+    auto basePath = GetTempFilePath("location_manifest_benchmark");
+    CreateServerDataFolder(basePath, 2000u);
+
+    BENCHMARK("index files")
+    {
+        DataProvider dataProvider(basePath);
+        dataProvider.SetUseLocationManifest(false);
+
+        return dataProvider.SetupServer();
+    };
+
+    {
+        DataProvider dataProvider(basePath);
+        REQUIRE(dataProvider.SetupServer());
+    }
+
+    BENCHMARK("manifest")
+    {
+        DataProvider dataProvider(basePath);
+
+        return dataProvider.SetupServer();
+    };
+
+    DataProvider dataProvider(basePath);
+    REQUIRE(dataProvider.SetupServer());
+
+    auto id = dataProvider.GetAssetId(AssetTables::Characters, "asset_1000");
+
+    BENCHMARK("lookup by name")
+    {
+        return dataProvider.GetCharacterPathFromName("asset_1000").native().size();
+    };
+
+    BENCHMARK("lookup by id")
+    {
+        return dataProvider.GetAssetPath(id).native().size();
+    };
+
+    std::filesystem::remove_all(basePath);
+}
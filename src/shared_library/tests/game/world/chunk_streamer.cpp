@@ -0,0 +1,335 @@
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <set>
+#include <vector>
+
+#include "catch2/catch.hpp"
+#include "game/world/chunk_streamer.h"
+
+using namespace std::literals;
+using namespace projectfarm::shared::concurrency;
+using namespace projectfarm::shared::game::world;
+
+namespace
+{
+    // a stand in for a tile map, filled by activated chunks and cleared by evicted ones
+    struct TestTiles
+    {
+        static constexpr uint16_t Empty {0xFFFFu};
+
+        uint32_t Width {0u};
+        uint32_t Height {0u};
+        std::vector<uint16_t> Tiles;
+
+        TestTiles(uint32_t width, uint32_t height)
+            : Width {width},
+              Height {height},
+              Tiles(static_cast<size_t>(width) * height, Empty)
+        {
+        }
+
+        void Fill(const WorldChunk& chunk, const std::vector<uint16_t>* layer)
+        {
+            for (auto y = 0u; y < chunk.HeightInTiles; ++y)
+            {
+                for (auto x = 0u; x < chunk.WidthInTiles; ++x)
+                {
+                    this->Tiles[(chunk.TileY + y) * this->Width + chunk.TileX + x] =
+                        layer ? (*layer)[y * chunk.WidthInTiles + x] : Empty;
+                }
+            }
+        }
+    };
+
+    uint16_t GetTileValue(uint32_t x, uint32_t y)
+    {
+        return static_cast<uint16_t>((x * 31u + y * 17u) % 1000u);
+    }
+
+    void SetupStreamer(ChunkStreamer& streamer, TestTiles& tiles)
+    {
+        streamer.SetPrepareChunk([](WorldChunk& chunk)
+        {
+            std::vector<uint16_t> layer;
+            layer.reserve(chunk.WidthInTiles * chunk.HeightInTiles);
+
+            for (auto y = 0u; y < chunk.HeightInTiles; ++y)
+            {
+                for (auto x = 0u; x < chunk.WidthInTiles; ++x)
+                {
+                    layer.push_back(GetTileValue(chunk.TileX + x, chunk.TileY + y));
+                }
+            }
+
+            chunk.Layers.emplace_back(std::move(layer));
+            return true;
+        });
+
+        streamer.SetActivateChunk([&tiles](const WorldChunk& chunk)
+        {
+            tiles.Fill(chunk, &chunk.Layers[0]);
+        });
+
+        streamer.SetEvictChunk([&tiles](const WorldChunk& chunk)
+        {
+            tiles.Fill(chunk, nullptr);
+        });
+    }
+
+    void UpdateUntilIdle(ChunkStreamer& streamer, int32_t centerTileX, int32_t centerTileY)
+    {
+        for (auto i = 0u; i < 10000u; ++i)
+        {
+            streamer.Update(centerTileX, centerTileY);
+
+            if (streamer.GetNumberOfPendingChunks() == 0u)
+            {
+                return;
+            }
+
+            std::this_thread::sleep_for(100us);
+        }
+
+        FAIL("Chunks were not activated.");
+    }
+}
+
+/*********************************************
+ * ChunkStreamer
+ ********************************************/
+
+TEST_CASE("ChunkStreamer - uneven size - covers every tile", "[world]")
+{
+    auto threadPool = std::make_shared<ThreadPool>(2);
+    TestTiles tiles(70, 33);
+
+    ChunkStreamer streamer(threadPool, tiles.Width, tiles.Height, 16);
+    SetupStreamer(streamer, tiles);
+
+    REQUIRE(streamer.GetNumberOfChunksX() == 5u);
+    REQUIRE(streamer.GetNumberOfChunksY() == 3u);
+
+    streamer.LoadAll();
+
+    REQUIRE(streamer.GetNumberOfActiveChunks() == 15u);
+
+    for (auto y = 0u; y < tiles.Height; ++y)
+    {
+        for (auto x = 0u; x < tiles.Width; ++x)
+        {
+            REQUIRE(tiles.Tiles[y * tiles.Width + x] == GetTileValue(x, y));
+        }
+    }
+}
+
+TEST_CASE("ChunkStreamer - update - prepares chunks on other threads and activates on the calling thread", "[world]")
+{
+    auto threadPool = std::make_shared<ThreadPool>(2);
+    TestTiles tiles(256, 256);
+
+    ChunkStreamer streamer(threadPool, tiles.Width, tiles.Height, 32);
+    SetupStreamer(streamer, tiles);
+
+    std::mutex mutex;
+    std::set<std::thread::id> prepareThreadIds;
+    auto activatedOnCallingThread = true;
+    auto callingThreadId = std::this_thread::get_id();
+
+    streamer.SetPrepareChunk([&mutex, &prepareThreadIds](WorldChunk& chunk)
+    {
+        {
+            std::scoped_lock lock(mutex);
+            prepareThreadIds.insert(std::this_thread::get_id());
+        }
+
+        chunk.Layers.emplace_back(chunk.WidthInTiles * chunk.HeightInTiles, static_cast<uint16_t>(1u));
+        return true;
+    });
+
+    streamer.SetActivateChunk([&](const WorldChunk& chunk)
+    {
+        activatedOnCallingThread &= std::this_thread::get_id() == callingThreadId;
+        tiles.Fill(chunk, &chunk.Layers[0]);
+    });
+
+    streamer.SetLoadRadius(1);
+
+    UpdateUntilIdle(streamer, 128, 128);
+
+    REQUIRE(activatedOnCallingThread);
+    REQUIRE_FALSE(prepareThreadIds.empty());
+    REQUIRE(prepareThreadIds.count(callingThreadId) == 0u);
+
+    // a 3x3 square of chunks around the center
+    REQUIRE(streamer.GetNumberOfActiveChunks() == 9u);
+    REQUIRE(streamer.IsChunkActive(3, 3));
+    REQUIRE(streamer.IsChunkActive(4, 4));
+    REQUIRE(streamer.IsChunkActive(5, 5));
+    REQUIRE_FALSE(streamer.IsChunkActive(6, 6));
+    REQUIRE(tiles.Tiles[128 * tiles.Width + 128] == 1u);
+    REQUIRE(tiles.Tiles[0] == TestTiles::Empty);
+}
+
+TEST_CASE("ChunkStreamer - center moves away - evicts far chunks", "[world]")
+{
+    auto threadPool = std::make_shared<ThreadPool>(2);
+    TestTiles tiles(512, 64);
+
+    ChunkStreamer streamer(threadPool, tiles.Width, tiles.Height, 32);
+    SetupStreamer(streamer, tiles);
+
+    streamer.SetLoadRadius(1);
+
+    UpdateUntilIdle(streamer, 0, 0);
+
+    REQUIRE(streamer.IsTileActive(0, 0));
+    REQUIRE(tiles.Tiles[0] == GetTileValue(0, 0));
+
+    // within the eviction margin, so nothing is evicted
+    UpdateUntilIdle(streamer, 64, 0);
+    REQUIRE(streamer.IsTileActive(0, 0));
+
+    UpdateUntilIdle(streamer, 500, 0);
+
+    REQUIRE_FALSE(streamer.IsTileActive(0, 0));
+    REQUIRE(tiles.Tiles[0] == TestTiles::Empty);
+    REQUIRE(streamer.IsTileActive(500, 0));
+    REQUIRE(streamer.GetNumberOfActiveChunks() == 4u);
+
+    // the camera is away from the area
+    UpdateUntilIdle(streamer, -10000, -10000);
+    REQUIRE(streamer.GetNumberOfActiveChunks() == 0u);
+}
+
+TEST_CASE("ChunkStreamer - many ready chunks - activates within the update budget", "[world]")
+{
+    auto threadPool = std::make_shared<ThreadPool>(2);
+    TestTiles tiles(256, 256);
+
+    ChunkStreamer streamer(threadPool, tiles.Width, tiles.Height, 16);
+    SetupStreamer(streamer, tiles);
+
+    streamer.SetLoadRadius(100);
+    streamer.SetUpdateBudget(3, 1000000);
+
+    std::vector<uint32_t> activations;
+
+    while (streamer.GetNumberOfActiveChunks() < 256u)
+    {
+        streamer.Update(0, 0);
+        activations.push_back(streamer.GetLastNumberOfActivations());
+
+        std::this_thread::sleep_for(100us);
+    }
+
+    for (auto numberOfActivations : activations)
+    {
+        REQUIRE(numberOfActivations <= 3u);
+    }
+}
+
+TEST_CASE("ChunkStreamer - slow preparation - update time stays bounded", "[world]")
+{
+    auto threadPool = std::make_shared<ThreadPool>(2);
+    TestTiles tiles(256, 256);
+
+    ChunkStreamer streamer(threadPool, tiles.Width, tiles.Height, 32);
+    SetupStreamer(streamer, tiles);
+
+    // preparing all 64 chunks on the calling thread would take at least 320ms
+    streamer.SetPrepareChunk([](WorldChunk& chunk)
+    {
+        std::this_thread::sleep_for(5ms);
+
+        chunk.Layers.emplace_back(chunk.WidthInTiles * chunk.HeightInTiles, static_cast<uint16_t>(1u));
+        return true;
+    });
+
+    streamer.SetLoadRadius(8);
+
+    std::chrono::steady_clock::duration longestUpdate {};
+
+    while (streamer.GetNumberOfActiveChunks() < 64u)
+    {
+        auto startTime = std::chrono::steady_clock::now();
+
+        streamer.Update(0, 0);
+
+        longestUpdate = std::max(longestUpdate, std::chrono::steady_clock::now() - startTime);
+
+        std::this_thread::sleep_for(1ms);
+    }
+
+    REQUIRE(longestUpdate < 5ms);
+}
+
+TEST_CASE("ChunkStreamer - tile changes while preparing - prepares the chunk again", "[world]")
+{
+    auto threadPool = std::make_shared<ThreadPool>(1);
+    TestTiles tiles(32, 32);
+
+    ChunkStreamer streamer(threadPool, tiles.Width, tiles.Height, 32);
+    SetupStreamer(streamer, tiles);
+
+    std::atomic<uint16_t> value {1u};
+    std::promise<void> prepareStarted;
+    std::promise<void> tileChanged;
+    auto tileChangedFuture = tileChanged.get_future().share();
+    auto isFirstPrepare = true;
+
+    streamer.SetPrepareChunk([&](WorldChunk& chunk)
+    {
+        auto tileValue = value.load();
+
+        if (isFirstPrepare)
+        {
+            isFirstPrepare = false;
+            prepareStarted.set_value();
+            tileChangedFuture.wait();
+        }
+
+        chunk.Layers.emplace_back(chunk.WidthInTiles * chunk.HeightInTiles, tileValue);
+        return true;
+    });
+
+    streamer.Update(0, 0);
+    prepareStarted.get_future().wait();
+
+    value = 2u;
+    streamer.Invalidate(5, 5);
+    tileChanged.set_value();
+
+    UpdateUntilIdle(streamer, 0, 0);
+
+    REQUIRE(tiles.Tiles[0] == 2u);
+}
+
+TEST_CASE("ChunkStreamer - failed preparation - does not activate the chunk", "[world]")
+{
+    auto threadPool = std::make_shared<ThreadPool>(2);
+    TestTiles tiles(64, 32);
+
+    ChunkStreamer streamer(threadPool, tiles.Width, tiles.Height, 32);
+    SetupStreamer(streamer, tiles);
+
+    streamer.SetPrepareChunk([](WorldChunk& chunk)
+    {
+        if (chunk.ChunkX == 1u)
+        {
+            throw std::runtime_error("failed");
+        }
+
+        chunk.Layers.emplace_back(chunk.WidthInTiles * chunk.HeightInTiles, static_cast<uint16_t>(1u));
+        return true;
+    });
+
+    streamer.LoadAll();
+
+    REQUIRE(streamer.IsChunkActive(0, 0));
+    REQUIRE_FALSE(streamer.IsChunkActive(1, 0));
+    REQUIRE(streamer.GetNumberOfPendingChunks() == 0u);
+}
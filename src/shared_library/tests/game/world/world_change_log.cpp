@@ -0,0 +1,252 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "catch2/catch.hpp"
+#include "world_test_util.h"
+#include "game/world/world_change_log.h"
+
+using namespace projectfarm::shared::game::world;
+
+namespace
+{
+    // the size of each change as the change log used to be sent
+    constexpr uint64_t UncompressedChangeSize {19u};
+
+    bool AreEqual(const WorldChangeLogEntry& a, const WorldChangeLogEntry& b)
+    {
+        return a.LayerIndex == b.LayerIndex && a.TileX == b.TileX && a.TileY == b.TileY &&
+               a.Time == b.Time && a.PlotIndex == b.PlotIndex;
+    }
+
+    std::vector<std::byte> Encode(const std::vector<WorldChangeLogEntry>& changes)
+    {
+        std::vector<std::byte> bytes;
+        EncodeWorldChanges(changes, bytes);
+
+        return bytes;
+    }
+}
+
+/*********************************************
+ * WorldChangeLog
+ ********************************************/
+
+TEST_CASE("WorldChangeLog::GetChanges - tile changed many times - returns the latest change", "[world_change_log]")
+{
+    WorldChangeLog log(4u);
+
+    REQUIRE(log.Add(CreateChange(0u, 1u, 1u, 10u, 5u)));
+    REQUIRE(log.Add(CreateChange(0u, 1u, 1u, 20u, 6u)));
+    REQUIRE(log.Add(CreateChange(1u, 0u, 0u, 30u, 7u)));
+    REQUIRE(log.Add(CreateChange(0u, 1u, 1u, 40u, 8u)));
+
+    // compacted
+    REQUIRE(log.GetNumberOfTailEntries() == 0);
+    REQUIRE(log.GetNumberOfSnapshotEntries() == 2);
+
+    REQUIRE(log.Add(CreateChange(0u, 1u, 1u, 50u, 9u)));
+    REQUIRE(log.Add(CreateChange(0u, 0u, 2u, 60u, 1u)));
+    REQUIRE(log.GetNumberOfTailEntries() == 2);
+    REQUIRE(log.GetNumberOfChangesAdded() == 6);
+
+    auto changes = log.GetChanges();
+    REQUIRE(changes.size() == 3);
+
+    // ordered by layer, row then column
+    REQUIRE(AreEqual(changes[0], CreateChange(0u, 1u, 1u, 50u, 9u)));
+    REQUIRE(AreEqual(changes[1], CreateChange(0u, 0u, 2u, 60u, 1u)));
+    REQUIRE(AreEqual(changes[2], CreateChange(1u, 0u, 0u, 30u, 7u)));
+}
+
+TEST_CASE("WorldChangeLog::GetChanges - since a time - returns only later changes", "[world_change_log]")
+{
+    WorldChangeLog log(2u);
+
+    REQUIRE(log.Add(CreateChange(0u, 0u, 0u, 10u, 1u)));
+    REQUIRE(log.Add(CreateChange(0u, 1u, 0u, 20u, 2u)));
+    REQUIRE(log.Add(CreateChange(0u, 2u, 0u, 30u, 3u)));
+
+    auto changes = log.GetChanges(15u);
+    REQUIRE(changes.size() == 2);
+    REQUIRE(changes[0].Time == 20u);
+    REQUIRE(changes[1].Time == 30u);
+
+    REQUIRE(log.GetChanges(30u).empty());
+}
+
+TEST_CASE("WorldChangeLog::GetChanges - since a time after compacting - skips tiles changed before", "[world_change_log]")
+{
+    WorldChangeLog log(3u);
+
+    REQUIRE(log.Add(CreateChange(0u, 0u, 0u, 10u, 1u)));
+    REQUIRE(log.Add(CreateChange(0u, 1u, 0u, 20u, 2u)));
+    REQUIRE(log.Add(CreateChange(0u, 0u, 0u, 30u, 3u)));
+
+    // an older change to a tile arriving late does not replace the newer one
+    REQUIRE(log.Add(CreateChange(0u, 1u, 0u, 5u, 4u)));
+    REQUIRE(log.Add(CreateChange(0u, 2u, 0u, 40u, 5u)));
+    REQUIRE(log.Add(CreateChange(0u, 1u, 0u, 50u, 6u)));
+
+    REQUIRE(log.GetNumberOfTailEntries() == 0);
+
+    auto changes = log.GetChanges(25u);
+    REQUIRE(changes.size() == 3);
+    REQUIRE(AreEqual(changes[0], CreateChange(0u, 0u, 0u, 30u, 3u)));
+    REQUIRE(AreEqual(changes[1], CreateChange(0u, 1u, 0u, 50u, 6u)));
+    REQUIRE(AreEqual(changes[2], CreateChange(0u, 2u, 0u, 40u, 5u)));
+
+    changes = log.GetChanges(45u);
+    REQUIRE(changes.size() == 1);
+    REQUIRE(AreEqual(changes[0], CreateChange(0u, 1u, 0u, 50u, 6u)));
+
+    REQUIRE(log.GetChanges(50u).empty());
+
+    log.Clear();
+    REQUIRE(log.GetChanges().empty());
+}
+
+TEST_CASE("WorldChangeLog::Add - tile out of range - is not added", "[world_change_log]")
+{
+    WorldChangeLog log;
+
+    REQUIRE_FALSE(log.Add(CreateChange(0u, WorldChangeLog::MaxTileCoordinate, 0u, 1u, 1u)));
+    REQUIRE(log.GetChanges().empty());
+}
+
+/*********************************************
+ * Encoding
+ ********************************************/
+
+TEST_CASE("DecodeWorldChanges - encoded changes - returns the same changes", "[world_change_log]")
+{
+    std::vector<WorldChangeLogEntry> changes
+    {
+        CreateChange(0u, 5u, 3u, 1000u, 2u),
+        CreateChange(0u, 2u, 3u, 900u, 2u),
+        CreateChange(0u, 0xFFFFFFu, 0u, 0xFFFFFFFFFFFFu, 65535u),
+        CreateChange(3u, 0u, 100u, 1u, 0u),
+        CreateChange(255u, 7u, 7u, 50000000000u, 12u),
+    };
+
+    auto bytes = Encode(changes);
+
+    uint32_t index {0u};
+    std::vector<WorldChangeLogEntry> decoded;
+    REQUIRE(DecodeWorldChanges(bytes, index, decoded));
+    REQUIRE(index == bytes.size());
+
+    REQUIRE(decoded.size() == changes.size());
+    for (auto i = 0u; i < changes.size(); ++i)
+    {
+        REQUIRE(AreEqual(decoded[i], changes[i]));
+    }
+}
+
+TEST_CASE("DecodeWorldChanges - no changes - returns no changes", "[world_change_log]")
+{
+    auto bytes = Encode({});
+    REQUIRE(bytes.size() == 1);
+
+    uint32_t index {0u};
+    std::vector<WorldChangeLogEntry> decoded { CreateChange(0u, 0u, 0u, 0u, 0u) };
+    REQUIRE(DecodeWorldChanges(bytes, index, decoded));
+    REQUIRE(decoded.empty());
+}
+
+TEST_CASE("DecodeWorldChanges - truncated data - fails", "[world_change_log]")
+{
+    std::vector<WorldChangeLogEntry> changes;
+    for (auto i = 0u; i < 100u; ++i)
+    {
+        changes.push_back(CreateChange(static_cast<uint8_t>(i % 3u), i, i * 2u, i * 1000u, static_cast<uint16_t>(i)));
+    }
+
+    auto bytes = Encode(changes);
+
+    for (auto size : { bytes.size() - 1u, bytes.size() / 2u, static_cast<size_t>(1u) })
+    {
+        std::vector<std::byte> truncated(bytes.begin(), bytes.begin() + static_cast<std::ptrdiff_t>(size));
+
+        uint32_t index {0u};
+        std::vector<WorldChangeLogEntry> decoded;
+        REQUIRE_FALSE(DecodeWorldChanges(truncated, index, decoded));
+        REQUIRE(decoded.empty());
+    }
+}
+
+TEST_CASE("EncodeWorldChangeChunks - many changes - chunks decode to the same changes", "[world_change_log]")
+{
+    std::vector<WorldChangeLogEntry> changes;
+    for (auto i = 0u; i < 1000u; ++i)
+    {
+        changes.push_back(CreateChange(0u, i % 40u, i / 40u, 5000u + i, static_cast<uint16_t>(i / 100u)));
+    }
+
+    auto chunks = EncodeWorldChangeChunks(changes, 300u);
+    REQUIRE(chunks.size() == 4);
+
+    std::vector<WorldChangeLogEntry> decoded;
+
+    for (const auto& chunk : chunks)
+    {
+        uint32_t index {0u};
+        std::vector<WorldChangeLogEntry> chunkChanges;
+        REQUIRE(DecodeWorldChanges(chunk, index, chunkChanges));
+
+        decoded.insert(decoded.end(), chunkChanges.begin(), chunkChanges.end());
+    }
+
+    REQUIRE(decoded.size() == changes.size());
+    for (auto i = 0u; i < changes.size(); ++i)
+    {
+        REQUIRE(AreEqual(decoded[i], changes[i]));
+    }
+
+    REQUIRE(EncodeWorldChangeChunks({}, 300u).size() == 1);
+}
+
+TEST_CASE("WorldChangeLog - 1M tile changes - load size is bounded by the island size", "[world_change_log]")
+{
+    constexpr uint32_t width {64u};
+    constexpr uint32_t height {64u};
+    constexpr uint8_t numberOfLayers {3u};
+    constexpr uint64_t numberOfTiles = static_cast<uint64_t>(width) * height * numberOfLayers;
+
+    WorldChangeLog log;
+
+    std::mt19937 random(1234u);
+    std::uniform_int_distribution<uint32_t> tile(0u, width * height * numberOfLayers - 1u);
+    std::uniform_int_distribution<uint16_t> plot(0u, 20u);
+
+    uint64_t time {0u};
+
+    auto addChanges = [&](uint32_t count)
+    {
+        for (auto i = 0u; i < count; ++i)
+        {
+            auto t = tile(random);
+            time += 1000u + (t % 7u);
+
+            REQUIRE(log.Add(CreateChange(static_cast<uint8_t>(t / (width * height)),
+                                         t % width, (t / width) % height, time, plot(random))));
+        }
+    };
+
+    addChanges(100000u);
+    auto sizeAfter100K = Encode(log.GetChanges()).size();
+
+    addChanges(900000u);
+    REQUIRE(log.GetNumberOfChangesAdded() == 1000000u);
+
+    auto changes = log.GetChanges();
+    auto sizeAfter1M = Encode(changes).size();
+
+    REQUIRE(changes.size() <= numberOfTiles);
+    REQUIRE(log.GetNumberOfSnapshotEntries() <= numberOfTiles);
+    REQUIRE(log.GetNumberOfTailEntries() < WorldChangeLog::DefaultCompactionThreshold);
+
+    // far smaller than the 19MB the full log would take, and no bigger than after 100K changes
+    REQUIRE(sizeAfter1M < numberOfTiles * UncompressedChangeSize);
+    REQUIRE(sizeAfter1M < sizeAfter100K + sizeAfter100K / 10u);
+}
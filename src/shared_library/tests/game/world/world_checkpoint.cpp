@@ -0,0 +1,417 @@
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "catch2/catch.hpp"
+#include "test_util.h"
+#include "world_test_util.h"
+#include "game/world/world_checkpoint.h"
+
+using namespace projectfarm::shared::game::world;
+
+namespace
+{
+    EntityCheckpoint CreateEntity(const std::string& type, float x, float y)
+    {
+        EntityCheckpoint entity;
+        entity.CharacterType = type;
+        entity.PositionX = x;
+        entity.PositionY = y;
+        entity.MoveToDestinationX = x + 1.5f;
+        entity.MoveToDestinationY = y - 0.25f;
+        entity.States = { {2u, 1u}, {0u, 0u} };
+        entity.BehaviourStates = { {1u, 0u} };
+
+        return entity;
+    }
+
+    WorldCheckpoint CreateCheckpoint(uint64_t sequence, uint64_t gameTime)
+    {
+        WorldCheckpoint checkpoint;
+        checkpoint.WorldName = "world";
+        checkpoint.Sequence = sequence;
+        checkpoint.GameTime = gameTime;
+
+        return checkpoint;
+    }
+
+    bool AreEqual(const WorldChangeLogEntry& a, const WorldChangeLogEntry& b)
+    {
+        return a.LayerIndex == b.LayerIndex && a.TileX == b.TileX && a.TileY == b.TileY &&
+               a.Time == b.Time && a.PlotIndex == b.PlotIndex;
+    }
+
+    bool WaitForCheckpoints(const WorldCheckpointWriter& writer, uint64_t numberOfCheckpoints)
+    {
+        for (auto i = 0u; i < 500u; ++i)
+        {
+            if (writer.GetNumberOfCheckpointsWritten() >= numberOfCheckpoints)
+            {
+                return true;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+
+        return false;
+    }
+}
+
+/*********************************************
+ * Encoding
+ ********************************************/
+
+TEST_CASE("DecodeWorldCheckpoint - encoded checkpoint - returns the same checkpoint", "[world_checkpoint]")
+{
+    auto checkpoint = CreateCheckpoint(7u, 123456789u);
+    checkpoint.IslandChanges = { { CreateChange(0u, 1u, 2u, 100u, 3u), CreateChange(2u, 5u, 0u, 200u, 9u) }, {} };
+    checkpoint.Entities = { CreateEntity("farmer", 1.0f, 2.0f), CreateEntity("cow", -3.5f, 10.25f) };
+    checkpoint.ScriptState = R"({ "day": 4 })";
+
+    std::vector<std::byte> bytes;
+    EncodeWorldCheckpoint(checkpoint, bytes);
+
+    uint32_t index {0u};
+    WorldCheckpoint decoded;
+    REQUIRE(DecodeWorldCheckpoint(bytes, index, decoded));
+    REQUIRE(index == bytes.size());
+
+    REQUIRE(decoded.WorldName == "world");
+    REQUIRE(decoded.Sequence == 7u);
+    REQUIRE(decoded.GameTime == 123456789u);
+    REQUIRE(decoded.ScriptState == checkpoint.ScriptState);
+
+    REQUIRE(decoded.IslandChanges.size() == 2);
+    REQUIRE(decoded.IslandChanges[0].size() == 2);
+    REQUIRE(AreEqual(decoded.IslandChanges[0][1], checkpoint.IslandChanges[0][1]));
+    REQUIRE(decoded.IslandChanges[1].empty());
+
+    REQUIRE(decoded.Entities.size() == 2);
+    REQUIRE(decoded.Entities[1].CharacterType == "cow");
+    REQUIRE(decoded.Entities[1].PositionX == -3.5f);
+    REQUIRE(decoded.Entities[1].MoveToDestinationY == 10.0f);
+    REQUIRE(decoded.Entities[1].States.size() == 2);
+    REQUIRE(decoded.Entities[1].States[0].Key == 2u);
+    REQUIRE(decoded.Entities[1].States[0].Value == 1u);
+    REQUIRE(decoded.Entities[1].BehaviourStates.size() == 1);
+
+    for (auto size : { bytes.size() - 1u, bytes.size() / 2u, static_cast<size_t>(3u) })
+    {
+        std::vector<std::byte> truncated(bytes.begin(), bytes.begin() + static_cast<std::ptrdiff_t>(size));
+
+        index = 0u;
+        REQUIRE_FALSE(DecodeWorldCheckpoint(truncated, index, decoded));
+    }
+}
+
+/*********************************************
+ * WorldCheckpointStore
+ ********************************************/
+
+TEST_CASE("WorldCheckpointStore::Restore - base and journal - returns the latest state", "[world_checkpoint]")
+{
+    auto directory = GetTempFilePath("checkpoint_store");
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    WorldCheckpointStore store(directory, "world");
+    REQUIRE_FALSE(store.Restore());
+
+    auto base = CreateCheckpoint(1u, 1000u);
+    base.IslandChanges = { { CreateChange(0u, 0u, 0u, 100u, 1u), CreateChange(0u, 1u, 0u, 100u, 1u) } };
+    base.Entities = { CreateEntity("cow", 0.0f, 0.0f) };
+    base.ScriptState = "base";
+    REQUIRE(store.WriteBase(base));
+
+    auto record = CreateCheckpoint(2u, 2000u);
+    record.IslandChanges = { { CreateChange(0u, 1u, 0u, 1500u, 4u) }, { CreateChange(1u, 3u, 3u, 1600u, 5u) } };
+    record.Entities = { CreateEntity("cow", 8.0f, 9.0f) };
+    record.ScriptState = "journal";
+    REQUIRE(store.AppendToJournal(record));
+
+    auto restored = store.Restore();
+    REQUIRE(restored);
+    REQUIRE(restored->Sequence == 2u);
+    REQUIRE(restored->GameTime == 2000u);
+    REQUIRE(restored->ScriptState == "journal");
+    REQUIRE(restored->Entities.size() == 1);
+    REQUIRE(restored->Entities[0].PositionX == 8.0f);
+
+    REQUIRE(restored->IslandChanges.size() == 2);
+    REQUIRE(restored->IslandChanges[0].size() == 2);
+    REQUIRE(AreEqual(restored->IslandChanges[0][0], CreateChange(0u, 0u, 0u, 100u, 1u)));
+    REQUIRE(AreEqual(restored->IslandChanges[0][1], CreateChange(0u, 1u, 0u, 1500u, 4u)));
+    REQUIRE(restored->IslandChanges[1].size() == 1);
+
+    // a new base empties the journal
+    REQUIRE(store.WriteBase(*restored));
+    REQUIRE(std::filesystem::file_size(store.GetJournalFilePath()) == 0u);
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("WorldCheckpointStore::Restore - torn journal record - is ignored", "[world_checkpoint]")
+{
+    auto directory = GetTempFilePath("checkpoint_torn");
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    WorldCheckpointStore store(directory, "world");
+    REQUIRE(store.WriteBase(CreateCheckpoint(1u, 1000u)));
+
+    auto first = CreateCheckpoint(2u, 2000u);
+    first.ScriptState = "first";
+    REQUIRE(store.AppendToJournal(first));
+
+    auto second = CreateCheckpoint(3u, 3000u);
+    second.ScriptState = "second";
+    REQUIRE(store.AppendToJournal(second));
+
+    // a crash part way through writing the last record
+    auto journalSize = std::filesystem::file_size(store.GetJournalFilePath());
+    std::filesystem::resize_file(store.GetJournalFilePath(), journalSize - 3u);
+
+    auto restored = store.Restore();
+    REQUIRE(restored);
+    REQUIRE(restored->Sequence == 2u);
+    REQUIRE(restored->ScriptState == "first");
+
+    // a record with a bad checksum hides every record after it
+    {
+        std::fstream fs(store.GetJournalFilePath(), std::ios::in | std::ios::out | std::ios::binary);
+        fs.seekp(20);
+        fs.put('x');
+    }
+
+    restored = store.Restore();
+    REQUIRE(restored);
+    REQUIRE(restored->Sequence == 1u);
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("WorldCheckpointStore::Restore - journal older than the base - is skipped", "[world_checkpoint]")
+{
+    auto directory = GetTempFilePath("checkpoint_stale");
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    WorldCheckpointStore store(directory, "world");
+
+    auto base = CreateCheckpoint(5u, 5000u);
+    base.ScriptState = "base";
+    REQUIRE(store.WriteBase(base));
+
+    // as if emptying the journal failed after writing the base
+    auto stale = CreateCheckpoint(4u, 4000u);
+    stale.ScriptState = "stale";
+    REQUIRE(store.AppendToJournal(stale));
+
+    auto restored = store.Restore();
+    REQUIRE(restored);
+    REQUIRE(restored->Sequence == 5u);
+    REQUIRE(restored->ScriptState == "base");
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("WorldCheckpointStore::Restore - corrupt base - returns nothing", "[world_checkpoint]")
+{
+    auto directory = GetTempFilePath("checkpoint_corrupt");
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    WorldCheckpointStore store(directory, "world");
+    REQUIRE(store.WriteBase(CreateCheckpoint(1u, 1000u)));
+
+    {
+        std::fstream fs(store.GetBaseFilePath(), std::ios::in | std::ios::out | std::ios::binary);
+        fs.seekp(24);
+        fs.put('x');
+    }
+
+    REQUIRE_FALSE(store.Restore());
+
+    std::filesystem::remove_all(directory);
+}
+
+/*********************************************
+ * WorldCheckpointWriter
+ ********************************************/
+
+TEST_CASE("WorldCheckpointWriter - many checkpoints - folds the journal into a new base", "[world_checkpoint]")
+{
+    auto directory = GetTempFilePath("checkpoint_writer");
+    std::filesystem::remove_all(directory);
+
+    WorldCheckpointWriter writer(directory, "world", 2u);
+
+    auto seed = CreateCheckpoint(10u, 0u);
+    seed.IslandChanges = { { CreateChange(0u, 0u, 0u, 50u, 1u) } };
+    writer.Seed(seed);
+
+    REQUIRE(writer.Start());
+
+    WorldCheckpointStore store(directory, "world");
+
+    for (auto i = 1u; i <= 4u; ++i)
+    {
+        auto checkpoint = CreateCheckpoint(0u, i * 1000u);
+        checkpoint.IslandChanges = { { CreateChange(0u, i, 0u, i * 1000u, static_cast<uint16_t>(i)) } };
+        checkpoint.ScriptState = std::to_string(i);
+
+        writer.Submit(std::move(checkpoint));
+        REQUIRE(WaitForCheckpoints(writer, i));
+
+        // a base, two journal records, then a new base
+        auto journalSize = std::filesystem::file_size(store.GetJournalFilePath());
+        REQUIRE((journalSize == 0u) == (i == 1u || i == 4u));
+
+        auto restored = store.Restore();
+        REQUIRE(restored);
+        REQUIRE(restored->Sequence == 10u + i);
+        REQUIRE(restored->ScriptState == std::to_string(i));
+        REQUIRE(restored->IslandChanges.size() == 1);
+        REQUIRE(restored->IslandChanges[0].size() == 1u + i);
+    }
+
+    writer.Stop();
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("WorldCheckpointWriter::Stop - checkpoint submitted - is written", "[world_checkpoint]")
+{
+    auto directory = GetTempFilePath("checkpoint_stop");
+    std::filesystem::remove_all(directory);
+
+    {
+        WorldCheckpointWriter writer(directory, "world");
+        REQUIRE(writer.Start());
+
+        for (auto i = 1u; i <= 3u; ++i)
+        {
+            auto checkpoint = CreateCheckpoint(0u, i * 1000u);
+            checkpoint.IslandChanges = { { CreateChange(0u, i, i, i * 1000u, 1u) } };
+            writer.Submit(std::move(checkpoint));
+        }
+
+        writer.Stop();
+        REQUIRE(writer.GetNumberOfCheckpointsWritten() >= 1u);
+    }
+
+    WorldCheckpointStore store(directory, "world");
+
+    // merged checkpoints keep every change
+    auto restored = store.Restore();
+    REQUIRE(restored);
+    REQUIRE(restored->GameTime == 3000u);
+    REQUIRE(restored->IslandChanges.size() == 1);
+    REQUIRE(restored->IslandChanges[0].size() == 3);
+
+    std::filesystem::remove_all(directory);
+}
+
+/*********************************************
+ * Benchmarks
+ ********************************************/
+
+TEST_CASE("World checkpoint - restore a 64x64x3 island with 31 journal records", "[world_checkpoint][.benchmark]")
+{
+    constexpr uint32_t width {64u};
+    constexpr uint32_t height {64u};
+    constexpr uint8_t numberOfLayers {3u};
+    constexpr uint32_t numberOfEntities {500u};
+
+    auto directory = GetTempFilePath("checkpoint_benchmark");
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    WorldCheckpointStore store(directory, "world");
+
+    std::vector<EntityCheckpoint> entities;
+    for (auto i = 0u; i < numberOfEntities; ++i)
+    {
+        entities.emplace_back(CreateEntity("npc_" + std::to_string(i % 10u), static_cast<float>(i), 1.0f));
+    }
+
+    auto base = CreateCheckpoint(1u, 1000u);
+    base.Entities = entities;
+
+    auto& baseChanges = base.IslandChanges.emplace_back();
+    for (auto layer = 0u; layer < numberOfLayers; ++layer)
+    {
+        for (auto y = 0u; y < height; ++y)
+        {
+            for (auto x = 0u; x < width; ++x)
+            {
+                baseChanges.push_back(CreateChange(static_cast<uint8_t>(layer), x, y, 1000u, 1u));
+            }
+        }
+    }
+
+    REQUIRE(store.WriteBase(base));
+
+    for (auto r = 0u; r < 31u; ++r)
+    {
+        auto record = CreateCheckpoint(2u + r, 2000u + r * 1000u);
+        record.Entities = entities;
+
+        auto& changes = record.IslandChanges.emplace_back();
+        for (auto i = 0u; i < 200u; ++i)
+        {
+            auto tile = (r * 200u + i * 7u) % (width * height);
+            changes.push_back(CreateChange(static_cast<uint8_t>(i % numberOfLayers), tile % width, tile / width,
+                                           record.GameTime, static_cast<uint16_t>(r)));
+        }
+
+        REQUIRE(store.AppendToJournal(record));
+    }
+
+    BENCHMARK("restore")
+    {
+        return store.Restore()->IslandChanges[0].size();
+    };
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("World checkpoint - submit a checkpoint during a tick", "[world_checkpoint][.benchmark]")
+{
+    auto directory = GetTempFilePath("checkpoint_submit_benchmark");
+    std::filesystem::remove_all(directory);
+
+    WorldCheckpointWriter writer(directory, "world");
+    REQUIRE(writer.Start());
+
+    std::vector<EntityCheckpoint> entities;
+    for (auto i = 0u; i < 500u; ++i)
+    {
+        entities.emplace_back(CreateEntity("npc", static_cast<float>(i), 1.0f));
+    }
+
+    uint64_t time {0u};
+
+    BENCHMARK("submit 500 entities and 100 changes")
+    {
+        auto checkpoint = CreateCheckpoint(0u, ++time);
+        checkpoint.Entities = entities;
+
+        auto& changes = checkpoint.IslandChanges.emplace_back();
+        for (auto i = 0u; i < 100u; ++i)
+        {
+            changes.push_back(CreateChange(0u, i, static_cast<uint32_t>(time % 64u), time, 1u));
+        }
+
+        writer.Submit(std::move(checkpoint));
+        return time;
+    };
+
+    writer.Stop();
+
+    std::filesystem::remove_all(directory);
+}
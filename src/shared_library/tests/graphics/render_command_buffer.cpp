@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <vector>
+
+#include "catch2/catch.hpp"
+#include "graphics/render_command_buffer.h"
+#include "math/random_engine.h"
+
+using namespace projectfarm::shared::graphics;
+
+namespace
+{
+    // counts the calls a GL backend would make, and the order of the draws
+    class RecordingRenderBackend final : public RenderBackend
+    {
+    public:
+        uint32_t MaterialBinds {0u};
+        uint32_t TextureBinds {0u};
+        uint32_t ColorChanges {0u};
+
+        std::vector<uint32_t> Draws;
+
+        void BindMaterial(const RenderCommand&) noexcept override
+        {
+            ++this->MaterialBinds;
+        }
+
+        void BindTexture(const RenderCommand&) noexcept override
+        {
+            ++this->TextureBinds;
+        }
+
+        void SetColor(const RenderCommand&) noexcept override
+        {
+            ++this->ColorChanges;
+        }
+
+        void Draw(const RenderCommand& command) noexcept override
+        {
+            this->Draws.push_back(command.DrawIndex);
+        }
+    };
+
+    RenderCommand CreateCommand(uint32_t renderLayer, uint32_t materialId, uint32_t textureId,
+                                uint32_t color, uint32_t drawIndex, uint8_t order = 0u)
+    {
+        RenderCommand command;
+        command.RenderLayer = renderLayer;
+        command.MaterialId = materialId;
+        command.TextureId = textureId;
+        command.Color = color;
+        command.DrawIndex = drawIndex;
+        command.Order = order;
+
+        return command;
+    }
+}
+
+TEST_CASE("RenderCommandBuffer::Sort - commands out of order - are by render layer then order", "[graphics]")
+{
+    RenderCommandBuffer buffer;
+    buffer.Add(CreateCommand(3u, 0u, 1u, 0u, 0u));
+    buffer.Add(CreateCommand(1u, 0u, 2u, 0u, 1u, 1u));
+    buffer.Add(CreateCommand(2u, 1u, 1u, 0u, 2u));
+    buffer.Add(CreateCommand(1u, 1u, 3u, 0u, 3u));
+
+    buffer.Sort();
+
+    RecordingRenderBackend backend;
+    buffer.Submit(backend);
+
+    REQUIRE(backend.Draws == std::vector<uint32_t> {3u, 1u, 2u, 0u});
+}
+
+TEST_CASE("RenderCommandBuffer::Sort - same keys - stay in the order they were added", "[graphics]")
+{
+    RenderCommandBuffer buffer;
+
+    for (auto i = 0u; i < 10u; ++i)
+    {
+        buffer.Add(CreateCommand(1u + i % 2u, 0u, 1u, 0u, i));
+    }
+
+    buffer.Sort();
+
+    RecordingRenderBackend backend;
+    buffer.Submit(backend);
+
+    REQUIRE(backend.Draws == std::vector<uint32_t> {0u, 2u, 4u, 6u, 8u, 1u, 3u, 5u, 7u, 9u});
+}
+
+TEST_CASE("RenderCommandBuffer::Sort - random keys - is the same as a stable sort", "[graphics]")
+{
+    projectfarm::shared::math::RandomEngine randomEngine;
+    randomEngine.Initialize(12345u);
+
+    RenderCommandBuffer buffer;
+
+    for (auto i = 0u; i < 5000u; ++i)
+    {
+        buffer.Add(CreateCommand(randomEngine.Next(0u, 300u), randomEngine.Next(0u, 4u),
+                                 randomEngine.Next(0u, 2000u), randomEngine.Next(0u, 3u), i));
+    }
+
+    auto expected = buffer.GetCommands();
+    std::stable_sort(expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs)
+    {
+        return lhs.SortKey < rhs.SortKey;
+    });
+
+    buffer.Sort();
+
+    const auto& commands = buffer.GetCommands();
+
+    REQUIRE(commands.size() == expected.size());
+    REQUIRE(std::equal(commands.begin(), commands.end(), expected.begin(), [](const auto& lhs, const auto& rhs)
+    {
+        return lhs.DrawIndex == rhs.DrawIndex;
+    }));
+}
+
+TEST_CASE("RenderCommandBuffer::CreateSortKey - render layer past 24 bits - is after every other layer", "[graphics]")
+{
+    auto last = RenderCommandBuffer::CreateSortKey(CreateCommand(0x1000000u, 0u, 0u, 0u, 0u));
+    auto highest = RenderCommandBuffer::CreateSortKey(CreateCommand(0xFFFFFEu, 0xFFu, 0xFFFFu, 0xFFFFFFFFu, 0u, 15u));
+
+    REQUIRE(last > highest);
+}
+
+TEST_CASE("RenderCommandBuffer::Submit - draws with the same state - binds it once", "[graphics]")
+{
+    RenderCommandBuffer buffer;
+
+    for (auto i = 0u; i < 100u; ++i)
+    {
+        buffer.Add(CreateCommand(1u + i, 2u, 5u, 0xFFFFFFFFu, i));
+    }
+
+    buffer.Sort();
+
+    RecordingRenderBackend backend;
+    auto statistics = buffer.Submit(backend);
+
+    REQUIRE(backend.Draws.size() == 100u);
+    REQUIRE(backend.MaterialBinds == 1u);
+    REQUIRE(backend.TextureBinds == 1u);
+    REQUIRE(backend.ColorChanges == 1u);
+
+    REQUIRE(statistics.Draws == 100u);
+    REQUIRE(statistics.RenderLayers == 100u);
+}
+
+TEST_CASE("RenderCommandBuffer::Submit - interleaved textures in a layer - are grouped", "[graphics]")
+{
+    RenderCommandBuffer buffer;
+
+    for (auto i = 0u; i < 10u; ++i)
+    {
+        buffer.Add(CreateCommand(1u, 0u, 1u + i % 2u, 0u, i));
+    }
+
+    buffer.Sort();
+
+    RecordingRenderBackend backend;
+    auto statistics = buffer.Submit(backend);
+
+    REQUIRE(backend.TextureBinds == 2u);
+    REQUIRE(backend.MaterialBinds == 1u);
+    REQUIRE(statistics.TextureBinds == 2u);
+    REQUIRE(statistics.RenderLayers == 1u);
+}
+
+TEST_CASE("RenderCommandBuffer::Submit - new material with the same color - sets the color again", "[graphics]")
+{
+    RenderCommandBuffer buffer;
+    buffer.Add(CreateCommand(1u, 0u, 1u, 7u, 0u));
+    buffer.Add(CreateCommand(2u, 1u, 1u, 7u, 1u));
+    buffer.Add(CreateCommand(3u, 1u, 1u, 7u, 2u));
+    buffer.Add(CreateCommand(3u, 1u, 1u, 8u, 3u));
+
+    buffer.Sort();
+
+    RecordingRenderBackend backend;
+    auto statistics = buffer.Submit(backend);
+
+    REQUIRE(backend.MaterialBinds == 2u);
+    REQUIRE(backend.TextureBinds == 1u);
+    REQUIRE(backend.ColorChanges == 3u);
+    REQUIRE(statistics.ColorChanges == 3u);
+}
+
+TEST_CASE("RenderCommandBuffer::Submit - cleared - draws nothing", "[graphics]")
+{
+    RenderCommandBuffer buffer;
+    buffer.Add(CreateCommand(1u, 0u, 1u, 0u, 0u));
+
+    buffer.Clear();
+    buffer.Sort();
+
+    RecordingRenderBackend backend;
+    auto statistics = buffer.Submit(backend);
+
+    REQUIRE(backend.Draws.empty());
+    REQUIRE(backend.MaterialBinds == 0u);
+    REQUIRE(statistics.Draws == 0u);
+    REQUIRE(statistics.RenderLayers == 0u);
+}
@@ -0,0 +1,342 @@
+#include <array>
+#include <set>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "catch2/catch.hpp"
+#include "graphics/texture_atlas.h"
+
+using namespace projectfarm::shared::graphics;
+
+namespace
+{
+    bool Overlaps(const AtlasEntry& a, const AtlasEntry& b, uint32_t padding)
+    {
+        return a.Page == b.Page &&
+               a.X - padding < b.X + b.Width + padding && b.X - padding < a.X + a.Width + padding &&
+               a.Y - padding < b.Y + b.Height + padding && b.Y - padding < a.Y + a.Height + padding;
+    }
+
+    // every pixel is its own position in the image, with the image index in the alpha
+    DecodedImagePtr CreateImage(uint32_t width, uint32_t height, uint8_t index)
+    {
+        auto image = std::make_shared<DecodedImage>();
+        image->Width = width;
+        image->Height = height;
+
+        for (auto y = 0u; y < height; ++y)
+        {
+            for (auto x = 0u; x < width; ++x)
+            {
+                image->Pixels.push_back(static_cast<std::byte>(x));
+                image->Pixels.push_back(static_cast<std::byte>(y));
+                image->Pixels.push_back(std::byte {0});
+                image->Pixels.push_back(static_cast<std::byte>(index));
+            }
+        }
+
+        return image;
+    }
+
+    std::array<uint8_t, 4> GetPixel(const DecodedImage& image, uint32_t x, uint32_t y)
+    {
+        auto offset = (static_cast<size_t>(y) * image.Width + x) * 4u;
+
+        return { static_cast<uint8_t>(image.Pixels[offset]),
+                 static_cast<uint8_t>(image.Pixels[offset + 1u]),
+                 static_cast<uint8_t>(image.Pixels[offset + 2u]),
+                 static_cast<uint8_t>(image.Pixels[offset + 3u]) };
+    }
+}
+
+/*********************************************
+ * Build
+ ********************************************/
+
+TEST_CASE("TextureAtlasLayout::Build - many images - packs without overlapping", "[texture_atlas]")
+{
+    std::vector<AtlasImage> images;
+    for (auto i = 0u; i < 50u; ++i)
+    {
+        images.push_back({ "image_" + std::to_string(i), 16u + (i * 37u) % 200u, 16u + (i * 53u) % 120u });
+    }
+
+    TextureAtlasLayout layout;
+    REQUIRE(layout.Build(images, 1024u, 1u));
+
+    const auto& entries = layout.GetEntries();
+    REQUIRE(entries.size() == images.size());
+    REQUIRE(layout.Matches(images));
+
+    for (auto i = 0u; i < entries.size(); ++i)
+    {
+        const auto& entry = entries[i];
+        const auto& page = layout.GetPages()[entry.Page];
+
+        REQUIRE(entry.X >= 1u);
+        REQUIRE(entry.Y >= 1u);
+        REQUIRE(entry.X + entry.Width + 1u <= page.Width);
+        REQUIRE(entry.Y + entry.Height + 1u <= page.Height);
+
+        for (auto j = i + 1u; j < entries.size(); ++j)
+        {
+            REQUIRE_FALSE(Overlaps(entry, entries[j], 1u));
+        }
+    }
+}
+
+TEST_CASE("TextureAtlasLayout::Build - images fit on one page - uses one power of two page", "[texture_atlas]")
+{
+    std::vector<AtlasImage> images
+    {
+        { "grass", 256u, 512u },
+        { "water", 256u, 256u },
+        { "characters", 384u, 96u },
+    };
+
+    TextureAtlasLayout layout;
+    REQUIRE(layout.Build(images));
+
+    REQUIRE(layout.GetPages().size() == 1);
+
+    auto page = layout.GetPages()[0];
+    REQUIRE((page.Width & (page.Width - 1u)) == 0u);
+    REQUIRE((page.Height & (page.Height - 1u)) == 0u);
+    REQUIRE(page.Width <= TextureAtlasLayout::DefaultMaxPageSize);
+    REQUIRE(page.Height <= TextureAtlasLayout::DefaultMaxPageSize);
+}
+
+TEST_CASE("TextureAtlasLayout::Build - images do not fit on one page - uses more pages", "[texture_atlas]")
+{
+    std::vector<AtlasImage> images;
+    for (auto i = 0u; i < 5u; ++i)
+    {
+        images.push_back({ "image_" + std::to_string(i), 500u, 500u });
+    }
+
+    TextureAtlasLayout layout;
+    REQUIRE(layout.Build(images, 1024u, 1u));
+
+    REQUIRE(layout.GetPages().size() == 2);
+
+    std::set<uint32_t> pages;
+    for (const auto& entry : layout.GetEntries())
+    {
+        pages.insert(entry.Page);
+    }
+
+    REQUIRE(pages.size() == 2);
+}
+
+TEST_CASE("TextureAtlasLayout::Build - image larger than a page - fails", "[texture_atlas]")
+{
+    TextureAtlasLayout layout;
+    REQUIRE_FALSE(layout.Build({ { "huge", 1024u, 16u } }, 1024u, 1u));
+    REQUIRE(layout.GetEntries().empty());
+    REQUIRE(layout.GetPages().empty());
+}
+
+TEST_CASE("TextureAtlasLayout::Build - duplicate names - fails", "[texture_atlas]")
+{
+    TextureAtlasLayout layout;
+    REQUIRE_FALSE(layout.Build({ { "grass", 16u, 16u }, { "grass", 32u, 32u } }));
+}
+
+/*********************************************
+ * UV remapping
+ ********************************************/
+
+TEST_CASE("TextureAtlasLayout::MapRect - rect within image - is offset by the image position", "[texture_atlas]")
+{
+    TextureAtlasLayout layout;
+    REQUIRE(layout.Build({ { "tall", 64u, 128u }, { "tiles", 64u, 64u } }, 256u, 2u));
+
+    const auto* entry = layout.Find("tiles");
+    REQUIRE(entry);
+
+    auto rect = layout.MapRect("tiles", 16u, 32u, 16u, 16u);
+    REQUIRE(rect);
+    REQUIRE(rect->Page == entry->Page);
+    REQUIRE(rect->X == entry->X + 16u);
+    REQUIRE(rect->Y == entry->Y + 32u);
+    REQUIRE(rect->Width == 16u);
+    REQUIRE(rect->Height == 16u);
+
+    REQUIRE_FALSE(layout.MapRect("tiles", 56u, 0u, 16u, 16u));
+    REQUIRE_FALSE(layout.MapRect("missing", 0u, 0u, 16u, 16u));
+}
+
+TEST_CASE("TextureAtlasLayout::GetUVs - rect within image - is normalized to the page", "[texture_atlas]")
+{
+    TextureAtlasLayout layout;
+    REQUIRE(layout.Build({ { "tall", 64u, 128u }, { "tiles", 64u, 64u } }, 256u, 2u));
+
+    const auto* entry = layout.Find("tiles");
+    const auto& page = layout.GetPages()[entry->Page];
+
+    auto uvs = layout.GetUVs("tiles", 16u, 32u, 16u, 16u);
+    REQUIRE(uvs);
+    REQUIRE(uvs->U1 == Approx(static_cast<float>(entry->X + 16u) / page.Width));
+    REQUIRE(uvs->V1 == Approx(static_cast<float>(entry->Y + 32u) / page.Height));
+    REQUIRE(uvs->U2 == Approx(static_cast<float>(entry->X + 32u) / page.Width));
+    REQUIRE(uvs->V2 == Approx(static_cast<float>(entry->Y + 48u) / page.Height));
+
+    auto whole = layout.GetUVs("tall", 0u, 0u, 64u, 128u);
+    REQUIRE(whole);
+    REQUIRE(whole->U1 > 0.0f);
+    REQUIRE(whole->U2 <= 1.0f);
+    REQUIRE(whole->V2 <= 1.0f);
+}
+
+/*********************************************
+ * Json
+ ********************************************/
+
+TEST_CASE("TextureAtlasLayout::FromJson - written layout - reads the same layout", "[texture_atlas]")
+{
+    std::vector<AtlasImage> images { { "a", 30u, 20u }, { "b", 10u, 40u }, { "c", 600u, 600u } };
+
+    TextureAtlasLayout layout;
+    REQUIRE(layout.Build(images, 1024u, 1u));
+
+    TextureAtlasLayout readLayout;
+    REQUIRE(readLayout.FromJson(layout.ToJson()));
+    REQUIRE(readLayout.Matches(images));
+    REQUIRE(readLayout.GetPages().size() == layout.GetPages().size());
+    REQUIRE(readLayout.GetPadding() == 1u);
+
+    for (const auto& entry : layout.GetEntries())
+    {
+        const auto* readEntry = readLayout.Find(entry.Name);
+        REQUIRE(readEntry);
+        REQUIRE(readEntry->Page == entry.Page);
+        REQUIRE(readEntry->X == entry.X);
+        REQUIRE(readEntry->Y == entry.Y);
+    }
+
+    images[0].Width = 31u;
+    REQUIRE_FALSE(readLayout.Matches(images));
+}
+
+TEST_CASE("TextureAtlasLayout::FromJson - invalid layout - fails", "[texture_atlas]")
+{
+    TextureAtlasLayout layout;
+    REQUIRE_FALSE(layout.FromJson(nlohmann::json::parse(R"({ "pages": [] })")));
+
+    REQUIRE_FALSE(layout.FromJson(nlohmann::json::parse(R"({
+        "padding": 1,
+        "pages": [ { "width": 64, "height": 64 } ],
+        "entries": [ { "name": "a", "page": 0, "x": 60, "y": 1, "width": 16, "height": 16 } ]
+    })")));
+    REQUIRE(layout.GetEntries().empty());
+}
+
+TEST_CASE("TextureAtlasLayout::FromJson - entry inside its padding - fails", "[texture_atlas]")
+{
+    TextureAtlasLayout layout;
+
+    REQUIRE_FALSE(layout.FromJson(nlohmann::json::parse(R"({
+        "padding": 2,
+        "pages": [ { "width": 64, "height": 64 } ],
+        "entries": [ { "name": "a", "page": 0, "x": 1, "y": 8, "width": 16, "height": 16 } ]
+    })")));
+
+    REQUIRE_FALSE(layout.FromJson(nlohmann::json::parse(R"({
+        "padding": 2,
+        "pages": [ { "width": 64, "height": 64 } ],
+        "entries": [ { "name": "a", "page": 0, "x": 8, "y": 0, "width": 16, "height": 16 } ]
+    })")));
+
+    REQUIRE_FALSE(layout.FromJson(nlohmann::json::parse(R"({
+        "padding": 2,
+        "pages": [ { "width": 64, "height": 64 } ],
+        "entries": [ { "name": "a", "page": 0, "x": 8, "y": 8, "width": 4294967295, "height": 16 } ]
+    })")));
+
+    REQUIRE(layout.GetEntries().empty());
+
+    REQUIRE(layout.FromJson(nlohmann::json::parse(R"({
+        "padding": 2,
+        "pages": [ { "width": 64, "height": 64 } ],
+        "entries": [ { "name": "a", "page": 0, "x": 2, "y": 2, "width": 60, "height": 60 } ]
+    })")));
+}
+
+/*********************************************
+ * ComposeAtlasPage
+ ********************************************/
+
+TEST_CASE("ComposeAtlasPage - images - are copied with their edges repeated", "[texture_atlas]")
+{
+    std::unordered_map<std::string, DecodedImagePtr> images
+    {
+        { "a", CreateImage(8u, 4u, 1u) },
+        { "b", CreateImage(5u, 6u, 2u) },
+    };
+
+    TextureAtlasLayout layout;
+    REQUIRE(layout.Build({ { "a", 8u, 4u }, { "b", 5u, 6u } }, 64u, 1u));
+
+    auto page = ComposeAtlasPage(layout, 0u, images);
+    REQUIRE(page);
+    REQUIRE(page->Width == layout.GetPages()[0].Width);
+    REQUIRE(page->Height == layout.GetPages()[0].Height);
+
+    for (const auto& entry : layout.GetEntries())
+    {
+        auto index = static_cast<uint8_t>(entry.Name == "a" ? 1u : 2u);
+
+        for (auto y = 0u; y < entry.Height; ++y)
+        {
+            for (auto x = 0u; x < entry.Width; ++x)
+            {
+                auto expected = std::array<uint8_t, 4> { static_cast<uint8_t>(x), static_cast<uint8_t>(y), 0u, index };
+                REQUIRE(GetPixel(*page, entry.X + x, entry.Y + y) == expected);
+            }
+        }
+
+        // the corners of the padding repeat the corners of the image
+        REQUIRE(GetPixel(*page, entry.X - 1u, entry.Y - 1u) == std::array<uint8_t, 4> { 0u, 0u, 0u, index });
+        REQUIRE(GetPixel(*page, entry.X + entry.Width, entry.Y + entry.Height) ==
+                std::array<uint8_t, 4> { static_cast<uint8_t>(entry.Width - 1u),
+                                         static_cast<uint8_t>(entry.Height - 1u), 0u, index });
+    }
+}
+
+TEST_CASE("ComposeAtlasPage - image with a different size - fails", "[texture_atlas]")
+{
+    TextureAtlasLayout layout;
+    REQUIRE(layout.Build({ { "a", 8u, 4u } }, 64u, 1u));
+
+    REQUIRE_FALSE(ComposeAtlasPage(layout, 0u, { { "a", CreateImage(8u, 5u, 1u) } }));
+    REQUIRE_FALSE(ComposeAtlasPage(layout, 0u, {}));
+    REQUIRE_FALSE(ComposeAtlasPage(layout, 1u, { { "a", CreateImage(8u, 4u, 1u) } }));
+}
+
+/*********************************************
+ * GetPngImageSize
+ ********************************************/
+
+TEST_CASE("GetPngImageSize - png header - returns the size", "[texture_atlas]")
+{
+    std::vector<uint8_t> header
+    {
+        0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A,
+        0x00, 0x00, 0x00, 0x0D, 'I', 'H', 'D', 'R',
+        0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xF0,
+        0x08, 0x06, 0x00, 0x00, 0x00,
+    };
+
+    auto data = reinterpret_cast<const std::byte*>(header.data());
+
+    auto size = GetPngImageSize({ data, header.size() });
+    REQUIRE(size);
+    REQUIRE(size->first == 320u);
+    REQUIRE(size->second == 240u);
+
+    REQUIRE_FALSE(GetPngImageSize({ data, 20u }));
+
+    header[1] = 0x00;
+    REQUIRE_FALSE(GetPngImageSize({ data, header.size() }));
+}
@@ -0,0 +1,203 @@
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+#include "catch2/catch.hpp"
+#include "graphics/texture_decoder.h"
+
+using namespace projectfarm::shared::concurrency;
+using namespace projectfarm::shared::graphics;
+
+namespace
+{
+    // a square image where the size is the number before the extension, such as `a_10.png`
+    DecodedImagePtr DecodeTestImage(const std::string& path)
+    {
+        if (path.find("missing") != std::string::npos)
+        {
+            return {};
+        }
+
+        auto start = path.rfind('_') + 1;
+        auto size = static_cast<uint32_t>(std::stoul(path.substr(start, path.rfind('.') - start)));
+
+        auto image = std::make_shared<DecodedImage>();
+        image->Width = size;
+        image->Height = size;
+        image->Pixels.resize(static_cast<size_t>(size) * size * 4u);
+
+        return image;
+    }
+
+    std::vector<TextureDecoder::Upload> WaitForUploads(TextureDecoder& decoder, uint64_t maxBytes)
+    {
+        for (auto i = 0u; i < 10000u; ++i)
+        {
+            auto uploads = decoder.TakeUploads(maxBytes);
+            if (!uploads.empty())
+            {
+                return uploads;
+            }
+
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+
+        return {};
+    }
+}
+
+/*********************************************
+ * TextureDecoder
+ ********************************************/
+
+TEST_CASE("TextureDecoder - request - decodes on another thread", "[graphics]")
+{
+    std::atomic<bool> decodedOnCallingThread {false};
+    auto callingThreadId = std::this_thread::get_id();
+
+    TextureDecoder decoder(std::make_shared<ThreadPool>(2), [&](const auto& path)
+    {
+        decodedOnCallingThread = decodedOnCallingThread || std::this_thread::get_id() == callingThreadId;
+        return DecodeTestImage(path);
+    }, 1000000u);
+
+    auto image = decoder.Request("a_8.png").get();
+
+    REQUIRE(image);
+    REQUIRE(image->Width == 8u);
+    REQUIRE(image->GetSizeInBytes() == 256u);
+    REQUIRE_FALSE(decodedOnCallingThread);
+
+    auto uploads = WaitForUploads(decoder, 1000000u);
+    REQUIRE(uploads.size() == 1u);
+    REQUIRE(uploads[0].Path == "a_8.png");
+    REQUIRE(uploads[0].Image == image);
+
+    REQUIRE(decoder.IsCached("a_8.png"));
+    REQUIRE(decoder.GetNumberOfPendingRequests() == 0u);
+}
+
+TEST_CASE("TextureDecoder - same path requested while decoding - decodes once", "[graphics]")
+{
+    std::promise<void> release;
+    auto releaseFuture = release.get_future().share();
+
+    TextureDecoder decoder(std::make_shared<ThreadPool>(2), [releaseFuture](const auto& path)
+    {
+        releaseFuture.wait();
+        return DecodeTestImage(path);
+    }, 1000000u);
+
+    auto first = decoder.Request("a_4.png");
+    auto second = decoder.Request("a_4.png");
+    (void)decoder.Request("a_4.png", false);
+
+    REQUIRE(decoder.GetNumberOfDecodes() == 1u);
+    REQUIRE(decoder.GetNumberOfPendingRequests() == 1u);
+
+    release.set_value();
+
+    REQUIRE(first.get() == second.get());
+
+    auto uploads = WaitForUploads(decoder, 1000000u);
+    REQUIRE(uploads.size() == 1u);
+
+    // cached, so not decoded again
+    REQUIRE(decoder.Decode("a_4.png") == first.get());
+    REQUIRE(decoder.Request("a_4.png").get() == first.get());
+    REQUIRE(decoder.GetNumberOfDecodes() == 1u);
+}
+
+TEST_CASE("TextureDecoder - take uploads - keeps within the byte budget", "[graphics]")
+{
+    TextureDecoder decoder(std::make_shared<ThreadPool>(2), DecodeTestImage, 1000000u);
+
+    // 400 bytes each
+    for (const auto& path : { "a_10.png", "b_10.png", "c_10.png", "d_10.png" })
+    {
+        (void)decoder.Request(path).get();
+    }
+
+    auto uploads = decoder.TakeUploads(1000u);
+    REQUIRE(uploads.size() == 2u);
+    REQUIRE(uploads[0].Path == "a_10.png");
+    REQUIRE(uploads[1].Path == "b_10.png");
+
+    uploads = decoder.TakeUploads(1000u);
+    REQUIRE(uploads.size() == 2u);
+    REQUIRE(uploads[0].Path == "c_10.png");
+    REQUIRE(uploads[1].Path == "d_10.png");
+
+    // larger than the budget, but still uploaded on its own
+    (void)decoder.Request("e_100.png").get();
+    (void)decoder.Request("f_1.png").get();
+
+    uploads = decoder.TakeUploads(1000u);
+    REQUIRE(uploads.size() == 1u);
+    REQUIRE(uploads[0].Path == "e_100.png");
+
+    REQUIRE(decoder.TakeUploads(1000u).size() == 1u);
+    REQUIRE(decoder.TakeUploads(1000u).empty());
+}
+
+TEST_CASE("TextureDecoder - cache is full - removes the least recently used image", "[graphics]")
+{
+    // 3 images of 400 bytes
+    TextureDecoder decoder(std::make_shared<ThreadPool>(1), DecodeTestImage, 1200u);
+
+    auto a = decoder.Decode("a_10.png");
+    (void)decoder.Decode("b_10.png");
+    (void)decoder.Decode("c_10.png");
+
+    REQUIRE(decoder.GetCacheSizeInBytes() == 1200u);
+
+    // `a` is now the most recently used
+    REQUIRE(decoder.Decode("a_10.png") == a);
+
+    (void)decoder.Decode("d_10.png");
+
+    REQUIRE(decoder.GetCacheSizeInBytes() == 1200u);
+    REQUIRE(decoder.IsCached("a_10.png"));
+    REQUIRE_FALSE(decoder.IsCached("b_10.png"));
+    REQUIRE(decoder.IsCached("c_10.png"));
+    REQUIRE(decoder.IsCached("d_10.png"));
+
+    // too large to cache at all
+    REQUIRE(decoder.Decode("e_100.png"));
+    REQUIRE_FALSE(decoder.IsCached("e_100.png"));
+    REQUIRE(decoder.GetCacheSizeInBytes() == 1200u);
+
+    REQUIRE(decoder.GetNumberOfDecodes() == 5u);
+}
+
+TEST_CASE("TextureDecoder - failed decode - returns an empty upload and is not cached", "[graphics]")
+{
+    TextureDecoder decoder(std::make_shared<ThreadPool>(1), DecodeTestImage, 1000000u);
+
+    REQUIRE_FALSE(decoder.Request("missing_1.png").get());
+
+    auto uploads = WaitForUploads(decoder, 1000000u);
+    REQUIRE(uploads.size() == 1u);
+    REQUIRE_FALSE(uploads[0].Image);
+
+    REQUIRE_FALSE(decoder.IsCached("missing_1.png"));
+}
+
+TEST_CASE("TextureDecoder - decode throws - returns no image", "[graphics]")
+{
+    TextureDecoder decoder(std::make_shared<ThreadPool>(1), [](const auto&) -> DecodedImagePtr
+    {
+        throw std::runtime_error("failed");
+    }, 1000000u);
+
+    REQUIRE_FALSE(decoder.Decode("a_1.png"));
+
+    (void)decoder.Request("b_1.png");
+
+    auto uploads = WaitForUploads(decoder, 1000000u);
+    REQUIRE(uploads.size() == 1u);
+    REQUIRE_FALSE(uploads[0].Image);
+}
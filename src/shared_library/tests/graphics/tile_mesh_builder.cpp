@@ -0,0 +1,100 @@
+#include <algorithm>
+
+#include "catch2/catch.hpp"
+#include "graphics/tile_mesh_builder.h"
+
+using namespace projectfarm::shared::graphics;
+
+/*********************************************
+ * TileMeshData
+ ********************************************/
+
+TEST_CASE("TileMeshData::AddTile - tile in the top left quarter - is in normalized device coordinates", "[graphics]")
+{
+    TileMeshData mesh;
+    mesh.AddTile({32.0f, 0.0f, 32.0f, 16.0f}, 128u, 64u,
+                 {0.0f, 0.0f, 50.0f, 25.0f}, 100u, 50u);
+
+    REQUIRE(mesh.GetNumberOfTiles() == 1u);
+
+    // top left, bottom left, top right, bottom right
+    REQUIRE(mesh.Positions == std::vector<float> {-1.0f, 1.0f, -1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f});
+    REQUIRE(mesh.TextureCoordinates == std::vector<float> {0.25f, 0.0f, 0.25f, 0.25f, 0.5f, 0.0f, 0.5f, 0.25f});
+    REQUIRE(mesh.Indexes == std::vector<uint32_t> {0u, 1u, 2u, 2u, 1u, 3u});
+}
+
+TEST_CASE("TileMeshData::Clear - tiles added - is empty", "[graphics]")
+{
+    TileMeshData mesh;
+    mesh.AddTile({0.0f, 0.0f, 16.0f, 16.0f}, 16u, 16u, {0.0f, 0.0f, 16.0f, 16.0f}, 16u, 16u);
+
+    mesh.Clear();
+
+    REQUIRE(mesh.IsEmpty());
+    REQUIRE(mesh.Positions.empty());
+    REQUIRE(mesh.TextureCoordinates.empty());
+}
+
+/*********************************************
+ * TileChunkMeshBuilder
+ ********************************************/
+
+TEST_CASE("TileChunkMeshBuilder::AddTile - two textures - has a mesh for each", "[graphics]")
+{
+    TileChunkMeshBuilder builder;
+    builder.Begin(64u, 64u);
+
+    builder.AddTile(7u, 32u, 32u, {0.0f, 0.0f, 16.0f, 16.0f}, {0.0f, 0.0f, 32.0f, 32.0f});
+    builder.AddTile(3u, 32u, 32u, {0.0f, 0.0f, 16.0f, 16.0f}, {32.0f, 0.0f, 32.0f, 32.0f});
+    builder.AddTile(7u, 32u, 32u, {16.0f, 0.0f, 16.0f, 16.0f}, {0.0f, 32.0f, 32.0f, 32.0f});
+
+    REQUIRE(builder.GetNumberOfTiles() == 3u);
+    REQUIRE(builder.GetNumberOfMeshes() == 2u);
+
+    REQUIRE(builder.GetTextureKey(0u) == 7u);
+    REQUIRE(builder.GetMesh(0u).GetNumberOfTiles() == 2u);
+
+    // the second tile of a mesh starts after the first's vertices
+    REQUIRE(builder.GetMesh(0u).Indexes[6u] == 4u);
+
+    REQUIRE(builder.GetTextureKey(1u) == 3u);
+    REQUIRE(builder.GetMesh(1u).GetNumberOfTiles() == 1u);
+}
+
+TEST_CASE("TileChunkMeshBuilder::Begin - after a chunk - starts with no meshes", "[graphics]")
+{
+    TileChunkMeshBuilder builder;
+    builder.Begin(64u, 64u);
+    builder.AddTile(1u, 32u, 32u, {0.0f, 0.0f, 16.0f, 16.0f}, {0.0f, 0.0f, 32.0f, 32.0f});
+
+    builder.Begin(32u, 32u);
+
+    REQUIRE(builder.GetNumberOfMeshes() == 0u);
+    REQUIRE(builder.GetNumberOfTiles() == 0u);
+
+    // positions are relative to the new chunk's size
+    builder.AddTile(2u, 32u, 32u, {0.0f, 0.0f, 16.0f, 16.0f}, {0.0f, 0.0f, 32.0f, 32.0f});
+
+    REQUIRE(builder.GetNumberOfMeshes() == 1u);
+    REQUIRE(builder.GetTextureKey(0u) == 2u);
+    REQUIRE(builder.GetMesh(0u).Positions == std::vector<float> {-1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f, -1.0f});
+}
+
+TEST_CASE("TileChunkMeshBuilder::AddTile - more vertices than a 16 bit index holds - indexes past 65535", "[graphics]")
+{
+    constexpr uint32_t NumberOfTiles {20'000u};
+
+    TileChunkMeshBuilder builder;
+    builder.Begin(1024u, 1024u);
+
+    for (auto i = 0u; i < NumberOfTiles; ++i)
+    {
+        builder.AddTile(0u, 16u, 16u, {0.0f, 0.0f, 16.0f, 16.0f}, {0.0f, 0.0f, 8.0f, 8.0f});
+    }
+
+    const auto& mesh = builder.GetMesh(0u);
+
+    REQUIRE(mesh.GetNumberOfTiles() == NumberOfTiles);
+    REQUIRE(*std::max_element(mesh.Indexes.begin(), mesh.Indexes.end()) ==
+            NumberOfTiles * TileMeshData::VerticesPerTile - 1u);
+}
@@ -0,0 +1,138 @@
+#include <thread>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <limits>
+
+#include "catch2/catch.hpp"
+#include "metrics/metrics.h"
+
+using namespace projectfarm::shared::metrics;
+
+/*********************************************
+ * Counter / Gauge
+ ********************************************/
+
+TEST_CASE("Counter::Increment - from many threads - counts every increment", "[metrics]")
+{
+    Counter counter;
+
+    std::vector<std::thread> threads;
+    for (auto t = 0u; t < 4u; ++t)
+    {
+        threads.emplace_back([&counter]()
+        {
+            for (auto i = 0u; i < 10000u; ++i)
+            {
+                counter.Increment();
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    counter.Increment(5u);
+
+    REQUIRE(counter.GetValue() == 40005u);
+}
+
+TEST_CASE("Gauge - set, increment and decrement - has the latest value", "[metrics]")
+{
+    Gauge gauge;
+
+    gauge.Set(10);
+    gauge.Increment(3);
+    gauge.Decrement(20);
+
+    REQUIRE(gauge.GetValue() == -7);
+}
+
+/*********************************************
+ * Histogram
+ ********************************************/
+
+TEST_CASE("Histogram::GetBucketIndex - values - fall in a bucket that covers them", "[metrics]")
+{
+    std::vector<uint64_t> values {0u, 1u, 15u, 16u, 17u, 31u, 32u, 33u, 1000u, 123456789u,
+                                  std::numeric_limits<uint64_t>::max()};
+
+    for (auto value : values)
+    {
+        auto index = Histogram::GetBucketIndex(value);
+
+        REQUIRE(index < Histogram::NumberOfBuckets);
+        REQUIRE(Histogram::GetBucketUpperBound(index) >= value);
+
+        if (index > 0u)
+        {
+            REQUIRE(Histogram::GetBucketUpperBound(index - 1u) < value);
+        }
+    }
+
+    REQUIRE(Histogram::GetBucketIndex(std::numeric_limits<uint64_t>::max()) == Histogram::NumberOfBuckets - 1u);
+}
+
+TEST_CASE("Histogram::GetValueAtPercentile - uniform values - are within the bucket error", "[metrics]")
+{
+    Histogram histogram;
+
+    for (auto value = 1u; value <= 10000u; ++value)
+    {
+        histogram.Record(value);
+    }
+
+    REQUIRE(histogram.GetCount() == 10000u);
+    REQUIRE(histogram.GetSum() == 50005000u);
+    REQUIRE(histogram.GetMax() == 10000u);
+
+    for (auto [percentile, expected] : std::vector<std::pair<double, double>> {{50.0, 5000.0},
+                                                                               {90.0, 9000.0},
+                                                                               {99.0, 9900.0}})
+    {
+        auto value = static_cast<double>(histogram.GetValueAtPercentile(percentile));
+
+        REQUIRE(value >= expected);
+        REQUIRE(value <= expected * 1.0625);
+    }
+
+    REQUIRE(histogram.GetValueAtPercentile(100.0) == 10000u);
+    REQUIRE(histogram.GetValueAtPercentile(0.0) == 1u);
+}
+
+TEST_CASE("Histogram::GetValueAtPercentile - no values - is zero", "[metrics]")
+{
+    Histogram histogram;
+
+    REQUIRE(histogram.GetValueAtPercentile(99.0) == 0u);
+}
+
+/*********************************************
+ * Benchmarks
+ ********************************************/
+
+TEST_CASE("Metrics update cost", "[metrics][.benchmark]")
+{
+    Counter counter;
+    Histogram histogram;
+
+    std::mt19937_64 engine {1u};
+    std::vector<uint64_t> values(1024u);
+    std::generate(values.begin(), values.end(), [&engine]() { return engine() % 100000u; });
+
+    BENCHMARK("Counter::Increment")
+    {
+        counter.Increment();
+        return counter.GetValue();
+    };
+
+    auto index = 0u;
+
+    BENCHMARK("Histogram::Record")
+    {
+        histogram.Record(values[index++ & 1023u]);
+        return histogram.GetCount();
+    };
+}
@@ -0,0 +1,86 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "catch2/catch.hpp"
+#include "test_util.h"
+#include "metrics/metrics_registry.h"
+
+using namespace projectfarm::shared::metrics;
+
+TEST_CASE("MetricsRegistry - same name and labels - return the same metric", "[metrics]")
+{
+    MetricsRegistry registry;
+
+    auto& a = registry.GetCounter("packets_total", "Packets.", {{"type", "1"}});
+    auto& b = registry.GetCounter("packets_total", "Packets.", {{"type", "1"}});
+    auto& c = registry.GetCounter("packets_total", "Packets.", {{"type", "2"}});
+
+    REQUIRE(&a == &b);
+    REQUIRE(&a != &c);
+}
+
+TEST_CASE("MetricsRegistry::GetPrometheusText - every type - is written in the text format", "[metrics]")
+{
+    MetricsRegistry registry;
+
+    registry.GetCounter("packets_total", "Packets sent.", {{"type", "1"}}).Increment(3u);
+    registry.GetCounter("packets_total", "Packets sent.", {{"type", "2"}}).Increment();
+    registry.GetGauge("players", "Players in a \\ world.\nPer world.", {{"world", "a \"b\""}}).Set(4);
+    registry.GetHistogram("tick_microseconds", "Tick duration.").Record(10u);
+
+    auto text = registry.GetPrometheusText();
+
+    REQUIRE(text ==
+        "# HELP packets_total Packets sent.\n"
+        "# TYPE packets_total counter\n"
+        "packets_total{type=\"1\"} 3\n"
+        "packets_total{type=\"2\"} 1\n"
+        "# HELP players Players in a \\\\ world.\\nPer world.\n"
+        "# TYPE players gauge\n"
+        "players{world=\"a \\\"b\\\"\"} 4\n"
+        "# HELP tick_microseconds Tick duration.\n"
+        "# TYPE tick_microseconds summary\n"
+        "tick_microseconds{quantile=\"0.5\"} 10\n"
+        "tick_microseconds{quantile=\"0.9\"} 10\n"
+        "tick_microseconds{quantile=\"0.99\"} 10\n"
+        "tick_microseconds{quantile=\"0.999\"} 10\n"
+        "tick_microseconds_sum 10\n"
+        "tick_microseconds_count 1\n");
+}
+
+TEST_CASE("MetricsRegistry - name reused with another type or invalid - is not written", "[metrics]")
+{
+    MetricsRegistry registry;
+
+    registry.GetCounter("metric", "A counter.").Increment();
+    registry.GetGauge("metric", "A gauge.").Set(100);
+    registry.GetGauge("1invalid", "An invalid name.").Set(100);
+    registry.GetGauge("valid", "An invalid label.", {{"bad-label", "1"}}).Set(100);
+
+    REQUIRE(registry.GetPrometheusText() ==
+        "# HELP metric A counter.\n"
+        "# TYPE metric counter\n"
+        "metric 1\n");
+}
+
+TEST_CASE("MetricsRegistry::WriteToFile - valid path - writes the text", "[metrics]")
+{
+    MetricsRegistry registry;
+    registry.GetCounter("written_total", "Written.").Increment(7u);
+
+    auto filePath = GetTempFilePath("metrics.prom");
+
+    REQUIRE(registry.WriteToFile(filePath));
+
+    std::ifstream fs(filePath);
+    std::stringstream ss;
+    ss << fs.rdbuf();
+    fs.close();
+
+    std::filesystem::remove(filePath);
+
+    REQUIRE(ss.str() == registry.GetPrometheusText());
+    REQUIRE_FALSE(std::filesystem::exists(filePath.string() + ".tmp"));
+}
@@ -0,0 +1,153 @@
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "catch2/catch.hpp"
+#include "test_util.h"
+#include "metrics/metrics_server.h"
+#include "platform/platform_id.h"
+
+#if !defined(IS_WINDOWS)
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#endif
+
+using namespace projectfarm::shared::metrics;
+
+#if !defined(IS_WINDOWS)
+namespace
+{
+    // sends `request` to the loopback port and returns everything sent back
+    std::string SendRequest(uint16_t port, const std::string& request)
+    {
+        auto socket = ::socket(AF_INET, SOCK_STREAM, 0);
+        REQUIRE(socket >= 0);
+
+        sockaddr_in address {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(port);
+
+        REQUIRE(::connect(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0);
+        REQUIRE(::send(socket, request.data(), request.size(), 0) == static_cast<ssize_t>(request.size()));
+
+        std::string response;
+        char buffer[1024];
+
+        while (true)
+        {
+            auto received = ::recv(socket, buffer, sizeof(buffer), 0);
+            if (received <= 0)
+            {
+                break;
+            }
+
+            response.append(buffer, static_cast<size_t>(received));
+        }
+
+        ::close(socket);
+
+        return response;
+    }
+
+    std::string GetBody(const std::string& response)
+    {
+        auto index = response.find("\r\n\r\n");
+        REQUIRE(index != std::string::npos);
+
+        return response.substr(index + 4u);
+    }
+}
+
+TEST_CASE("MetricsServer - scraped from a local client - serves the metrics", "[metrics]")
+{
+    MetricsRegistry registry;
+    auto& counter = registry.GetCounter("scrapes_total", "Scrapes.");
+
+    MetricsServer server(registry);
+    server.SetListenPort(0u);
+
+    REQUIRE(server.Start());
+    REQUIRE(server.GetPort() > 0u);
+
+    counter.Increment(2u);
+
+    auto response = SendRequest(server.GetPort(), "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+
+    REQUIRE(response.rfind("HTTP/1.1 200 OK\r\n", 0) == 0);
+    REQUIRE(response.find("Content-Type: text/plain; version=0.0.4") != std::string::npos);
+    REQUIRE(GetBody(response) == registry.GetPrometheusText());
+    REQUIRE(GetBody(response).find("scrapes_total 2\n") != std::string::npos);
+
+    // each scrape sees the latest values
+    counter.Increment();
+
+    response = SendRequest(server.GetPort(), "GET /metrics HTTP/1.0\r\n\r\n");
+    REQUIRE(GetBody(response).find("scrapes_total 3\n") != std::string::npos);
+
+    server.Stop();
+
+    REQUIRE(server.GetNumberOfRequests() == 2u);
+}
+
+TEST_CASE("MetricsServer - other requests - are refused", "[metrics]")
+{
+    MetricsRegistry registry;
+
+    MetricsServer server(registry);
+    server.SetListenPort(0u);
+
+    REQUIRE(server.Start());
+
+    auto response = SendRequest(server.GetPort(), "GET / HTTP/1.1\r\n\r\n");
+    REQUIRE(response.rfind("HTTP/1.1 404 Not Found\r\n", 0) == 0);
+
+    response = SendRequest(server.GetPort(), "POST /metrics HTTP/1.1\r\n\r\n");
+    REQUIRE(response.rfind("HTTP/1.1 405 Method Not Allowed\r\n", 0) == 0);
+}
+#endif
+
+TEST_CASE("MetricsServer - dump file - is written periodically and on stop", "[metrics]")
+{
+    MetricsRegistry registry;
+    auto& gauge = registry.GetGauge("players", "Players.");
+    gauge.Set(3);
+
+    auto filePath = GetTempFilePath("metrics_dump.prom");
+    std::filesystem::remove(filePath);
+
+    MetricsServer server(registry);
+    server.SetDumpFile(filePath, 50u);
+
+    REQUIRE(server.Start());
+
+    auto readFile = [&filePath]()
+    {
+        std::ifstream fs(filePath);
+        std::stringstream ss;
+        ss << fs.rdbuf();
+
+        return ss.str();
+    };
+
+    auto startTime = std::chrono::steady_clock::now();
+    while (!std::filesystem::exists(filePath) &&
+           std::chrono::steady_clock::now() - startTime < std::chrono::seconds(5))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    REQUIRE(readFile().find("players 3\n") != std::string::npos);
+
+    gauge.Set(5);
+    server.Stop();
+
+    REQUIRE(readFile().find("players 5\n") != std::string::npos);
+
+    std::filesystem::remove(filePath);
+}
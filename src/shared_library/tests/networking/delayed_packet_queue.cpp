@@ -0,0 +1,63 @@
+#include <vector>
+
+#include "catch2/catch.hpp"
+#include "networking/delayed_packet_queue.h"
+
+using namespace projectfarm::shared::networking;
+
+namespace
+{
+    std::vector<int> TakeDue(DelayedPacketQueue<int>& queue, uint64_t currentTime)
+    {
+        std::vector<int> packets;
+        queue.TakeDue(currentTime, [&packets](int packet)
+        {
+            packets.push_back(packet);
+        });
+
+        return packets;
+    }
+}
+
+TEST_CASE("DelayedPacketQueue::TakeDue - packets due at different times - are taken when due", "[networking]")
+{
+    DelayedPacketQueue<int> queue;
+    queue.Add(1, 1500u);
+    queue.Add(2, 1200u);
+    queue.Add(3, 1500u);
+
+    REQUIRE(TakeDue(queue, 1000u).empty());
+    REQUIRE(queue.GetMillisecondsUntilNext(1000u) == 200u);
+
+    REQUIRE(TakeDue(queue, 1200u) == std::vector<int> {2});
+    REQUIRE(queue.GetMillisecondsUntilNext(1200u) == 300u);
+
+    REQUIRE(TakeDue(queue, 1600u) == std::vector<int> {1, 3});
+    REQUIRE(queue.IsEmpty());
+}
+
+TEST_CASE("DelayedPacketQueue::TakeDue - time goes backwards - sends nothing early", "[networking]")
+{
+    DelayedPacketQueue<int> queue;
+    queue.Add(1, 1500u);
+    queue.Add(2, 2000u);
+
+    REQUIRE(TakeDue(queue, 1000u).empty());
+
+    // a time earlier than the last, as a wall clock set back would give
+    REQUIRE(TakeDue(queue, 0u).empty());
+    REQUIRE(queue.GetMillisecondsUntilNext(0u) == 1500u);
+    REQUIRE(queue.GetSize() == 2u);
+
+    REQUIRE(TakeDue(queue, 1499u).empty());
+    REQUIRE(TakeDue(queue, 1500u) == std::vector<int> {1});
+    REQUIRE(queue.GetSize() == 1u);
+}
+
+TEST_CASE("DelayedPacketQueue::GetMillisecondsUntilNext - packet overdue - is 0", "[networking]")
+{
+    DelayedPacketQueue<int> queue;
+    queue.Add(1, 1500u);
+
+    REQUIRE(queue.GetMillisecondsUntilNext(2000u) == 0u);
+}
@@ -0,0 +1,149 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+#include "catch2/catch.hpp"
+#include "test_util.h"
+#include "networking/packet_capture.h"
+#include "networking/packets/client_server_chatbox_message.h"
+#include "networking/packets/client_server_test_udp.h"
+
+using namespace projectfarm::shared::networking;
+
+TEST_CASE("PacketCapture - every record type - reads back what was written", "[networking]")
+{
+    auto filePath = GetTempFilePath("packet_capture.pfcap");
+
+    packets::ClientServerChatboxMessagePacket chatboxMessage;
+    chatboxMessage.SetMessage("hello");
+
+    packets::ClientServerTestUdp testUdp;
+    testUdp.SetPlayerId(42u);
+
+    {
+        PacketCaptureWriter writer;
+        REQUIRE(writer.Open(filePath));
+
+        writer.WriteClientAdded(10u, 1u);
+        writer.WriteTCPPacket(250u, 1u, chatboxMessage);
+        writer.WriteUDPPacket(1'000'000u, 0x0100007Fu, 0x1F90u, testUdp);
+        writer.WriteClientRemoved(2'000'000u, 1u);
+
+        REQUIRE(writer.GetNumberOfRecords() == 4u);
+    }
+
+    PacketCaptureReader reader;
+    REQUIRE(reader.Open(filePath));
+
+    PacketCaptureRecord record;
+
+    REQUIRE(reader.ReadNext(record));
+    REQUIRE(record.Type == PacketCaptureRecordTypes::ClientAdded);
+    REQUIRE(record.TimeInMicroseconds == 10u);
+    REQUIRE(record.ClientId == 1u);
+    REQUIRE_FALSE(record.ReceivedPacket);
+
+    REQUIRE(reader.ReadNext(record));
+    REQUIRE(record.Type == PacketCaptureRecordTypes::TCPPacket);
+    REQUIRE(record.TimeInMicroseconds == 250u);
+    REQUIRE(record.ClientId == 1u);
+    REQUIRE(record.ReceivedPacket);
+    REQUIRE(record.ReceivedPacket->GetPacketType() == PacketTypes::ClientServerChatboxMessage);
+    REQUIRE(std::static_pointer_cast<packets::ClientServerChatboxMessagePacket>(
+            record.ReceivedPacket)->GetMessage() == "hello");
+
+    REQUIRE(reader.ReadNext(record));
+    REQUIRE(record.Type == PacketCaptureRecordTypes::UDPPacket);
+    REQUIRE(record.TimeInMicroseconds == 1'000'000u);
+    REQUIRE(record.Host == 0x0100007Fu);
+    REQUIRE(record.Port == 0x1F90u);
+    REQUIRE(record.ReceivedPacket);
+    REQUIRE(record.ReceivedPacket->GetPacketType() == PacketTypes::ClientServerTestUdp);
+    REQUIRE(std::static_pointer_cast<packets::ClientServerTestUdp>(record.ReceivedPacket)->GetPlayerId() == 42u);
+
+    REQUIRE(reader.ReadNext(record));
+    REQUIRE(record.Type == PacketCaptureRecordTypes::ClientRemoved);
+    REQUIRE(record.TimeInMicroseconds == 2'000'000u);
+    REQUIRE(record.ClientId == 1u);
+
+    REQUIRE_FALSE(reader.ReadNext(record));
+    REQUIRE_FALSE(reader.HasError());
+
+    std::filesystem::remove(filePath);
+}
+
+TEST_CASE("PacketCapture - time goes backwards - is kept with the record before", "[networking]")
+{
+    auto filePath = GetTempFilePath("packet_capture.pfcap");
+
+    {
+        PacketCaptureWriter writer;
+        REQUIRE(writer.Open(filePath));
+
+        writer.WriteClientAdded(100u, 1u);
+        writer.WriteClientAdded(50u, 2u);
+    }
+
+    PacketCaptureReader reader;
+    REQUIRE(reader.Open(filePath));
+
+    PacketCaptureRecord record;
+
+    REQUIRE(reader.ReadNext(record));
+    REQUIRE(record.TimeInMicroseconds == 100u);
+
+    REQUIRE(reader.ReadNext(record));
+    REQUIRE(record.TimeInMicroseconds == 100u);
+    REQUIRE(record.ClientId == 2u);
+
+    std::filesystem::remove(filePath);
+}
+
+TEST_CASE("PacketCapture - truncated file - stops with an error", "[networking]")
+{
+    auto filePath = GetTempFilePath("packet_capture.pfcap");
+
+    packets::ClientServerChatboxMessagePacket chatboxMessage;
+    chatboxMessage.SetMessage("a message that will be cut off");
+
+    {
+        PacketCaptureWriter writer;
+        REQUIRE(writer.Open(filePath));
+
+        writer.WriteClientAdded(0u, 1u);
+        writer.WriteTCPPacket(1u, 1u, chatboxMessage);
+    }
+
+    std::filesystem::resize_file(filePath, std::filesystem::file_size(filePath) - 4u);
+
+    PacketCaptureReader reader;
+    REQUIRE(reader.Open(filePath));
+
+    PacketCaptureRecord record;
+
+    REQUIRE(reader.ReadNext(record));
+    REQUIRE(record.Type == PacketCaptureRecordTypes::ClientAdded);
+
+    REQUIRE_FALSE(reader.ReadNext(record));
+    REQUIRE(reader.HasError());
+
+    std::filesystem::remove(filePath);
+}
+
+TEST_CASE("PacketCapture - not a capture file - fails to open", "[networking]")
+{
+    auto filePath = GetTempFilePath("packet_capture.pfcap");
+
+    {
+        std::ofstream fs(filePath, std::ios::binary);
+        fs << "not a capture";
+    }
+
+    PacketCaptureReader reader;
+    REQUIRE_FALSE(reader.Open(filePath));
+    REQUIRE(reader.HasError());
+
+    std::filesystem::remove(filePath);
+
+    REQUIRE_FALSE(reader.Open(filePath));
+}
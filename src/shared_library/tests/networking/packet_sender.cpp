@@ -0,0 +1,45 @@
+#include <memory>
+#include <SDL_net.h>
+
+#include "catch2/catch.hpp"
+#include "networking/packet_factory.h"
+#include "networking/packet_sender.h"
+#include "networking/network_metrics.h"
+#include "networking/packets/server_client_chatbox_message.h"
+
+using namespace projectfarm::shared::networking;
+
+namespace
+{
+    std::shared_ptr<Packet> CreateChatboxMessagePacket()
+    {
+        auto packet = std::static_pointer_cast<packets::ServerClientChatboxMessagePacket>(
+                PacketFactory::CreatePacket(PacketTypes::ServerClientChatboxMessage));
+
+        packet->SetUsername("System");
+        packet->SetMessage("hello");
+
+        return packet;
+    }
+}
+
+TEST_CASE("PacketSender::AddPacketToSend - discarding and serializing - counts the serialized bytes", "[networking]")
+{
+    PacketSender packetSender;
+    packetSender.SetDiscardPackets(true);
+    packetSender.SetSerializeDiscardedPackets(true);
+    REQUIRE(packetSender.Initialize());
+
+    auto packet = CreateChatboxMessagePacket();
+
+    IPaddress ipAddress {};
+
+    auto packetsBefore = GetNumberOfPacketsSent();
+    auto bytesBefore = GetNumberOfPacketBytesSent();
+
+    packetSender.AddPacketToSend(ipAddress, packet);
+    packetSender.AddPacketToSend(ipAddress, packet);
+
+    REQUIRE(GetNumberOfPacketsSent() - packetsBefore == 2u);
+    REQUIRE(GetNumberOfPacketBytesSent() - bytesBefore == 2u * packet->GetBytes().size());
+}
@@ -0,0 +1,62 @@
+#include <sstream>
+#include <string>
+#include <nlohmann/json.hpp>
+
+#include "catch2/catch.hpp"
+#include "profiling/chrome_trace_writer.h"
+
+using namespace projectfarm::shared::profiling;
+
+TEST_CASE("ChromeTraceWriter - events and a thread name - are valid json", "[profiling]")
+{
+    std::stringstream ss;
+
+    ChromeTraceWriter writer(ss);
+    writer.WriteThreadName(2u, "main");
+    writer.WriteEvent("update", "script", 10.0, 2.5, 2u);
+    writer.Finish();
+
+    auto json = nlohmann::json::parse(ss.str());
+    const auto& events = json["traceEvents"];
+
+    REQUIRE(events.size() == 2u);
+
+    REQUIRE(events[0]["ph"] == "M");
+    REQUIRE(events[0]["args"]["name"] == "main");
+
+    REQUIRE(events[1]["name"] == "update");
+    REQUIRE(events[1]["cat"] == "script");
+    REQUIRE(events[1]["ts"].get<double>() == Approx(10.0));
+    REQUIRE(events[1]["dur"].get<double>() == Approx(2.5));
+    REQUIRE(events[1]["tid"] == 2u);
+}
+
+TEST_CASE("ChromeTraceWriter - no events - is valid json", "[profiling]")
+{
+    std::stringstream ss;
+
+    ChromeTraceWriter writer(ss);
+    writer.Finish();
+
+    auto json = nlohmann::json::parse(ss.str());
+
+    REQUIRE(json["traceEvents"].empty());
+}
+
+TEST_CASE("ChromeTraceWriter - names with quotes and control characters - are escaped", "[profiling]")
+{
+    auto name = std::string("a\"b\\c\td\re\nf") + '\x01' + "g.js:update";
+
+    std::stringstream ss;
+
+    ChromeTraceWriter writer(ss);
+    writer.WriteThreadName(1u, name);
+    writer.WriteEvent(name, "script", 0.0, 1.0, 1u);
+    writer.Finish();
+
+    auto json = nlohmann::json::parse(ss.str());
+    const auto& events = json["traceEvents"];
+
+    REQUIRE(events[0]["args"]["name"] == name);
+    REQUIRE(events[1]["name"] == name);
+}
@@ -0,0 +1,143 @@
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch2/catch.hpp"
+#include "profiling/frame_statistics.h"
+
+using namespace projectfarm::shared::profiling;
+
+namespace
+{
+    FrameSample CreateFrame(uint64_t frameTimeInMicroseconds)
+    {
+        FrameSample sample;
+        sample.FrameTimeInMicroseconds = frameTimeInMicroseconds;
+        sample.UpdateTimeInMicroseconds = frameTimeInMicroseconds / 4u;
+        sample.RenderTimeInMicroseconds = frameTimeInMicroseconds / 2u;
+
+        return sample;
+    }
+
+    std::vector<std::string> GetLines(const FrameStatistics& statistics)
+    {
+        std::stringstream ss;
+        statistics.WriteCsv(ss);
+
+        std::vector<std::string> lines;
+        for (std::string line; std::getline(ss, line);)
+        {
+            lines.push_back(line);
+        }
+
+        return lines;
+    }
+}
+
+TEST_CASE("FrameStatistics::GetPercentiles - 100 frames - are the nearest ranks", "[profiling]")
+{
+    FrameStatistics statistics(100u);
+
+    // added out of order, as the percentiles are of the values, not the order they came in
+    for (auto i = 100u; i > 0u; --i)
+    {
+        statistics.AddFrame(CreateFrame(i * 1000u));
+    }
+
+    auto frame = statistics.GetPercentiles(FrameTimings::Frame);
+    REQUIRE(frame.P50 == 50'000u);
+    REQUIRE(frame.P95 == 95'000u);
+    REQUIRE(frame.P99 == 99'000u);
+
+    auto update = statistics.GetPercentiles(FrameTimings::Update);
+    REQUIRE(update.P50 == 12'500u);
+
+    auto render = statistics.GetPercentiles(FrameTimings::Render);
+    REQUIRE(render.P99 == 49'500u);
+}
+
+TEST_CASE("FrameStatistics::GetPercentiles - no frames - are zero", "[profiling]")
+{
+    FrameStatistics statistics;
+
+    auto frame = statistics.GetPercentiles(FrameTimings::Frame);
+    REQUIRE(frame.P50 == 0u);
+    REQUIRE(frame.P99 == 0u);
+
+    REQUIRE(statistics.GetLastFrame().FrameTimeInMicroseconds == 0u);
+    REQUIRE(statistics.GetPacketsPerSecond() == 0.0);
+}
+
+TEST_CASE("FrameStatistics::AddFrame - more frames than are kept - only keeps the latest", "[profiling]")
+{
+    FrameStatistics statistics(10u);
+
+    for (auto i = 1u; i <= 25u; ++i)
+    {
+        statistics.AddFrame(CreateFrame(i));
+    }
+
+    REQUIRE(statistics.GetNumberOfFrames() == 10u);
+    REQUIRE(statistics.GetNumberOfFramesAdded() == 25u);
+    REQUIRE(statistics.GetLastFrame().FrameTimeInMicroseconds == 25u);
+
+    // only frames 16 to 25 are left
+    auto frame = statistics.GetPercentiles(FrameTimings::Frame);
+    REQUIRE(frame.P50 == 20u);
+    REQUIRE(frame.P99 == 25u);
+
+    // but every frame is in the histogram
+    REQUIRE(statistics.GetHistogram(FrameTimings::Frame).GetCount() == 25u);
+}
+
+TEST_CASE("FrameStatistics::AddFrame - frame over the slow frame time - is counted as slow", "[profiling]")
+{
+    FrameStatistics statistics(10u, 50'000u);
+
+    REQUIRE_FALSE(statistics.AddFrame(CreateFrame(16'000u)));
+    REQUIRE_FALSE(statistics.AddFrame(CreateFrame(50'000u)));
+    REQUIRE(statistics.AddFrame(CreateFrame(50'001u)));
+
+    REQUIRE(statistics.GetNumberOfSlowFrames() == 1u);
+}
+
+TEST_CASE("FrameStatistics::GetPacketsPerSecond - packets over half a second - are doubled", "[profiling]")
+{
+    FrameStatistics statistics;
+
+    for (auto i = 0u; i < 10u; ++i)
+    {
+        auto sample = CreateFrame(50'000u);
+        sample.PacketsSent = 2u;
+        sample.PacketsReceived = 3u;
+
+        statistics.AddFrame(sample);
+    }
+
+    REQUIRE(statistics.GetPacketsPerSecond() == Approx(100.0));
+}
+
+TEST_CASE("FrameStatistics::WriteCsv - more frames than are kept - writes the latest from oldest to newest", "[profiling]")
+{
+    FrameStatistics statistics(3u);
+
+    for (auto i = 1u; i <= 5u; ++i)
+    {
+        auto sample = CreateFrame(i * 100u);
+        sample.Allocations = i;
+        sample.DrawCalls = 10u;
+        sample.RoundTripTimeInMicroseconds = 30'000u;
+        sample.NumberOfEntities = 7u;
+        sample.TextureMemoryInBytes = 4096u;
+
+        statistics.AddFrame(sample);
+    }
+
+    auto lines = GetLines(statistics);
+
+    REQUIRE(lines.size() == 4u);
+    REQUIRE(lines[0] == "frame,frame_us,update_us,render_us,allocations,draw_calls,packets_sent,packets_received,"
+                        "round_trip_us,entities,texture_bytes");
+    REQUIRE(lines[1] == "2,300,75,150,3,10,0,0,30000,7,4096");
+    REQUIRE(lines[3] == "4,500,125,250,5,10,0,0,30000,7,4096");
+}
@@ -0,0 +1,234 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "catch2/catch.hpp"
+#include "test_util.h"
+#include "profiling/profiler.h"
+
+using namespace projectfarm::shared::profiling;
+
+namespace
+{
+    nlohmann::json ExportTrace(const std::string& fileName)
+    {
+        auto filePath = GetTempFilePath(fileName);
+        REQUIRE(Profiler::ExportChromeTrace(filePath));
+
+        std::ifstream fs(filePath);
+        auto json = nlohmann::json::parse(fs);
+
+        fs.close();
+        std::filesystem::remove(filePath);
+
+        return json;
+    }
+
+    // stops recording and clears the events, whichever way the test ends
+    class ProfilerSession final
+    {
+    public:
+        ProfilerSession()
+        {
+            Profiler::Clear();
+            Profiler::SetEnabled(true);
+        }
+
+        ~ProfilerSession()
+        {
+            Profiler::SetEnabled(false);
+            Profiler::Clear();
+        }
+    };
+}
+
+/*********************************************
+ * ProfileZone
+ ********************************************/
+
+TEST_CASE("ProfileZone - profiler disabled - records nothing", "[profiling]")
+{
+    Profiler::Clear();
+    Profiler::SetEnabled(false);
+
+    {
+        ProfileZone zone("disabled");
+    }
+
+    REQUIRE(Profiler::GetNumberOfEvents() == 0);
+}
+
+TEST_CASE("ProfileZone - nested zones - are exported as a Chrome trace", "[profiling]")
+{
+    ProfilerSession session;
+
+    Profiler::SetThreadName("main \"test\"");
+
+    {
+        ProfileZone outer("outer");
+
+        {
+            ProfileZone inner("inner");
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    std::thread([]()
+    {
+        ProfileZone zone("other thread");
+    }).join();
+
+    REQUIRE(Profiler::GetNumberOfEvents() == 3);
+
+    auto json = ExportTrace("profiler_trace.json");
+    const auto& events = json["traceEvents"];
+
+    const nlohmann::json* outer {nullptr};
+    const nlohmann::json* inner {nullptr};
+    const nlohmann::json* other {nullptr};
+    auto hasThreadName {false};
+
+    for (const auto& event : events)
+    {
+        auto name = event["name"].get<std::string>();
+
+        if (name == "thread_name")
+        {
+            hasThreadName = event["args"]["name"] == "main \"test\"";
+        }
+        else if (name == "outer")
+        {
+            outer = &event;
+        }
+        else if (name == "inner")
+        {
+            inner = &event;
+        }
+        else if (name == "other thread")
+        {
+            other = &event;
+        }
+    }
+
+    REQUIRE(hasThreadName);
+    REQUIRE(outer);
+    REQUIRE(inner);
+    REQUIRE(other);
+
+    REQUIRE((*outer)["ph"] == "X");
+    REQUIRE((*inner)["dur"].get<double>() >= 1000.0);
+
+    // the inner zone is within the outer one, on the same thread
+    REQUIRE((*inner)["ts"].get<double>() >= (*outer)["ts"].get<double>());
+    REQUIRE((*inner)["ts"].get<double>() + (*inner)["dur"].get<double>() <=
+            (*outer)["ts"].get<double>() + (*outer)["dur"].get<double>() + 0.001);
+    REQUIRE((*inner)["tid"] == (*outer)["tid"]);
+    REQUIRE((*other)["tid"] != (*outer)["tid"]);
+}
+
+TEST_CASE("Profiler::Record - more events than a thread keeps - keeps the latest", "[profiling]")
+{
+    ProfilerSession session;
+
+    for (auto i = 0u; i < Profiler::MaxEventsPerThread + 10u; ++i)
+    {
+        Profiler::Record(i < 10u ? "old" : "new", 1000u + i, 1001u + i);
+    }
+
+    REQUIRE(Profiler::GetNumberOfEvents() == Profiler::MaxEventsPerThread);
+
+    auto json = ExportTrace("profiler_wrap.json");
+
+    std::vector<nlohmann::json> events;
+    for (const auto& event : json["traceEvents"])
+    {
+        if (event["ph"] == "X")
+        {
+            events.push_back(event);
+        }
+    }
+
+    REQUIRE(events.size() == Profiler::MaxEventsPerThread);
+    REQUIRE(events.front()["name"] == "new");
+    REQUIRE(events.front()["ts"].get<double>() == 0.0);
+    REQUIRE(events.back()["name"] == "new");
+}
+
+TEST_CASE("Profiler::GetZoneTotals - zones on two threads - are added together by name", "[profiling]")
+{
+    ProfilerSession session;
+
+    Profiler::Record("tick", 1000u, 1500u);
+    Profiler::Record("tick", 2000u, 2300u);
+    Profiler::Record("broadcast", 1100u, 1200u);
+
+    std::thread([]()
+    {
+        Profiler::Record("tick", 1000u, 1900u);
+    }).join();
+
+    auto totals = Profiler::GetZoneTotals();
+
+    REQUIRE(totals.size() == 2u);
+
+    REQUIRE(std::string(totals[0].Name) == "tick");
+    REQUIRE(totals[0].NumberOfEvents == 3u);
+    REQUIRE(totals[0].TotalNanoseconds == 1700u);
+    REQUIRE(totals[0].MaxNanoseconds == 900u);
+
+    REQUIRE(std::string(totals[1].Name) == "broadcast");
+    REQUIRE(totals[1].NumberOfEvents == 1u);
+    REQUIRE(totals[1].TotalNanoseconds == 100u);
+}
+
+TEST_CASE("PROFILE_ZONE - profiler enabled - records the zone if compiled in", "[profiling]")
+{
+    ProfilerSession session;
+
+    {
+        PROFILE_ZONE("macro");
+        PROFILE_ZONE("macro 2");
+    }
+
+#ifdef ENABLE_PROFILER
+    REQUIRE(Profiler::GetNumberOfEvents() == 2);
+#else
+    REQUIRE(Profiler::GetNumberOfEvents() == 0);
+#endif
+}
+
+/*********************************************
+ * Benchmarks
+ ********************************************/
+
+TEST_CASE("ProfileZone overhead", "[profiling][.benchmark]")
+{
+    uint64_t counter {0u};
+
+    BENCHMARK("no zone")
+    {
+        return ++counter;
+    };
+
+    Profiler::SetEnabled(false);
+
+    BENCHMARK("disabled zone")
+    {
+        ProfileZone zone("benchmark");
+        return ++counter;
+    };
+
+    Profiler::SetEnabled(true);
+
+    BENCHMARK("enabled zone")
+    {
+        ProfileZone zone("benchmark");
+        return ++counter;
+    };
+
+    Profiler::SetEnabled(false);
+    Profiler::Clear();
+}
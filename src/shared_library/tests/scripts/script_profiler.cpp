@@ -0,0 +1,213 @@
+#include <fstream>
+#include <sstream>
+#include <memory>
+#include <string>
+
+#include "catch2/catch.hpp"
+#include "test_util.h"
+#include "scripting/script_system.h"
+#include "math/random_engine.h"
+
+using namespace std::literals;
+using namespace projectfarm::shared::scripting;
+
+namespace
+{
+    class TestWorldScript final : public Script
+    {
+    public:
+        [[nodiscard]]
+        std::vector<std::pair<FunctionTypes, bool>> GetFunctions() const noexcept override
+        {
+            return
+            {
+                { FunctionTypes::Init, true },
+                { FunctionTypes::Update, true },
+            };
+        }
+    };
+
+    class TestScriptFactory final : public ScriptFactory
+    {
+    public:
+        [[nodiscard]]
+        std::shared_ptr<Script> CreateScript(ScriptTypes type) noexcept override
+        {
+            if (type != ScriptTypes::World)
+            {
+                return {};
+            }
+
+            return std::make_shared<TestWorldScript>();
+        }
+    };
+
+    const auto HotCode = "var total = 0;"
+                         "function fib(n) { return n < 2 ? n : fib(n - 1) + fib(n - 2); }"
+                         "function init() { total = 0; }"
+                         "function update() { total += fib(20); }"s;
+
+    std::string ReadFile(const std::filesystem::path& path)
+    {
+        std::ifstream fp(path);
+
+        std::stringstream ss;
+        ss << fp.rdbuf();
+
+        return ss.str();
+    }
+}
+
+/*********************************************
+ * ExportProfile
+ ********************************************/
+
+TEST_CASE("ExportProfile - hot script - call counters, collapsed stacks and trace are exported", "[script_profiler]")
+{
+    constexpr auto numberOfUpdates = 200u;
+
+    auto randomEngine = std::make_shared<projectfarm::shared::math::RandomEngine>();
+    randomEngine->Initialize();
+
+    auto scriptSystem = std::make_shared<ScriptSystem>();
+    scriptSystem->SetScriptFactory(std::make_shared<TestScriptFactory>());
+    scriptSystem->SetRandomEngine(randomEngine);
+
+    if (!scriptSystem->Initialize(CurrentWorkingDirectory))
+    {
+        FAIL("Failed to initialize script system.");
+    }
+
+    scriptSystem->StartProfiling();
+
+    auto result = true;
+
+    {
+        auto script = scriptSystem->CreateScript(ScriptTypes::World, HotCode, "hot.js");
+        REQUIRE(script);
+
+        result &= script->CallFunction(FunctionTypes::Init, {});
+
+        for (auto i = 0u; i < numberOfUpdates; ++i)
+        {
+            result &= script->CallFunction(FunctionTypes::Update, {});
+        }
+    }
+
+    auto outputDirectory = GetTempFilePath("script_profile");
+    std::filesystem::remove_all(outputDirectory);
+
+    auto exported = scriptSystem->ExportProfile(outputDirectory);
+
+    auto callCounters = scriptSystem->GetProfiler()->GetCallCounters();
+    auto collapsedStacks = scriptSystem->GetProfiler()->GetCollapsedStacks();
+
+    scriptSystem->StopProfiling();
+    scriptSystem->Shutdown();
+
+    REQUIRE(result);
+    REQUIRE(exported);
+
+    auto update = callCounters.find({"hot.js", FunctionTypes::Update});
+    REQUIRE(update != callCounters.end());
+    REQUIRE(update->second.NumberOfCalls == numberOfUpdates);
+    REQUIRE(update->second.TotalMicroseconds >= update->second.MaxMicroseconds);
+
+    auto init = callCounters.find({"hot.js", FunctionTypes::Init});
+    REQUIRE(init != callCounters.end());
+    REQUIRE(init->second.NumberOfCalls == 1);
+
+    // the sampler should have caught `fib` at least once
+    auto hasFib = false;
+    for (const auto& [stack, hits] : collapsedStacks)
+    {
+        hasFib |= stack.find("fib") != std::string::npos && hits > 0;
+    }
+    REQUIRE(hasFib);
+
+    auto folded = ReadFile(outputDirectory / "scripts.folded");
+    REQUIRE(folded.find("fib (hot.js:") != std::string::npos);
+
+    auto trace = ReadFile(outputDirectory / "scripts.trace.json");
+    REQUIRE(trace.find("\"traceEvents\"") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"hot.js:update\"") != std::string::npos);
+
+    auto calls = ReadFile(outputDirectory / "scripts.calls.csv");
+    REQUIRE(calls.find("\"hot.js\",\"update\","s + std::to_string(numberOfUpdates) + ",") != std::string::npos);
+
+    std::filesystem::remove_all(outputDirectory);
+}
+
+TEST_CASE("ExportProfile - profiling not started - no calls are recorded", "[script_profiler]")
+{
+    auto randomEngine = std::make_shared<projectfarm::shared::math::RandomEngine>();
+    randomEngine->Initialize();
+
+    auto scriptSystem = std::make_shared<ScriptSystem>();
+    scriptSystem->SetScriptFactory(std::make_shared<TestScriptFactory>());
+    scriptSystem->SetRandomEngine(randomEngine);
+
+    if (!scriptSystem->Initialize(CurrentWorkingDirectory))
+    {
+        FAIL("Failed to initialize script system.");
+    }
+
+    auto result = true;
+
+    {
+        auto script = scriptSystem->CreateScript(ScriptTypes::World, HotCode, "hot.js");
+        REQUIRE(script);
+
+        result &= script->CallFunction(FunctionTypes::Init, {});
+        result &= script->CallFunction(FunctionTypes::Update, {});
+    }
+
+    auto callCounters = scriptSystem->GetProfiler()->GetCallCounters();
+
+    scriptSystem->Shutdown();
+
+    REQUIRE(result);
+    REQUIRE(callCounters.empty());
+}
+
+TEST_CASE("ExportProfile - script name with a comma and quotes - call counters are quoted", "[script_profiler]")
+{
+    auto randomEngine = std::make_shared<projectfarm::shared::math::RandomEngine>();
+    randomEngine->Initialize();
+
+    auto scriptSystem = std::make_shared<ScriptSystem>();
+    scriptSystem->SetScriptFactory(std::make_shared<TestScriptFactory>());
+    scriptSystem->SetRandomEngine(randomEngine);
+
+    if (!scriptSystem->Initialize(CurrentWorkingDirectory))
+    {
+        FAIL("Failed to initialize script system.");
+    }
+
+    scriptSystem->StartProfiling();
+
+    auto result = true;
+
+    {
+        auto script = scriptSystem->CreateScript(ScriptTypes::World, HotCode, "a,\"b\".js");
+        REQUIRE(script);
+
+        result &= script->CallFunction(FunctionTypes::Init, {});
+    }
+
+    auto outputDirectory = GetTempFilePath("script_profile_quoted");
+    std::filesystem::remove_all(outputDirectory);
+
+    auto exported = scriptSystem->ExportProfile(outputDirectory);
+
+    scriptSystem->StopProfiling();
+    scriptSystem->Shutdown();
+
+    REQUIRE(result);
+    REQUIRE(exported);
+
+    auto calls = ReadFile(outputDirectory / "scripts.calls.csv");
+    REQUIRE(calls.find("\"a,\"\"b\"\".js\",\"init\",1,") != std::string::npos);
+
+    std::filesystem::remove_all(outputDirectory);
+}
@@ -0,0 +1,219 @@
+#include <future>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <cstdint>
+#include <array>
+#include <thread>
+#include <algorithm>
+
+#include "catch2/catch.hpp"
+#include "test_util.h"
+#include "scripting/script_system.h"
+#include "math/random_engine.h"
+
+using namespace std::literals;
+using namespace projectfarm::shared::scripting;
+
+namespace
+{
+    class TestWorldScript final : public Script
+    {
+    public:
+        [[nodiscard]]
+        std::vector<std::pair<FunctionTypes, bool>> GetFunctions() const noexcept override
+        {
+            return
+            {
+                { FunctionTypes::Init, true },
+                { FunctionTypes::Update, true },
+            };
+        }
+
+        void SetupGlobalTemplate(v8::Local<v8::ObjectTemplate>& globalTemplate) noexcept override
+        {
+            globalTemplate->Set(v8::String::NewFromUtf8(this->_isolate, "add_tick").ToLocalChecked(),
+                                v8::FunctionTemplate::New(this->_isolate, &TestWorldScript::AddTick));
+        }
+
+        static void AddTick(const v8::FunctionCallbackInfo<v8::Value>& args)
+        {
+            v8::HandleScope handleScope(args.GetIsolate());
+
+            auto self = args.Holder();
+            auto wrap = v8::Local<v8::External>::Cast(self->GetInternalField(1));
+            auto ticks = static_cast<std::atomic<uint32_t>*>(wrap->Value());
+
+            ++(*ticks);
+        }
+    };
+
+    class TestScriptFactory final : public ScriptFactory
+    {
+    public:
+        [[nodiscard]]
+        std::shared_ptr<Script> CreateScript(ScriptTypes type) noexcept override
+        {
+            if (type != ScriptTypes::World)
+            {
+                return {};
+            }
+
+            return std::make_shared<TestWorldScript>();
+        }
+    };
+
+    const auto WorldCode = "var total = 0;"
+                           "function init() { total = 0; }"
+                           "function update() { total += random_int(1, 1); add_tick(); }"s;
+}
+
+/*********************************************
+ * CreateScript
+ ********************************************/
+
+TEST_CASE("CreateScript - scripted worlds on four threads - each thread runs on its own isolate", "[script_system]")
+{
+    constexpr auto numberOfThreads = 4u;
+    constexpr auto numberOfWorldsPerThread = 8u;
+    constexpr auto numberOfTicks = 1000u;
+
+    auto randomEngine = std::make_shared<projectfarm::shared::math::RandomEngine>();
+    randomEngine->Initialize();
+
+    auto scriptSystem = std::make_shared<ScriptSystem>();
+    scriptSystem->SetScriptFactory(std::make_shared<TestScriptFactory>());
+    scriptSystem->SetRandomEngine(randomEngine);
+
+    if (!scriptSystem->Initialize(CurrentWorkingDirectory))
+    {
+        FAIL("Failed to initialize script system.");
+    }
+
+    std::vector<std::future<std::pair<bool, v8::Isolate*>>> futures;
+
+    std::array<std::atomic<uint32_t>, numberOfThreads * numberOfWorldsPerThread> ticks {};
+
+    // ensures all threads, and so all isolates, are alive at the same time
+    std::atomic<uint32_t> threadsReady {0u};
+
+    for (auto t = 0u; t < numberOfThreads; ++t)
+    {
+        auto future = std::async(std::launch::async, [&scriptSystem, &ticks, &threadsReady, t]()
+        {
+            auto result = true;
+            v8::Isolate* isolate {nullptr};
+
+            {
+                std::vector<std::shared_ptr<Script>> worlds;
+
+                for (auto w = 0u; w < numberOfWorldsPerThread; ++w)
+                {
+                    auto script = scriptSystem->CreateScript(ScriptTypes::World, WorldCode);
+                    if (!script)
+                    {
+                        result = false;
+                        break;
+                    }
+
+                    script->SetObjectInternalField(&ticks[t * numberOfWorldsPerThread + w]);
+
+                    result &= script->CallFunction(FunctionTypes::Init, {});
+
+                    isolate = script->GetIsolate();
+                    worlds.emplace_back(std::move(script));
+                }
+
+                ++threadsReady;
+                while (threadsReady < numberOfThreads)
+                {
+                    std::this_thread::yield();
+                }
+
+                for (auto i = 0u; i < numberOfTicks; ++i)
+                {
+                    for (const auto& world : worlds)
+                    {
+                        result &= world->CallFunction(FunctionTypes::Update, {});
+                        result &= world->GetIsolate() == isolate;
+                    }
+                }
+            }
+
+            scriptSystem->ReleaseIsolateForCurrentThread();
+
+            return std::make_pair(result, isolate);
+        });
+
+        futures.emplace_back(std::move(future));
+    }
+
+    std::vector<v8::Isolate*> isolates;
+
+    for (auto& f : futures)
+    {
+        auto [result, isolate] = f.get();
+
+        REQUIRE(result);
+        REQUIRE(isolate != nullptr);
+
+        isolates.push_back(isolate);
+    }
+
+    // only the isolate of the initializing thread should remain
+    auto remainingIsolates = scriptSystem->GetNumberOfIsolates();
+
+    scriptSystem->Shutdown();
+
+    for (const auto& tick : ticks)
+    {
+        REQUIRE(tick == numberOfTicks);
+    }
+
+    std::sort(isolates.begin(), isolates.end());
+    REQUIRE(std::unique(isolates.begin(), isolates.end()) == isolates.end());
+
+    REQUIRE(remainingIsolates == 1);
+}
+
+/*********************************************
+ * GetIsolateForCurrentThread
+ ********************************************/
+
+TEST_CASE("GetIsolateForCurrentThread - thread exits without releasing - its isolate is disposed of", "[script_system]")
+{
+    auto scriptSystem = std::make_shared<ScriptSystem>();
+    scriptSystem->SetScriptFactory(std::make_shared<TestScriptFactory>());
+
+    if (!scriptSystem->Initialize(CurrentWorkingDirectory))
+    {
+        FAIL("Failed to initialize script system.");
+    }
+
+    // Catch can't be used from other threads, so the results are checked once they have exited
+    std::vector<v8::Isolate*> isolates;
+    std::vector<size_t> numberOfIsolatesWhileAlive;
+
+    // thread ids are often reused by the next thread, which must still get a new isolate
+    for (auto i = 0u; i < 3u; ++i)
+    {
+        std::thread([&scriptSystem, &isolates, &numberOfIsolatesWhileAlive]()
+        {
+            isolates.push_back(scriptSystem->GetIsolateForCurrentThread());
+            numberOfIsolatesWhileAlive.push_back(scriptSystem->GetNumberOfIsolates());
+        }).join();
+    }
+
+    auto remainingIsolates = scriptSystem->GetNumberOfIsolates();
+
+    scriptSystem->Shutdown();
+
+    for (auto i = 0u; i < 3u; ++i)
+    {
+        REQUIRE(isolates[i] != nullptr);
+        REQUIRE(numberOfIsolatesWhileAlive[i] == 2u);
+    }
+
+    // only the isolate of the initializing thread should remain
+    REQUIRE(remainingIsolates == 1u);
+}
@@ -1,4 +1,15 @@
+#include <atomic>
+#include <fstream>
+#include <cstdint>
+
 #include "test_util.h"
+#include "platform/platform_id.h"
+
+#if defined(IS_WINDOWS)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 
 std::filesystem::path CurrentWorkingDirectory;
 
@@ -19,3 +30,27 @@ std::filesystem::path GetConfigFilePath(std::filesystem::path fileName)
     auto path = CurrentWorkingDirectory / "../../src/shared_library/tests/test_data/config/" / fileName;
     return path.lexically_normal();
 }
+
+std::filesystem::path GetTempFilePath(const std::string& fileName)
+{
+    static std::atomic<uint32_t> numberOfTempFiles {0u};
+
+#if defined(IS_WINDOWS)
+    auto processId = _getpid();
+#else
+    auto processId = getpid();
+#endif
+
+    auto uniqueFileName = "projectfarm_" + std::to_string(processId) + "_" +
+                          std::to_string(++numberOfTempFiles) + "_" + fileName;
+
+    return std::filesystem::temp_directory_path() / uniqueFileName;
+}
+
+void WriteTextFile(const std::filesystem::path& filePath, const std::string& text)
+{
+    std::filesystem::create_directories(filePath.parent_path());
+
+    std::ofstream fs(filePath, std::ios::trunc);
+    fs << text;
+}
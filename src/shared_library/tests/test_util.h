@@ -2,6 +2,7 @@
 #define PROJECTFARM_TEST_UTIL_H
 
 #include <filesystem>
+#include <string>
 
 extern std::filesystem::path CurrentWorkingDirectory;
 
@@ -11,4 +12,10 @@ std::filesystem::path GetCSSFilePath(std::filesystem::path fileName);
 
 std::filesystem::path GetConfigFilePath(std::filesystem::path fileName);
 
+// a path in the temp directory that no other call, or test process, is given
+std::filesystem::path GetTempFilePath(const std::string& fileName);
+
+// replaces the file, creating its folder if needed
+void WriteTextFile(const std::filesystem::path& filePath, const std::string& text);
+
 #endif
\ No newline at end of file
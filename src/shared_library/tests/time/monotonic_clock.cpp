@@ -0,0 +1,85 @@
+#include "catch2/catch.hpp"
+#include "time/monotonic_clock.h"
+#include "time/stopwatch.h"
+
+using namespace projectfarm::shared::time;
+
+/*********************************************
+ * CachedTime
+ ********************************************/
+
+TEST_CASE("CachedTime::Update - time goes backwards - keeps the latest time", "[time]")
+{
+    CachedTime cachedTime;
+
+    REQUIRE(cachedTime.Update(5'000u) == 5'000u);
+    REQUIRE(cachedTime.Update(2'000u) == 5'000u);
+    REQUIRE(cachedTime.GetMicroseconds() == 5'000u);
+
+    REQUIRE(cachedTime.Update(6'000u) == 6'000u);
+    REQUIRE(cachedTime.GetMicroseconds() == 6'000u);
+}
+
+/*********************************************
+ * MonotonicClock
+ ********************************************/
+
+TEST_CASE("MonotonicClock::Update - called repeatedly - never goes backwards", "[time]")
+{
+    auto lastTime = MonotonicClock::Update();
+
+    for (auto i = 0u; i < 1000u; ++i)
+    {
+        auto time = MonotonicClock::Update();
+        REQUIRE(time >= lastTime);
+
+        lastTime = time;
+    }
+
+    REQUIRE(MonotonicClock::GetMicroseconds() >= lastTime);
+}
+
+TEST_CASE("MonotonicClock::ReadCoarseMicroseconds - compared with the precise time - is from the same start", "[time]")
+{
+    auto coarseTime = MonotonicClock::ReadCoarseMicroseconds();
+    auto preciseTime = MonotonicClock::ReadMicroseconds();
+
+    // the coarse time lags behind by at most a kernel tick
+    REQUIRE(coarseTime <= preciseTime + 1000u);
+    REQUIRE(preciseTime - coarseTime < 100'000u);
+}
+
+/*********************************************
+ * Stopwatch::Tick
+ ********************************************/
+
+TEST_CASE("Stopwatch::Tick - time goes backwards - counts no time and carries on from there", "[time]")
+{
+    Stopwatch sw;
+    sw.SetTargetMilliseconds(100);
+    sw.Start(1'000'000u);
+
+    REQUIRE_FALSE(sw.Tick(1'060'000u));
+
+    // a jump back doesn't wrap around into a tick
+    REQUIRE_FALSE(sw.Tick(500'000u));
+
+    // only the 60ms from before the jump and 30ms from after it
+    REQUIRE_FALSE(sw.Tick(530'000u));
+    REQUIRE(sw.Tick(540'000u));
+}
+
+TEST_CASE("Stopwatch::Tick - time jumps forwards - ticks once", "[time]")
+{
+    Stopwatch sw;
+    sw.SetTargetMilliseconds(100);
+    sw.Start(0u);
+
+    auto numberOfTicks = 0u;
+    sw.SetOnTick([&numberOfTicks]() { ++numberOfTicks; });
+
+    REQUIRE(sw.Tick(60'000'000u));
+    REQUIRE_FALSE(sw.Tick(60'050'000u));
+
+    REQUIRE(numberOfTicks == 1u);
+}
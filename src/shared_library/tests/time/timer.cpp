@@ -0,0 +1,33 @@
+#include "catch2/catch.hpp"
+#include "time/timer.h"
+
+using namespace projectfarm::shared::time;
+
+/*********************************************
+ * IncrementFrame
+ ********************************************/
+
+TEST_CASE("Timer::IncrementFrame - fixed frame duration - does not read the clock", "[time]")
+{
+    Timer timer;
+
+    for (auto i = 0u; i < 60u; ++i)
+    {
+        timer.IncrementFrame(16'667u);
+    }
+
+    REQUIRE(timer.GetTotalGameDurationInMicroseconds() == 60u * 16'667u);
+    REQUIRE(timer.GetLastFrameDurationInMicroseconds() == 16'667u);
+    REQUIRE(timer.GetLastFrameDurationInMilliseconds() == 16u);
+    REQUIRE(timer.GetFPS() > 0u);
+}
+
+TEST_CASE("Timer::IncrementFrame - fixed frame duration after a reset - carries on from the reset time", "[time]")
+{
+    Timer timer;
+    timer.Reset(5'000'000u);
+
+    timer.IncrementFrame(1000u);
+
+    REQUIRE(timer.GetTotalGameDurationInMicroseconds() == 5'001'000u);
+}
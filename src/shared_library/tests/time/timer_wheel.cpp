@@ -0,0 +1,237 @@
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "catch2/catch.hpp"
+#include "time/timer_wheel.h"
+
+using namespace projectfarm::shared::time;
+
+/*********************************************
+ * ScheduleOnce
+ ********************************************/
+
+TEST_CASE("ScheduleOnce - advance to due time - calls callback once", "[timer_wheel]")
+{
+    TimerWheel wheel;
+
+    auto result = 0u;
+
+    auto handle = wheel.ScheduleOnce(500, [&result](){ ++result; });
+
+    wheel.Advance(499);
+    REQUIRE(result == 0);
+    REQUIRE(wheel.IsScheduled(handle));
+
+    wheel.Advance(500);
+    REQUIRE(result == 1);
+    REQUIRE_FALSE(wheel.IsScheduled(handle));
+
+    wheel.Advance(5000);
+    REQUIRE(result == 1);
+}
+
+TEST_CASE("ScheduleOnce - timers across all levels - each called at its due time", "[timer_wheel]")
+{
+    TimerWheel wheel;
+
+    std::vector<uint64_t> dueTimes { 1, 255, 256, 257, 16383, 16384, 16385, 1048576, 67108864, 5000000000 };
+    std::vector<uint64_t> result;
+
+    for (auto dueTime : dueTimes)
+    {
+        (void)wheel.ScheduleOnce(dueTime, [&wheel, &result](){ result.push_back(wheel.GetCurrentMilliseconds()); });
+    }
+
+    // advance in uneven steps to make sure no slot is skipped
+    uint64_t time {0u};
+    while (time < dueTimes.back())
+    {
+        time = std::min<uint64_t>(time + 9973u, dueTimes.back());
+        wheel.Advance(time);
+    }
+
+    REQUIRE(result == dueTimes);
+    REQUIRE(wheel.GetNumberOfTimers() == 0);
+}
+
+/*********************************************
+ * ScheduleRecurring
+ ********************************************/
+
+TEST_CASE("ScheduleRecurring - 500ms timer - calls callback every interval", "[timer_wheel]")
+{
+    TimerWheel wheel;
+
+    auto result = 0u;
+
+    (void)wheel.ScheduleRecurring(500, [&result](){ ++result; });
+
+    auto targetRunTime {5000u};
+
+    for (auto time = 0u; time <= targetRunTime; time += 50u)
+    {
+        wheel.Advance(time);
+    }
+
+    REQUIRE(result == 10);
+}
+
+TEST_CASE("ScheduleRecurring - late advance - next interval starts from when called", "[timer_wheel]")
+{
+    TimerWheel wheel;
+
+    std::vector<uint64_t> result;
+
+    (void)wheel.ScheduleRecurring(100, [&wheel, &result](){ result.push_back(wheel.GetCurrentMilliseconds()); });
+
+    wheel.Advance(100);
+    wheel.Advance(250);
+    wheel.Advance(350);
+
+    // the second call was late, in the advance to 250, so the next is 100 after that
+    std::vector<uint64_t> expected { 100, 200, 350 };
+
+    REQUIRE(result == expected);
+}
+
+TEST_CASE("ScheduleRecurring - 3s stall - calls callback once, not for each missed interval", "[timer_wheel]")
+{
+    TimerWheel wheel;
+
+    auto result = 0u;
+
+    (void)wheel.ScheduleRecurring(100, [&result](){ ++result; });
+
+    wheel.Advance(100);
+    REQUIRE(result == 1);
+
+    wheel.Advance(3100);
+    REQUIRE(result == 2);
+
+    wheel.Advance(3199);
+    REQUIRE(result == 2);
+
+    wheel.Advance(3200);
+    REQUIRE(result == 3);
+}
+
+/*********************************************
+ * Cancel
+ ********************************************/
+
+TEST_CASE("Cancel - scheduled timer - callback not called", "[timer_wheel]")
+{
+    TimerWheel wheel;
+
+    auto result = 0u;
+
+    auto handle = wheel.ScheduleRecurring(100, [&result](){ ++result; });
+
+    // advanced in steps, as a single late advance only calls a recurring timer once
+    for (auto time = 50u; time <= 250u; time += 50u)
+    {
+        wheel.Advance(time);
+    }
+
+    REQUIRE(wheel.Cancel(handle));
+
+    wheel.Advance(1000);
+
+    REQUIRE(result == 2);
+    REQUIRE(wheel.GetNumberOfTimers() == 0);
+}
+
+TEST_CASE("Cancel - stale handle - does not cancel reused timer", "[timer_wheel]")
+{
+    TimerWheel wheel;
+
+    auto result = 0u;
+
+    auto staleHandle = wheel.ScheduleOnce(10, [](){});
+    wheel.Advance(10);
+
+    // this will reuse the released timer
+    auto handle = wheel.ScheduleOnce(10, [&result](){ ++result; });
+
+    REQUIRE_FALSE(wheel.Cancel(staleHandle));
+    REQUIRE(wheel.IsScheduled(handle));
+
+    wheel.Advance(20);
+
+    REQUIRE(result == 1);
+}
+
+TEST_CASE("Cancel - timer cancels itself from its callback - callback not called again", "[timer_wheel]")
+{
+    TimerWheel wheel;
+
+    auto result = 0u;
+    auto handle = TimerWheel::InvalidHandle;
+
+    handle = wheel.ScheduleRecurring(10, [&wheel, &result, &handle]()
+    {
+        ++result;
+        wheel.Cancel(handle);
+    });
+
+    wheel.Advance(100);
+
+    REQUIRE(result == 1);
+}
+
+/*********************************************
+ * Advance
+ ********************************************/
+
+TEST_CASE("Advance - 100k timers", "[timer_wheel][.benchmark]")
+{
+    constexpr auto numberOfTimers = 100000u;
+
+    TimerWheel wheel;
+
+    auto result = 0u;
+
+    BENCHMARK("Schedule 100k recurring timers")
+    {
+        TimerWheel w;
+
+        for (auto i = 0u; i < numberOfTimers; ++i)
+        {
+            (void)w.ScheduleRecurring(50u + i % 1000u, [&result](){ ++result; });
+        }
+
+        return w.GetNumberOfTimers();
+    };
+
+    for (auto i = 0u; i < numberOfTimers; ++i)
+    {
+        // spread the intervals out as character scripts typically do
+        (void)wheel.ScheduleRecurring(50u + i % 1000u, [&result](){ ++result; });
+    }
+
+    uint64_t time {0u};
+
+    BENCHMARK("Advance 1ms with 100k recurring timers")
+    {
+        wheel.Advance(++time);
+        return result;
+    };
+
+    BENCHMARK("Schedule 100k one shot timers due in an hour and advance 100ms")
+    {
+        TimerWheel w;
+
+        for (auto i = 0u; i < numberOfTimers; ++i)
+        {
+            (void)w.ScheduleOnce(3600000u, [&result](){ ++result; });
+        }
+
+        for (auto t = 1u; t <= 100u; ++t)
+        {
+            w.Advance(t);
+        }
+
+        return result;
+    };
+}
@@ -0,0 +1,134 @@
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#include "catch2/catch.hpp"
+#include "utils/compression.h"
+
+using namespace projectfarm::shared::utils;
+
+namespace
+{
+    std::vector<std::byte> ToBytes(const std::string& s)
+    {
+        std::vector<std::byte> bytes(s.size());
+        for (auto i = 0u; i < s.size(); ++i)
+        {
+            bytes[i] = static_cast<std::byte>(s[i]);
+        }
+
+        return bytes;
+    }
+
+    std::vector<std::byte> RoundTrip(const std::vector<std::byte>& data)
+    {
+        auto compressed = CompressLz(data.data(), data.size());
+
+        std::vector<std::byte> decompressed(data.size());
+        REQUIRE(DecompressLz(compressed.data(), compressed.size(), decompressed.data(), decompressed.size()));
+
+        return decompressed;
+    }
+}
+
+/*********************************************
+ * CompressLz
+ ********************************************/
+
+TEST_CASE("CompressLz - empty data - round trips", "[compression]")
+{
+    std::vector<std::byte> data;
+
+    auto compressed = CompressLz(data.data(), data.size());
+
+    REQUIRE(compressed.empty());
+    REQUIRE(DecompressLz(compressed.data(), compressed.size(), nullptr, 0u));
+}
+
+TEST_CASE("CompressLz - short data - round trips", "[compression]")
+{
+    auto data = ToBytes("ab");
+
+    REQUIRE(RoundTrip(data) == data);
+}
+
+TEST_CASE("CompressLz - repetitive text - round trips smaller", "[compression]")
+{
+    std::string text;
+    for (auto i = 0u; i < 1000u; ++i)
+    {
+        text += R"({ "name": "plot_)" + std::to_string(i) + R"(", "tileSet": "grass", "isCollidable": false },)";
+    }
+
+    auto data = ToBytes(text);
+
+    auto compressed = CompressLz(data.data(), data.size());
+
+    REQUIRE(compressed.size() < data.size() / 2u);
+    REQUIRE(RoundTrip(data) == data);
+}
+
+TEST_CASE("CompressLz - overlapping run - round trips", "[compression]")
+{
+    auto data = ToBytes("a" + std::string(1000, 'b') + "c");
+
+    REQUIRE(RoundTrip(data) == data);
+}
+
+TEST_CASE("CompressLz - incompressible data - round trips", "[compression]")
+{
+    std::vector<std::byte> data(100000);
+
+    uint32_t state {12345u};
+    for (auto& b : data)
+    {
+        state = state * 1664525u + 1013904223u;
+        b = static_cast<std::byte>(state >> 24u);
+    }
+
+    REQUIRE(RoundTrip(data) == data);
+}
+
+/*********************************************
+ * DecompressLz
+ ********************************************/
+
+TEST_CASE("GetMaxDecompressedLzSize - long run - is not exceeded", "[compression]")
+{
+    auto data = ToBytes(std::string(100000, 'a'));
+
+    auto compressed = CompressLz(data.data(), data.size());
+
+    REQUIRE(data.size() <= GetMaxDecompressedLzSize(compressed.size()));
+    REQUIRE(GetMaxDecompressedLzSize(0u) == 0u);
+}
+
+TEST_CASE("DecompressLz - wrong output size - returns false", "[compression]")
+{
+    auto data = ToBytes(std::string(200, 'x'));
+
+    auto compressed = CompressLz(data.data(), data.size());
+
+    std::vector<std::byte> decompressed(data.size() - 1u);
+    REQUIRE_FALSE(DecompressLz(compressed.data(), compressed.size(), decompressed.data(), decompressed.size()));
+
+    decompressed.resize(data.size() + 1u);
+    REQUIRE_FALSE(DecompressLz(compressed.data(), compressed.size(), decompressed.data(), decompressed.size()));
+}
+
+TEST_CASE("DecompressLz - match before start - returns false", "[compression]")
+{
+    // a match of 3 bytes, 1 byte back, with nothing before it
+    std::vector<std::byte> compressed { std::byte {0x80}, std::byte {0x01}, std::byte {0x00} };
+
+    std::vector<std::byte> decompressed(3u);
+    REQUIRE_FALSE(DecompressLz(compressed.data(), compressed.size(), decompressed.data(), decompressed.size()));
+}
+
+TEST_CASE("DecompressLz - truncated literals - returns false", "[compression]")
+{
+    std::vector<std::byte> compressed { std::byte {0x05}, std::byte {'a'} };
+
+    std::vector<std::byte> decompressed(6u);
+    REQUIRE_FALSE(DecompressLz(compressed.data(), compressed.size(), decompressed.data(), decompressed.size()));
+}
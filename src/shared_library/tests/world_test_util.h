@@ -0,0 +1,21 @@
+#ifndef PROJECTFARM_WORLD_TEST_UTIL_H
+#define PROJECTFARM_WORLD_TEST_UTIL_H
+
+#include <cstdint>
+
+#include "game/world/world_change_log.h"
+
+inline projectfarm::shared::game::world::WorldChangeLogEntry CreateChange(uint8_t layer, uint32_t x, uint32_t y,
+                                                                         uint64_t time, uint16_t plot)
+{
+    projectfarm::shared::game::world::WorldChangeLogEntry entry;
+    entry.LayerIndex = layer;
+    entry.TileX = x;
+    entry.TileY = y;
+    entry.Time = time;
+    entry.PlotIndex = plot;
+
+    return entry;
+}
+
+#endif
@@ -3,6 +3,7 @@
 #include <sstream>
 
 #include "clock.h"
+#include "platform/platform_id.h"
 
 namespace projectfarm::shared::time
 {
@@ -24,6 +25,19 @@ namespace projectfarm::shared::time
         return millisecondsSinceEpoch;
     }
 
+    uint64_t Clock::CoarseMillisecondsSinceEpoch() noexcept
+    {
+#if defined(IS_LINUX) && defined(CLOCK_REALTIME_COARSE)
+        timespec ts {};
+        if (clock_gettime(CLOCK_REALTIME_COARSE, &ts) == 0)
+        {
+            return static_cast<uint64_t>(ts.tv_sec) * 1000u + static_cast<uint64_t>(ts.tv_nsec) / 1'000'000u;
+        }
+#endif
+
+        return Clock::MillisecondsSinceEpoch();
+    }
+
     std::string Clock::UTCAsShortString() noexcept
     {
         auto s = Clock::UTCAsString(Clock::ShortTimeFormatString);
@@ -14,6 +14,10 @@ namespace projectfarm::shared::time
 
         static uint64_t MillisecondsSinceEpoch() noexcept;
 
+        // `CLOCK_REALTIME_COARSE` on Linux, which is cheaper to read but only updated every
+        // kernel tick (1 to 4ms). The same as `MillisecondsSinceEpoch` elsewhere.
+        static uint64_t CoarseMillisecondsSinceEpoch() noexcept;
+
         static std::string UTCAsShortString() noexcept;
         static std::string UTCAsLongString() noexcept;
         static std::string UTCAsString(const std::string& format) noexcept;
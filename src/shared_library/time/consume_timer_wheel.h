@@ -0,0 +1,31 @@
+#ifndef PROJECTFARM_CONSUME_TIMER_WHEEL_H
+#define PROJECTFARM_CONSUME_TIMER_WHEEL_H
+
+#include <memory>
+
+namespace projectfarm::shared::time
+{
+    class TimerWheel;
+
+    class ConsumeTimerWheel
+    {
+    public:
+        ConsumeTimerWheel() = default;
+        virtual ~ConsumeTimerWheel() = default;
+
+        [[nodiscard]] const std::shared_ptr<TimerWheel>& GetTimerWheel() const
+        {
+            return _timerWheel;
+        }
+
+        void SetTimerWheel(const std::shared_ptr<TimerWheel>& timerWheel)
+        {
+            this->_timerWheel = timerWheel;
+        }
+
+    private:
+        std::shared_ptr<TimerWheel> _timerWheel;
+    };
+}
+
+#endif
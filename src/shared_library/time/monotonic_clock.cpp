@@ -0,0 +1,73 @@
+#include <chrono>
+
+#include "monotonic_clock.h"
+#include "platform/platform_id.h"
+
+#ifdef IS_LINUX
+#include <ctime>
+#endif
+
+namespace projectfarm::shared::time
+{
+    namespace
+    {
+        CachedTime& GetCachedTime() noexcept
+        {
+            static CachedTime cachedTime;
+            return cachedTime;
+        }
+    }
+
+    uint64_t CachedTime::Update(uint64_t microseconds) noexcept
+    {
+        auto current = this->_microseconds.load(std::memory_order_relaxed);
+
+        while (microseconds > current)
+        {
+            if (this->_microseconds.compare_exchange_weak(current, microseconds, std::memory_order_relaxed))
+            {
+                return microseconds;
+            }
+        }
+
+        return current;
+    }
+
+    uint64_t MonotonicClock::ReadMicroseconds() noexcept
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    uint64_t MonotonicClock::ReadCoarseMicroseconds() noexcept
+    {
+#if defined(IS_LINUX) && defined(CLOCK_MONOTONIC_COARSE)
+        // the same start as `steady_clock`, so the two can be compared
+        timespec ts {};
+        if (clock_gettime(CLOCK_MONOTONIC_COARSE, &ts) == 0)
+        {
+            return static_cast<uint64_t>(ts.tv_sec) * 1'000'000u + static_cast<uint64_t>(ts.tv_nsec) / 1000u;
+        }
+#endif
+
+        return MonotonicClock::ReadMicroseconds();
+    }
+
+    uint64_t MonotonicClock::Update() noexcept
+    {
+        return GetCachedTime().Update(MonotonicClock::ReadMicroseconds());
+    }
+
+    uint64_t MonotonicClock::GetMicroseconds() noexcept
+    {
+        auto microseconds = GetCachedTime().GetMicroseconds();
+
+        // nothing has updated it yet, such as before the first frame
+        if (microseconds == 0u)
+        {
+            return MonotonicClock::Update();
+        }
+
+        return microseconds;
+    }
+}
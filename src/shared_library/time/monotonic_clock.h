@@ -0,0 +1,62 @@
+#ifndef PROJECTFARM_MONOTONIC_CLOCK_H
+#define PROJECTFARM_MONOTONIC_CLOCK_H
+
+#include <cstdint>
+#include <atomic>
+
+namespace projectfarm::shared::time
+{
+    // Keeps the latest time it has been given, so it never goes backwards even if
+    // the clock it is given times from does
+    class CachedTime final
+    {
+    public:
+        CachedTime() = default;
+        ~CachedTime() = default;
+
+        CachedTime(const CachedTime&) = delete;
+        CachedTime(CachedTime&&) = delete;
+
+        // returns the cached time, which is `microseconds` unless it is earlier than the last
+        uint64_t Update(uint64_t microseconds) noexcept;
+
+        [[nodiscard]]
+        uint64_t GetMicroseconds() const noexcept
+        {
+            return this->_microseconds.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<uint64_t> _microseconds {0u};
+    };
+
+    // Time from an unspecified start that is not changed by the system time being set,
+    // for delays, intervals and frame times. Times shown to people use `Clock`.
+    class MonotonicClock final
+    {
+    public:
+        // as precise as the platform allows
+        [[nodiscard]]
+        static uint64_t ReadMicroseconds() noexcept;
+
+        // `CLOCK_MONOTONIC_COARSE` on Linux, which is only updated every kernel tick (1 to 4ms)
+        // but is much cheaper to read. The same as `ReadMicroseconds` elsewhere.
+        [[nodiscard]]
+        static uint64_t ReadCoarseMicroseconds() noexcept;
+
+        // reads the clock and caches the time. `Timer` calls this each frame and tick.
+        static uint64_t Update() noexcept;
+
+        // the time of the last `Update`, for things checked many times each frame or tick
+        [[nodiscard]]
+        static uint64_t GetMicroseconds() noexcept;
+
+        [[nodiscard]]
+        static uint64_t GetMilliseconds() noexcept
+        {
+            return MonotonicClock::GetMicroseconds() / 1000u;
+        }
+    };
+}
+
+#endif
@@ -1,11 +1,17 @@
 #include "stopwatch.h"
+#include "monotonic_clock.h"
 
 namespace projectfarm::shared::time
 {
     void Stopwatch::Start() noexcept
+    {
+        this->Start(MonotonicClock::ReadMicroseconds());
+    }
+
+    void Stopwatch::Start(uint64_t currentMicroseconds) noexcept
     {
         this->_started = true;
-        this->_lastTime = std::chrono::steady_clock::now();
+        this->_lastTime = currentMicroseconds;
     }
 
     void Stopwatch::Stop() noexcept
@@ -28,13 +34,20 @@ namespace projectfarm::shared::time
             return false;
         }
 
-        auto currentTime = std::chrono::steady_clock::now();
-        auto duration = currentTime - this->_lastTime;
-        this->_lastTime = currentTime;
+        return this->Tick(MonotonicClock::ReadMicroseconds());
+    }
+
+    bool Stopwatch::Tick(uint64_t currentMicroseconds) noexcept
+    {
+        if (!this->_started)
+        {
+            return false;
+        }
 
-        auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        auto microseconds = currentMicroseconds > this->_lastTime ? currentMicroseconds - this->_lastTime : 0u;
+        this->_lastTime = currentMicroseconds;
 
-        if (microseconds == 0)
+        if (microseconds == 0u)
         {
             return false;
         }
@@ -2,7 +2,6 @@
 #define PROJECTFARM_STOPWATCH_H
 
 #include <cstdint>
-#include <chrono>
 #include <functional>
 
 namespace projectfarm::shared::time
@@ -13,7 +12,9 @@ namespace projectfarm::shared::time
         Stopwatch() = default;
         ~Stopwatch() = default;
 
+        // reads `MonotonicClock`
         void Start() noexcept;
+        void Start(uint64_t currentMicroseconds) noexcept;
         void Stop() noexcept;
         void Reset() noexcept;
 
@@ -24,6 +25,10 @@ namespace projectfarm::shared::time
 
         bool Tick() noexcept;
 
+        // for callers that already have the time, such as from `MonotonicClock::GetMicroseconds`.
+        // A time earlier than the last is counted as no time passing.
+        bool Tick(uint64_t currentMicroseconds) noexcept;
+
         void SetTargetMilliseconds(uint64_t milliseconds) noexcept
         {
             this->_targetMicroseconds = milliseconds * 1000u;
@@ -42,7 +47,7 @@ namespace projectfarm::shared::time
     private:
         uint64_t _targetMicroseconds {0u};
         uint64_t _currentMicroseconds {0u};
-        std::chrono::steady_clock::time_point _lastTime;
+        uint64_t _lastTime {0u};
 
         std::function<void(void)> _onTick;
 
@@ -1,35 +1,47 @@
 #include "timer.h"
+#include "monotonic_clock.h"
 
 namespace projectfarm::shared::time
 {
-    void Timer::Reset()
+    void Timer::Reset(uint64_t totalGameDuration)
     {
         this->_totalFrames = 0;
-        this->_totalGameDuration = 0;
+        this->_totalGameDuration = totalGameDuration;
         this->_lastFrameDuration = 0;
         this->_fps = 0;
         this->_fpsCounter = 0;
         this->_fpsDurationCounter = 0;
 
-        this->_baseTime = std::chrono::steady_clock::now();
-        this->_lastFrameTime = this->_baseTime;
+        this->_lastFrameTime = MonotonicClock::Update();
+        this->_baseTime = this->_lastFrameTime - totalGameDuration;
     }
 
     void Timer::IncrementFrame()
     {
-        auto currentTime = std::chrono::steady_clock::now();
+        auto currentTime = MonotonicClock::Update();
 
         this->_totalFrames++;
 
-        auto gameTime = currentTime - this->_baseTime;
-        this->_totalGameDuration =
-            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(gameTime).count());
+        this->_totalGameDuration = currentTime - this->_baseTime;
 
-        auto lastFrameTime = currentTime - this->_lastFrameTime;
+        this->_lastFrameDuration = currentTime - this->_lastFrameTime;
         this->_lastFrameTime = currentTime;
-        this->_lastFrameDuration =
-            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(lastFrameTime).count());
 
+        this->UpdateFPS();
+    }
+
+    void Timer::IncrementFrame(uint64_t frameDurationInMicroseconds) noexcept
+    {
+        this->_totalFrames++;
+
+        this->_totalGameDuration += frameDurationInMicroseconds;
+        this->_lastFrameDuration = frameDurationInMicroseconds;
+
+        this->UpdateFPS();
+    }
+
+    void Timer::UpdateFPS() noexcept
+    {
         this->_fpsDurationCounter += this->_lastFrameDuration;
         if (this->_fpsDurationCounter >= 1000000)
         {
@@ -1,8 +1,7 @@
 #ifndef PROJECTFARM_TIMER_H
 #define PROJECTFARM_TIMER_H
 
-#include <cstdlib>
-#include <chrono>
+#include <cstdint>
 
 namespace projectfarm::shared::time
 {
@@ -15,10 +14,17 @@ namespace projectfarm::shared::time
         }
         ~Timer() = default;
 
-        void Reset();
+        // `totalGameDuration` continues the game time from a previous run, such as a checkpoint
+        void Reset(uint64_t totalGameDuration = 0);
 
+        // also updates `MonotonicClock`'s cached time
         void IncrementFrame();
 
+        // moves on by `frameDurationInMicroseconds` without reading the clock, so a
+        // simulation gets the same times on every run. A timer should only be
+        // incremented one of the two ways
+        void IncrementFrame(uint64_t frameDurationInMicroseconds) noexcept;
+
         [[nodiscard]]
         uint64_t GetTotalGameDurationInMicroseconds() const
         {
@@ -49,13 +55,16 @@ namespace projectfarm::shared::time
         }
 
     private:
+        void UpdateFPS() noexcept;
+
         uint64_t _totalFrames {0};
 
-        std::chrono::steady_clock::time_point _baseTime;
+        // of `MonotonicClock`
+        uint64_t _baseTime {0};
 
         uint64_t _totalGameDuration {0};
 
-        std::chrono::steady_clock::time_point _lastFrameTime;
+        uint64_t _lastFrameTime {0};
         uint64_t _lastFrameDuration {0};
 
         uint64_t _fps {0};
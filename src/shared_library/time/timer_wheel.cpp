@@ -0,0 +1,246 @@
+#include <algorithm>
+
+#include "timer_wheel.h"
+
+namespace projectfarm::shared::time
+{
+    TimerHandle TimerWheel::ScheduleOnce(uint64_t milliseconds, std::function<void(void)> callback) noexcept
+    {
+        return this->Schedule(milliseconds, 0u, std::move(callback));
+    }
+
+    TimerHandle TimerWheel::ScheduleRecurring(uint64_t milliseconds, std::function<void(void)> callback) noexcept
+    {
+        // an interval of 0 would never let the wheel move forward
+        auto interval = std::max<uint64_t>(milliseconds, 1u);
+
+        return this->Schedule(interval, interval, std::move(callback));
+    }
+
+    TimerHandle TimerWheel::Schedule(uint64_t milliseconds, uint64_t interval,
+                                     std::function<void(void)> callback) noexcept
+    {
+        uint32_t index {0u};
+
+        if (this->_freeTimers.empty())
+        {
+            index = static_cast<uint32_t>(this->_timers.size());
+            this->_timers.emplace_back();
+        }
+        else
+        {
+            index = this->_freeTimers.back();
+            this->_freeTimers.pop_back();
+        }
+
+        auto& timer = this->_timers[index];
+        timer.Callback = std::move(callback);
+        timer.IntervalMilliseconds = interval;
+        timer.DueMilliseconds = this->_advanceMilliseconds + std::max<uint64_t>(milliseconds, 1u);
+        timer.IsActive = true;
+
+        auto handle = TimerWheel::MakeHandle(index, timer.Generation);
+
+        this->Insert(handle, timer.DueMilliseconds);
+
+        ++this->_numberOfTimers;
+
+        return handle;
+    }
+
+    bool TimerWheel::Cancel(TimerHandle handle) noexcept
+    {
+        if (!this->GetTimer(handle))
+        {
+            return false;
+        }
+
+        // the handle is left in its slot and skipped when the slot is run
+        this->Release(TimerWheel::GetIndex(handle));
+
+        return true;
+    }
+
+    bool TimerWheel::IsScheduled(TimerHandle handle) const noexcept
+    {
+        return this->GetTimer(handle) != nullptr;
+    }
+
+    void TimerWheel::Advance(uint64_t currentMilliseconds) noexcept
+    {
+        // nothing can fire, so there is no need to walk the slots
+        if (this->_numberOfTimers == 0u && currentMilliseconds > this->_currentMilliseconds)
+        {
+            this->_currentMilliseconds = currentMilliseconds;
+            this->_advanceMilliseconds = currentMilliseconds;
+            return;
+        }
+
+        this->_advanceMilliseconds = std::max(this->_advanceMilliseconds, currentMilliseconds);
+
+        while (this->_currentMilliseconds < currentMilliseconds)
+        {
+            ++this->_currentMilliseconds;
+
+            if ((this->_currentMilliseconds & (FirstLevelSize - 1u)) == 0u)
+            {
+                for (auto level = 0u; level < NumberOfLevels - 1u; ++level)
+                {
+                    this->Cascade(level);
+
+                    auto shift = FirstLevelBits + LevelBits * level;
+                    if (((this->_currentMilliseconds >> shift) & (LevelSize - 1u)) != 0u)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            this->RunFirstLevelSlot();
+        }
+    }
+
+    TimerWheel::TimerData* TimerWheel::GetTimer(TimerHandle handle) noexcept
+    {
+        auto index = TimerWheel::GetIndex(handle);
+
+        if (index >= this->_timers.size())
+        {
+            return nullptr;
+        }
+
+        auto& timer = this->_timers[index];
+
+        if (!timer.IsActive || timer.Generation != TimerWheel::GetGeneration(handle))
+        {
+            return nullptr;
+        }
+
+        return &timer;
+    }
+
+    const TimerWheel::TimerData* TimerWheel::GetTimer(TimerHandle handle) const noexcept
+    {
+        return const_cast<TimerWheel*>(this)->GetTimer(handle);
+    }
+
+    void TimerWheel::Insert(TimerHandle handle, uint64_t dueMilliseconds) noexcept
+    {
+        auto delta = dueMilliseconds - this->_currentMilliseconds;
+
+        if (delta < FirstLevelSize)
+        {
+            this->_firstLevel[dueMilliseconds & (FirstLevelSize - 1u)].push_back(handle);
+            return;
+        }
+
+        for (auto level = 0u; level < NumberOfLevels - 1u; ++level)
+        {
+            auto shift = FirstLevelBits + LevelBits * level;
+
+            auto isLastLevel = level == NumberOfLevels - 2u;
+            auto levelRange = uint64_t {1u} << (shift + LevelBits);
+
+            if (delta < levelRange || isLastLevel)
+            {
+                // timers beyond the range of the wheel are placed in the furthest slot
+                // and will be re-inserted from there when that slot is cascaded
+                auto slotMilliseconds = delta < levelRange ? dueMilliseconds
+                                                           : this->_currentMilliseconds + levelRange - 1u;
+
+                this->_levels[level][(slotMilliseconds >> shift) & (LevelSize - 1u)].push_back(handle);
+                return;
+            }
+        }
+    }
+
+    void TimerWheel::Release(uint32_t index) noexcept
+    {
+        auto& timer = this->_timers[index];
+
+        timer.Callback = {};
+        timer.IsActive = false;
+
+        // 0 is never a valid generation, so a handle is never `InvalidHandle`
+        if (++timer.Generation == 0u)
+        {
+            timer.Generation = 1u;
+        }
+
+        this->_freeTimers.push_back(index);
+
+        --this->_numberOfTimers;
+    }
+
+    void TimerWheel::Cascade(uint32_t level) noexcept
+    {
+        auto shift = FirstLevelBits + LevelBits * level;
+        auto& slot = this->_levels[level][(this->_currentMilliseconds >> shift) & (LevelSize - 1u)];
+
+        std::vector<TimerHandle> handles;
+        handles.swap(slot);
+
+        for (auto handle : handles)
+        {
+            if (auto timer = this->GetTimer(handle); timer)
+            {
+                this->Insert(handle, std::max(timer->DueMilliseconds, this->_currentMilliseconds));
+            }
+        }
+    }
+
+    void TimerWheel::RunFirstLevelSlot() noexcept
+    {
+        auto& slot = this->_firstLevel[this->_currentMilliseconds & (FirstLevelSize - 1u)];
+
+        if (slot.empty())
+        {
+            return;
+        }
+
+        std::vector<TimerHandle> handles;
+        handles.swap(slot);
+
+        for (auto handle : handles)
+        {
+            // this may have been cancelled by an earlier callback
+            auto timer = this->GetTimer(handle);
+            if (!timer)
+            {
+                continue;
+            }
+
+            // the callback is moved out as it could cancel its own timer, or schedule
+            // new timers, while it is running
+            auto callback = std::move(timer->Callback);
+
+            if (timer->IntervalMilliseconds == 0u)
+            {
+                this->Release(TimerWheel::GetIndex(handle));
+
+                if (callback)
+                {
+                    callback();
+                }
+
+                continue;
+            }
+
+            // from the time being advanced to, as that is when the callback is actually
+            // called, and rescheduling from the slot would fire again for each missed interval
+            timer->DueMilliseconds = this->_advanceMilliseconds + timer->IntervalMilliseconds;
+            this->Insert(handle, timer->DueMilliseconds);
+
+            if (callback)
+            {
+                callback();
+            }
+
+            // `_timers` may have been resized by the callback
+            if (auto rescheduledTimer = this->GetTimer(handle); rescheduledTimer)
+            {
+                rescheduledTimer->Callback = std::move(callback);
+            }
+        }
+    }
+}
@@ -0,0 +1,126 @@
+#ifndef PROJECTFARM_TIMER_WHEEL_H
+#define PROJECTFARM_TIMER_WHEEL_H
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <functional>
+
+namespace projectfarm::shared::time
+{
+    using TimerHandle = uint64_t;
+
+    // A hierarchical timer wheel with a resolution of 1 millisecond.
+    // Only timers that are due are visited when advancing the wheel, so
+    // the cost of a tick does not depend on the number of scheduled timers.
+    class TimerWheel final
+    {
+    public:
+        static constexpr TimerHandle InvalidHandle {0u};
+
+        explicit TimerWheel(uint64_t currentMilliseconds = 0u) noexcept
+            : _currentMilliseconds {currentMilliseconds},
+              _advanceMilliseconds {currentMilliseconds}
+        {
+        }
+        ~TimerWheel() = default;
+
+        // `callback` is called once, `milliseconds` from now
+        [[nodiscard]]
+        TimerHandle ScheduleOnce(uint64_t milliseconds, std::function<void(void)> callback) noexcept;
+
+        // `callback` is called every `milliseconds`. As with `Stopwatch`, the next interval
+        // starts from the time the callback was called, not the time it was due, so
+        // intervals missed by a late `Advance` are called once rather than caught up.
+        [[nodiscard]]
+        TimerHandle ScheduleRecurring(uint64_t milliseconds, std::function<void(void)> callback) noexcept;
+
+        // returns false if the timer has already fired (and was not recurring) or was cancelled
+        bool Cancel(TimerHandle handle) noexcept;
+
+        [[nodiscard]]
+        bool IsScheduled(TimerHandle handle) const noexcept;
+
+        // calls the callbacks of all timers due up to and including `currentMilliseconds`
+        void Advance(uint64_t currentMilliseconds) noexcept;
+
+        [[nodiscard]]
+        uint64_t GetCurrentMilliseconds() const noexcept
+        {
+            return this->_currentMilliseconds;
+        }
+
+        [[nodiscard]]
+        size_t GetNumberOfTimers() const noexcept
+        {
+            return this->_numberOfTimers;
+        }
+
+    private:
+        struct TimerData
+        {
+            std::function<void(void)> Callback;
+            uint64_t DueMilliseconds {0u};
+            uint64_t IntervalMilliseconds {0u};
+            uint32_t Generation {1u};
+            bool IsActive {false};
+        };
+
+        static constexpr uint32_t FirstLevelBits {8u};
+        static constexpr uint32_t LevelBits {6u};
+        static constexpr uint32_t NumberOfLevels {5u};
+
+        static constexpr uint32_t FirstLevelSize {1u << FirstLevelBits};
+        static constexpr uint32_t LevelSize {1u << LevelBits};
+
+        // slots hold handles rather than indexes so cancelled timers can be lazily skipped
+        std::array<std::vector<TimerHandle>, FirstLevelSize> _firstLevel;
+        std::array<std::array<std::vector<TimerHandle>, LevelSize>, NumberOfLevels - 1> _levels;
+
+        std::vector<TimerData> _timers;
+        std::vector<uint32_t> _freeTimers;
+
+        uint64_t _currentMilliseconds {0u};
+
+        // the time being advanced to, which is when the callbacks are called
+        uint64_t _advanceMilliseconds {0u};
+
+        size_t _numberOfTimers {0u};
+
+        [[nodiscard]]
+        TimerHandle Schedule(uint64_t milliseconds, uint64_t interval,
+                             std::function<void(void)> callback) noexcept;
+
+        [[nodiscard]]
+        TimerData* GetTimer(TimerHandle handle) noexcept;
+
+        [[nodiscard]]
+        const TimerData* GetTimer(TimerHandle handle) const noexcept;
+
+        void Insert(TimerHandle handle, uint64_t dueMilliseconds) noexcept;
+        void Release(uint32_t index) noexcept;
+
+        void Cascade(uint32_t level) noexcept;
+        void RunFirstLevelSlot() noexcept;
+
+        [[nodiscard]]
+        static TimerHandle MakeHandle(uint32_t index, uint32_t generation) noexcept
+        {
+            return (static_cast<uint64_t>(generation) << 32u) | index;
+        }
+
+        [[nodiscard]]
+        static uint32_t GetIndex(TimerHandle handle) noexcept
+        {
+            return static_cast<uint32_t>(handle & 0xFFFFFFFFu);
+        }
+
+        [[nodiscard]]
+        static uint32_t GetGeneration(TimerHandle handle) noexcept
+        {
+            return static_cast<uint32_t>(handle >> 32u);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef PROJECTFARM_BYTE_SPAN_H
+#define PROJECTFARM_BYTE_SPAN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace projectfarm::shared::utils
+{
+    // a non-owning view of a range of bytes
+    class ByteSpan final
+    {
+    public:
+        ByteSpan() = default;
+        ByteSpan(const std::byte* data, uint64_t size) noexcept
+            : _data {data},
+              _size {size}
+        {
+        }
+        ~ByteSpan() = default;
+
+        [[nodiscard]]
+        const std::byte* data() const noexcept
+        {
+            return this->_data;
+        }
+
+        [[nodiscard]]
+        uint64_t size() const noexcept
+        {
+            return this->_size;
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return this->_size == 0u;
+        }
+
+        [[nodiscard]]
+        const std::byte* begin() const noexcept
+        {
+            return this->_data;
+        }
+
+        [[nodiscard]]
+        const std::byte* end() const noexcept
+        {
+            return this->_data + this->_size;
+        }
+
+        [[nodiscard]]
+        std::string_view AsStringView() const noexcept
+        {
+            return { reinterpret_cast<const char*>(this->_data), static_cast<size_t>(this->_size) };
+        }
+
+    private:
+        const std::byte* _data {nullptr};
+        uint64_t _size {0u};
+    };
+}
+
+#endif
@@ -0,0 +1,154 @@
+#include <cstring>
+
+#include "compression.h"
+
+namespace projectfarm::shared::utils
+{
+    namespace
+    {
+        constexpr uint64_t MinMatchLength {3u};
+        constexpr uint64_t MaxMatchLength {0x7Fu + MinMatchLength};
+        constexpr uint64_t MaxLiteralLength {0x80u};
+        constexpr uint64_t MaxMatchDistance {0xFFFFu};
+
+        constexpr uint32_t HashBits {14u};
+
+        uint32_t Hash(const std::byte* data) noexcept
+        {
+            auto value = static_cast<uint32_t>(data[0]) |
+                         static_cast<uint32_t>(data[1]) << 8u |
+                         static_cast<uint32_t>(data[2]) << 16u;
+
+            return (value * 2654435761u) >> (32u - HashBits);
+        }
+
+        void WriteLiterals(std::vector<std::byte>& output, const std::byte* data, uint64_t size) noexcept
+        {
+            while (size > 0u)
+            {
+                auto length = size < MaxLiteralLength ? size : MaxLiteralLength;
+
+                output.push_back(static_cast<std::byte>(length - 1u));
+                output.insert(output.end(), data, data + length);
+
+                data += length;
+                size -= length;
+            }
+        }
+    }
+
+    std::vector<std::byte> CompressLz(const std::byte* data, uint64_t size) noexcept
+    {
+        std::vector<std::byte> output;
+        output.reserve(size / 2u + 16u);
+
+        // the position + 1 of the last time each hash was seen, so 0 is empty
+        std::vector<uint64_t> table(1u << HashBits, 0u);
+
+        uint64_t position {0u};
+        uint64_t literalStart {0u};
+
+        while (position + MinMatchLength <= size)
+        {
+            auto hash = Hash(data + position);
+            auto candidate = table[hash];
+            table[hash] = position + 1u;
+
+            if (candidate == 0u || position - (candidate - 1u) > MaxMatchDistance ||
+                std::memcmp(data + candidate - 1u, data + position, MinMatchLength) != 0)
+            {
+                ++position;
+                continue;
+            }
+
+            auto matchStart = candidate - 1u;
+            auto length = MinMatchLength;
+
+            while (position + length < size && length < MaxMatchLength &&
+                   data[matchStart + length] == data[position + length])
+            {
+                ++length;
+            }
+
+            WriteLiterals(output, data + literalStart, position - literalStart);
+
+            auto distance = position - matchStart;
+
+            output.push_back(static_cast<std::byte>(0x80u | (length - MinMatchLength)));
+            output.push_back(static_cast<std::byte>(distance & 0xFFu));
+            output.push_back(static_cast<std::byte>(distance >> 8u));
+
+            for (auto i = position + 1u; i < position + length && i + MinMatchLength <= size; ++i)
+            {
+                table[Hash(data + i)] = i + 1u;
+            }
+
+            position += length;
+            literalStart = position;
+        }
+
+        WriteLiterals(output, data + literalStart, size - literalStart);
+
+        return output;
+    }
+
+    uint64_t GetMaxDecompressedLzSize(uint64_t size) noexcept
+    {
+        // every match token is 3 bytes, and nothing expands more than the longest match
+        return size / 3u * MaxMatchLength;
+    }
+
+    bool DecompressLz(const std::byte* data, uint64_t size, std::byte* output, uint64_t outputSize) noexcept
+    {
+        uint64_t position {0u};
+        uint64_t outputPosition {0u};
+
+        while (position < size)
+        {
+            auto control = static_cast<uint8_t>(data[position++]);
+
+            if (control < 0x80u)
+            {
+                auto length = static_cast<uint64_t>(control) + 1u;
+
+                if (position + length > size || outputPosition + length > outputSize)
+                {
+                    return false;
+                }
+
+                std::memcpy(output + outputPosition, data + position, length);
+
+                position += length;
+                outputPosition += length;
+            }
+            else
+            {
+                auto length = static_cast<uint64_t>(control & 0x7Fu) + MinMatchLength;
+
+                if (position + 2u > size)
+                {
+                    return false;
+                }
+
+                auto distance = static_cast<uint64_t>(data[position]) |
+                                static_cast<uint64_t>(data[position + 1u]) << 8u;
+                position += 2u;
+
+                if (distance == 0u || distance > outputPosition || outputPosition + length > outputSize)
+                {
+                    return false;
+                }
+
+                // matches can overlap the bytes they produce, so copy forwards one at a time
+                for (auto i = 0u; i < length; ++i)
+                {
+                    output[outputPosition + i] = output[outputPosition - distance + i];
+                }
+
+                outputPosition += length;
+            }
+        }
+
+        return outputPosition == outputSize;
+    }
+}
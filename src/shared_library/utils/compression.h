@@ -0,0 +1,29 @@
+#ifndef PROJECTFARM_COMPRESSION_H
+#define PROJECTFARM_COMPRESSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// A small LZ77 compressor, aimed at fast decompression of text assets.
+//
+// The compressed data is a sequence of tokens. A control byte below 0x80 is followed by
+// (control + 1) literal bytes. Any other control byte is a match of ((control & 0x7F) + 3)
+// bytes, followed by the distance back to the match as a little endian uint16.
+
+namespace projectfarm::shared::utils
+{
+    [[nodiscard]]
+    std::vector<std::byte> CompressLz(const std::byte* data, uint64_t size) noexcept;
+
+    // the most that `size` bytes of compressed data can decompress to, so a size read
+    // from a file can be checked before allocating for it
+    [[nodiscard]]
+    uint64_t GetMaxDecompressedLzSize(uint64_t size) noexcept;
+
+    // `outputSize` must be the size of the uncompressed data
+    [[nodiscard]]
+    bool DecompressLz(const std::byte* data, uint64_t size, std::byte* output, uint64_t outputSize) noexcept;
+}
+
+#endif
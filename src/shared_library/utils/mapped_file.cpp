@@ -0,0 +1,158 @@
+#include <fstream>
+
+#include "mapped_file.h"
+#include "platform/platform_id.h"
+#include "api/logging/logging.h"
+
+#if !defined(IS_WINDOWS)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace projectfarm::shared::utils
+{
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->Close();
+
+        this->_data = other._data;
+        this->_size = other._size;
+        this->_isMapped = other._isMapped;
+        this->_buffer = std::move(other._buffer);
+
+        // the moved buffer keeps its storage, so `_data` is still valid
+        other._data = nullptr;
+        other._size = 0u;
+        other._isMapped = false;
+
+        return *this;
+    }
+
+    bool MappedFile::Open(const std::filesystem::path& filePath) noexcept
+    {
+        this->Close();
+
+        if (this->Map(filePath))
+        {
+            return true;
+        }
+
+        if (!this->Read(filePath))
+        {
+            api::logging::Log("Failed to open file: " + filePath.u8string());
+            return false;
+        }
+
+        return true;
+    }
+
+    void MappedFile::Close() noexcept
+    {
+        if (this->_isMapped)
+        {
+            this->Unmap();
+        }
+
+        this->_data = nullptr;
+        this->_size = 0u;
+        this->_isMapped = false;
+
+        this->_buffer.clear();
+        this->_buffer.shrink_to_fit();
+    }
+
+#if defined(IS_WINDOWS)
+    bool MappedFile::Map(const std::filesystem::path&) noexcept
+    {
+        // we read the file instead
+        return false;
+    }
+
+    void MappedFile::Unmap() noexcept
+    {
+    }
+#else
+    bool MappedFile::Map(const std::filesystem::path& filePath) noexcept
+    {
+        auto fd = ::open(filePath.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        struct stat fileStat {};
+        if (::fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        auto size = static_cast<size_t>(fileStat.st_size);
+
+        auto data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        // the mapping keeps its own reference to the file
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        this->_data = static_cast<const std::byte*>(data);
+        this->_size = size;
+        this->_isMapped = true;
+
+        return true;
+    }
+
+    void MappedFile::Unmap() noexcept
+    {
+        ::munmap(const_cast<std::byte*>(this->_data), static_cast<size_t>(this->_size));
+    }
+#endif
+
+    bool MappedFile::Read(const std::filesystem::path& filePath) noexcept
+    {
+        std::ifstream fs(filePath, std::ios::binary | std::ios::ate);
+        if (!fs.is_open())
+        {
+            return false;
+        }
+
+        auto size = static_cast<uint64_t>(fs.tellg());
+        if (size == 0u)
+        {
+            return false;
+        }
+
+        fs.seekg(0);
+
+        this->_buffer.resize(size);
+        fs.read(reinterpret_cast<char*>(this->_buffer.data()), static_cast<std::streamsize>(size));
+
+        if (!fs)
+        {
+            this->_buffer.clear();
+            return false;
+        }
+
+        this->_data = this->_buffer.data();
+        this->_size = size;
+        this->_isMapped = false;
+
+        return true;
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef PROJECTFARM_MAPPED_FILE_H
+#define PROJECTFARM_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <filesystem>
+
+namespace projectfarm::shared::utils
+{
+    // A read-only view of a whole file. The file is memory mapped where the platform
+    // supports it, otherwise it is read into memory.
+    class MappedFile final
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile()
+        {
+            this->Close();
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        [[nodiscard]]
+        bool Open(const std::filesystem::path& filePath) noexcept;
+
+        void Close() noexcept;
+
+        [[nodiscard]]
+        bool IsOpen() const noexcept
+        {
+            return this->_data != nullptr;
+        }
+
+        [[nodiscard]]
+        const std::byte* GetData() const noexcept
+        {
+            return this->_data;
+        }
+
+        [[nodiscard]]
+        uint64_t GetSize() const noexcept
+        {
+            return this->_size;
+        }
+
+        [[nodiscard]]
+        bool IsMapped() const noexcept
+        {
+            return this->_isMapped;
+        }
+
+    private:
+        const std::byte* _data {nullptr};
+        uint64_t _size {0u};
+
+        bool _isMapped {false};
+
+        // used when the file could not be mapped
+        std::vector<std::byte> _buffer;
+
+        [[nodiscard]]
+        bool Map(const std::filesystem::path& filePath) noexcept;
+
+        void Unmap() noexcept;
+
+        [[nodiscard]]
+        bool Read(const std::filesystem::path& filePath) noexcept;
+    };
+}
+
+#endif
@@ -66,6 +66,59 @@ namespace projectfarm::shared::utils
         }
     }
 
+    void WriteVarUInt64(std::vector<std::byte>& bytes, uint64_t value) noexcept
+    {
+        while (value >= 0x80u)
+        {
+            bytes.push_back(static_cast<std::byte>((value & 0x7Fu) | 0x80u));
+            value >>= 7u;
+        }
+
+        bytes.push_back(static_cast<std::byte>(value));
+    }
+
+    void WriteVarInt64(std::vector<std::byte>& bytes, int64_t value) noexcept
+    {
+        auto zigzag = (static_cast<uint64_t>(value) << 1u) ^ static_cast<uint64_t>(value >> 63);
+        WriteVarUInt64(bytes, zigzag);
+    }
+
+    bool ReadVarUInt64(const std::vector<std::byte>& bytes, uint32_t& index, uint64_t& value) noexcept
+    {
+        value = 0u;
+
+        for (auto shift = 0u; shift < 64u; shift += 7u)
+        {
+            if (index >= bytes.size())
+            {
+                return false;
+            }
+
+            auto byte = static_cast<uint64_t>(bytes[index++]);
+            value |= (byte & 0x7Fu) << shift;
+
+            if ((byte & 0x80u) == 0u)
+            {
+                return true;
+            }
+        }
+
+        // too many bytes for a 64 bit value
+        return false;
+    }
+
+    bool ReadVarInt64(const std::vector<std::byte>& bytes, uint32_t& index, int64_t& value) noexcept
+    {
+        uint64_t zigzag {0u};
+        if (!ReadVarUInt64(bytes, index, zigzag))
+        {
+            return false;
+        }
+
+        value = static_cast<int64_t>(zigzag >> 1u) ^ -static_cast<int64_t>(zigzag & 1u);
+        return true;
+    }
+
     bool ReadBool(const std::vector<std::byte>& bytes, uint32_t& index) noexcept
     {
         return ReadUInt8(bytes, index) != 0;
@@ -86,8 +139,8 @@ namespace projectfarm::shared::utils
     {
         auto i = static_cast<unsigned int>(index);
 
-        auto value = (static_cast<uint64_t>(bytes[i + 2]) << 8ul) |
-                     (static_cast<uint64_t>(bytes[i + 3]) << 0ul);
+        auto value = (static_cast<uint64_t>(bytes[i + 0]) << 8ul) |
+                     (static_cast<uint64_t>(bytes[i + 1]) << 0ul);
 
         index += sizeof(uint16_t);
 
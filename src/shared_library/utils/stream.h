@@ -24,6 +24,16 @@ namespace projectfarm::shared::utils
     uint64_t ReadUInt64(const std::vector<std::byte>& bytes, uint32_t& index) noexcept;
     std::string ReadString(const std::vector<std::byte>& bytes, uint32_t& index) noexcept;
 
+    // 7 bits per byte, so small values take fewer bytes
+    void WriteVarUInt64(std::vector<std::byte>& bytes, uint64_t value) noexcept;
+
+    // zigzag encoded, so small negative values also take fewer bytes
+    void WriteVarInt64(std::vector<std::byte>& bytes, int64_t value) noexcept;
+
+    // unlike the fixed size reads, these check the bounds and return false if the data is truncated
+    [[nodiscard]] bool ReadVarUInt64(const std::vector<std::byte>& bytes, uint32_t& index, uint64_t& value) noexcept;
+    [[nodiscard]] bool ReadVarInt64(const std::vector<std::byte>& bytes, uint32_t& index, int64_t& value) noexcept;
+
     bool ReadBoolFromBinaryFile(std::ifstream& fs) noexcept;
     std::string ReadStringFromBinaryFile(std::ifstream& fs) noexcept;
     uint8_t ReadUInt8FromBinaryFile(std::ifstream& fs) noexcept;